@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+#
+#  Copyright 2008 Search Solution Corporation
+#  Copyright 2016 CUBRID Corporation
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+
+#
+# serial_bench.py - NEXT_VALUE / AUTO_INCREMENT throughput under concurrent sessions
+#
+# Every session runs in its own process and connection through a broker. Run it once with
+# serial_prefetch_count=0 and once with a prefetch count (e.g. 100) set in cubrid.conf to compare.
+#
+# example: serial_bench.py -u CUBRID:localhost:33000:testdb::: -s 64 -d 30 -m auto_increment
+#
+
+import sys
+import time
+import multiprocessing
+from optparse import OptionParser
+
+import CUBRIDdb
+
+SERIAL_NAME = 'bench_serial'
+TABLE_NAME = 'bench_serial_tbl'
+
+
+def setup(options):
+	conn = CUBRIDdb.connect(options.url, options.user, options.password)
+	cur = conn.cursor()
+	cur.execute('DROP SERIAL IF EXISTS %s' % SERIAL_NAME)
+	cur.execute('DROP TABLE IF EXISTS %s' % TABLE_NAME)
+	cur.execute('CREATE SERIAL %s START WITH 1 INCREMENT BY 1 CACHE %d' % (SERIAL_NAME, options.cache))
+	cur.execute('CREATE TABLE %s (id BIGINT AUTO_INCREMENT PRIMARY KEY, session_id INT)' % TABLE_NAME)
+	# values are prefetched only for cached serials
+	cur.execute('ALTER SERIAL %s_ai_id CACHE %d' % (TABLE_NAME, options.cache))
+	conn.commit()
+	cur.close()
+	conn.close()
+
+
+def session(options, session_id, start_event, result_queue):
+	conn = CUBRIDdb.connect(options.url, options.user, options.password)
+	conn.set_autocommit(True)
+	cur = conn.cursor()
+
+	if options.mode == 'next_value':
+		stmt = 'SELECT %s.NEXT_VALUE FROM db_root' % SERIAL_NAME
+	else:
+		stmt = 'INSERT INTO %s (session_id) VALUES (%d)' % (TABLE_NAME, session_id)
+
+	start_event.wait()
+
+	count = 0
+	end = time.time() + options.duration
+	while time.time() < end:
+		cur.execute(stmt)
+		if options.mode == 'next_value':
+			cur.fetchone()
+		count += 1
+
+	cur.close()
+	conn.close()
+	result_queue.put(count)
+
+
+def main():
+	usage = "usage: %prog [options]"
+	parser = OptionParser(usage=usage, version="%prog 1.0")
+	parser.add_option("-u", "--url", dest="url", default="CUBRID:localhost:33000:demodb:::", help="connection url");
+	parser.add_option("-U", "--user", dest="user", default="dba", help="user name");
+	parser.add_option("-P", "--password", dest="password", default="", help="password");
+	parser.add_option("-s", "--sessions", dest="sessions", type="int", default=32, help="concurrent sessions");
+	parser.add_option("-d", "--duration", dest="duration", type="int", default=10, help="seconds to run");
+	parser.add_option("-c", "--cache", dest="cache", type="int", default=100, help="serial cache size");
+	parser.add_option("-m", "--mode", dest="mode", default="next_value", help="next_value or auto_increment");
+
+	(options, args) = parser.parse_args()
+
+	if options.mode not in ('next_value', 'auto_increment'):
+		parser.error("unknown mode %s" % options.mode)
+
+	setup(options)
+
+	start_event = multiprocessing.Event()
+	result_queue = multiprocessing.Queue()
+	workers = [multiprocessing.Process(target=session, args=(options, i, start_event, result_queue))
+	           for i in range(options.sessions)]
+	for w in workers:
+		w.start()
+
+	# give every session the time to connect
+	time.sleep(2)
+	start_event.set()
+
+	total = 0
+	for w in workers:
+		total += result_queue.get()
+	for w in workers:
+		w.join()
+
+	print("mode: %s, sessions: %d, duration: %d s" % (options.mode, options.sessions, options.duration))
+	print("total values: %d" % total)
+	print("values/sec: %.1f" % (float(total) / options.duration))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#  Copyright 2008 Search Solution Corporation
+#  Copyright 2016 CUBRID Corporation
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+
+#
+# uca_sort_bench.py - ORDER BY and sort based GROUP BY time on a string column of a collation with expansions
+#
+# Every query runs with sort_normalized_string_keys=no (strings compared by their collation weights on each
+# comparison) and with sort_normalized_string_keys=yes (sort keys built once per record and compared by memcmp).
+# The collation must be compiled in the locale library (make_locale), e.g. utf8_de_exp.
+#
+# example: uca_sort_bench.py -u CUBRID:localhost:33000:testdb::: -c utf8_de_exp -n 1000000 -r 5
+#
+
+import sys
+import time
+import random
+from optparse import OptionParser
+
+import CUBRIDdb
+
+TABLE_NAME = 'bench_uca_sort_tbl'
+
+WORDS = [u'Straße', u'strasse', u'Äpfel', u'apfel', u'Müller', u'Mueller', u'été', u'ete',
+         u'Größe', u'grosse', u'Coöperation', u'cooperation', u'naïve', u'naive']
+
+# the sort keys are used when the sort columns are not all the columns of the sorted list
+QUERIES = [
+	('order by', 'SELECT id, name, filler FROM %s ORDER BY name' % TABLE_NAME),
+	('group by', 'SELECT /*+ NO_HASH_AGGREGATE */ name, SUM(id) FROM %s GROUP BY name' % TABLE_NAME),
+]
+
+
+def setup(options):
+	conn = CUBRIDdb.connect(options.url, options.user, options.password)
+	cur = conn.cursor()
+	cur.execute('DROP TABLE IF EXISTS %s' % TABLE_NAME)
+	cur.execute('CREATE TABLE %s (id INT PRIMARY KEY, name VARCHAR(200) COLLATE %s, filler VARCHAR(100))'
+	            % (TABLE_NAME, options.collation))
+
+	rnd = random.Random(1)
+	batch = []
+	for i in range(options.rows):
+		name = u' '.join(rnd.choice(WORDS) for w in range(rnd.randint(1, 4))) + u' %d' % rnd.randint(0, options.groups)
+		batch.append((i, name.encode('utf-8'), 'x' * 50))
+		if len(batch) == 1000:
+			cur.executemany('INSERT INTO %s VALUES (?, ?, ?)' % TABLE_NAME, batch)
+			conn.commit()
+			batch = []
+	if batch:
+		cur.executemany('INSERT INTO %s VALUES (?, ?, ?)' % TABLE_NAME, batch)
+	conn.commit()
+	cur.close()
+	conn.close()
+
+
+def run(cur, stmt, repeat):
+	best = None
+	for r in range(repeat):
+		start = time.time()
+		cur.execute(stmt)
+		while cur.fetchmany(10000):
+			pass
+		elapsed = time.time() - start
+		best = elapsed if best is None else min(best, elapsed)
+	return best
+
+
+def main():
+	usage = "usage: %prog [options]"
+	parser = OptionParser(usage=usage, version="%prog 1.0")
+	parser.add_option("-u", "--url", dest="url", default="CUBRID:localhost:33000:demodb:::", help="connection url");
+	parser.add_option("-U", "--user", dest="user", default="dba", help="user name");
+	parser.add_option("-P", "--password", dest="password", default="", help="password");
+	parser.add_option("-c", "--collation", dest="collation", default="utf8_de_exp", help="collation of the column");
+	parser.add_option("-n", "--rows", dest="rows", type="int", default=500000, help="rows to load");
+	parser.add_option("-g", "--groups", dest="groups", type="int", default=10000, help="distinct suffixes of names");
+	parser.add_option("-r", "--repeat", dest="repeat", type="int", default=3, help="runs of each query (best is kept)");
+	parser.add_option("-s", "--skip-load", dest="skip_load", action="store_true", default=False,
+	                  help="use the rows of a previous run");
+
+	(options, args) = parser.parse_args()
+
+	if not options.skip_load:
+		setup(options)
+
+	conn = CUBRIDdb.connect(options.url, options.user, options.password)
+	conn.set_autocommit(True)
+	cur = conn.cursor()
+
+	print("collation: %s, rows: %d" % (options.collation, options.rows))
+	print("%-10s %12s %12s %8s" % ("query", "weights (s)", "keys (s)", "speedup"))
+	for (name, stmt) in QUERIES:
+		cur.execute("SET SYSTEM PARAMETERS 'sort_normalized_string_keys=no'")
+		without_keys = run(cur, stmt, options.repeat)
+		cur.execute("SET SYSTEM PARAMETERS 'sort_normalized_string_keys=yes'")
+		with_keys = run(cur, stmt, options.repeat)
+		print("%-10s %12.3f %12.3f %7.2fx" % (name, without_keys, with_keys, without_keys / max(with_keys, 0.001)))
+
+	cur.close()
+	conn.close()
+
+
+if __name__ == '__main__':
+	main()
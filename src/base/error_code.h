@@ -1738,7 +1738,13 @@
 
 #define ER_SP_SERVER_CRASHED                        -1359
 
-#define ER_LAST_ERROR                               -1360
+#define ER_LOG_BACKUP_CHANGE_TRACKING_MISMATCH      -1360
+
+#define ER_RESOURCE_GROUP_INVALID_DEFINITION        -1361
+#define ER_RESOURCE_GROUP_QUERY_LIMIT               -1362
+#define ER_RESOURCE_GROUP_TEMP_QUOTA_EXCEEDED       -1363
+
+#define ER_LAST_ERROR                               -1364
 
 /*
  * CAUTION!
@@ -267,6 +267,11 @@ static int lang_strmatch_utf8_uca (const LANG_COLLATION * lang_coll, bool is_mat
 				   const int size1, const unsigned char *str2, const int size2,
 				   const unsigned char *escape, const bool has_last_escape, int *str1_match_size,
 				   bool ignore_trailing_space);
+static int lang_sort_key_utf8_uca_w_level (const COLL_DATA * coll_data, const int level, const unsigned char *str,
+					   const int size, bool ignore_trailing_space, bool reverse, unsigned char *key,
+					   const int key_size, int pos);
+static int lang_sort_key_utf8_uca (const LANG_COLLATION * lang_coll, const unsigned char *str, const int size,
+				   bool ignore_trailing_space, unsigned char *key, const int key_size);
 static int lang_str_utf8_trail_zero_weights (const LANG_COLLATION * lang_coll, const unsigned char *str, int size);
 static int lang_str_utf8_trail_zero_weights_w_exp (const COLL_DATA * coll_data, const int level,
 						   const unsigned char *str, int size);
@@ -4490,6 +4495,190 @@ lang_strmatch_utf8_uca_w_coll_data (const COLL_DATA * coll_data, bool is_match,
   return 0;
 }
 
+/*
+ * lang_sort_key_utf8_uca_w_level() - append the weights of one UCA level of
+ *				      a string to its sort key
+ *
+ *   return: position in key after the weights of the level
+ *   coll_data(in): collation data
+ *   level(in): UCA level (0 to 3)
+ *   str(in):
+ *   size(in):
+ *   ignore_trailing_space(in):
+ *   reverse(in): true to complement the bytes of the level (reversed order)
+ *   key(out): only the bytes before key_size are written
+ *   key_size(in):
+ *   pos(in): position in key where the weights of the level start
+ *
+ *  Note : Follows lang_strmatch_utf8_uca_w_level: each weight which is not
+ *	   ignorable is stored big endian, plus one, followed by a zero
+ *	   terminator of the same width, so a string which is a prefix of
+ *	   another sorts first. Zero weights of other characters than space
+ *	   are skipped; when trailing spaces are not ignored, their number at
+ *	   the end of the string decides between strings with equal weights.
+ */
+static int
+lang_sort_key_utf8_uca_w_level (const COLL_DATA * coll_data, const int level, const unsigned char *str,
+				const int size, bool ignore_trailing_space, bool reverse, unsigned char *key,
+				const int key_size, int pos)
+{
+  const unsigned char *str_end = str + size;
+  unsigned char *str_next;
+  UCA_L13_W *uca_w_l13 = NULL;
+  UCA_L4_W *uca_w_l4 = NULL;
+  unsigned int cp_contr;
+  unsigned int w;
+  int num_ce, i, b;
+  int w_size;
+  int start_pos = pos;
+  int last_pos = pos;		/* position after the last non-zero weight */
+  unsigned int trail_ignorable = 0;
+  unsigned char c;
+
+  assert (level >= 0 && level <= 3);
+
+  /* L1 and L4 weights use 16 bits, L2 weights 9 bits, L3 weights 7 bits */
+  w_size = (level == 0 || level == 3) ? 3 : ((level == 1) ? 2 : 1);
+
+  while (str < str_end)
+    {
+      if (level == 3)
+	{
+	  lang_get_uca_w_l4 (coll_data, true, str, CAST_BUFLEN (str_end - str), &uca_w_l4, &num_ce, &str_next,
+			     &cp_contr);
+	}
+      else
+	{
+	  lang_get_uca_w_l13 (coll_data, true, str, CAST_BUFLEN (str_end - str), &uca_w_l13, &num_ce, &str_next,
+			      &cp_contr);
+	}
+      assert (num_ce > 0);
+
+      for (i = 0; i < num_ce; i++)
+	{
+	  w = GET_UCA_WEIGHT (level, i, uca_w_l13, uca_w_l4);
+	  if (w == 0 && *str != ASCII_SPACE)
+	    {
+	      trail_ignorable++;
+	      continue;
+	    }
+
+	  w++;
+	  for (b = w_size - 1; b >= 0; b--)
+	    {
+	      if (pos < key_size)
+		{
+		  key[pos] = (unsigned char) (w >> (8 * b));
+		}
+	      pos++;
+	    }
+	  trail_ignorable = 0;
+
+	  if (w > 1)
+	    {
+	      last_pos = pos;
+	    }
+	}
+
+      str = str_next;
+    }
+
+  if (ignore_trailing_space)
+    {
+      /* trailing zero weights (spaces) are not compared */
+      pos = last_pos;
+    }
+
+  for (b = 0; b < w_size; b++)
+    {
+      if (pos < key_size)
+	{
+	  key[pos] = 0;
+	}
+      pos++;
+    }
+
+  if (!ignore_trailing_space)
+    {
+      for (b = 3; b >= 0; b--)
+	{
+	  if (pos < key_size)
+	    {
+	      key[pos] = (unsigned char) (trail_ignorable >> (8 * b));
+	    }
+	  pos++;
+	}
+    }
+
+  if (reverse)
+    {
+      for (i = start_pos; i < pos && i < key_size; i++)
+	{
+	  c = key[i];
+	  key[i] = (unsigned char) ~c;
+	}
+    }
+
+  return pos;
+}
+
+/*
+ * lang_sort_key_utf8_uca() - build the sort key of a string for a collation
+ *			      using full UCA weights (expansions and
+ *			      contractions)
+ *
+ *   return: size of the sort key; only the first key_size bytes are written
+ *   lang_coll(in):
+ *   str(in):
+ *   size(in):
+ *   ignore_trailing_space(in):
+ *   key(out):
+ *   key_size(in):
+ *
+ *  Note : memcmp of two keys (the shorter key sorting first on a common
+ *	   prefix) orders the strings as lang_strcmp_utf8_uca. The levels are
+ *	   appended in the order they are compared. Not used for collations
+ *	   with backwards secondary level.
+ */
+static int
+lang_sort_key_utf8_uca (const LANG_COLLATION * lang_coll, const unsigned char *str, const int size,
+			bool ignore_trailing_space, unsigned char *key, const int key_size)
+{
+  const COLL_DATA *coll_data = &(lang_coll->coll);
+  bool reverse_case = (coll_data->uca_opt.sett_caseFirst == 1);
+  int pos;
+
+  assert (!coll_data->uca_opt.sett_backwards);
+
+  pos = lang_sort_key_utf8_uca_w_level (coll_data, 0, str, size, ignore_trailing_space, false, key, key_size, 0);
+
+  if (coll_data->uca_opt.sett_strength == TAILOR_PRIMARY)
+    {
+      if (coll_data->uca_opt.sett_caseLevel)
+	{
+	  pos =
+	    lang_sort_key_utf8_uca_w_level (coll_data, 2, str, size, ignore_trailing_space, reverse_case, key,
+					    key_size, pos);
+	}
+      return pos;
+    }
+
+  pos = lang_sort_key_utf8_uca_w_level (coll_data, 1, str, size, ignore_trailing_space, false, key, key_size, pos);
+  if (coll_data->uca_opt.sett_strength == TAILOR_SECONDARY)
+    {
+      return pos;
+    }
+
+  pos =
+    lang_sort_key_utf8_uca_w_level (coll_data, 2, str, size, ignore_trailing_space, reverse_case, key, key_size, pos);
+  if (coll_data->uca_opt.sett_strength == TAILOR_TERTIARY)
+    {
+      return pos;
+    }
+
+  return lang_sort_key_utf8_uca_w_level (coll_data, 3, str, size, ignore_trailing_space, false, key, key_size, pos);
+}
+
 /*
  * lang_str_utf8_trail_zero_weights() - cheks if remaining characters of an
  *					UTF-8 string have all zero weights
@@ -7012,6 +7201,10 @@ lang_locale_data_load_from_lib (LANG_LOCALE_DATA * lld, void *lib_handle, const
 	  lang_coll->next_coll_seq = lang_next_coll_seq_utf8_w_contr;
 	  lang_coll->split_key = lang_split_key_w_exp;
 	  lang_coll->mht2str = lang_mht2str_utf8_exp;
+	  if (!coll->uca_opt.sett_backwards)
+	    {
+	      lang_coll->sort_key = lang_sort_key_utf8_uca;
+	    }
 	  lang_coll->options.allow_like_rewrite = false;
 	  lang_coll->options.allow_prefix_index = false;
 	}
@@ -182,6 +182,9 @@ struct lang_collation
   unsigned int (*mht2str) (const LANG_COLLATION * lang_coll, const unsigned char *str, const int size);
   /* collation data init function */
   void (*init_coll) (LANG_COLLATION * lang_coll);
+  /* build a key whose memcmp order is the fastcmp order (strxfrm); NULL if not supported by the collation */
+  int (*sort_key) (const LANG_COLLATION * lang_coll, const unsigned char *str, const int size,
+		   bool ignore_trailing_space, unsigned char *key, const int key_size);
 };
 
 /* Language locale data */
@@ -204,9 +204,8 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
   rep->n_fixed = 0;
   rep->n_variable = 0;
   rep->fixed_length = or_rep->fixed_length;
-#if 0				/* reserved for future use */
-  rep->repr_reserved_1 = 0;
-#endif
+  rep->n_col_groups = 0;
+  rep->col_groups = NULL;
   rep->fixed = NULL;
   rep->variable = NULL;
 
@@ -486,6 +485,11 @@ orc_free_diskrep (DISK_REPR * rep)
 	  free_and_init (rep->variable);
 	}
 
+      if (rep->col_groups != NULL)
+	{
+	  free_and_init (rep->col_groups);
+	}
+
       free_and_init (rep);
     }
 }
@@ -0,0 +1,469 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * open_hash_table.hpp - hash table with open addressing, for single threaded hot paths
+ *
+ *  Unlike MHT_TABLE, which allocates an entry per key and chains the entries of a bucket, the table keeps its entries
+ *  (key, value, hash and least recently used links) in one dense array and finds them through an array of slots
+ *  probed linearly. A slot holds the hash of its key next to the entry index, so a probe reads contiguous memory and
+ *  calls Equal only when the hashes match. Hashes are computed once per key; growing the table does not call Hash.
+ *
+ *  Templates:
+ *
+ *      Key, Value: trivially copyable types (usually pointers); the table does not own what they point to.
+ *      Hash: unsigned int operator() (const Key &) const
+ *      Equal: bool operator() (const Key &, const Key &) const
+ *
+ *  Entries are addressed by their index in [0, count ()), which also allows iterating over them. Erasing an entry
+ *  moves the last entry in its place, so an erase during an iteration must not advance the index.
+ */
+
+#ifndef _OPEN_HASH_TABLE_HPP_
+#define _OPEN_HASH_TABLE_HPP_
+
+#include "error_manager.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <type_traits>
+
+namespace cubbase
+{
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  class open_hash_table
+  {
+    public:
+      using index_type = unsigned int;
+      static const index_type NULL_INDEX = (index_type) -1;
+
+      open_hash_table (const Hash &hash = Hash (), const Equal &equal = Equal ());
+      ~open_hash_table ();
+
+      open_hash_table (const open_hash_table &) = delete;
+      open_hash_table &operator= (const open_hash_table &) = delete;
+
+      int init (index_type est_size);	// allocate room for est_size entries; error code
+
+      index_type find (const Key &key);	// entry index or NULL_INDEX; the entry becomes the most recently used
+      int insert (const Key &key, const Value &value);	// key must not be in the table; error code
+      void erase (index_type index);
+      void clear ();
+
+      index_type count () const;
+      index_type lru_first () const;	// least recently used entry or NULL_INDEX
+      const Key &get_key (index_type index) const;
+      Value &get_value (index_type index);
+
+    private:
+      struct slot
+      {
+	unsigned int hash;
+	index_type entry;		// NULL_INDEX if the slot is empty
+      };
+
+      struct entry
+      {
+	Key key;
+	Value value;
+	unsigned int hash;
+	index_type lru_prev;
+	index_type lru_next;
+      };
+
+      static_assert (std::is_trivially_copyable<Key>::value, "open_hash_table keys are copied as memory");
+      static_assert (std::is_trivially_copyable<Value>::value, "open_hash_table values are copied as memory");
+
+      static const index_type MIN_SLOTS = 16;
+
+      inline index_type home_slot (unsigned int hash) const;
+      index_type find_slot_of_entry (index_type index) const;
+      int grow ();
+      void lru_unlink (index_type index);
+      void lru_append (index_type index);
+
+      Hash m_hash;
+      Equal m_equal;
+
+      slot *m_slots;
+      index_type m_slot_count;	// power of two
+      unsigned int m_slot_shift;	// 32 - log2 (m_slot_count)
+
+      entry *m_entries;
+      index_type m_entry_count;
+      index_type m_entry_capacity;	// 3/4 of the slots, to keep the probes short
+
+      index_type m_lru_head;
+      index_type m_lru_tail;
+  };
+} // namespace cubbase
+
+//////////////////////////////////////////////////////////////////////////
+// implementation
+//////////////////////////////////////////////////////////////////////////
+
+namespace cubbase
+{
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  open_hash_table<Key, Value, Hash, Equal>::open_hash_table (const Hash &hash, const Equal &equal)
+    : m_hash (hash)
+    , m_equal (equal)
+    , m_slots (NULL)
+    , m_slot_count (0)
+    , m_slot_shift (0)
+    , m_entries (NULL)
+    , m_entry_count (0)
+    , m_entry_capacity (0)
+    , m_lru_head (NULL_INDEX)
+    , m_lru_tail (NULL_INDEX)
+  {
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  open_hash_table<Key, Value, Hash, Equal>::~open_hash_table ()
+  {
+    free (m_slots);
+    free (m_entries);
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  int
+  open_hash_table<Key, Value, Hash, Equal>::init (index_type est_size)
+  {
+    index_type slot_count = MIN_SLOTS;
+    unsigned int shift = 32 - 4;
+
+    assert (m_slots == NULL && m_entries == NULL);
+
+    while (slot_count / 4 * 3 < est_size && slot_count < ((index_type) 1 << 31))
+      {
+	slot_count <<= 1;
+	shift--;
+      }
+
+    m_slots = (slot *) malloc (slot_count * sizeof (slot));
+    m_entries = (entry *) malloc ((slot_count / 4 * 3) * sizeof (entry));
+    if (m_slots == NULL || m_entries == NULL)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		slot_count * (sizeof (slot) + sizeof (entry)));
+	free (m_slots);
+	free (m_entries);
+	m_slots = NULL;
+	m_entries = NULL;
+	return ER_OUT_OF_VIRTUAL_MEMORY;
+      }
+
+    for (index_type i = 0; i < slot_count; i++)
+      {
+	m_slots[i].entry = NULL_INDEX;
+      }
+    m_slot_count = slot_count;
+    m_slot_shift = shift;
+    m_entry_capacity = slot_count / 4 * 3;
+
+    return NO_ERROR;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  typename open_hash_table<Key, Value, Hash, Equal>::index_type
+  open_hash_table<Key, Value, Hash, Equal>::home_slot (unsigned int hash) const
+  {
+    /* fibonacci hashing: the high bits of the product depend on all the bits of the hash */
+    return (index_type) ((hash * 2654435769u) >> m_slot_shift);
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  typename open_hash_table<Key, Value, Hash, Equal>::index_type
+  open_hash_table<Key, Value, Hash, Equal>::find (const Key &key)
+  {
+    unsigned int hash;
+    index_type pos, mask = m_slot_count - 1;
+
+    if (m_entry_count == 0)
+      {
+	return NULL_INDEX;
+      }
+
+    hash = m_hash (key);
+    for (pos = home_slot (hash); m_slots[pos].entry != NULL_INDEX; pos = (pos + 1) & mask)
+      {
+	if (m_slots[pos].hash == hash && m_equal (m_entries[m_slots[pos].entry].key, key))
+	  {
+	    index_type index = m_slots[pos].entry;
+
+	    if (index != m_lru_tail)
+	      {
+		lru_unlink (index);
+		lru_append (index);
+	      }
+	    return index;
+	  }
+      }
+
+    return NULL_INDEX;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  int
+  open_hash_table<Key, Value, Hash, Equal>::insert (const Key &key, const Value &value)
+  {
+    unsigned int hash;
+    index_type pos, mask;
+    int error;
+
+    if (m_slots == NULL)
+      {
+	error = init (MIN_SLOTS);
+	if (error != NO_ERROR)
+	  {
+	    return error;
+	  }
+      }
+    if (m_entry_count == m_entry_capacity)
+      {
+	error = grow ();
+	if (error != NO_ERROR)
+	  {
+	    return error;
+	  }
+      }
+
+    hash = m_hash (key);
+    mask = m_slot_count - 1;
+    for (pos = home_slot (hash); m_slots[pos].entry != NULL_INDEX; pos = (pos + 1) & mask)
+      {
+	assert (m_slots[pos].hash != hash || !m_equal (m_entries[m_slots[pos].entry].key, key));
+      }
+
+    m_slots[pos].hash = hash;
+    m_slots[pos].entry = m_entry_count;
+
+    m_entries[m_entry_count].key = key;
+    m_entries[m_entry_count].value = value;
+    m_entries[m_entry_count].hash = hash;
+    lru_append (m_entry_count);
+    m_entry_count++;
+
+    return NO_ERROR;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  typename open_hash_table<Key, Value, Hash, Equal>::index_type
+  open_hash_table<Key, Value, Hash, Equal>::find_slot_of_entry (index_type index) const
+  {
+    index_type pos, mask = m_slot_count - 1;
+
+    for (pos = home_slot (m_entries[index].hash); m_slots[pos].entry != index; pos = (pos + 1) & mask)
+      {
+	assert (m_slots[pos].entry != NULL_INDEX);
+      }
+
+    return pos;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  void
+  open_hash_table<Key, Value, Hash, Equal>::erase (index_type index)
+  {
+    index_type hole, pos, home, last, mask = m_slot_count - 1;
+
+    assert (index < m_entry_count);
+
+    /* empty the slot and move back the following slots of the probe sequence, so no tombstones are needed */
+    hole = find_slot_of_entry (index);
+    for (pos = (hole + 1) & mask; m_slots[pos].entry != NULL_INDEX; pos = (pos + 1) & mask)
+      {
+	home = home_slot (m_slots[pos].hash);
+	if (((pos - home) & mask) >= ((pos - hole) & mask))
+	  {
+	    m_slots[hole] = m_slots[pos];
+	    hole = pos;
+	  }
+      }
+    m_slots[hole].entry = NULL_INDEX;
+
+    lru_unlink (index);
+
+    /* keep the entries dense: move the last one in place of the erased one */
+    last = m_entry_count - 1;
+    if (index != last)
+      {
+	m_slots[find_slot_of_entry (last)].entry = index;
+	m_entries[index] = m_entries[last];
+
+	if (m_entries[index].lru_prev != NULL_INDEX)
+	  {
+	    m_entries[m_entries[index].lru_prev].lru_next = index;
+	  }
+	else
+	  {
+	    m_lru_head = index;
+	  }
+	if (m_entries[index].lru_next != NULL_INDEX)
+	  {
+	    m_entries[m_entries[index].lru_next].lru_prev = index;
+	  }
+	else
+	  {
+	    m_lru_tail = index;
+	  }
+      }
+    m_entry_count--;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  void
+  open_hash_table<Key, Value, Hash, Equal>::clear ()
+  {
+    for (index_type i = 0; i < m_slot_count; i++)
+      {
+	m_slots[i].entry = NULL_INDEX;
+      }
+    m_entry_count = 0;
+    m_lru_head = m_lru_tail = NULL_INDEX;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  int
+  open_hash_table<Key, Value, Hash, Equal>::grow ()
+  {
+    index_type new_slot_count = m_slot_count * 2;
+    index_type new_entry_capacity = new_slot_count / 4 * 3;
+    index_type pos, mask = new_slot_count - 1;
+    slot *new_slots;
+    entry *new_entries;
+
+    if (m_slot_count >= ((index_type) 1 << 31))
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) -1);
+	return ER_OUT_OF_VIRTUAL_MEMORY;
+      }
+
+    new_slots = (slot *) malloc (new_slot_count * sizeof (slot));
+    if (new_slots == NULL)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, new_slot_count * sizeof (slot));
+	return ER_OUT_OF_VIRTUAL_MEMORY;
+      }
+    new_entries = (entry *) realloc (m_entries, new_entry_capacity * sizeof (entry));
+    if (new_entries == NULL)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, new_entry_capacity * sizeof (entry));
+	free (new_slots);
+	return ER_OUT_OF_VIRTUAL_MEMORY;
+      }
+
+    free (m_slots);
+    m_slots = new_slots;
+    m_entries = new_entries;
+    m_slot_count = new_slot_count;
+    m_slot_shift--;
+    m_entry_capacity = new_entry_capacity;
+
+    /* the hashes are kept in the entries; rebuild the slots without hashing the keys again */
+    for (index_type i = 0; i < m_slot_count; i++)
+      {
+	m_slots[i].entry = NULL_INDEX;
+      }
+    for (index_type i = 0; i < m_entry_count; i++)
+      {
+	for (pos = home_slot (m_entries[i].hash); m_slots[pos].entry != NULL_INDEX; pos = (pos + 1) & mask)
+	  ;
+	m_slots[pos].hash = m_entries[i].hash;
+	m_slots[pos].entry = i;
+      }
+
+    return NO_ERROR;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  void
+  open_hash_table<Key, Value, Hash, Equal>::lru_unlink (index_type index)
+  {
+    entry &e = m_entries[index];
+
+    if (e.lru_prev != NULL_INDEX)
+      {
+	m_entries[e.lru_prev].lru_next = e.lru_next;
+      }
+    else
+      {
+	m_lru_head = e.lru_next;
+      }
+    if (e.lru_next != NULL_INDEX)
+      {
+	m_entries[e.lru_next].lru_prev = e.lru_prev;
+      }
+    else
+      {
+	m_lru_tail = e.lru_prev;
+      }
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  void
+  open_hash_table<Key, Value, Hash, Equal>::lru_append (index_type index)
+  {
+    entry &e = m_entries[index];
+
+    e.lru_prev = m_lru_tail;
+    e.lru_next = NULL_INDEX;
+    if (m_lru_tail != NULL_INDEX)
+      {
+	m_entries[m_lru_tail].lru_next = index;
+      }
+    else
+      {
+	m_lru_head = index;
+      }
+    m_lru_tail = index;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  typename open_hash_table<Key, Value, Hash, Equal>::index_type
+  open_hash_table<Key, Value, Hash, Equal>::count () const
+  {
+    return m_entry_count;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  typename open_hash_table<Key, Value, Hash, Equal>::index_type
+  open_hash_table<Key, Value, Hash, Equal>::lru_first () const
+  {
+    return m_lru_head;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  const Key &
+  open_hash_table<Key, Value, Hash, Equal>::get_key (index_type index) const
+  {
+    assert (index < m_entry_count);
+    return m_entries[index].key;
+  }
+
+  template <typename Key, typename Value, typename Hash, typename Equal>
+  Value &
+  open_hash_table<Key, Value, Hash, Equal>::get_value (index_type index)
+  {
+    assert (index < m_entry_count);
+    return m_entries[index].value;
+  }
+} // namespace cubbase
+
+#endif // _OPEN_HASH_TABLE_HPP_
@@ -129,6 +129,7 @@ static int f_load_Time_get_oldest_mvcc_acquire_time (void);
 static int f_load_Count_get_oldest_mvcc_retry (void);
 static int f_load_thread_stats (void);
 static int f_load_thread_daemon_stats (void);
+static int f_load_resource_group_stats (void);
 
 static void f_dump_in_file_Num_data_page_fix_ext (FILE *, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_data_page_promote_ext (FILE *, const UINT64 * stat_vals);
@@ -142,6 +143,7 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_resource_group_stats (FILE * f, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -155,6 +157,7 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_resource_group_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -452,6 +455,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_PAGE_PROMOTE_SUCCESS, "Data_page_total_promote_success"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_PAGE_PROMOTE_FAILED, "Data_page_total_promote_fail"),
   PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_PB_PAGE_PROMOTE_TOTAL_TIME_10USEC, "Data_page_total_promote_time_msec"),
+  PSTAT_METADATA_INIT_COMPUTED_RATIO (PSTAT_TEMP_COMPRESSION_RATIO, "Temp_page_compression_ratio"),
 
   /* Page buffer extended */
   /* detailed unfix module */
@@ -553,6 +557,14 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS, "Log_LZ4_compress"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS, "Log_LZ4_decompress"),
 
+  /* Temporary page LZ4 compression statistics */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TEMP_NUM_PAGES_WRITTEN, "Num_temp_pages_written"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TEMP_NUM_PAGES_COMPRESSED, "Num_temp_pages_compressed"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TEMP_NUM_RAW_BYTES, "Num_temp_raw_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TEMP_NUM_WRITTEN_BYTES, "Num_temp_written_bytes"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TEMP_LZ4_COMPRESS_TIME_COUNTERS, "Temp_LZ4_compress"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TEMP_LZ4_DECOMPRESS_TIME_COUNTERS, "Temp_LZ4_decompress"),
+
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_HIGH_PRIO, "Num_alloc_bcb_wait_threads_high_priority"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_LOW_PRIO, "Num_alloc_bcb_wait_threads_low_priority"),
@@ -604,7 +616,10 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_RESOURCE_GROUP_COUNTERS, "Resource_group_counters_timers",
+			       &f_dump_in_file_resource_group_stats, &f_dump_in_buffer_resource_group_stats,
+			       &f_load_resource_group_stats)
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
@@ -1328,6 +1343,21 @@ perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes)
     }
   perfmon_add_stat_at_offset (thread_p, PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES, offset, 1);
 }
+
+/*
+ *   perfmon_resource_group_add - add amount to a counter of a resource group
+ *   return: none
+ */
+void
+perfmon_resource_group_add (THREAD_ENTRY * thread_p, int group_id, PERF_RESOURCE_GROUP_COUNTER counter,
+			    UINT64 amount)
+{
+  assert (group_id >= 0 && group_id < PERF_RESOURCE_GROUP_MAX_CNT);
+  assert (counter >= 0 && counter < PERF_RESOURCE_GROUP_COUNTER_CNT);
+
+  perfmon_add_stat_at_offset (thread_p, PSTAT_RESOURCE_GROUP_COUNTERS, PERF_RESOURCE_GROUP_OFFSET (group_id, counter),
+			      amount);
+}
 #endif /* SERVER_MODE || SA_MODE */
 
 int
@@ -1840,6 +1870,10 @@ perfmon_server_calc_stats (UINT64 * stats)
   stats[pstat_Metadata[PSTAT_PB_PAGE_PROMOTE_SUCCESS].start_offset] *= 100;
   stats[pstat_Metadata[PSTAT_PB_PAGE_PROMOTE_FAILED].start_offset] *= 100;
 
+  stats[pstat_Metadata[PSTAT_TEMP_COMPRESSION_RATIO].start_offset] =
+    SAFE_DIV (stats[pstat_Metadata[PSTAT_TEMP_NUM_WRITTEN_BYTES].start_offset] * 100 * 100,
+	      stats[pstat_Metadata[PSTAT_TEMP_NUM_RAW_BYTES].start_offset]);
+
 #if defined (SERVER_MODE)
   pgbuf_peek_stats (&(stats[pstat_Metadata[PSTAT_PB_FIXED_CNT].start_offset]),
 		    &(stats[pstat_Metadata[PSTAT_PB_DIRTY_CNT].start_offset]),
@@ -4288,6 +4322,127 @@ perfmon_stat_dump_in_buffer_thread_daemon_stats (const UINT64 * stats_ptr, char
     }
 }
 
+static const char *perfmon_Resource_group_counter_names[PERF_RESOURCE_GROUP_COUNTER_CNT] = {
+  "requests",
+  "request_time_usec",
+  "queued_requests",
+  "queue_wait_time_usec",
+  "queries",
+  "query_time_usec",
+  "query_waits",
+  "query_rejects",
+  "temp_quota_errors",
+  "io_reads",
+  "io_throttle_time_usec"
+};
+
+static int
+f_load_resource_group_stats (void)
+{
+  return PERF_RESOURCE_GROUP_COUNTERS;
+}
+
+/*
+ * perfmon_stat_dump_resource_group_stats () - Print the counters of the resource groups that were used, followed by
+ *					       their average request and query times
+ *
+ * stream(in): output file (NULL when printing to buffer)
+ * stats_ptr(in): start of array values
+ * s(in/out): output string (NULL when printing to file)
+ * remaining_size(in/out): remaining size in string s (NULL when printing to file)
+ *
+ */
+static void
+perfmon_stat_dump_resource_group_stats (FILE * stream, const UINT64 * stats_ptr, char **s, int *remaining_size)
+{
+  const UINT64 *group_stats;
+  UINT64 value;
+  char name[64];
+  int group_id, counter, ret;
+
+  for (group_id = 0; group_id < PERF_RESOURCE_GROUP_MAX_CNT; group_id++)
+    {
+      group_stats = stats_ptr + PERF_RESOURCE_GROUP_OFFSET (group_id, 0);
+      if (group_stats[PERF_RESOURCE_GROUP_REQUESTS] == 0 && group_stats[PERF_RESOURCE_GROUP_QUERIES] == 0)
+	{
+	  continue;
+	}
+
+      for (counter = 0; counter < PERF_RESOURCE_GROUP_COUNTER_CNT + 2; counter++)
+	{
+	  if (counter == PERF_RESOURCE_GROUP_COUNTER_CNT)
+	    {
+	      snprintf (name, sizeof (name), "Group_%d.avg_request_time_usec", group_id);
+	      value = SAFE_DIV (group_stats[PERF_RESOURCE_GROUP_REQUEST_TIME], group_stats[PERF_RESOURCE_GROUP_REQUESTS]);
+	    }
+	  else if (counter == PERF_RESOURCE_GROUP_COUNTER_CNT + 1)
+	    {
+	      snprintf (name, sizeof (name), "Group_%d.avg_query_time_usec", group_id);
+	      value = SAFE_DIV (group_stats[PERF_RESOURCE_GROUP_QUERY_TIME], group_stats[PERF_RESOURCE_GROUP_QUERIES]);
+	    }
+	  else
+	    {
+	      snprintf (name, sizeof (name), "Group_%d.%s", group_id, perfmon_Resource_group_counter_names[counter]);
+	      value = group_stats[counter];
+	    }
+	  if (value == 0)
+	    {
+	      continue;
+	    }
+
+	  if (stream != NULL)
+	    {
+	      fprintf (stream, "%-40s = %16llu\n", name, (long long unsigned int) value);
+	    }
+	  else
+	    {
+	      ret = snprintf (*s, *remaining_size, "%-40s = %16llu\n", name, (long long unsigned int) value);
+	      *remaining_size -= ret;
+	      *s += ret;
+	      if (*remaining_size <= 0)
+		{
+		  return;
+		}
+	    }
+	}
+    }
+}
+
+/*
+ * f_dump_in_file_resource_group_stats () - Write in file the values for resource group statistics
+ *
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_resource_group_stats (FILE * f, const UINT64 * stat_vals)
+{
+  assert (f != NULL);
+
+  perfmon_stat_dump_resource_group_stats (f, stat_vals, NULL, NULL);
+}
+
+/*
+ * f_dump_in_buffer_resource_group_stats () - Write to a buffer the values for resource group statistics
+ *
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_resource_group_stats (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  assert (s != NULL);
+  assert (remaining_size != NULL);
+
+  if (*s != NULL)
+    {
+      perfmon_stat_dump_resource_group_stats (NULL, stat_vals, s, remaining_size);
+    }
+}
+
 #if defined (SERVER_MODE)
 static void
 perfmon_peek_thread_daemon_stats (UINT64 * stats)
@@ -132,6 +132,30 @@ typedef enum
 #define PERF_OBJ_LOCK_STAT_COUNTERS (SCH_M_LOCK + 1)
 #define PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT 10
 
+/* Per resource group counters; see resource_group.hpp. */
+#define PERF_RESOURCE_GROUP_MAX_CNT 16
+
+typedef enum
+{
+  PERF_RESOURCE_GROUP_REQUESTS = 0,
+  PERF_RESOURCE_GROUP_REQUEST_TIME,	/* usec */
+  PERF_RESOURCE_GROUP_QUEUED_REQUESTS,
+  PERF_RESOURCE_GROUP_QUEUE_WAIT_TIME,	/* usec */
+  PERF_RESOURCE_GROUP_QUERIES,
+  PERF_RESOURCE_GROUP_QUERY_TIME,	/* usec */
+  PERF_RESOURCE_GROUP_QUERY_WAITS,
+  PERF_RESOURCE_GROUP_QUERY_REJECTS,
+  PERF_RESOURCE_GROUP_TEMP_QUOTA_ERRORS,
+  PERF_RESOURCE_GROUP_IO_READS,
+  PERF_RESOURCE_GROUP_IO_THROTTLE_TIME,	/* usec */
+
+  PERF_RESOURCE_GROUP_COUNTER_CNT
+} PERF_RESOURCE_GROUP_COUNTER;
+
+#define PERF_RESOURCE_GROUP_COUNTERS (PERF_RESOURCE_GROUP_MAX_CNT * PERF_RESOURCE_GROUP_COUNTER_CNT)
+
+#define PERF_RESOURCE_GROUP_OFFSET(group,counter) ((group) * PERF_RESOURCE_GROUP_COUNTER_CNT + (counter))
+
 #define SAFE_DIV(a, b) ((b) == 0 ? 0 : (a) / (b))
 
 /* Count & timer values. */
@@ -526,6 +550,8 @@ typedef enum
   PSTAT_PB_PAGE_PROMOTE_FAILED,
   /* total promotion time */
   PSTAT_PB_PAGE_PROMOTE_TOTAL_TIME_10USEC,
+  /* (temp_num_written_bytes x 100 / temp_num_raw_bytes) x 100 */
+  PSTAT_TEMP_COMPRESSION_RATIO,
 
   /* Page buffer extended */
   /* detailed unfix module */
@@ -624,6 +650,14 @@ typedef enum
   PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS,
   PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS,
 
+  /* Temporary page LZ4 compress statistics */
+  PSTAT_TEMP_NUM_PAGES_WRITTEN,
+  PSTAT_TEMP_NUM_PAGES_COMPRESSED,
+  PSTAT_TEMP_NUM_RAW_BYTES,
+  PSTAT_TEMP_NUM_WRITTEN_BYTES,
+  PSTAT_TEMP_LZ4_COMPRESS_TIME_COUNTERS,
+  PSTAT_TEMP_LZ4_DECOMPRESS_TIME_COUNTERS,
+
   /* peeked stats */
   PSTAT_PB_WAIT_THREADS_HIGH_PRIO,
   PSTAT_PB_WAIT_THREADS_LOW_PRIO,
@@ -648,6 +682,7 @@ typedef enum
   PSTAT_THREAD_DAEMON_STATS,
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
+  PSTAT_RESOURCE_GROUP_COUNTERS,
 
   PSTAT_COUNT
 } PERF_STAT_ID;
@@ -1477,6 +1512,8 @@ extern void perfmon_pbx_fix_acquire_time (THREAD_ENTRY * thread_p, int page_type
 					  int cond_type, UINT64 amount);
 extern void perfmon_mvcc_snapshot (THREAD_ENTRY * thread_p, int snapshot, int rec_type, int visibility);
 extern void perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes);
+extern void perfmon_resource_group_add (THREAD_ENTRY * thread_p, int group_id, PERF_RESOURCE_GROUP_COUNTER counter,
+					UINT64 amount);
 
 #endif /* SERVER_MODE || SA_MODE */
 
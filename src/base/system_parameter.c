@@ -736,6 +736,41 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_PRINT_INDEX_DETAIL        "print_index_detail"
 
 #define PRM_NAME_ORACLE_STYLE_DIVIDE "oracle_style_divide"
+#define PRM_NAME_OPTIMIZER_DP_JOIN_LIMIT "optimizer_dp_join_limit"
+#define PRM_NAME_SERIAL_PREFETCH_COUNT "serial_prefetch_count"
+#define PRM_NAME_COLUMNAR_CACHE_CLASSES "columnar_cache_classes"
+#define PRM_NAME_COLUMNAR_CACHE_MAX_SIZE "columnar_cache_max_size"
+#define PRM_NAME_MAX_SUBQUERY_MEMO_SIZE "max_subquery_memo_size"
+#define PRM_NAME_JAVA_STORED_PROCEDURE_BATCH_SIZE "java_stored_procedure_batch_size"
+#define PRM_NAME_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS "java_stored_procedure_deterministic_functions"
+#define PRM_NAME_MAX_QUERY_MEMORY_SIZE "max_query_memory_size"
+#define PRM_NAME_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS "query_memory_grant_wait_time_in_msecs"
+#define PRM_NAME_TEMP_FILE_COMPRESSION "temp_file_compression"
+#define PRM_NAME_BACKUP_CHANGE_TRACKING "backup_change_tracking"
+#define PRM_NAME_BACKUP_CHANGE_TRACKING_VERIFY "backup_change_tracking_verify"
+#define PRM_NAME_RESTORE_DECOMPRESS_THREADS "restore_decompress_threads"
+#define PRM_NAME_RESTORE_BUFFER_SIZE "restore_buffer_size"
+#define PRM_NAME_ACTIVE_SESSION_HISTORY "active_session_history"
+#define PRM_NAME_ACTIVE_SESSION_HISTORY_INTERVAL "active_session_history_interval_in_msecs"
+#define PRM_NAME_ACTIVE_SESSION_HISTORY_SIZE "active_session_history_size"
+#define PRM_NAME_RESOURCE_GROUPS "resource_groups"
+#define PRM_NAME_RESOURCE_GROUP_USERS "resource_group_users"
+#define PRM_NAME_RESOURCE_GROUP_BROKERS "resource_group_brokers"
+#define PRM_NAME_RESOURCE_GROUP_QUERY_WAIT_TIME "resource_group_query_wait_time_in_msecs"
+#define PRM_NAME_AUTO_UPDATE_STATISTICS "auto_update_statistics"
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_THRESHOLD "auto_update_statistics_threshold"
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_MIN_CHANGES "auto_update_statistics_min_changes"
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_INTERVAL "auto_update_statistics_interval_in_secs"
+#define PRM_NAME_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC "auto_update_statistics_io_pages_per_sec"
+#define PRM_NAME_STATISTICS_COLUMN_GROUPS "statistics_column_groups"
+#define PRM_NAME_HF_INSERT_PAGE_AFFINITY "heap_insert_page_affinity"
+#define PRM_NAME_BT_RIGHTMOST_LEAF_INSERT "index_rightmost_leaf_insert"
+#define PRM_NAME_SORT_NORMALIZED_STRING_KEYS "sort_normalized_string_keys"
+#define PRM_NAME_STATEMENT_STATISTICS "statement_statistics"
+#define PRM_NAME_STATEMENT_STATISTICS_SIZE "statement_statistics_size"
+#define PRM_NAME_INDEX_LOAD_PARALLELISM "index_load_parallelism"
+#define PRM_NAME_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE "max_entries_in_tran_temp_file_cache"
+#define PRM_NAME_JSON_SERIALIZE_INDEXED "json_serialize_indexed"
 
 /*
  * Note about ERROR_LIST and INTEGER_LIST type
@@ -2413,6 +2448,184 @@ static int prm_vacuum_ovfp_check_threshold_upper = INT_MAX;
 static int prm_vacuum_ovfp_check_threshold_lower = 2;
 static unsigned int prm_vacuum_ovfp_check_threshold_flag = 0;
 
+int PRM_OPTIMIZER_DP_JOIN_LIMIT = 20;
+static int prm_optimizer_dp_join_limit_default = 20;
+static int prm_optimizer_dp_join_limit_lower = 0;
+static int prm_optimizer_dp_join_limit_upper = 24;
+static unsigned int prm_optimizer_dp_join_limit_flag = 0;
+
+int PRM_SERIAL_PREFETCH_COUNT = 0;
+static int prm_serial_prefetch_count_default = 0;
+static int prm_serial_prefetch_count_lower = 0;
+static int prm_serial_prefetch_count_upper = 1000000;
+static unsigned int prm_serial_prefetch_count_flag = 0;
+
+const char *PRM_COLUMNAR_CACHE_CLASSES = "";
+static const char *prm_columnar_cache_classes_default = "";
+static unsigned int prm_columnar_cache_classes_flag = 0;
+
+UINT64 PRM_COLUMNAR_CACHE_MAX_SIZE = (256 * 1024 * 1024);
+static UINT64 prm_columnar_cache_max_size_default = (256 * 1024 * 1024);
+static UINT64 prm_columnar_cache_max_size_lower = (1024 * 1024);
+static UINT64 prm_columnar_cache_max_size_upper = (64ULL * 1024 * 1024 * 1024);
+static unsigned int prm_columnar_cache_max_size_flag = 0;
+
+UINT64 PRM_MAX_SUBQUERY_MEMO_SIZE = (2 * 1024 * 1024);
+static UINT64 prm_max_subquery_memo_size_default = (2 * 1024 * 1024);
+static UINT64 prm_max_subquery_memo_size_lower = 0;
+static UINT64 prm_max_subquery_memo_size_upper = (1024 * 1024 * 1024);
+static unsigned int prm_max_subquery_memo_size_flag = 0;
+
+int PRM_JAVA_STORED_PROCEDURE_BATCH_SIZE = 1;
+static int prm_java_stored_procedure_batch_size_default = 1;
+static int prm_java_stored_procedure_batch_size_lower = 1;
+static int prm_java_stored_procedure_batch_size_upper = 65536;
+static unsigned int prm_java_stored_procedure_batch_size_flag = 0;
+
+const char *PRM_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS = "";
+static const char *prm_java_stored_procedure_deterministic_functions_default = "";
+static unsigned int prm_java_stored_procedure_deterministic_functions_flag = 0;
+
+UINT64 PRM_MAX_QUERY_MEMORY_SIZE = 0;
+static UINT64 prm_max_query_memory_size_default = 0;
+static UINT64 prm_max_query_memory_size_lower = 0;
+static UINT64 prm_max_query_memory_size_upper = ((UINT64) 1024 * 1024 * 1024 * 1024);
+static unsigned int prm_max_query_memory_size_flag = 0;
+
+int PRM_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS = 1000;
+static int prm_query_memory_grant_wait_time_in_msecs_default = 1000;
+static int prm_query_memory_grant_wait_time_in_msecs_lower = 0;
+static int prm_query_memory_grant_wait_time_in_msecs_upper = 60000;
+static unsigned int prm_query_memory_grant_wait_time_in_msecs_flag = 0;
+
+bool PRM_TEMP_FILE_COMPRESSION = false;
+static bool prm_temp_file_compression_default = false;
+static unsigned int prm_temp_file_compression_flag = 0;
+
+bool PRM_BACKUP_CHANGE_TRACKING = false;
+static bool prm_backup_change_tracking_default = false;
+static unsigned int prm_backup_change_tracking_flag = 0;
+
+bool PRM_BACKUP_CHANGE_TRACKING_VERIFY = false;
+static bool prm_backup_change_tracking_verify_default = false;
+static unsigned int prm_backup_change_tracking_verify_flag = 0;
+
+int PRM_RESTORE_DECOMPRESS_THREADS = 0;
+static int prm_restore_decompress_threads_default = 0;
+static int prm_restore_decompress_threads_lower = 0;
+static int prm_restore_decompress_threads_upper = 64;
+static unsigned int prm_restore_decompress_threads_flag = 0;
+
+UINT64 PRM_RESTORE_BUFFER_SIZE = ((UINT64) 64 * 1024 * 1024);
+static UINT64 prm_restore_buffer_size_default = ((UINT64) 64 * 1024 * 1024);
+static UINT64 prm_restore_buffer_size_lower = ((UINT64) 1024 * 1024);
+static UINT64 prm_restore_buffer_size_upper = ((UINT64) 1024 * 1024 * 1024);
+static unsigned int prm_restore_buffer_size_flag = 0;
+
+bool PRM_ACTIVE_SESSION_HISTORY = false;
+static bool prm_active_session_history_default = false;
+static unsigned int prm_active_session_history_flag = 0;
+
+int PRM_ACTIVE_SESSION_HISTORY_INTERVAL = 100;
+static int prm_active_session_history_interval_default = 100;
+static int prm_active_session_history_interval_lower = 10;
+static int prm_active_session_history_interval_upper = 10000;
+static unsigned int prm_active_session_history_interval_flag = 0;
+
+int PRM_ACTIVE_SESSION_HISTORY_SIZE = 65536;
+static int prm_active_session_history_size_default = 65536;
+static int prm_active_session_history_size_lower = 1024;
+static int prm_active_session_history_size_upper = 4194304;
+static unsigned int prm_active_session_history_size_flag = 0;
+
+const char *PRM_RESOURCE_GROUPS = NULL;
+static const char *prm_resource_groups_default = NULL;
+static unsigned int prm_resource_groups_flag = 0;
+
+const char *PRM_RESOURCE_GROUP_USERS = NULL;
+static const char *prm_resource_group_users_default = NULL;
+static unsigned int prm_resource_group_users_flag = 0;
+
+const char *PRM_RESOURCE_GROUP_BROKERS = NULL;
+static const char *prm_resource_group_brokers_default = NULL;
+static unsigned int prm_resource_group_brokers_flag = 0;
+
+int PRM_RESOURCE_GROUP_QUERY_WAIT_TIME = 10000;
+static int prm_resource_group_query_wait_time_default = 10000;
+static int prm_resource_group_query_wait_time_lower = 0;
+static int prm_resource_group_query_wait_time_upper = INT_MAX;
+static unsigned int prm_resource_group_query_wait_time_flag = 0;
+
+bool PRM_AUTO_UPDATE_STATISTICS = false;
+static bool prm_auto_update_statistics_default = false;
+static unsigned int prm_auto_update_statistics_flag = 0;
+
+float PRM_AUTO_UPDATE_STATISTICS_THRESHOLD = 0.2f;
+static float prm_auto_update_statistics_threshold_default = 0.2f;
+static float prm_auto_update_statistics_threshold_lower = 0.01f;
+static float prm_auto_update_statistics_threshold_upper = 10.0f;
+static unsigned int prm_auto_update_statistics_threshold_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_MIN_CHANGES = 1000;
+static int prm_auto_update_statistics_min_changes_default = 1000;
+static int prm_auto_update_statistics_min_changes_lower = 1;
+static int prm_auto_update_statistics_min_changes_upper = INT_MAX;
+static unsigned int prm_auto_update_statistics_min_changes_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_INTERVAL = 60;
+static int prm_auto_update_statistics_interval_default = 60;
+static int prm_auto_update_statistics_interval_lower = 1;
+static int prm_auto_update_statistics_interval_upper = 86400;
+static unsigned int prm_auto_update_statistics_interval_flag = 0;
+
+int PRM_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC = 1000;
+static int prm_auto_update_statistics_io_pages_per_sec_default = 1000;
+static int prm_auto_update_statistics_io_pages_per_sec_lower = 1;
+static int prm_auto_update_statistics_io_pages_per_sec_upper = INT_MAX;
+static unsigned int prm_auto_update_statistics_io_pages_per_sec_flag = 0;
+
+const char *PRM_STATISTICS_COLUMN_GROUPS = NULL;
+static const char *prm_statistics_column_groups_default = NULL;
+static unsigned int prm_statistics_column_groups_flag = 0;
+
+bool PRM_HF_INSERT_PAGE_AFFINITY = true;
+static bool prm_hf_insert_page_affinity_default = true;
+static unsigned int prm_hf_insert_page_affinity_flag = 0;
+
+bool PRM_BT_RIGHTMOST_LEAF_INSERT = true;
+static bool prm_bt_rightmost_leaf_insert_default = true;
+static unsigned int prm_bt_rightmost_leaf_insert_flag = 0;
+
+bool PRM_SORT_NORMALIZED_STRING_KEYS = true;
+static bool prm_sort_normalized_string_keys_default = true;
+static unsigned int prm_sort_normalized_string_keys_flag = 0;
+
+bool PRM_STATEMENT_STATISTICS = false;
+static bool prm_statement_statistics_default = false;
+static unsigned int prm_statement_statistics_flag = 0;
+
+int PRM_STATEMENT_STATISTICS_SIZE = 1024;
+static int prm_statement_statistics_size_default = 1024;
+static int prm_statement_statistics_size_lower = 64;
+static int prm_statement_statistics_size_upper = 65536;
+static unsigned int prm_statement_statistics_size_flag = 0;
+
+int PRM_INDEX_LOAD_PARALLELISM = 1;
+static int prm_index_load_parallelism_default = 1;
+static int prm_index_load_parallelism_lower = 1;
+static int prm_index_load_parallelism_upper = 16;
+static unsigned int prm_index_load_parallelism_flag = 0;
+
+int PRM_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE = 4;
+static int prm_max_entries_in_tran_temp_file_cache_default = 4;
+static int prm_max_entries_in_tran_temp_file_cache_lower = 0;
+static int prm_max_entries_in_tran_temp_file_cache_upper = 64;
+static unsigned int prm_max_entries_in_tran_temp_file_cache_flag = 0;
+
+bool PRM_JSON_SERIALIZE_INDEXED = true;
+static bool prm_json_serialize_indexed_default = true;
+static unsigned int prm_json_serialize_indexed_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -6347,6 +6560,410 @@ SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_DP_JOIN_LIMIT,
+   PRM_NAME_OPTIMIZER_DP_JOIN_LIMIT,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_optimizer_dp_join_limit_flag,
+   (void *) &prm_optimizer_dp_join_limit_default,
+   (void *) &PRM_OPTIMIZER_DP_JOIN_LIMIT,
+   (void *) &prm_optimizer_dp_join_limit_upper,
+   (void *) &prm_optimizer_dp_join_limit_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SERIAL_PREFETCH_COUNT,
+   PRM_NAME_SERIAL_PREFETCH_COUNT,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_serial_prefetch_count_flag,
+   (void *) &prm_serial_prefetch_count_default,
+   (void *) &PRM_SERIAL_PREFETCH_COUNT,
+   (void *) &prm_serial_prefetch_count_upper,
+   (void *) &prm_serial_prefetch_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_COLUMNAR_CACHE_CLASSES,
+   PRM_NAME_COLUMNAR_CACHE_CLASSES,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_columnar_cache_classes_flag,
+   (void *) &prm_columnar_cache_classes_default,
+   (void *) &PRM_COLUMNAR_CACHE_CLASSES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_COLUMNAR_CACHE_MAX_SIZE,
+   PRM_NAME_COLUMNAR_CACHE_MAX_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_columnar_cache_max_size_flag,
+   (void *) &prm_columnar_cache_max_size_default,
+   (void *) &PRM_COLUMNAR_CACHE_MAX_SIZE,
+   (void *) &prm_columnar_cache_max_size_upper,
+   (void *) &prm_columnar_cache_max_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_SUBQUERY_MEMO_SIZE,
+   PRM_NAME_MAX_SUBQUERY_MEMO_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_subquery_memo_size_flag,
+   (void *) &prm_max_subquery_memo_size_default,
+   (void *) &PRM_MAX_SUBQUERY_MEMO_SIZE,
+   (void *) &prm_max_subquery_memo_size_upper,
+   (void *) &prm_max_subquery_memo_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   PRM_NAME_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_java_stored_procedure_batch_size_flag,
+   (void *) &prm_java_stored_procedure_batch_size_default,
+   (void *) &PRM_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   (void *) &prm_java_stored_procedure_batch_size_upper,
+   (void *) &prm_java_stored_procedure_batch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS,
+   PRM_NAME_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS,
+   (PRM_FOR_CLIENT),
+   PRM_STRING,
+   &prm_java_stored_procedure_deterministic_functions_flag,
+   (void *) &prm_java_stored_procedure_deterministic_functions_default,
+   (void *) &PRM_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_QUERY_MEMORY_SIZE,
+   PRM_NAME_MAX_QUERY_MEMORY_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_query_memory_size_flag,
+   (void *) &prm_max_query_memory_size_default,
+   (void *) &PRM_MAX_QUERY_MEMORY_SIZE,
+   (void *) &prm_max_query_memory_size_upper,
+   (void *) &prm_max_query_memory_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS,
+   PRM_NAME_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_query_memory_grant_wait_time_in_msecs_flag,
+   (void *) &prm_query_memory_grant_wait_time_in_msecs_default,
+   (void *) &PRM_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS,
+   (void *) &prm_query_memory_grant_wait_time_in_msecs_upper,
+   (void *) &prm_query_memory_grant_wait_time_in_msecs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_FILE_COMPRESSION,
+   PRM_NAME_TEMP_FILE_COMPRESSION,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_temp_file_compression_flag,
+   (void *) &prm_temp_file_compression_default,
+   (void *) &PRM_TEMP_FILE_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BACKUP_CHANGE_TRACKING,
+   PRM_NAME_BACKUP_CHANGE_TRACKING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_backup_change_tracking_flag,
+   (void *) &prm_backup_change_tracking_default,
+   (void *) &PRM_BACKUP_CHANGE_TRACKING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BACKUP_CHANGE_TRACKING_VERIFY,
+   PRM_NAME_BACKUP_CHANGE_TRACKING_VERIFY,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_backup_change_tracking_verify_flag,
+   (void *) &prm_backup_change_tracking_verify_default,
+   (void *) &PRM_BACKUP_CHANGE_TRACKING_VERIFY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESTORE_DECOMPRESS_THREADS,
+   PRM_NAME_RESTORE_DECOMPRESS_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_restore_decompress_threads_flag,
+   (void *) &prm_restore_decompress_threads_default,
+   (void *) &PRM_RESTORE_DECOMPRESS_THREADS,
+   (void *) &prm_restore_decompress_threads_upper,
+   (void *) &prm_restore_decompress_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESTORE_BUFFER_SIZE,
+   PRM_NAME_RESTORE_BUFFER_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_restore_buffer_size_flag,
+   (void *) &prm_restore_buffer_size_default,
+   (void *) &PRM_RESTORE_BUFFER_SIZE,
+   (void *) &prm_restore_buffer_size_upper,
+   (void *) &prm_restore_buffer_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ACTIVE_SESSION_HISTORY,
+   PRM_NAME_ACTIVE_SESSION_HISTORY,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_active_session_history_flag,
+   (void *) &prm_active_session_history_default,
+   (void *) &PRM_ACTIVE_SESSION_HISTORY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ACTIVE_SESSION_HISTORY_INTERVAL,
+   PRM_NAME_ACTIVE_SESSION_HISTORY_INTERVAL,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_active_session_history_interval_flag,
+   (void *) &prm_active_session_history_interval_default,
+   (void *) &PRM_ACTIVE_SESSION_HISTORY_INTERVAL,
+   (void *) &prm_active_session_history_interval_upper,
+   (void *) &prm_active_session_history_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ACTIVE_SESSION_HISTORY_SIZE,
+   PRM_NAME_ACTIVE_SESSION_HISTORY_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_active_session_history_size_flag,
+   (void *) &prm_active_session_history_size_default,
+   (void *) &PRM_ACTIVE_SESSION_HISTORY_SIZE,
+   (void *) &prm_active_session_history_size_upper,
+   (void *) &prm_active_session_history_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESOURCE_GROUPS,
+   PRM_NAME_RESOURCE_GROUPS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_resource_groups_flag,
+   (void *) &prm_resource_groups_default,
+   (void *) &PRM_RESOURCE_GROUPS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESOURCE_GROUP_USERS,
+   PRM_NAME_RESOURCE_GROUP_USERS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_resource_group_users_flag,
+   (void *) &prm_resource_group_users_default,
+   (void *) &PRM_RESOURCE_GROUP_USERS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESOURCE_GROUP_BROKERS,
+   PRM_NAME_RESOURCE_GROUP_BROKERS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_resource_group_brokers_flag,
+   (void *) &prm_resource_group_brokers_default,
+   (void *) &PRM_RESOURCE_GROUP_BROKERS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RESOURCE_GROUP_QUERY_WAIT_TIME,
+   PRM_NAME_RESOURCE_GROUP_QUERY_WAIT_TIME,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_resource_group_query_wait_time_flag,
+   (void *) &prm_resource_group_query_wait_time_default,
+   (void *) &PRM_RESOURCE_GROUP_QUERY_WAIT_TIME,
+   (void *) &prm_resource_group_query_wait_time_upper,
+   (void *) &prm_resource_group_query_wait_time_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS,
+   PRM_NAME_AUTO_UPDATE_STATISTICS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_auto_update_statistics_flag,
+   (void *) &prm_auto_update_statistics_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_THRESHOLD,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_THRESHOLD,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   &prm_auto_update_statistics_threshold_flag,
+   (void *) &prm_auto_update_statistics_threshold_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_THRESHOLD,
+   (void *) &prm_auto_update_statistics_threshold_upper,
+   (void *) &prm_auto_update_statistics_threshold_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_min_changes_flag,
+   (void *) &prm_auto_update_statistics_min_changes_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+   (void *) &prm_auto_update_statistics_min_changes_upper,
+   (void *) &prm_auto_update_statistics_min_changes_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_INTERVAL,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_interval_flag,
+   (void *) &prm_auto_update_statistics_interval_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_INTERVAL,
+   (void *) &prm_auto_update_statistics_interval_upper,
+   (void *) &prm_auto_update_statistics_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC,
+   PRM_NAME_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_auto_update_statistics_io_pages_per_sec_flag,
+   (void *) &prm_auto_update_statistics_io_pages_per_sec_default,
+   (void *) &PRM_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC,
+   (void *) &prm_auto_update_statistics_io_pages_per_sec_upper,
+   (void *) &prm_auto_update_statistics_io_pages_per_sec_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATISTICS_COLUMN_GROUPS,
+   PRM_NAME_STATISTICS_COLUMN_GROUPS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_statistics_column_groups_flag,
+   (void *) &prm_statistics_column_groups_default,
+   (void *) &PRM_STATISTICS_COLUMN_GROUPS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HF_INSERT_PAGE_AFFINITY,
+   PRM_NAME_HF_INSERT_PAGE_AFFINITY,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_hf_insert_page_affinity_flag,
+   (void *) &prm_hf_insert_page_affinity_default,
+   (void *) &PRM_HF_INSERT_PAGE_AFFINITY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BT_RIGHTMOST_LEAF_INSERT,
+   PRM_NAME_BT_RIGHTMOST_LEAF_INSERT,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_bt_rightmost_leaf_insert_flag,
+   (void *) &prm_bt_rightmost_leaf_insert_default,
+   (void *) &PRM_BT_RIGHTMOST_LEAF_INSERT,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_NORMALIZED_STRING_KEYS,
+   PRM_NAME_SORT_NORMALIZED_STRING_KEYS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_sort_normalized_string_keys_flag,
+   (void *) &prm_sort_normalized_string_keys_default,
+   (void *) &PRM_SORT_NORMALIZED_STRING_KEYS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATEMENT_STATISTICS,
+   PRM_NAME_STATEMENT_STATISTICS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_statement_statistics_flag,
+   (void *) &prm_statement_statistics_default,
+   (void *) &PRM_STATEMENT_STATISTICS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATEMENT_STATISTICS_SIZE,
+   PRM_NAME_STATEMENT_STATISTICS_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_statement_statistics_size_flag,
+   (void *) &prm_statement_statistics_size_default,
+   (void *) &PRM_STATEMENT_STATISTICS_SIZE,
+   (void *) &prm_statement_statistics_size_upper,
+   (void *) &prm_statement_statistics_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_INDEX_LOAD_PARALLELISM,
+   PRM_NAME_INDEX_LOAD_PARALLELISM,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_index_load_parallelism_flag,
+   (void *) &prm_index_load_parallelism_default,
+   (void *) &PRM_INDEX_LOAD_PARALLELISM,
+   (void *) &prm_index_load_parallelism_upper,
+   (void *) &prm_index_load_parallelism_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE,
+   PRM_NAME_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_INTEGER,
+   &prm_max_entries_in_tran_temp_file_cache_flag,
+   (void *) &prm_max_entries_in_tran_temp_file_cache_default,
+   (void *) &PRM_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE,
+   (void *) &prm_max_entries_in_tran_temp_file_cache_upper,
+   (void *) &prm_max_entries_in_tran_temp_file_cache_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JSON_SERIALIZE_INDEXED,
+   PRM_NAME_JSON_SERIALIZE_INDEXED,
+   (PRM_FOR_CLIENT | PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_json_serialize_indexed_flag,
+   (void *) &prm_json_serialize_indexed_default,
+   (void *) &PRM_JSON_SERIALIZE_INDEXED,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 static int num_session_parameters = 0;
@@ -475,8 +475,43 @@ enum param_id
   PRM_ID_DEDUPLICATE_KEY_LEVEL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_PRINT_INDEX_DETAIL,	/* support for SUPPORT_DEDUPLICATE_KEY_MODE */
   PRM_ID_HA_SQL_LOG_MAX_COUNT,
+  PRM_ID_OPTIMIZER_DP_JOIN_LIMIT,
+  PRM_ID_SERIAL_PREFETCH_COUNT,
+  PRM_ID_COLUMNAR_CACHE_CLASSES,
+  PRM_ID_COLUMNAR_CACHE_MAX_SIZE,
+  PRM_ID_MAX_SUBQUERY_MEMO_SIZE,
+  PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+  PRM_ID_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS,
+  PRM_ID_MAX_QUERY_MEMORY_SIZE,
+  PRM_ID_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS,
+  PRM_ID_TEMP_FILE_COMPRESSION,
+  PRM_ID_BACKUP_CHANGE_TRACKING,
+  PRM_ID_BACKUP_CHANGE_TRACKING_VERIFY,
+  PRM_ID_RESTORE_DECOMPRESS_THREADS,
+  PRM_ID_RESTORE_BUFFER_SIZE,
+  PRM_ID_ACTIVE_SESSION_HISTORY,
+  PRM_ID_ACTIVE_SESSION_HISTORY_INTERVAL,
+  PRM_ID_ACTIVE_SESSION_HISTORY_SIZE,
+  PRM_ID_RESOURCE_GROUPS,
+  PRM_ID_RESOURCE_GROUP_USERS,
+  PRM_ID_RESOURCE_GROUP_BROKERS,
+  PRM_ID_RESOURCE_GROUP_QUERY_WAIT_TIME,
+  PRM_ID_AUTO_UPDATE_STATISTICS,
+  PRM_ID_AUTO_UPDATE_STATISTICS_THRESHOLD,
+  PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES,
+  PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL,
+  PRM_ID_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC,
+  PRM_ID_STATISTICS_COLUMN_GROUPS,
+  PRM_ID_HF_INSERT_PAGE_AFFINITY,
+  PRM_ID_BT_RIGHTMOST_LEAF_INSERT,
+  PRM_ID_SORT_NORMALIZED_STRING_KEYS,
+  PRM_ID_STATEMENT_STATISTICS,
+  PRM_ID_STATEMENT_STATISTICS_SIZE,
+  PRM_ID_INDEX_LOAD_PARALLELISM,
+  PRM_ID_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE,
+  PRM_ID_JSON_SERIALIZE_INDEXED,
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_HA_SQL_LOG_MAX_COUNT
+  PRM_LAST_ID = PRM_ID_JSON_SERIALIZE_INDEXED
 };
 typedef enum param_id PARAM_ID;
 
@@ -39,6 +39,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/time.h>
+#include <sys/stat.h>
 #endif /* WINDOWS */
 #include <assert.h>
 
@@ -80,6 +81,9 @@
 #include "ddl_log.h"
 #include "api_compat.h"
 #include "method_callback.hpp"
+#include "elo.h"
+#include "es_common.h"
+#include "utility.h"
 
 #if defined (CAS_FOR_CGW)
 #include "cas_cgw.h"
@@ -11316,6 +11320,265 @@ ux_lob_read (DB_VALUE * lob_dbval, INT64 offset, int size, T_NET_BUF * net_buf)
   return 0;
 }
 
+/*
+ * lob_is_server_local () - is the connected database server on the host of the CAS
+ *   return: true if it is known to be local
+ */
+static bool
+lob_is_server_local (void)
+{
+  char *host_connected = db_get_host_connected ();
+
+  if (host_connected == NULL || host_connected[0] == '\0')
+    {
+      return false;
+    }
+
+  if (strcmp (host_connected, "localhost") == 0 || strcmp (host_connected, "127.0.0.1") == 0)
+    {
+      return true;
+    }
+
+  return util_is_localhost (host_connected);
+}
+
+/*
+ * lob_open_local_file () - open the file of a LOB if the CAS can read it without the database server
+ *   return: file descriptor, or -1 if the LOB is read through the database server
+ *   elo(in):
+ *   lob_size(in): size of the LOB
+ *
+ *   Note: ES_POSIX files are on the host of the database server. They are read directly only when the connected
+ *	   server is on the host of the CAS; a file of another host could have the same path.
+ */
+static int
+lob_open_local_file (const DB_ELO * elo, INT64 lob_size)
+{
+#if defined(WINDOWS)
+  return -1;
+#else /* WINDOWS */
+  const char *path;
+  struct stat stat_buf;
+  int fd;
+
+  switch (es_get_type (elo->locator))
+    {
+    case ES_POSIX:
+      if (!lob_is_server_local ())
+	{
+	  return -1;
+	}
+      path = ES_POSIX_PATH_POS (elo->locator);
+      break;
+    case ES_LOCAL:
+      path = ES_LOCAL_PATH_POS (elo->locator);
+      break;
+    default:
+      return -1;
+    }
+
+  fd = open (path, O_RDONLY);
+  if (fd < 0)
+    {
+      return -1;
+    }
+
+  if (fstat (fd, &stat_buf) < 0 || !S_ISREG (stat_buf.st_mode) || stat_buf.st_size != lob_size)
+    {
+      close (fd);
+      return -1;
+    }
+
+  return fd;
+#endif /* !WINDOWS */
+}
+
+/*
+ * ux_lob_read_stream () - prepare to send a part of a LOB right after the reply
+ *   return: error code
+ *   lob_dbval(in):
+ *   offset(in): first byte to send
+ *   length(in): bytes to send; fewer are sent if the LOB ends before
+ *   net_buf(out): the reply has the number of bytes that follow it
+ *
+ *   Note: the bytes are sent by ux_lob_send_stream once the reply is written, so the driver gets the whole part
+ *	   with a single request.
+ */
+int
+ux_lob_read_stream (DB_VALUE * lob_dbval, INT64 offset, INT64 length, T_NET_BUF * net_buf)
+{
+  DB_BIGINT lob_size;
+  INT64 size;
+  int err_code, fd;
+  DB_ELO *elo;
+
+  elo = db_get_elo (lob_dbval);
+  cas_log_debug (ARG_FILE_LINE, "ux_lob_read_stream: locator=%s, size=%lld, type=%u", elo->locator, elo->size,
+		 elo->type);
+
+  lob_size = db_elo_size (elo);
+  if (lob_size < 0)
+    {
+      errors_in_transaction++;
+      err_code = ERROR_INFO_SET ((int) lob_size, DBMS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return err_code;
+    }
+
+  size = (offset < lob_size) ? MIN (length, lob_size - offset) : 0;
+
+  if (size > 0)
+    {
+      fd = lob_open_local_file (elo, lob_size);
+      cas_log_debug (ARG_FILE_LINE, "ux_lob_read_stream: %lld bytes from %s", size,
+		     (fd >= 0) ? "the file" : "the server");
+      if (net_buf_cp_post_send_lob (net_buf, elo->locator, fd, offset, size) < 0)
+	{
+	  err_code = ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+	  NET_BUF_ERR_SET (net_buf);
+	  return err_code;
+	}
+    }
+
+  /* set result: on success, bytes that follow the reply */
+  net_buf_cp_bigint (net_buf, size, NULL);
+
+  return 0;
+}
+
+/*
+ * ux_lob_send_stream () - send the LOB part prepared by ux_lob_read_stream
+ *   return: 0 if success, -1 if the connection has to be closed
+ *   sock_fd(in):
+ *   net_buf(in):
+ *
+ *   Note: the reply already promised the bytes to the driver, so an error in the middle can only be told by closing
+ *	   the connection.
+ */
+int
+ux_lob_send_stream (SOCKET sock_fd, T_NET_BUF * net_buf)
+{
+  DB_ELO elo;
+  DB_BIGINT size_read;
+  INT64 offset = net_buf->post_lob_offset;
+  INT64 size = net_buf->post_lob_size;
+  char *buf;
+  int err_code;
+
+#if !defined(WINDOWS)
+  if (net_buf->post_lob_fd >= 0)
+    {
+      if (net_write_from_fd (sock_fd, net_buf->post_lob_fd, offset, size) < 0)
+	{
+	  cas_log_write (0, false, "lob_read_stream error: %lld bytes not sent", size);
+	  return -1;
+	}
+      return 0;
+    }
+#endif /* !WINDOWS */
+
+  buf = (char *) MALLOC (NET_STREAM_WINDOW_SIZE);
+  if (buf == NULL)
+    {
+      return -1;
+    }
+
+  elo_init_structure (&elo);
+  elo.locator = net_buf->post_send_lob;
+  elo.type = ELO_FBO;
+
+  while (size > 0)
+    {
+      err_code = db_elo_read (&elo, offset, buf, (size_t) MIN (size, NET_STREAM_WINDOW_SIZE), &size_read);
+      if (err_code < 0 || size_read <= 0 || net_write_stream (sock_fd, buf, (int) size_read) < 0)
+	{
+	  cas_log_write (0, false, "lob_read_stream error:%d %lld bytes not sent", err_code, size);
+	  FREE_MEM (buf);
+	  return -1;
+	}
+      offset += size_read;
+      size -= size_read;
+    }
+
+  FREE_MEM (buf);
+  return 0;
+}
+
+/*
+ * ux_lob_write_stream () - write the bytes that follow the request to a LOB
+ *   return: error code; CAS_ER_COMMUNICATION if the connection has to be closed
+ *   sock_fd(in):
+ *   lob_dbval(in):
+ *   offset(in): where to write in the LOB
+ *   length(in): bytes that follow the request
+ *   net_buf(out): the reply has the number of bytes written
+ *
+ *   Note: the driver sends all the bytes without waiting for a reply. They are read in windows of
+ *	   NET_STREAM_WINDOW_SIZE; after a failed write the rest is read and dropped, so the next request is found.
+ */
+int
+ux_lob_write_stream (SOCKET sock_fd, DB_VALUE * lob_dbval, INT64 offset, INT64 length, T_NET_BUF * net_buf)
+{
+  DB_BIGINT size_written;
+  INT64 total_written = 0;
+  int err_code = 0, window;
+  char *buf;
+  DB_ELO *elo;
+
+  elo = db_get_elo (lob_dbval);
+  cas_log_debug (ARG_FILE_LINE, "ux_lob_write_stream: locator=%s, size=%lld, type=%u", elo->locator, elo->size,
+		 elo->type);
+
+  buf = (char *) MALLOC ((size_t) MIN (MAX (length, 1), NET_STREAM_WINDOW_SIZE));
+  if (buf == NULL)
+    {
+      ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return CAS_ER_COMMUNICATION;
+    }
+
+  while (length > 0)
+    {
+      window = (int) MIN (length, NET_STREAM_WINDOW_SIZE);
+      if (net_read_stream (sock_fd, buf, window) < 0)
+	{
+	  FREE_MEM (buf);
+	  ERROR_INFO_SET (CAS_ER_COMMUNICATION, CAS_ERROR_INDICATOR);
+	  NET_BUF_ERR_SET (net_buf);
+	  return CAS_ER_COMMUNICATION;
+	}
+      length -= window;
+
+      if (err_code < 0)
+	{
+	  continue;
+	}
+
+      err_code = db_elo_write (elo, offset + total_written, buf, window, &size_written);
+      if (err_code < 0)
+	{
+	  errors_in_transaction++;
+	  err_code = ERROR_INFO_SET (err_code, DBMS_ERROR_INDICATOR);
+	  continue;
+	}
+      total_written += size_written;
+    }
+
+  FREE_MEM (buf);
+  cas_log_debug (ARG_FILE_LINE, "ux_lob_write_stream: result_code=%d written=%lld", err_code, total_written);
+
+  if (err_code < 0)
+    {
+      NET_BUF_ERR_SET (net_buf);
+      return err_code;
+    }
+
+  /* set result: on success, bytes written */
+  net_buf_cp_bigint (net_buf, total_written, NULL);
+
+  return 0;
+}
+
 /* converting a DB_VALUE to a char taking care of nchar strings */
 static const char *
 convert_db_value_to_string (DB_VALUE * value, DB_VALUE * value_string)
@@ -232,6 +232,10 @@ extern void reset_optimization_level_as_saved (void);
 extern int ux_lob_new (int lob_type, T_NET_BUF * net_buf);
 extern int ux_lob_write (DB_VALUE * lob_dbval, int64_t offset, int size, char *data, T_NET_BUF * net_buf);
 extern int ux_lob_read (DB_VALUE * lob_dbval, int64_t offset, int size, T_NET_BUF * net_buf);
+extern int ux_lob_read_stream (DB_VALUE * lob_dbval, int64_t offset, int64_t length, T_NET_BUF * net_buf);
+extern int ux_lob_send_stream (SOCKET sock_fd, T_NET_BUF * net_buf);
+extern int ux_lob_write_stream (SOCKET sock_fd, DB_VALUE * lob_dbval, int64_t offset, int64_t length,
+				T_NET_BUF * net_buf);
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 
 extern int get_tuple_count (T_SRV_HANDLE * srv_handle);
@@ -2721,6 +2721,97 @@ fn_lob_read (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_I
   return FN_KEEP_CONN;
 }
 
+FN_RETURN
+fn_lob_read_stream (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
+{
+  DB_VALUE lob_dbval;
+  INT64 offset, length;
+  int err_code;
+  int elapsed_sec = 0, elapsed_msec = 0;
+  struct timeval lob_new_begin, lob_new_end;
+  DB_ELO *elo_debug;
+
+  if (argc != 3)
+    {
+      ERROR_INFO_SET (CAS_ER_ARGS, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return FN_KEEP_CONN;
+    }
+
+  net_arg_get_lob_value (&lob_dbval, argv[0]);
+  net_arg_get_bigint (&offset, argv[1]);
+  net_arg_get_bigint (&length, argv[2]);
+
+  if (offset < 0 || length < 0)
+    {
+      ERROR_INFO_SET (CAS_ER_ARGS, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      db_value_clear (&lob_dbval);
+      return FN_KEEP_CONN;
+    }
+
+  elo_debug = db_get_elo (&lob_dbval);
+  cas_log_write (0, false, "lob_read_stream lob_type=%d offset=%lld, length=%lld", elo_debug->type, offset, length);
+  gettimeofday (&lob_new_begin, NULL);
+
+  err_code = ux_lob_read_stream (&lob_dbval, offset, length, net_buf);
+
+  gettimeofday (&lob_new_end, NULL);
+  ut_timeval_diff (&lob_new_begin, &lob_new_end, &elapsed_sec, &elapsed_msec);
+
+  cas_log_write (0, false, "lob_read_stream %s%d time %d.%03d%s", err_code < 0 ? "error:" : "",
+		 err_info.err_number, elapsed_sec, elapsed_msec, get_error_log_eids (err_info.err_number));
+
+  db_value_clear (&lob_dbval);
+  return FN_KEEP_CONN;
+}
+
+FN_RETURN
+fn_lob_write_stream (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
+{
+  DB_VALUE lob_dbval;
+  INT64 offset, length;
+  int err_code;
+  int elapsed_sec = 0, elapsed_msec = 0;
+  struct timeval lob_new_begin, lob_new_end;
+  DB_ELO *elo_debug;
+
+  if (argc != 3)
+    {
+      /* the data that follows the request can not be skipped */
+      ERROR_INFO_SET (CAS_ER_ARGS, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return FN_CLOSE_CONN;
+    }
+
+  net_arg_get_lob_value (&lob_dbval, argv[0]);
+  net_arg_get_bigint (&offset, argv[1]);
+  net_arg_get_bigint (&length, argv[2]);
+
+  if (offset < 0 || length < 0)
+    {
+      ERROR_INFO_SET (CAS_ER_ARGS, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      db_value_clear (&lob_dbval);
+      return FN_CLOSE_CONN;
+    }
+
+  elo_debug = db_get_elo (&lob_dbval);
+  cas_log_write (0, false, "lob_write_stream lob_type=%d offset=%lld, length=%lld", elo_debug->type, offset, length);
+  gettimeofday (&lob_new_begin, NULL);
+
+  err_code = ux_lob_write_stream (sock_fd, &lob_dbval, offset, length, net_buf);
+
+  gettimeofday (&lob_new_end, NULL);
+  ut_timeval_diff (&lob_new_begin, &lob_new_end, &elapsed_sec, &elapsed_msec);
+
+  cas_log_write (0, false, "lob_write_stream %s%d time %d.%03d%s", err_code < 0 ? "error:" : "",
+		 err_info.err_number, elapsed_sec, elapsed_msec, get_error_log_eids (err_info.err_number));
+
+  db_value_clear (&lob_dbval);
+  return (err_code == CAS_ER_COMMUNICATION) ? FN_CLOSE_CONN : FN_KEEP_CONN;
+}
+
 FN_RETURN
 fn_deprecated (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 {
@@ -103,6 +103,10 @@ extern FN_RETURN fn_not_supported (SOCKET sock_fd, int argc, void **argv, T_NET_
 extern FN_RETURN fn_lob_new (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info);
 extern FN_RETURN fn_lob_write (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info);
 extern FN_RETURN fn_lob_read (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info);
+extern FN_RETURN fn_lob_read_stream (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf,
+				     T_REQ_INFO * req_info);
+extern FN_RETURN fn_lob_write_stream (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf,
+				      T_REQ_INFO * req_info);
 
 extern FN_RETURN fn_deprecated (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info);
 
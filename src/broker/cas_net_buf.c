@@ -31,7 +31,9 @@
 #if defined(WINDOWS)
 #include <winsock2.h>
 #include <windows.h>
+#include <io.h>
 #else /* WINDOWS */
+#include <unistd.h>
 #include <arpa/inet.h>
 #endif /* WINDOWS */
 
@@ -59,6 +61,10 @@ net_buf_init (T_NET_BUF * net_buf, T_BROKER_VERSION client_version)
   net_buf->err_code = 0;
   net_buf->post_file_size = 0;
   net_buf->post_send_file = NULL;
+  net_buf->post_lob_offset = 0;
+  net_buf->post_lob_size = 0;
+  net_buf->post_lob_fd = -1;
+  net_buf->post_send_lob = NULL;
   net_buf->client_version = client_version;
 }
 
@@ -69,6 +75,14 @@ net_buf_clear (T_NET_BUF * net_buf)
   net_buf->err_code = 0;
   net_buf->post_file_size = 0;
   FREE_MEM (net_buf->post_send_file);
+  net_buf->post_lob_offset = 0;
+  net_buf->post_lob_size = 0;
+  if (net_buf->post_lob_fd >= 0)
+    {
+      close (net_buf->post_lob_fd);
+      net_buf->post_lob_fd = -1;
+    }
+  FREE_MEM (net_buf->post_send_lob);
 }
 
 void
@@ -93,6 +107,30 @@ net_buf_cp_post_send_file (T_NET_BUF * net_buf, int size, char *filename)
   return 0;
 }
 
+int
+net_buf_cp_post_send_lob (T_NET_BUF * net_buf, const char *locator, int fd, int64_t offset, int64_t size)
+{
+  FREE_MEM (net_buf->post_send_lob);
+  ALLOC_COPY_STRLEN (net_buf->post_send_lob, locator);
+  if (net_buf->post_send_lob == NULL)
+    {
+      if (fd >= 0)
+	{
+	  close (fd);
+	}
+      net_buf->err_code = CAS_ER_NO_MORE_MEMORY;
+      return CAS_ER_NO_MORE_MEMORY;
+    }
+  if (net_buf->post_lob_fd >= 0)
+    {
+      close (net_buf->post_lob_fd);
+    }
+  net_buf->post_lob_fd = fd;
+  net_buf->post_lob_offset = offset;
+  net_buf->post_lob_size = size;
+  return 0;
+}
+
 int
 net_buf_cp_byte (T_NET_BUF * net_buf, char ch)
 {
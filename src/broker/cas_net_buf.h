@@ -97,6 +97,10 @@ struct t_net_buf
   int err_code;
   int post_file_size;
   char *post_send_file;
+  int64_t post_lob_offset;
+  int64_t post_lob_size;
+  int post_lob_fd;		/* file of post_send_lob if the CAS can read it, or -1 */
+  char *post_send_lob;		/* locator of a LOB streamed to the client after the reply */
   T_BROKER_VERSION client_version;
 };
 
@@ -107,6 +111,7 @@ extern void net_buf_init (T_NET_BUF * net_buf, T_BROKER_VERSION client_version);
 extern void net_buf_clear (T_NET_BUF * net_buf);
 extern void net_buf_destroy (T_NET_BUF * net_buf);
 extern int net_buf_cp_post_send_file (T_NET_BUF * net_buf, int, char *str);
+extern int net_buf_cp_post_send_lob (T_NET_BUF * net_buf, const char *locator, int fd, int64_t offset, int64_t size);
 extern int net_buf_cp_byte (T_NET_BUF * net_buf, char ch);
 extern int net_buf_cp_str (T_NET_BUF * net_buf, const char *buf, int size);
 extern int net_buf_cp_int (T_NET_BUF * net_buf, int value, int *begin_offset);
@@ -41,6 +41,9 @@
 #include <netinet/in.h>
 #include <sys/un.h>
 #include <poll.h>
+#if defined(LINUX)
+#include <sys/sendfile.h>
+#endif /* LINUX */
 #endif /* WINDOWS */
 
 #include "porting.h"
@@ -61,6 +64,9 @@
 
 static int write_buffer (SOCKET sock_fd, const char *buf, int size);
 static int read_buffer (SOCKET sock_fd, char *buf, int size);
+#if defined(LINUX)
+static int sendfile_buffer (SOCKET sock_fd, int fd, off_t * offset, int size);
+#endif /* LINUX */
 
 static void set_net_timeout_flag (void);
 static void unset_net_timeout_flag (void);
@@ -516,6 +522,67 @@ net_write_from_file (SOCKET sock_fd, int file_size, char *filename)
   return 0;
 }
 
+#if !defined(WINDOWS)
+/*
+ * net_write_from_fd () - send a part of an open file to the client
+ *
+ * return: 0 if success, -1 if the file could not be read or the client written
+ * sock_fd(in):
+ * fd(in): file to send
+ * offset(in): where to start in the file
+ * size(in): bytes to send
+ *
+ * Note: unless the connection uses SSL, the file is sent by the kernel with sendfile and its bytes are never copied
+ *	 to the CAS.
+ */
+int
+net_write_from_fd (SOCKET sock_fd, int fd, int64_t offset, int64_t size)
+{
+  char *read_buf;
+  ssize_t read_len;
+
+#if defined(LINUX)
+  if (!ssl_client)
+    {
+      off_t file_offset = (off_t) offset;
+      int write_len;
+
+      while (size > 0)
+	{
+	  write_len = sendfile_buffer (sock_fd, fd, &file_offset, (int) MIN (size, NET_STREAM_WINDOW_SIZE));
+	  if (write_len <= 0)
+	    {
+	      return -1;
+	    }
+	  size -= write_len;
+	}
+      return 0;
+    }
+#endif /* LINUX */
+
+  read_buf = (char *) MALLOC (NET_STREAM_WINDOW_SIZE);
+  if (read_buf == NULL)
+    {
+      return -1;
+    }
+
+  while (size > 0)
+    {
+      read_len = pread (fd, read_buf, (size_t) MIN (size, NET_STREAM_WINDOW_SIZE), (off_t) offset);
+      if (read_len <= 0 || net_write_stream (sock_fd, read_buf, (int) read_len) < 0)
+	{
+	  FREE_MEM (read_buf);
+	  return -1;
+	}
+      offset += read_len;
+      size -= read_len;
+    }
+
+  FREE_MEM (read_buf);
+  return 0;
+}
+#endif /* !WINDOWS */
+
 void
 net_timeout_set (int timeout_sec)
 {
@@ -675,6 +742,71 @@ retry_poll:
   return write_len;
 }
 
+#if defined(LINUX)
+static int
+sendfile_buffer (SOCKET sock_fd, int fd, off_t * offset, int size)
+{
+  ssize_t write_len = -1;
+#ifdef ASYNC_MODE
+  struct pollfd po[1] = { {0, 0, 0} };
+  int timeout, n;
+
+  timeout = net_timeout < 0 ? -1 : net_timeout * 1000;
+#endif /* ASYNC_MODE */
+
+  if (net_error_flag || IS_INVALID_SOCKET (sock_fd))
+    {
+      return -1;
+    }
+
+#ifdef ASYNC_MODE
+  po[0].fd = sock_fd;
+  po[0].events = POLLOUT;
+
+retry_poll:
+  n = poll (po, 1, timeout);
+  if (n < 0)
+    {
+      if (errno == EINTR)
+	{
+	  goto retry_poll;
+	}
+      else
+	{
+	  net_error_flag = 1;
+	  return -1;
+	}
+    }
+  else if (n == 0)
+    {
+      /* TIMEOUT */
+      net_error_flag = 1;
+      return -1;
+    }
+  else
+    {
+      if (po[0].revents & POLLERR || po[0].revents & POLLHUP)
+	{
+	  write_len = -1;
+	}
+      else if (po[0].revents & POLLOUT)
+	{
+#endif /* ASYNC_MODE */
+	  write_len = sendfile (sock_fd, fd, offset, size);
+#if defined(ASYNC_MODE)
+	}
+    }
+#endif /* ASYNC_MODE */
+
+  if (write_len <= 0)
+    {
+      /* a file shorter than expected also ends the stream */
+      net_error_flag = 1;
+    }
+  return (int) write_len;
+}
+#endif /* LINUX */
+
 #if defined(WINDOWS)
 static int
 get_host_ip (unsigned char *ip_addr)
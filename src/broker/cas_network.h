@@ -34,6 +34,9 @@
 #define NET_DEFAULT_TIMEOUT	60
 #define MYSQL_CONNECT_TIMEOUT	(5*60*60)	/* 5 hour. MySQL timeout = 8 hour */
 
+/* bytes sent or received at once when a LOB is streamed */
+#define NET_STREAM_WINDOW_SIZE	(1024 * 1024)
+
 #ifndef MIN
 #define MIN(X, Y)	((X) < (Y) ? (X) : (Y))
 #endif
@@ -287,6 +290,9 @@ extern int net_decode_str (char *msg, int msg_size, char *func_code, void ***ret
 
 extern int net_read_to_file (SOCKET sock_fd, int file_size, char *filename);
 extern int net_write_from_file (SOCKET sock_fd, int file_size, char *filename);
+#if !defined(WINDOWS)
+extern int net_write_from_fd (SOCKET sock_fd, int fd, int64_t offset, int64_t size);
+#endif /* !WINDOWS */
 
 extern void net_timeout_set (int timeout_sec);
 extern void init_msg_header (MSG_HEADER * header);
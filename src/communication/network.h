@@ -271,6 +271,9 @@ enum net_server_request
   NET_SERVER_FLASHBACK_GET_SUMMARY,
   NET_SERVER_FLASHBACK_GET_LOGINFO,
 
+  NET_SERVER_ASH_DUMP,
+  NET_SERVER_STMTSTAT_RESET,
+
   /*
    * This is the last entry. It is also used for the end of an
    * array of statistics information on client/server communication.
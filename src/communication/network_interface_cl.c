@@ -49,6 +49,8 @@
 #include "jsp_sr.h"
 #include "vacuum.h"
 #include "serial.h"
+#include "monitor_active_session_history.hpp"
+#include "monitor_statement_statistics.hpp"
 #endif /* defined (SA_MODE) */
 #include "oid.h"
 #include "error_manager.h"
@@ -9984,6 +9986,73 @@ vacuum_dump (FILE * outfp)
 #endif /* !CS_MODE */
 }
 
+/*
+ * ash_dump -
+ *
+ * return:
+ *
+ *   outfp(in):
+ */
+void
+ash_dump (FILE * outfp)
+{
+#if defined(CS_MODE)
+  if (outfp == NULL)
+    {
+      outfp = stdout;
+    }
+
+  (void) net_client_request_recv_stream (NET_SERVER_ASH_DUMP, NULL, 0, NULL, 0, NULL, 0, outfp);
+#else /* CS_MODE */
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  xash_dump (thread_p, outfp);
+
+  exit_server (*thread_p);
+#endif /* !CS_MODE */
+}
+
+/*
+ * stmtstat_reset - Send a NET_SERVER_STMTSTAT_RESET request to the server
+ *
+ * return: error code
+ *
+ * NOTE: Drop all entries of the statement statistics of the server.
+ * This function is a counter part to sstmtstat_reset().
+ */
+int
+stmtstat_reset (void)
+{
+#if defined(CS_MODE)
+  int status = ER_FAILED;
+  int req_error;
+  char *reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  req_error =
+    net_client_request (NET_SERVER_STMTSTAT_RESET, NULL, 0, reply, OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, NULL, 0);
+  if (!req_error)
+    {
+      (void) or_unpack_int (reply, &status);
+    }
+
+  return status;
+#else /* CS_MODE */
+  int status;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  status = xstmtstat_reset (thread_p);
+
+  exit_server (*thread_p);
+
+  return status;
+#endif /* !CS_MODE */
+}
+
 /*
  * log_get_mvcc_snapshot () - Get MVCC snapshot on server.
  *
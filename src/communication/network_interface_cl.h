@@ -192,6 +192,8 @@ extern "C"
 #endif
   extern void lock_dump (FILE * outfp);
   extern void vacuum_dump (FILE * outfp);
+  extern void ash_dump (FILE * outfp);
+  extern int stmtstat_reset (void);
 #ifdef __cplusplus
 }
 #endif
@@ -736,6 +736,13 @@ net_server_init (void)
 
   req_p = &net_Requests[NET_SERVER_FLASHBACK_GET_LOGINFO];
   req_p->processing_function = sflashback_get_loginfo;
+
+  req_p = &net_Requests[NET_SERVER_ASH_DUMP];
+  req_p->processing_function = sash_dump;
+
+  req_p = &net_Requests[NET_SERVER_STMTSTAT_RESET];
+  req_p->action_attribute = CHECK_AUTHORIZATION;
+  req_p->processing_function = sstmtstat_reset;
 }
 
 /*
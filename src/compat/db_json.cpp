@@ -74,6 +74,22 @@
 
 #define TODO_OPTIMIZE_JSON_BODY_STRING true
 
+/* flag set on the serialized type of arrays and objects that are followed by a member offset table */
+#define DB_JSON_SERIALIZED_INDEXED 0x100
+
+/*
+ * db_json_serialize_indexed () - true if arrays and objects are written with their offset tables
+ *
+ * Releases older than the indexed layout reject DB_JSON_SERIALIZED_INDEXED containers. json_serialize_indexed is
+ * turned off as long as the data may still be read by such a release (an HA replica not upgraded yet, a backup that
+ * is restored on it); both layouts are always readable.
+ */
+static bool
+db_json_serialize_indexed ()
+{
+  return prm_get_bool_value (PRM_ID_JSON_SERIALIZE_INDEXED);
+}
+
 
 #if TODO_OPTIMIZE_JSON_BODY_STRING
 struct JSON_RAW_STRING_DELETER
@@ -472,6 +488,7 @@ class JSON_SERIALIZER_LENGTH : public JSON_BASE_HANDLER
   public:
     JSON_SERIALIZER_LENGTH ()
       : m_length (0)
+      , m_is_indexed (db_json_serialize_indexed ())
     {
       //
     }
@@ -509,6 +526,7 @@ class JSON_SERIALIZER_LENGTH : public JSON_BASE_HANDLER
 
   private:
     std::size_t m_length;
+    bool m_is_indexed;
 };
 
 class JSON_SERIALIZER : public JSON_BASE_HANDLER
@@ -517,7 +535,8 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
     explicit JSON_SERIALIZER (OR_BUF &buffer)
       : m_error (NO_ERROR)
       , m_buffer (&buffer)
-      , m_size_pointers ()
+      , m_containers ()
+      , m_is_indexed (db_json_serialize_indexed ())
     {
       //
     }
@@ -539,10 +558,18 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
     bool EndArray (SizeType elementCount) override;
 
   private:
-    bool SaveSizePointers (char *ptr);
-    void SetSizePointers (SizeType size);
+    struct container_context
+    {
+      char *m_start;                        // position of the container type
+      bool m_is_array;
+      std::vector<int> m_offsets;           // offsets of members (keys) or elements, relative to m_start
+    };
 
-    bool PackType (const DB_JSON_TYPE &type);
+    bool StartContainer (const DB_JSON_TYPE &type);
+    bool EndContainer (SizeType size);
+    void SaveMemberOffset ();
+
+    bool PackType (const DB_JSON_TYPE &type, int flags = 0);
     bool PackString (const char *str);
 
     bool HasError ()
@@ -550,10 +577,11 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
       return m_error != NO_ERROR;
     }
 
-    int m_error;                            // internal error code
-    OR_BUF *m_buffer;                       // buffer to serialize to
-    std::stack<char *> m_size_pointers;     // stack used by nested arrays & objects to save starting pointer.
-    // member/element count is saved at the end
+    int m_error;                                    // internal error code
+    OR_BUF *m_buffer;                               // buffer to serialize to
+    std::stack<container_context> m_containers;     // stack used by nested arrays & objects.
+    // member/element count and offset table position are saved at the end
+    bool m_is_indexed;                              // write offset tables after arrays and objects
 };
 
 /*
@@ -679,10 +707,17 @@ static int db_json_unpack_string_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_
 static int db_json_unpack_int_to_value (OR_BUF *buf, JSON_VALUE &value);
 static int db_json_unpack_bigint_to_value (OR_BUF *buf, JSON_VALUE &value);
 static int db_json_unpack_bool_to_value (OR_BUF *buf, JSON_VALUE &value);
-static int db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator);
-static int db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator);
+static int db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator,
+    bool is_indexed);
+static int db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator,
+    bool is_indexed);
+static int db_json_serialized_get_type (OR_BUF *buf, DB_JSON_TYPE &type, bool &is_indexed);
+static int db_json_serialized_skip_string (OR_BUF *buf);
+static int db_json_serialized_read_container_header (OR_BUF *buf, bool is_indexed, int &count, char *&offset_table);
 
 static void db_json_add_element_to_array (JSON_DOC *doc, const JSON_VALUE *value);
+static int db_json_extract_document_from_serialized (const JSON_DOC &document,
+    const std::vector<JSON_PATH> &json_paths, JSON_DOC_STORE &result);
 
 int
 JSON_DUPLICATE_KEYS_CHECKER::CallBefore (const JSON_VALUE &value)
@@ -1045,6 +1080,9 @@ db_json_get_json_type_as_str (const DB_JSON_TYPE &json_type)
 unsigned int
 db_json_get_length (const JSON_DOC *document)
 {
+  // the document is read through its tree; build it if only the serialized image was kept
+  (void) document->Materialize ();
+
   if (!document->IsArray () && !document->IsObject ())
     {
       return 1;
@@ -1078,6 +1116,7 @@ db_json_get_length (const JSON_DOC *document)
 unsigned int
 db_json_get_depth (const JSON_DOC *doc)
 {
+  (void) doc->Materialize ();
   return db_json_value_get_depth (doc);
 }
 
@@ -1091,6 +1130,8 @@ db_json_unquote (const JSON_DOC &doc, char *&result_str)
 {
   assert (result_str == nullptr);
 
+  (void) doc.Materialize ();
+
   if (!doc.IsString ())
     {
       result_str = db_json_get_raw_json_body_from_document (&doc);
@@ -1156,6 +1197,80 @@ db_json_extract_document_from_path (const JSON_DOC *document, const std::string
   return db_json_extract_document_from_path (document, std::vector<std::string> { path }, result, allow_wildcards);
 }
 
+/*
+ * db_json_extract_document_from_serialized () - Extracts values from a document that is still in serialized form
+ *
+ * return          : error code
+ * document (in)   : serialized document
+ * json_paths (in) : paths without wildcards
+ * result (out)    : resulting doc; a json array if there are multiple paths
+ *
+ * Only the extracted values are deserialized. The result is the same as db_json_extract_document_from_path would
+ * produce on the materialized document.
+ */
+static int
+db_json_extract_document_from_serialized (const JSON_DOC &document, const std::vector<JSON_PATH> &json_paths,
+    JSON_DOC_STORE &result)
+{
+  const std::vector<char> &serialized = document.GetSerialized ();
+  int error_code = NO_ERROR;
+
+  for (const JSON_PATH &path : json_paths)
+    {
+      OR_BUF buf;
+      bool found = false;
+
+      or_init (&buf, const_cast<char *> (serialized.data ()), (int) serialized.size ());
+      error_code = path.seek_serialized (buf, found);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+      if (!found)
+	{
+	  continue;
+	}
+
+      if (json_paths.size () > 1)
+	{
+	  if (!result.is_mutable ())
+	    {
+	      result.create_mutable_reference ();
+	      result.get_mutable ()->SetArray ();
+	    }
+
+	  JSON_DOC *result_doc = result.get_mutable ();
+	  JSON_VALUE value;
+	  error_code = db_json_deserialize_doc_internal (&buf, value, result_doc->GetAllocator ());
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	  result_doc->PushBack (value, result_doc->GetAllocator ());
+	}
+      else
+	{
+	  if (!result.is_mutable ())
+	    {
+	      result.create_mutable_reference ();
+	    }
+
+	  JSON_DOC *result_doc = result.get_mutable ();
+	  error_code = db_json_deserialize_doc_internal (&buf, db_json_doc_to_value (*result_doc),
+			 result_doc->GetAllocator ());
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * db_json_extract_document_from_path () - Extracts from within the json a value based on the given path
  *
@@ -1183,6 +1298,7 @@ db_json_extract_document_from_path (const JSON_DOC *document, const std::vector<
     }
 
   std::vector<JSON_PATH> json_paths;
+  bool has_wildcard = false;
 
   for (const std::string &path : paths)
     {
@@ -1194,10 +1310,14 @@ db_json_extract_document_from_path (const JSON_DOC *document, const std::vector<
 	  return error_code;
 	}
 
-      if (!allow_wildcards && json_paths.back ().contains_wildcard ())
+      if (json_paths.back ().contains_wildcard ())
 	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_JSON_INVALID_PATH, 0);
-	  return ER_JSON_INVALID_PATH;
+	  if (!allow_wildcards)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_JSON_INVALID_PATH, 0);
+	      return ER_JSON_INVALID_PATH;
+	    }
+	  has_wildcard = true;
 	}
     }
 
@@ -1212,6 +1332,12 @@ db_json_extract_document_from_path (const JSON_DOC *document, const std::vector<
       array_result = json_paths[0].contains_wildcard ();
     }
 
+  if (document->IsSerialized () && !has_wildcard)
+    {
+      // jump straight to the values in the serialized image, the document is never built
+      return db_json_extract_document_from_serialized (*document, json_paths, result);
+    }
+
   std::vector<std::vector<const JSON_VALUE *>> produced_array (json_paths.size ());
   for (size_t i = 0; i < json_paths.size (); ++i)
     {
@@ -1361,6 +1487,7 @@ db_json_get_raw_json_body_from_document (const JSON_DOC *doc)
 
   buffer.Clear ();
 
+  (void) doc->Materialize ();
   doc->Accept (json_default_writer);
 
   return db_private_strdup (NULL, buffer.GetString ());
@@ -1387,6 +1514,7 @@ db_json_add_json_value_to_object (JSON_DOC &doc, const char *name, JSON_VALUE &v
 {
   JSON_VALUE key;
 
+  (void) doc.Materialize ();
   if (!doc.IsObject ())
     {
       doc.SetObject ();
@@ -1466,6 +1594,7 @@ db_json_add_element_to_array (JSON_DOC *doc, char *value)
 {
   JSON_VALUE v;
 
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1483,6 +1612,7 @@ db_json_add_element_to_array (JSON_DOC *doc, char *value)
 void
 db_json_add_element_to_array (JSON_DOC *doc, int value)
 {
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1494,6 +1624,7 @@ db_json_add_element_to_array (JSON_DOC *doc, int value)
 void
 db_json_add_element_to_array (JSON_DOC *doc, std::int64_t value)
 {
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1505,6 +1636,7 @@ db_json_add_element_to_array (JSON_DOC *doc, std::int64_t value)
 void
 db_json_add_element_to_array (JSON_DOC *doc, double value)
 {
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1518,6 +1650,8 @@ db_json_add_element_to_array (JSON_DOC *doc, const JSON_DOC *value)
 {
   JSON_VALUE new_doc;
 
+  db_json_materialize_document (value);
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1539,6 +1673,7 @@ db_json_add_element_to_array (JSON_DOC *doc, const JSON_VALUE *value)
 {
   JSON_VALUE new_doc;
 
+  (void) doc->Materialize ();
   if (!doc->IsArray ())
     {
       doc->SetArray ();
@@ -1628,6 +1763,14 @@ db_json_get_copy_of_doc (const JSON_DOC *doc)
 {
   JSON_DOC *new_doc = db_json_allocate_doc ();
 
+  if (doc->IsSerialized ())
+    {
+      // keep the copy lazy too
+      const std::vector<char> &serialized = doc->GetSerialized ();
+      new_doc->SetSerialized (serialized.data (), serialized.size ());
+      return new_doc;
+    }
+
   new_doc->CopyFrom (*doc, new_doc->GetAllocator ());
 
 #if TODO_OPTIMIZE_JSON_BODY_STRING
@@ -2518,48 +2661,56 @@ db_json_merge_preserve_func (const JSON_DOC *source, JSON_DOC *&dest)
 DB_JSON_TYPE
 db_json_get_type (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_type_of_value (doc);
 }
 
 int
 db_json_get_int_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_int_from_value (doc);
 }
 
 std::int64_t
 db_json_get_bigint_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_bigint_from_value (doc);
 }
 
 double
 db_json_get_double_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_double_from_value (doc);
 }
 
 const char *
 db_json_get_string_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_string_from_value (doc);
 }
 
 char *
 db_json_get_bool_as_str_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_bool_as_str_from_value (doc);
 }
 
 bool
 db_json_get_bool_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_get_bool_from_value (doc);
 }
 
 char *
 db_json_copy_string_from_document (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_copy_string_from_value (doc);
 }
 
@@ -2884,6 +3035,7 @@ db_json_pretty_func (const JSON_DOC &doc, char *&result_str)
 
   JSON_PRETTY_WRITER json_pretty_writer;
 
+  (void) doc.Materialize ();
   doc.Accept (json_pretty_writer);
 
   result_str = db_private_strdup (NULL, json_pretty_writer.ToString ().c_str ());
@@ -2975,6 +3127,8 @@ db_json_value_has_numeric_type (const JSON_VALUE *doc)
 int
 db_json_value_is_contained_in_doc (const JSON_DOC *doc, const JSON_DOC *value, bool &result)
 {
+  db_json_materialize_document (doc);
+  db_json_materialize_document (value);
   return db_json_value_is_contained_in_doc_helper (doc, value, result);
 }
 
@@ -3097,24 +3251,28 @@ db_json_value_is_contained_in_doc_helper (const JSON_VALUE *doc, const JSON_VALU
 void
 db_json_set_string_to_doc (JSON_DOC *doc, const char *str, unsigned len)
 {
+  doc->ResetSerialized ();
   doc->SetString (str, len, doc->GetAllocator ());
 }
 
 void
 db_json_set_double_to_doc (JSON_DOC *doc, double d)
 {
+  doc->ResetSerialized ();
   doc->SetDouble (d);
 }
 
 void
 db_json_set_int_to_doc (JSON_DOC *doc, int i)
 {
+  doc->ResetSerialized ();
   doc->SetInt (i);
 }
 
 void
 db_json_set_bigint_to_doc (JSON_DOC *doc, std::int64_t i)
 {
+  doc->ResetSerialized ();
   doc->SetInt64 (i);
 }
 
@@ -3125,6 +3283,8 @@ db_json_are_docs_equal (const JSON_DOC *doc1, const JSON_DOC *doc2)
     {
       return false;
     }
+  (void) doc1->Materialize ();
+  (void) doc2->Materialize ();
   return *doc1 == *doc2;
 }
 
@@ -3133,6 +3293,7 @@ db_json_make_document_null (JSON_DOC *doc)
 {
   if (doc != NULL)
     {
+      doc->ResetSerialized ();
       doc->SetNull ();
     }
 }
@@ -3140,6 +3301,7 @@ db_json_make_document_null (JSON_DOC *doc)
 bool
 db_json_doc_has_numeric_type (const JSON_DOC *doc)
 {
+  db_json_materialize_document (doc);
   return db_json_value_has_numeric_type (doc);
 }
 
@@ -3178,9 +3340,11 @@ db_value_to_json_path (const DB_VALUE &path_value, FUNC_CODE fcode, std::string
  * db_val(in)     : input db_value
  * force_copy(in) : whether json_doc needs to own the json_doc
  * json_doc(out)  : output JSON_DOC pointer
+ * allow_serialized(in) : true if the caller only reads json_doc through db_json_extract_document_from_path and a
+ *                        document read from disk can be kept in its serialized form
  */
 int
-db_value_to_json_doc (const DB_VALUE &db_val, bool force_copy, JSON_DOC_STORE &json_doc)
+db_value_to_json_doc (const DB_VALUE &db_val, bool force_copy, JSON_DOC_STORE &json_doc, bool allow_serialized)
 {
   int error_code = NO_ERROR;
 
@@ -3219,6 +3383,15 @@ db_value_to_json_doc (const DB_VALUE &db_val, bool force_copy, JSON_DOC_STORE &j
     }
 
     case DB_TYPE_JSON:
+      if (!allow_serialized && db_val.data.json.document != NULL)
+	{
+	  error_code = db_val.data.json.document->Materialize ();
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
       if (force_copy)
 	{
 	  json_doc.set_mutable_reference (db_json_get_copy_of_doc (db_val.data.json.document));
@@ -3430,34 +3603,94 @@ JSON_WALKER::WalkValue (const JSON_VALUE &value)
   return NO_ERROR;
 }
 
+/*
+ * Arrays and objects are serialized as:
+ *
+ *   TYPE | DB_JSON_SERIALIZED_INDEXED, COUNT, TABLE_OFFSET, member_1 ... member_n, offset_1 ... offset_n
+ *
+ * offset_i points (relative to the container type) to the i-th element of an array or to the key of the i-th member
+ * of an object, and TABLE_OFFSET points to offset_1. A reader can therefore jump to any member and skip the whole
+ * container without decoding it. Containers without DB_JSON_SERIALIZED_INDEXED (written by older versions, or
+ * with json_serialize_indexed turned off) have only TYPE and COUNT before their members.
+ */
 bool
-JSON_SERIALIZER::SaveSizePointers (char *ptr)
+JSON_SERIALIZER::StartContainer (const DB_JSON_TYPE &type)
 {
-  // save the current pointer
-  m_size_pointers.push (ptr);
+  if (!PackType (type, m_is_indexed ? DB_JSON_SERIALIZED_INDEXED : 0))
+    {
+      return false;
+    }
 
-  // skip the size
+  // save the container start, because we need to come back to overwrite the count and table offset
+  // we will know them in EndObject/EndArray
+  m_containers.push ({ m_buffer->ptr - OR_INT_SIZE, type == DB_JSON_ARRAY, {} });
+
+  // skip the count and the table offset
   m_error = or_put_int (m_buffer, 0);
+  if (m_error == NO_ERROR && m_is_indexed)
+    {
+      m_error = or_put_int (m_buffer, 0);
+    }
 
   return !HasError ();
 }
 
-void
-JSON_SERIALIZER::SetSizePointers (SizeType size)
+bool
+JSON_SERIALIZER::EndContainer (SizeType size)
 {
-  char *buf = m_size_pointers.top ();
-  m_size_pointers.pop ();
+  container_context &container = m_containers.top ();
+
+  assert (container.m_start >= m_buffer->buffer && container.m_start < m_buffer->ptr);
+
+  if (!m_is_indexed)
+    {
+      or_pack_int (container.m_start + OR_INT_SIZE, (int) size);
+      m_containers.pop ();
+      return true;
+    }
 
-  assert (buf >= m_buffer->buffer && buf < m_buffer->ptr);
+  assert (container.m_offsets.size () == size);
 
-  // overwrite that pointer with the correct size
-  or_pack_int (buf, (int) size);
+  int table_offset = (int) (m_buffer->ptr - container.m_start);
+  for (int offset : container.m_offsets)
+    {
+      m_error = or_put_int (m_buffer, offset);
+      if (HasError ())
+	{
+	  return false;
+	}
+    }
+
+  // overwrite the count and the table offset
+  or_pack_int (container.m_start + OR_INT_SIZE, (int) size);
+  or_pack_int (container.m_start + OR_INT_SIZE + OR_INT_SIZE, table_offset);
+
+  m_containers.pop ();
+  return true;
+}
+
+void
+JSON_SERIALIZER::SaveMemberOffset ()
+{
+  if (!m_is_indexed)
+    {
+      return;
+    }
+
+  container_context &container = m_containers.top ();
+  container.m_offsets.push_back ((int) (m_buffer->ptr - container.m_start));
 }
 
 bool
-JSON_SERIALIZER::PackType (const DB_JSON_TYPE &type)
+JSON_SERIALIZER::PackType (const DB_JSON_TYPE &type, int flags)
 {
-  m_error = or_put_int (m_buffer, static_cast<int> (type));
+  if (!m_containers.empty () && m_containers.top ().m_is_array)
+    {
+      // every value packed directly inside an array is an element
+      SaveMemberOffset ();
+    }
+
+  m_error = or_put_int (m_buffer, static_cast<int> (type) | flags);
   return !HasError ();
 }
 
@@ -3637,77 +3870,72 @@ JSON_SERIALIZER_LENGTH::Key (const Ch *str, SizeType length, bool copy)
 bool
 JSON_SERIALIZER::Key (const Ch *str, SizeType length, bool copy)
 {
+  SaveMemberOffset ();
   return PackString (str);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::StartObject ()
 {
+  // type, member count and offset table position
   m_length += GetTypePackedSize ();
-  m_length += OR_INT_SIZE;
+  m_length += m_is_indexed ? OR_INT_SIZE + OR_INT_SIZE : OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::StartObject ()
 {
-  if (!PackType (DB_JSON_OBJECT))
-    {
-      return false;
-    }
-
-  // add pointer to stack, because we need to come back to overwrite this pointer with the correct size
-  // we will know that in EndObject function
-  return SaveSizePointers (m_buffer->ptr);
+  return StartContainer (DB_JSON_OBJECT);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::StartArray ()
 {
+  // type, element count and offset table position
   m_length += GetTypePackedSize ();
-  m_length += OR_INT_SIZE;
+  m_length += m_is_indexed ? OR_INT_SIZE + OR_INT_SIZE : OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::StartArray ()
 {
-  if (!PackType (DB_JSON_ARRAY))
-    {
-      return false;
-    }
-
-  // add pointer to stack, because we need to come back to overwrite this pointer with the correct size
-  // we will know that in EndObject function
-  return SaveSizePointers (m_buffer->ptr);
+  return StartContainer (DB_JSON_ARRAY);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::EndObject (SizeType memberCount)
 {
+  // offset table
+  if (m_is_indexed)
+    {
+      m_length += memberCount * OR_INT_SIZE;
+    }
   return true;
 }
 
 bool
 JSON_SERIALIZER::EndObject (SizeType memberCount)
 {
-  // overwrite the count
-  SetSizePointers (memberCount);
-  return true;
+  return EndContainer (memberCount);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::EndArray (SizeType elementCount)
 {
+  // offset table
+  if (m_is_indexed)
+    {
+      m_length += elementCount * OR_INT_SIZE;
+    }
   return true;
 }
 
 bool
 JSON_SERIALIZER::EndArray (SizeType elementCount)
 {
-  // overwrite the count
-  SetSizePointers (elementCount);
-  return true;
+  return EndContainer (elementCount);
 }
 
 void
@@ -3933,6 +4161,20 @@ db_json_serialize (const JSON_DOC &doc, or_buf &buffer)
   JSON_SERIALIZER js (buffer);
   int error_code = NO_ERROR;
 
+  if (doc.IsSerialized () && db_json_serialize_indexed ())
+    {
+      // the document was never materialized; its image is already in the serialized format
+      const std::vector<char> &serialized = doc.GetSerialized ();
+      if (or_put_data (&buffer, serialized.data (), (int) serialized.size ()) != NO_ERROR)
+	{
+	  error_code = ER_TF_BUFFER_OVERFLOW;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+	}
+      return error_code;
+    }
+
+  // an image read with the indexed layout may not be written back when the layout is turned off
+  (void) doc.Materialize ();
   if (!doc.Accept (js))
     {
       error_code = ER_TF_BUFFER_OVERFLOW;
@@ -3947,6 +4189,12 @@ db_json_serialize_length (const JSON_DOC &doc)
 {
   JSON_SERIALIZER_LENGTH jsl;
 
+  if (doc.IsSerialized () && db_json_serialize_indexed ())
+    {
+      return doc.GetSerialized ().size ();
+    }
+
+  (void) doc.Materialize ();
   doc.Accept (jsl);
 
   return jsl.GetLength ();
@@ -4108,18 +4356,19 @@ db_json_unpack_bool_to_value (OR_BUF *buf, JSON_VALUE &value)
 }
 
 static int
-db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator)
+db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator, bool is_indexed)
 {
   int rc = NO_ERROR;
   int size;
+  char *offset_table = NULL;
 
   value.SetObject ();
 
   // get the member count of the object
-  size = or_get_int (buf, &rc);
+  rc = db_json_serialized_read_container_header (buf, is_indexed, size, offset_table);
   if (rc != NO_ERROR)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      ASSERT_ERROR ();
       return rc;
     }
 
@@ -4147,22 +4396,29 @@ db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEM
       value.AddMember (key, child, doc_allocator);
     }
 
+  if (is_indexed)
+    {
+      // members are decoded sequentially, the offset table is not needed
+      buf->ptr = offset_table + size * OR_INT_SIZE;
+    }
+
   return NO_ERROR;
 }
 
 static int
-db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator)
+db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator, bool is_indexed)
 {
   int rc = NO_ERROR;
   int size;
+  char *offset_table = NULL;
 
   value.SetArray ();
 
   // get the member count of the array
-  size = or_get_int (buf, &rc);
+  rc = db_json_serialized_read_container_header (buf, is_indexed, size, offset_table);
   if (rc != NO_ERROR)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      ASSERT_ERROR ();
       return rc;
     }
 
@@ -4182,6 +4438,12 @@ db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMP
       value.PushBack (child, doc_allocator);
     }
 
+  if (is_indexed)
+    {
+      // elements are decoded sequentially, the offset table is not needed
+      buf->ptr = offset_table + size * OR_INT_SIZE;
+    }
+
   return NO_ERROR;
 }
 
@@ -4197,10 +4459,11 @@ static int
 db_json_deserialize_doc_internal (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator)
 {
   DB_JSON_TYPE json_type;
+  bool is_indexed;
   int rc = NO_ERROR;
 
   // get the json scalar value
-  json_type = static_cast<DB_JSON_TYPE> (or_get_int (buf, &rc));
+  rc = db_json_serialized_get_type (buf, json_type, is_indexed);
   if (rc != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -4234,11 +4497,11 @@ db_json_deserialize_doc_internal (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_M
       break;
 
     case DB_JSON_OBJECT:
-      rc = db_json_unpack_object_to_value (buf, value, doc_allocator);
+      rc = db_json_unpack_object_to_value (buf, value, doc_allocator, is_indexed);
       break;
 
     case DB_JSON_ARRAY:
-      rc = db_json_unpack_array_to_value (buf, value, doc_allocator);
+      rc = db_json_unpack_array_to_value (buf, value, doc_allocator, is_indexed);
       break;
 
     default:
@@ -4281,3 +4544,426 @@ db_json_deserialize (OR_BUF *buf, JSON_DOC *&doc)
 
   return error_code;
 }
+
+/*
+ * db_json_deserialize_lazy () - read a json document from a buffer without building it
+ *
+ * return        : error code
+ * buf (in)      : buffer of the json serialized
+ * doc (out)     : json document
+ *
+ * Arrays and objects keep their serialized image (see JSON_DOC::IsSerialized); scalars are deserialized right away.
+ */
+int
+db_json_deserialize_lazy (OR_BUF *buf, JSON_DOC *&doc)
+{
+  char *start = buf->ptr;
+  DB_JSON_TYPE json_type;
+  bool is_indexed;
+  int error_code = NO_ERROR;
+
+  error_code = db_json_serialized_get_type (buf, json_type, is_indexed);
+  buf->ptr = start;
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  if (json_type != DB_JSON_OBJECT && json_type != DB_JSON_ARRAY)
+    {
+      return db_json_deserialize (buf, doc);
+    }
+
+  error_code = db_json_serialized_skip_value (buf);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  doc = db_json_allocate_doc ();
+  doc->SetSerialized (start, buf->ptr - start);
+
+  return NO_ERROR;
+}
+
+/*
+ * Materialize () - build the DOM of a document that only has its serialized image
+ *
+ * return : error code
+ */
+int
+JSON_DOC::Materialize () const
+{
+  if (!IsSerialized ())
+    {
+      return NO_ERROR;
+    }
+
+  std::lock_guard<std::mutex> lock (m_materialize_mutex);
+  if (!IsSerialized ())
+    {
+      // materialized by another reader while we were waiting
+      return NO_ERROR;
+    }
+
+  JSON_DOC &self = const_cast<JSON_DOC &> (*this);
+  OR_BUF buf;
+  int error_code = NO_ERROR;
+
+  // the DOM is built before the flag is cleared, so readers that see the document as materialized also see its tree
+  or_init (&buf, const_cast<char *> (m_serialized.data ()), (int) m_serialized.size ());
+  error_code = db_json_deserialize_doc_internal (&buf, reinterpret_cast<JSON_VALUE &> (self), self.GetAllocator ());
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      self.SetNull ();
+    }
+  m_is_serialized.store (false, std::memory_order_release);
+
+  return error_code;
+}
+
+void
+db_json_materialize_document (const JSON_DOC *doc)
+{
+  if (doc != NULL)
+    {
+      (void) doc->Materialize ();
+    }
+}
+
+static int
+db_json_serialized_get_type (OR_BUF *buf, DB_JSON_TYPE &type, bool &is_indexed)
+{
+  int rc = NO_ERROR;
+  int packed_type;
+
+  packed_type = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  is_indexed = (packed_type & DB_JSON_SERIALIZED_INDEXED) != 0;
+  type = static_cast<DB_JSON_TYPE> (packed_type & ~DB_JSON_SERIALIZED_INDEXED);
+
+  return NO_ERROR;
+}
+
+/*
+ * db_json_serialized_read_container_header () - read the header of a serialized array or object
+ *
+ * return            : error code
+ * buf (in)          : buffer positioned right after the container type
+ * is_indexed (in)   : true if the container has an offset table
+ * count (out)       : number of elements/members
+ * offset_table (out): start of the offset table, NULL if the container has none
+ */
+static int
+db_json_serialized_read_container_header (OR_BUF *buf, bool is_indexed, int &count, char *&offset_table)
+{
+  char *start = buf->ptr - OR_INT_SIZE;
+  int rc = NO_ERROR;
+
+  offset_table = NULL;
+
+  count = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  if (!is_indexed)
+    {
+      return NO_ERROR;
+    }
+
+  int table_offset = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  offset_table = start + table_offset;
+  if (count < 0 || offset_table < buf->ptr || offset_table + count * OR_INT_SIZE > buf->endptr)
+    {
+      return or_underflow (buf);
+    }
+
+  return NO_ERROR;
+}
+
+static int
+db_json_serialized_skip_string (OR_BUF *buf)
+{
+  int rc = NO_ERROR;
+  int str_length;
+
+  str_length = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  rc = or_advance (buf, str_length);
+  if (rc == NO_ERROR)
+    {
+      rc = or_align (buf, INT_ALIGNMENT);
+    }
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+    }
+
+  return rc;
+}
+
+/*
+ * db_json_serialized_skip_value () - advance the buffer past one serialized value
+ *
+ * return   : error code
+ * buf (in) : buffer positioned on a serialized value
+ *
+ * Containers with an offset table are skipped in constant time.
+ */
+int
+db_json_serialized_skip_value (OR_BUF *buf)
+{
+  DB_JSON_TYPE json_type;
+  bool is_indexed;
+  int count;
+  char *offset_table;
+  int rc = NO_ERROR;
+
+  rc = db_json_serialized_get_type (buf, json_type, is_indexed);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  switch (json_type)
+    {
+    case DB_JSON_NULL:
+      break;
+
+    case DB_JSON_BOOL:
+      rc = or_advance (buf, OR_INT_SIZE);
+      break;
+
+    case DB_JSON_INT:
+      // unsigned flag and value
+      rc = or_advance (buf, OR_INT_SIZE + OR_INT_SIZE);
+      break;
+
+    case DB_JSON_BIGINT:
+      // unsigned flag and value
+      rc = or_advance (buf, OR_INT_SIZE + OR_BIGINT_SIZE);
+      break;
+
+    case DB_JSON_DOUBLE:
+      rc = or_advance (buf, OR_DOUBLE_SIZE);
+      break;
+
+    case DB_JSON_STRING:
+      return db_json_serialized_skip_string (buf);
+
+    case DB_JSON_OBJECT:
+    case DB_JSON_ARRAY:
+      rc = db_json_serialized_read_container_header (buf, is_indexed, count, offset_table);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      if (is_indexed)
+	{
+	  // the offset table closes the container
+	  buf->ptr = offset_table + count * OR_INT_SIZE;
+	  return NO_ERROR;
+	}
+
+      for (int i = 0; i < count; i++)
+	{
+	  if (json_type == DB_JSON_OBJECT)
+	    {
+	      rc = db_json_serialized_skip_string (buf);
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+	    }
+
+	  rc = db_json_serialized_skip_value (buf);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+      break;
+
+    default:
+      /* we shouldn't get here */
+      assert (false);
+      return ER_FAILED;
+    }
+
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+    }
+
+  return rc;
+}
+
+/*
+ * db_json_serialized_find_member () - position the buffer on the value of an object member
+ *
+ * return     : error code
+ * buf (in)   : buffer positioned on a serialized value
+ * key (in)   : member name, encoded like the stored keys
+ * found (out): false if the value is not an object or has no such member
+ */
+int
+db_json_serialized_find_member (OR_BUF *buf, const std::string &key, bool &found)
+{
+  char *start = buf->ptr;
+  DB_JSON_TYPE json_type;
+  bool is_indexed;
+  int count;
+  char *offset_table;
+  int rc = NO_ERROR;
+
+  found = false;
+
+  rc = db_json_serialized_get_type (buf, json_type, is_indexed);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  if (json_type != DB_JSON_OBJECT)
+    {
+      return NO_ERROR;
+    }
+
+  rc = db_json_serialized_read_container_header (buf, is_indexed, count, offset_table);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  // keys are packed with their terminator
+  const int key_length = (int) key.length () + 1;
+
+  for (int i = 0; i < count; i++)
+    {
+      if (is_indexed)
+	{
+	  buf->ptr = start + OR_GET_INT (offset_table + i * OR_INT_SIZE);
+	}
+
+      char *key_start = buf->ptr;
+      int str_length = or_get_int (buf, &rc);
+      if (rc != NO_ERROR)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+	  return rc;
+	}
+
+      // first member with a matching key wins, like JSON_VALUE::FindMember
+      bool is_match = (str_length == key_length && buf->ptr + str_length <= buf->endptr
+		       && memcmp (buf->ptr, key.c_str (), key_length) == 0);
+
+      buf->ptr = key_start;
+      rc = db_json_serialized_skip_string (buf);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      if (is_match)
+	{
+	  found = true;
+	  return NO_ERROR;
+	}
+
+      if (!is_indexed)
+	{
+	  rc = db_json_serialized_skip_value (buf);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * db_json_serialized_find_element () - position the buffer on an array element
+ *
+ * return     : error code
+ * buf (in)   : buffer positioned on a serialized value
+ * index (in) : element index
+ * found (out): false if the value is not an array or the index is out of range
+ */
+int
+db_json_serialized_find_element (OR_BUF *buf, unsigned long index, bool &found)
+{
+  char *start = buf->ptr;
+  DB_JSON_TYPE json_type;
+  bool is_indexed;
+  int count;
+  char *offset_table;
+  int rc = NO_ERROR;
+
+  found = false;
+
+  rc = db_json_serialized_get_type (buf, json_type, is_indexed);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  if (json_type != DB_JSON_ARRAY)
+    {
+      return NO_ERROR;
+    }
+
+  rc = db_json_serialized_read_container_header (buf, is_indexed, count, offset_table);
+  if (rc != NO_ERROR)
+    {
+      return rc;
+    }
+
+  if (index >= (unsigned long) count)
+    {
+      return NO_ERROR;
+    }
+
+  if (is_indexed)
+    {
+      buf->ptr = start + OR_GET_INT (offset_table + index * OR_INT_SIZE);
+    }
+  else
+    {
+      for (unsigned long i = 0; i < index; i++)
+	{
+	  rc = db_json_serialized_skip_value (buf);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+    }
+
+  found = true;
+  return NO_ERROR;
+}
@@ -100,6 +100,7 @@ JSON_DOC *db_json_get_copy_of_doc (const JSON_DOC *doc);
 int db_json_serialize (const JSON_DOC &doc, or_buf &buffer);
 std::size_t db_json_serialize_length (const JSON_DOC &doc);
 int db_json_deserialize (or_buf *buf, JSON_DOC *&doc);
+int db_json_deserialize_lazy (or_buf *buf, JSON_DOC *&doc);
 
 int db_json_insert_func (const JSON_DOC *doc_to_be_inserted, JSON_DOC &doc_destination, const char *raw_path);
 int db_json_replace_func (const JSON_DOC *value, JSON_DOC &doc, const char *raw_path);
@@ -164,7 +165,8 @@ bool db_json_doc_has_numeric_type (const JSON_DOC *doc);
 bool db_json_doc_is_uncomparable (const JSON_DOC *doc);
 
 // DB_VALUE manipulation functions
-int db_value_to_json_doc (const DB_VALUE &db_val, bool copy_json, JSON_DOC_STORE &json_doc);
+int db_value_to_json_doc (const DB_VALUE &db_val, bool copy_json, JSON_DOC_STORE &json_doc,
+			  bool allow_serialized = false);
 int db_value_to_json_value (const DB_VALUE &db_val, JSON_DOC_STORE &json_doc);
 void db_make_json_from_doc_store_and_release (DB_VALUE &value, JSON_DOC_STORE &doc_store);
 int db_value_to_json_path (const DB_VALUE &path_value, FUNC_CODE fcode, std::string &path_str);
@@ -1010,6 +1010,50 @@ JSON_PATH::extract (const JSON_DOC &jd) const
   return res;
 }
 
+/*
+ * seek_serialized () - Walk a serialized document following a path, without deserializing it
+ *
+ * return : error code
+ * buf (in/out) : positioned on the serialized document; on success it points to the found value
+ * found (out)  : false if nothing exists at path
+ *
+ * Equivalent to get () on the materialized document. Wildcards are not supported.
+ */
+int
+JSON_PATH::seek_serialized (or_buf &buf, bool &found) const
+{
+  int error_code = NO_ERROR;
+
+  assert (!contains_wildcard ());
+
+  found = true;
+  for (const PATH_TOKEN &tkn : m_path_tokens)
+    {
+      switch (tkn.m_type)
+	{
+	case PATH_TOKEN::token_type::object_key:
+	{
+	  std::string encoded_key = db_json_json_string_as_utf8 (tkn.get_object_key ());
+	  error_code = db_json_serialized_find_member (&buf, encoded_key, found);
+	  break;
+	}
+	case PATH_TOKEN::token_type::array_index:
+	  error_code = db_json_serialized_find_element (&buf, tkn.get_array_index (), found);
+	  break;
+	default:
+	  found = false;
+	  break;
+	}
+
+      if (error_code != NO_ERROR || !found)
+	{
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
 bool
 JSON_PATH::erase (JSON_DOC &jd) const
 {
@@ -76,6 +76,7 @@ class JSON_PATH
     JSON_VALUE *get (JSON_DOC &jd) const;
     const JSON_VALUE *get (const JSON_DOC &jd) const;
     std::vector<const JSON_VALUE *> extract (const JSON_DOC &) const;
+    int seek_serialized (or_buf &buf, bool &found) const;
 
     void set (JSON_DOC &jd, const JSON_VALUE &jv) const;
     void set (JSON_VALUE &jd, const JSON_VALUE &jv, JSON_PRIVATE_MEMPOOL &allocator) const;
@@ -36,11 +36,14 @@ JSON_DOC::IsLeaf ()
 JSON_VALUE &
 db_json_doc_to_value (JSON_DOC &doc)
 {
+  // the tree is going to be walked; build it if the document was kept serialized
+  (void) doc.Materialize ();
   return reinterpret_cast<JSON_VALUE &> (doc);
 }
 
 const JSON_VALUE &
 db_json_doc_to_value (const JSON_DOC &doc)
 {
+  (void) doc.Materialize ();
   return reinterpret_cast<const JSON_VALUE &> (doc);
 }
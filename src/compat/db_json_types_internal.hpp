@@ -22,11 +22,19 @@
 #include "db_json_allocator.hpp"
 #include "db_rapidjson.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #if defined GetObject
 /* stupid windows and their definitions; GetObject is defined as GetObjectW or GetObjectA */
 #undef GetObject
 #endif /* defined GetObject */
 
+// forward definitions
+struct or_buf;
+
 typedef rapidjson::UTF8<> JSON_ENCODING;
 typedef rapidjson::GenericValue<JSON_ENCODING, JSON_PRIVATE_MEMPOOL> JSON_VALUE;
 
@@ -35,6 +43,39 @@ class JSON_DOC : public rapidjson::GenericDocument <JSON_ENCODING, JSON_PRIVATE_
   public:
     bool IsLeaf ();
 
+    /*
+     * A document read from disk may keep only its serialized image. Read-only path lookups are answered directly
+     * from the image (see JSON_PATH::seek_serialized); any other use must call Materialize () first, which builds
+     * the DOM and marks the image stale so that later modifications never see it.
+     *
+     * A document may be shared by several readers, so Materialize () is serialized by m_materialize_mutex and the
+     * image itself is kept until the document is destroyed: a reader that saw IsSerialized () may still be walking
+     * it while another one materializes the document.
+     */
+    bool IsSerialized () const
+    {
+      return m_is_serialized.load (std::memory_order_acquire);
+    }
+
+    const std::vector<char> &GetSerialized () const
+    {
+      return m_serialized;
+    }
+
+    void SetSerialized (const char *ptr, std::size_t size)
+    {
+      m_serialized.assign (ptr, ptr + size);
+      m_is_serialized.store (true, std::memory_order_release);
+    }
+
+    /* the DOM is about to be overwritten in place; the image does not describe the document anymore */
+    void ResetSerialized ()
+    {
+      m_is_serialized.store (false, std::memory_order_release);
+    }
+
+    int Materialize () const;
+
 #if TODO_OPTIMIZE_JSON_BODY_STRING
     /* TODO:
     In the future, it will be better if instead of constructing the json_body each time we need it,
@@ -59,6 +100,10 @@ class JSON_DOC : public rapidjson::GenericDocument <JSON_ENCODING, JSON_PRIVATE_
 #endif // TODO_OPTIMIZE_JSON_BODY_STRING
   private:
     static const int MAX_CHUNK_SIZE;
+
+    std::vector<char> m_serialized;
+    mutable std::atomic<bool> m_is_serialized { false };
+    mutable std::mutex m_materialize_mutex;
 #if TODO_OPTIMIZE_JSON_BODY_STRING
     /* mutable std::string json_body; */
 #endif // TODO_OPTIMIZE_JSON_BODY_STRING
@@ -67,4 +112,9 @@ class JSON_DOC : public rapidjson::GenericDocument <JSON_ENCODING, JSON_PRIVATE_
 JSON_VALUE &db_json_doc_to_value (JSON_DOC &doc);
 const JSON_VALUE &db_json_doc_to_value (const JSON_DOC &doc);
 
+/* navigation on the serialized form; buf must be positioned on a serialized value */
+int db_json_serialized_skip_value (or_buf *buf);
+int db_json_serialized_find_member (or_buf *buf, const std::string &key, bool &found);
+int db_json_serialized_find_element (or_buf *buf, unsigned long index, bool &found);
+
 #endif // !_DB_JSON_TYPES_INTERNAL_HPP
@@ -5087,7 +5087,7 @@ db_is_json_doc_type (DB_TYPE type)
 char *
 db_get_json_raw_body (const DB_VALUE * value)
 {
-  return db_json_get_json_body_from_document (*value->data.json.document);
+  return db_json_get_json_body_from_document (*db_get_json_document (value));
 }
 
 /*
@@ -23,6 +23,16 @@
 
 #include "dbtype_def.h"
 
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+  /* From db_json.cpp; documents read from disk are built on first access */
+  extern void db_json_materialize_document (const JSON_DOC * doc);
+#ifdef __cplusplus
+}
+#endif
+
 #if !defined (_NO_INLINE_DBTYPE_FUNCTION_)
 #include "porting_inline.hpp"
 
@@ -976,6 +986,8 @@ db_get_json_document (const DB_VALUE * value)
 
   assert (value->domain.general_info.type == DB_TYPE_JSON);
 
+  db_json_materialize_document (value->data.json.document);
+
   return value->data.json.document;
 }
 
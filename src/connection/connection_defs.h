@@ -438,6 +438,7 @@ struct css_conn_entry
 #if defined(SERVER_MODE)
   int idx;			/* connection index */
   BOOT_CLIENT_TYPE client_type;
+  int resource_group_id;	/* resource group of the client; see resource_group.hpp */
   SYNC_RMUTEX rmutex;		/* connection mutex */
 
   bool stop_talk;		/* block and stop this connection */
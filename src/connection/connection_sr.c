@@ -315,6 +315,7 @@ css_initialize_conn (CSS_CONN_ENTRY * conn, SOCKET fd)
 #if defined(SERVER_MODE)
   conn->session_p = NULL;
   conn->client_type = DB_CLIENT_TYPE_UNKNOWN;
+  conn->resource_group_id = 0;
 #endif
 
   err = css_initialize_list (&conn->request_queue, 0);
@@ -67,6 +67,7 @@
 #endif /* !WINDOWS */
 #if defined(SERVER_MODE)
 #include "connection_sr.h"
+#include "thread_manager.hpp"
 #else
 #include "connection_list_cl.h"
 #include "connection_cl.h"
@@ -1017,8 +1018,16 @@ static int
 css_send_io_vector (CSS_CONN_ENTRY * conn, struct iovec *vec_p, ssize_t total_len, int vector_length, int timeout)
 {
   int rc = NO_ERRORS;
+#if defined (SERVER_MODE)
+  THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
+
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_NETWORK);
+#endif
 
   rc = css_send_io_vector_with_socket (conn->fd, vec_p, total_len, vector_length, timeout);
+#if defined (SERVER_MODE)
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_NONE);
+#endif
   if (rc != NO_ERRORS)
     {
       css_shutdown_conn (conn);
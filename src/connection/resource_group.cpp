@@ -0,0 +1,895 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// resource_group.cpp - named groups of clients sharing the request workers, query slots, temp space and page reads
+//
+
+#include "resource_group.hpp"
+
+#include "error_manager.h"
+#include "log_impl.h"
+#include "perf_monitor.h"
+#include "porting.h"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#include "thread_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define RESGRP_MAX_COUNT PERF_RESOURCE_GROUP_MAX_CNT
+#define RESGRP_NAME_MAX_LENGTH 32
+#define RESGRP_DEFAULT_NAME "default"
+
+/* page reads a group may do at once above its rate before readers are delayed */
+#define RESGRP_IO_BURST_USEC 100000
+/* longest delay of one page read */
+#define RESGRP_IO_MAX_DELAY_USEC 1000000
+
+typedef struct resgrp_queued_request RESGRP_QUEUED_REQUEST;
+struct resgrp_queued_request
+{
+  CSS_CONN_ENTRY *conn;
+  double start_tag;		/* virtual time at which the request becomes eligible */
+  INT64 enqueue_usec;
+};
+
+typedef struct resgrp_group RESGRP_GROUP;
+struct resgrp_group
+{
+  char name[RESGRP_NAME_MAX_LENGTH + 1];
+  int weight;			/* share of the request workers, relative to the other groups */
+  int max_queries;		/* 0 for no limit */
+  int max_temp_pages;		/* 0 for no limit */
+  int max_io_pages_per_sec;	/* 0 for no limit */
+
+  /* request scheduling; protected by resgrp_Scheduler.mutex */
+  std::deque<RESGRP_QUEUED_REQUEST> queue;
+  double last_finish_tag;	/* finish tag of the last request admitted from the group */
+
+  /* concurrent queries; protected by query_mutex */
+  std::mutex query_mutex;
+  std::condition_variable query_cv;
+  int running_queries;
+
+  std::atomic<INT64> temp_pages;
+  std::atomic<INT64> io_theoretical_arrival_usec;	/* GCRA state of page reads */
+};
+
+typedef struct resgrp_assignment RESGRP_ASSIGNMENT;
+struct resgrp_assignment
+{
+  std::string key;		/* database user or broker name */
+  int group_id;
+};
+
+typedef struct resgrp_scheduler RESGRP_SCHEDULER;
+struct resgrp_scheduler
+{
+  std::mutex mutex;
+  int worker_count;		/* requests that may run before new ones are queued */
+  int running_count;		/* admitted requests that have not finished */
+  int queued_count;
+  double virtual_time;		/* start tag of the last dispatched request */
+};
+
+static RESGRP_GROUP resgrp_Groups[RESGRP_MAX_COUNT];
+static int resgrp_Count = 0;
+static bool resgrp_Is_enabled = false;
+static std::vector<RESGRP_ASSIGNMENT> resgrp_User_assignments;
+static std::vector<RESGRP_ASSIGNMENT> resgrp_Broker_assignments;
+static RESGRP_SCHEDULER resgrp_Scheduler;
+
+static INT64 resgrp_now_usec (void);
+static void resgrp_init_group (RESGRP_GROUP * group, const char *name);
+static int resgrp_find_group_by_name (const char *name);
+static int resgrp_set_invalid_definition (const char *definition, const char *reason);
+static int resgrp_parse_groups (const char *definition);
+static int resgrp_parse_group_option (const char *definition, RESGRP_GROUP * group, const std::string & option);
+static int resgrp_parse_assignments (const char *definition, std::vector<RESGRP_ASSIGNMENT> &assignments);
+static std::string resgrp_trim (const std::string & str);
+static void resgrp_tag_request (RESGRP_GROUP * group, double *start_tag);
+
+static INT64
+resgrp_now_usec (void)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).
+    count ();
+}
+
+static void
+resgrp_init_group (RESGRP_GROUP * group, const char *name)
+{
+  strncpy (group->name, name, RESGRP_NAME_MAX_LENGTH);
+  group->name[RESGRP_NAME_MAX_LENGTH] = '\0';
+  group->weight = 1;
+  group->max_queries = 0;
+  group->max_temp_pages = 0;
+  group->max_io_pages_per_sec = 0;
+  group->queue.clear ();
+  group->last_finish_tag = 0;
+  group->running_queries = 0;
+  group->temp_pages = 0;
+  group->io_theoretical_arrival_usec = 0;
+}
+
+static int
+resgrp_find_group_by_name (const char *name)
+{
+  int group_id;
+
+  for (group_id = 0; group_id < resgrp_Count; group_id++)
+    {
+      if (strcasecmp (resgrp_Groups[group_id].name, name) == 0)
+	{
+	  return group_id;
+	}
+    }
+
+  return RESGRP_NULL_ID;
+}
+
+static int
+resgrp_set_invalid_definition (const char *definition, const char *reason)
+{
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_RESOURCE_GROUP_INVALID_DEFINITION, 2, definition, reason);
+  return ER_RESOURCE_GROUP_INVALID_DEFINITION;
+}
+
+static std::string
+resgrp_trim (const std::string & str)
+{
+  size_t begin = str.find_first_not_of (" \t");
+  size_t end = str.find_last_not_of (" \t");
+
+  if (begin == std::string::npos)
+    {
+      return std::string ();
+    }
+  return str.substr (begin, end - begin + 1);
+}
+
+/*
+ * resgrp_parse_group_option () - set one "key=value" option of a group
+ *
+ * return          : error code
+ * definition (in) : the whole definition, for the error message
+ * group (in/out)  : group
+ * option (in)     : trimmed option
+ */
+static int
+resgrp_parse_group_option (const char *definition, RESGRP_GROUP * group, const std::string & option)
+{
+  size_t eq_pos = option.find ('=');
+  std::string key, value;
+  char *end_p = NULL;
+  long num;
+
+  if (eq_pos == std::string::npos)
+    {
+      return resgrp_set_invalid_definition (definition, "option is not key=value");
+    }
+  key = resgrp_trim (option.substr (0, eq_pos));
+  value = resgrp_trim (option.substr (eq_pos + 1));
+
+  num = strtol (value.c_str (), &end_p, 10);
+  if (value.empty () || *end_p != '\0' || num < 0 || num > INT_MAX)
+    {
+      return resgrp_set_invalid_definition (definition, "option value is not a number");
+    }
+
+  if (strcasecmp (key.c_str (), "weight") == 0)
+    {
+      if (num < 1 || num > 1000)
+	{
+	  return resgrp_set_invalid_definition (definition, "weight must be between 1 and 1000");
+	}
+      group->weight = (int) num;
+    }
+  else if (strcasecmp (key.c_str (), "max_queries") == 0)
+    {
+      group->max_queries = (int) num;
+    }
+  else if (strcasecmp (key.c_str (), "max_temp_pages") == 0)
+    {
+      group->max_temp_pages = (int) num;
+    }
+  else if (strcasecmp (key.c_str (), "max_io_pages_per_sec") == 0)
+    {
+      group->max_io_pages_per_sec = (int) num;
+    }
+  else
+    {
+      return resgrp_set_invalid_definition (definition, "unknown option");
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * resgrp_parse_groups () - define the groups of resource_groups
+ *
+ * return          : error code
+ * definition (in) : "name[(key=value,...)]; ..."
+ */
+static int
+resgrp_parse_groups (const char *definition)
+{
+  std::string def_str = definition;
+  size_t pos = 0, next_pos, open_pos, close_pos, opt_pos, opt_end;
+  std::string item, name, options;
+  RESGRP_GROUP *group;
+  int group_id, error;
+
+  while (pos <= def_str.size ())
+    {
+      next_pos = def_str.find (';', pos);
+      if (next_pos == std::string::npos)
+	{
+	  next_pos = def_str.size ();
+	}
+      item = resgrp_trim (def_str.substr (pos, next_pos - pos));
+      pos = next_pos + 1;
+      if (item.empty ())
+	{
+	  continue;
+	}
+
+      open_pos = item.find ('(');
+      if (open_pos != std::string::npos)
+	{
+	  close_pos = item.rfind (')');
+	  if (close_pos == std::string::npos || close_pos < open_pos || close_pos != item.size () - 1)
+	    {
+	      return resgrp_set_invalid_definition (definition, "unbalanced parentheses");
+	    }
+	  name = resgrp_trim (item.substr (0, open_pos));
+	  options = item.substr (open_pos + 1, close_pos - open_pos - 1);
+	}
+      else
+	{
+	  name = item;
+	  options.clear ();
+	}
+
+      if (name.empty () || name.size () > RESGRP_NAME_MAX_LENGTH
+	  || name.find_first_of (" \t,:=()") != std::string::npos)
+	{
+	  return resgrp_set_invalid_definition (definition, "invalid group name");
+	}
+
+      group_id = resgrp_find_group_by_name (name.c_str ());
+      if (group_id == RESGRP_DEFAULT_ID)
+	{
+	  /* settings of the default group */
+	  group = &resgrp_Groups[RESGRP_DEFAULT_ID];
+	}
+      else if (group_id != RESGRP_NULL_ID)
+	{
+	  return resgrp_set_invalid_definition (definition, "group is defined twice");
+	}
+      else if (resgrp_Count >= RESGRP_MAX_COUNT)
+	{
+	  return resgrp_set_invalid_definition (definition, "too many groups");
+	}
+      else
+	{
+	  group = &resgrp_Groups[resgrp_Count++];
+	  resgrp_init_group (group, name.c_str ());
+	}
+
+      for (opt_pos = 0; opt_pos <= options.size (); opt_pos = opt_end + 1)
+	{
+	  opt_end = options.find (',', opt_pos);
+	  if (opt_end == std::string::npos)
+	    {
+	      opt_end = options.size ();
+	    }
+	  item = resgrp_trim (options.substr (opt_pos, opt_end - opt_pos));
+	  if (item.empty ())
+	    {
+	      continue;
+	    }
+	  error = resgrp_parse_group_option (definition, group, item);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * resgrp_parse_assignments () - read "key:group, ..." of resource_group_users or resource_group_brokers
+ *
+ * return           : error code
+ * definition (in)  : parameter value
+ * assignments (out): keys and their groups
+ */
+static int
+resgrp_parse_assignments (const char *definition, std::vector<RESGRP_ASSIGNMENT> &assignments)
+{
+  std::string def_str = definition;
+  size_t pos = 0, next_pos, colon_pos;
+  std::string item;
+  RESGRP_ASSIGNMENT assignment;
+
+  while (pos <= def_str.size ())
+    {
+      next_pos = def_str.find_first_of (",;", pos);
+      if (next_pos == std::string::npos)
+	{
+	  next_pos = def_str.size ();
+	}
+      item = resgrp_trim (def_str.substr (pos, next_pos - pos));
+      pos = next_pos + 1;
+      if (item.empty ())
+	{
+	  continue;
+	}
+
+      colon_pos = item.find (':');
+      if (colon_pos == std::string::npos)
+	{
+	  return resgrp_set_invalid_definition (definition, "assignment is not name:group");
+	}
+      assignment.key = resgrp_trim (item.substr (0, colon_pos));
+      assignment.group_id = resgrp_find_group_by_name (resgrp_trim (item.substr (colon_pos + 1)).c_str ());
+      if (assignment.key.empty ())
+	{
+	  return resgrp_set_invalid_definition (definition, "assignment is not name:group");
+	}
+      if (assignment.group_id == RESGRP_NULL_ID)
+	{
+	  return resgrp_set_invalid_definition (definition, "group is not defined by resource_groups");
+	}
+      assignments.push_back (assignment);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * resgrp_initialize () - define the resource groups from the system parameters
+ *
+ * return            : error code
+ * worker_count (in) : number of request workers
+ */
+int
+resgrp_initialize (int worker_count)
+{
+  const char *groups_def = prm_get_string_value (PRM_ID_RESOURCE_GROUPS);
+  const char *users_def = prm_get_string_value (PRM_ID_RESOURCE_GROUP_USERS);
+  const char *brokers_def = prm_get_string_value (PRM_ID_RESOURCE_GROUP_BROKERS);
+  int error;
+
+  resgrp_Count = 1;
+  resgrp_init_group (&resgrp_Groups[RESGRP_DEFAULT_ID], RESGRP_DEFAULT_NAME);
+  resgrp_User_assignments.clear ();
+  resgrp_Broker_assignments.clear ();
+
+  resgrp_Scheduler.worker_count = MAX (worker_count, 1);
+  resgrp_Scheduler.running_count = 0;
+  resgrp_Scheduler.queued_count = 0;
+  resgrp_Scheduler.virtual_time = 0;
+
+  if (groups_def == NULL || groups_def[0] == '\0')
+    {
+      resgrp_Is_enabled = false;
+      return NO_ERROR;
+    }
+
+  error = resgrp_parse_groups (groups_def);
+  if (error == NO_ERROR && users_def != NULL)
+    {
+      error = resgrp_parse_assignments (users_def, resgrp_User_assignments);
+    }
+  if (error == NO_ERROR && brokers_def != NULL)
+    {
+      error = resgrp_parse_assignments (brokers_def, resgrp_Broker_assignments);
+    }
+  if (error != NO_ERROR)
+    {
+      resgrp_finalize ();
+      return error;
+    }
+
+  resgrp_Is_enabled = true;
+  return NO_ERROR;
+}
+
+void
+resgrp_finalize (void)
+{
+  int group_id;
+
+  resgrp_Is_enabled = false;
+  for (group_id = 0; group_id < resgrp_Count; group_id++)
+    {
+      resgrp_Groups[group_id].queue.clear ();
+    }
+  resgrp_Count = 1;
+  resgrp_User_assignments.clear ();
+  resgrp_Broker_assignments.clear ();
+}
+
+bool
+resgrp_is_enabled (void)
+{
+  return resgrp_Is_enabled;
+}
+
+const char *
+resgrp_get_name (int group_id)
+{
+  if (group_id < 0 || group_id >= resgrp_Count)
+    {
+      return RESGRP_DEFAULT_NAME;
+    }
+  return resgrp_Groups[group_id].name;
+}
+
+/*
+ * resgrp_find_client_group () - the group of a client that registers
+ *
+ * return            : group id
+ * db_user (in)      : database user
+ * program_name (in) : client program; "<broker>_cub_cas_<n>" for a CAS
+ */
+int
+resgrp_find_client_group (const char *db_user, const char *program_name)
+{
+  size_t key_len;
+
+  if (!resgrp_Is_enabled)
+    {
+      return RESGRP_DEFAULT_ID;
+    }
+
+  if (db_user != NULL)
+    {
+      for (const RESGRP_ASSIGNMENT &assignment : resgrp_User_assignments)
+	{
+	  if (strcasecmp (assignment.key.c_str (), db_user) == 0)
+	    {
+	      return assignment.group_id;
+	    }
+	}
+    }
+
+  if (program_name != NULL)
+    {
+      for (const RESGRP_ASSIGNMENT &assignment : resgrp_Broker_assignments)
+	{
+	  key_len = assignment.key.size ();
+	  if (strncasecmp (assignment.key.c_str (), program_name, key_len) == 0 && program_name[key_len] == '_')
+	    {
+	      return assignment.group_id;
+	    }
+	}
+    }
+
+  return RESGRP_DEFAULT_ID;
+}
+
+int
+resgrp_get_thread_group (THREAD_ENTRY * thread_p)
+{
+  if (thread_p == NULL || thread_p->conn_entry == NULL)
+    {
+      return RESGRP_DEFAULT_ID;
+    }
+  return thread_p->conn_entry->resource_group_id;
+}
+
+/*
+ * resgrp_tag_request () - start-time fair queueing tags of a request of the group; scheduler mutex is held
+ */
+static void
+resgrp_tag_request (RESGRP_GROUP * group, double *start_tag)
+{
+  *start_tag = MAX (resgrp_Scheduler.virtual_time, group->last_finish_tag);
+  group->last_finish_tag = *start_tag + 1.0 / group->weight;
+}
+
+/*
+ * resgrp_admit_request () - admit a new request of the connection or queue it
+ *
+ * return    : true if the request is pushed to the workers now, false if it waits in the queue of its group
+ * conn (in) : connection with a pending request
+ */
+bool
+resgrp_admit_request (CSS_CONN_ENTRY * conn)
+{
+  RESGRP_GROUP *group;
+  RESGRP_QUEUED_REQUEST request;
+
+  if (!resgrp_Is_enabled)
+    {
+      return true;
+    }
+
+  assert (conn->resource_group_id >= 0 && conn->resource_group_id < resgrp_Count);
+  group = &resgrp_Groups[conn->resource_group_id];
+
+  std::unique_lock<std::mutex> ulock (resgrp_Scheduler.mutex);
+
+  resgrp_tag_request (group, &request.start_tag);
+
+  /* requests of a transaction in progress or of a method callback may hold what running requests wait for */
+  if (conn->in_transaction || conn->in_method || resgrp_Scheduler.running_count < resgrp_Scheduler.worker_count)
+    {
+      resgrp_Scheduler.virtual_time = MAX (resgrp_Scheduler.virtual_time, request.start_tag);
+      resgrp_Scheduler.running_count++;
+      return true;
+    }
+
+  request.conn = conn;
+  request.enqueue_usec = resgrp_now_usec ();
+  group->queue.push_back (request);
+  resgrp_Scheduler.queued_count++;
+  return false;
+}
+
+/*
+ * resgrp_end_request () - a worker has finished a request; pick the next queued request to run
+ *
+ * return            : connection of the request to push to the workers, or NULL
+ * thread_p (in)     : thread entry of the worker
+ * group_id (in)     : group of the finished request
+ * elapsed_usec (in) : time the request ran
+ */
+CSS_CONN_ENTRY *
+resgrp_end_request (THREAD_ENTRY * thread_p, int group_id, UINT64 elapsed_usec)
+{
+  RESGRP_GROUP *group, *next_group = NULL;
+  RESGRP_QUEUED_REQUEST request;
+  int i;
+
+  if (!resgrp_Is_enabled)
+    {
+      return NULL;
+    }
+
+  perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_REQUESTS, 1);
+  perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_REQUEST_TIME, elapsed_usec);
+
+  if (thread_p != NULL)
+    {
+      /* the next request of the worker may be of another group */
+      thread_p->resgrp_io_delay_usec = 0;
+    }
+
+  {
+    std::unique_lock<std::mutex> ulock (resgrp_Scheduler.mutex);
+
+    assert (resgrp_Scheduler.running_count > 0);
+    resgrp_Scheduler.running_count--;
+
+    if (resgrp_Scheduler.queued_count == 0 || resgrp_Scheduler.running_count >= resgrp_Scheduler.worker_count)
+      {
+	return NULL;
+      }
+
+    for (i = 0; i < resgrp_Count; i++)
+      {
+	group = &resgrp_Groups[i];
+	if (!group->queue.empty ()
+	    && (next_group == NULL || group->queue.front ().start_tag < next_group->queue.front ().start_tag))
+	  {
+	    next_group = group;
+	    group_id = i;
+	  }
+      }
+    assert (next_group != NULL);
+
+    request = next_group->queue.front ();
+    next_group->queue.pop_front ();
+    resgrp_Scheduler.queued_count--;
+    resgrp_Scheduler.running_count++;
+    resgrp_Scheduler.virtual_time = MAX (resgrp_Scheduler.virtual_time, request.start_tag);
+  }
+
+  perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_QUEUED_REQUESTS, 1);
+  perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_QUEUE_WAIT_TIME,
+			      (UINT64) MAX (resgrp_now_usec () - request.enqueue_usec, 0));
+
+  return request.conn;
+}
+
+/*
+ * resgrp_remove_queued_requests () - take the queued requests of a connection that goes down out of the queues
+ *
+ * return    : number of requests removed; the caller pushes them to the workers
+ * conn (in) : connection
+ */
+int
+resgrp_remove_queued_requests (CSS_CONN_ENTRY * conn)
+{
+  int group_id, removed_count = 0;
+  std::deque<RESGRP_QUEUED_REQUEST> *queue;
+
+  if (!resgrp_Is_enabled)
+    {
+      return 0;
+    }
+
+  std::unique_lock<std::mutex> ulock (resgrp_Scheduler.mutex);
+
+  for (group_id = 0; group_id < resgrp_Count; group_id++)
+    {
+      queue = &resgrp_Groups[group_id].queue;
+      for (auto it = queue->begin (); it != queue->end ();)
+	{
+	  if (it->conn == conn)
+	    {
+	      it = queue->erase (it);
+	      removed_count++;
+	    }
+	  else
+	    {
+	      ++it;
+	    }
+	}
+    }
+
+  resgrp_Scheduler.queued_count -= removed_count;
+  resgrp_Scheduler.running_count += removed_count;
+
+  return removed_count;
+}
+
+/*
+ * resgrp_start_query () - get a query slot of the group of the thread, waiting for one if the group runs
+ *			   max_queries queries already
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * slot (out)    : slot to pass to resgrp_end_query
+ */
+int
+resgrp_start_query (THREAD_ENTRY * thread_p, RESGRP_QUERY_SLOT * slot)
+{
+  RESGRP_GROUP *group;
+  int wait_msecs;
+  bool dummy;
+
+  slot->group_id = RESGRP_NULL_ID;
+  slot->is_counted = false;
+  slot->start_usec = 0;
+
+  if (!resgrp_Is_enabled)
+    {
+      return NO_ERROR;
+    }
+
+  slot->group_id = resgrp_get_thread_group (thread_p);
+  slot->start_usec = resgrp_now_usec ();
+  group = &resgrp_Groups[slot->group_id];
+  if (group->max_queries == 0)
+    {
+      return NO_ERROR;
+    }
+
+  std::unique_lock<std::mutex> ulock (group->query_mutex);
+
+  if (group->running_queries >= group->max_queries)
+    {
+      wait_msecs = prm_get_integer_value (PRM_ID_RESOURCE_GROUP_QUERY_WAIT_TIME);
+      auto deadline = std::chrono::steady_clock::now () + std::chrono::milliseconds (wait_msecs);
+
+      perfmon_resource_group_add (thread_p, slot->group_id, PERF_RESOURCE_GROUP_QUERY_WAITS, 1);
+
+      while (group->running_queries >= group->max_queries)
+	{
+	  if (std::chrono::steady_clock::now () >= deadline)
+	    {
+	      ulock.unlock ();
+	      perfmon_resource_group_add (thread_p, slot->group_id, PERF_RESOURCE_GROUP_QUERY_REJECTS, 1);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_RESOURCE_GROUP_QUERY_LIMIT, 2, group->name, wait_msecs);
+	      return ER_RESOURCE_GROUP_QUERY_LIMIT;
+	    }
+	  if (logtb_is_interrupted (thread_p, true, &dummy))
+	    {
+	      ulock.unlock ();
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	      return ER_INTERRUPTED;
+	    }
+
+	  /* wake up at least every 100 msecs to check interrupts */
+	  (void) group->query_cv.wait_until (ulock, std::min (deadline, std::chrono::steady_clock::now ()
+							       + std::chrono::milliseconds (100)));
+	}
+    }
+
+  group->running_queries++;
+  slot->is_counted = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * resgrp_end_query () - a query started by resgrp_start_query has finished
+ *
+ * thread_p (in) : thread entry
+ * slot (in/out) : slot of the query
+ */
+void
+resgrp_end_query (THREAD_ENTRY * thread_p, RESGRP_QUERY_SLOT * slot)
+{
+  RESGRP_GROUP *group;
+
+  if (slot->group_id == RESGRP_NULL_ID)
+    {
+      return;
+    }
+
+  /* the query has unfixed its pages; still counted as running while it sleeps */
+  resgrp_pay_page_read_delay (thread_p);
+
+  group = &resgrp_Groups[slot->group_id];
+  if (slot->is_counted)
+    {
+      std::unique_lock<std::mutex> ulock (group->query_mutex);
+      group->running_queries--;
+      group->query_cv.notify_one ();
+      slot->is_counted = false;
+    }
+
+  perfmon_resource_group_add (thread_p, slot->group_id, PERF_RESOURCE_GROUP_QUERIES, 1);
+  perfmon_resource_group_add (thread_p, slot->group_id, PERF_RESOURCE_GROUP_QUERY_TIME,
+			      (UINT64) MAX (resgrp_now_usec () - slot->start_usec, 0));
+  slot->group_id = RESGRP_NULL_ID;
+}
+
+/*
+ * resgrp_charge_temp_pages () - charge new temp file pages to a group
+ *
+ * return        : error code; ER_RESOURCE_GROUP_TEMP_QUOTA_EXCEEDED if the group would hold more than max_temp_pages
+ * thread_p (in) : thread entry
+ * group_id (in) : group
+ * npages (in)   : pages to charge
+ */
+int
+resgrp_charge_temp_pages (THREAD_ENTRY * thread_p, int group_id, int npages)
+{
+  RESGRP_GROUP *group;
+
+  if (!resgrp_Is_enabled)
+    {
+      return NO_ERROR;
+    }
+
+  group = &resgrp_Groups[group_id];
+  if (group->max_temp_pages == 0)
+    {
+      return NO_ERROR;
+    }
+
+  if (group->temp_pages.fetch_add (npages) + npages > group->max_temp_pages)
+    {
+      group->temp_pages.fetch_sub (npages);
+      perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_TEMP_QUOTA_ERRORS, 1);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_RESOURCE_GROUP_TEMP_QUOTA_EXCEEDED, 2, group->name,
+	      group->max_temp_pages);
+      return ER_RESOURCE_GROUP_TEMP_QUOTA_EXCEEDED;
+    }
+
+  return NO_ERROR;
+}
+
+void
+resgrp_release_temp_pages (int group_id, int npages)
+{
+  if (!resgrp_Is_enabled || resgrp_Groups[group_id].max_temp_pages == 0)
+    {
+      return;
+    }
+
+  resgrp_Groups[group_id].temp_pages.fetch_sub (npages);
+  assert (resgrp_Groups[group_id].temp_pages.load () >= 0);
+}
+
+/*
+ * resgrp_charge_page_read () - count a page read from disk and compute how long the thread must sleep to keep its
+ *				group under max_io_pages_per_sec
+ *
+ * thread_p (in) : thread entry
+ *
+ * note: a generic cell rate algorithm; each read moves the theoretical arrival time of the group one emission
+ *	 interval ahead, and the reader owes what it is ahead of now by more than the burst tolerance. The read is
+ *	 done with a BCB and often with latches on other pages, so the delay is only slept later, by
+ *	 resgrp_pay_page_read_delay.
+ */
+void
+resgrp_charge_page_read (THREAD_ENTRY * thread_p)
+{
+  RESGRP_GROUP *group;
+  INT64 now_usec, interval_usec, tat, new_tat, delay_usec;
+  int group_id;
+
+  if (!resgrp_Is_enabled)
+    {
+      return;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  group_id = resgrp_get_thread_group (thread_p);
+  group = &resgrp_Groups[group_id];
+  perfmon_resource_group_add (thread_p, group_id, PERF_RESOURCE_GROUP_IO_READS, 1);
+  if (group->max_io_pages_per_sec == 0)
+    {
+      return;
+    }
+
+  interval_usec = 1000000 / group->max_io_pages_per_sec;
+  now_usec = resgrp_now_usec ();
+  tat = group->io_theoretical_arrival_usec.load ();
+  do
+    {
+      new_tat = MAX (tat, now_usec) + interval_usec;
+    }
+  while (!group->io_theoretical_arrival_usec.compare_exchange_weak (tat, new_tat));
+
+  delay_usec = new_tat - interval_usec - RESGRP_IO_BURST_USEC - now_usec;
+  if (delay_usec <= 0)
+    {
+      return;
+    }
+
+  /* the delay of a later read includes the one of an earlier read that was not slept yet */
+  thread_p->resgrp_io_delay_usec = MAX (thread_p->resgrp_io_delay_usec, MIN (delay_usec, RESGRP_IO_MAX_DELAY_USEC));
+}
+
+/*
+ * resgrp_pay_page_read_delay () - sleep for the page reads the group of the thread is over its rate
+ *
+ * thread_p (in) : thread entry; it must not hold any page latch or BCB
+ */
+void
+resgrp_pay_page_read_delay (THREAD_ENTRY * thread_p)
+{
+  INT64 delay_usec;
+
+  if (thread_p == NULL || thread_p->resgrp_io_delay_usec <= 0)
+    {
+      return;
+    }
+
+  delay_usec = thread_p->resgrp_io_delay_usec;
+  thread_p->resgrp_io_delay_usec = 0;
+
+  std::this_thread::sleep_for (std::chrono::microseconds (delay_usec));
+  perfmon_resource_group_add (thread_p, resgrp_get_thread_group (thread_p), PERF_RESOURCE_GROUP_IO_THROTTLE_TIME,
+			      (UINT64) delay_usec);
+}
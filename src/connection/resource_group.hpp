@@ -0,0 +1,82 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// resource_group.hpp - named groups of clients sharing the request workers, query slots, temp space and page reads
+//
+//  Groups are defined by resource_groups, e.g.
+//    resource_groups="report(weight=1,max_queries=4,max_temp_pages=100000,max_io_pages_per_sec=2000);oltp(weight=8)"
+//  and a client joins a group when it registers: by its database user (resource_group_users="REPORTER:report") or
+//  else by the broker it comes from (resource_group_brokers="query_editor:report"). Other clients are in the
+//  "default" group, which can be given settings too by defining it.
+//
+//  When the request workers are all busy, new requests that start a transaction wait in the queue of their group.
+//  A finishing worker picks the next request by start-time fair queueing, so under contention each group gets a
+//  share of the workers proportional to its weight; requests inside a transaction or of a method callback are never
+//  queued, because they may hold locks the running requests wait for.
+//
+//  max_queries limits the queries a group executes at once (others wait up to
+//  resource_group_query_wait_time_in_msecs for a slot), max_temp_pages the temp file pages of query results the group
+//  holds, and max_io_pages_per_sec the pages the group reads from disk (readers are delayed to keep the rate).
+//
+//  Requests, queue waits, queries, quota errors and throttled reads of each group are in statdump as
+//  Resource_group_counters_timers, where groups are listed by index in the order of resource_groups (0 is default).
+//
+
+#ifndef _RESOURCE_GROUP_HPP_
+#define _RESOURCE_GROUP_HPP_
+
+#if !defined (SERVER_MODE)
+#error Wrong module
+#endif // not SERVER_MODE
+
+#include "connection_defs.h"
+#include "thread_compat.hpp"
+
+#define RESGRP_DEFAULT_ID 0
+#define RESGRP_NULL_ID (-1)
+
+typedef struct resgrp_query_slot RESGRP_QUERY_SLOT;
+struct resgrp_query_slot
+{
+  int group_id;			/* RESGRP_NULL_ID if resource groups are not used */
+  bool is_counted;		/* holds one of the max_queries slots of the group */
+  INT64 start_usec;
+};
+
+extern int resgrp_initialize (int worker_count);
+extern void resgrp_finalize (void);
+extern bool resgrp_is_enabled (void);
+extern const char *resgrp_get_name (int group_id);
+extern int resgrp_find_client_group (const char *db_user, const char *program_name);
+extern int resgrp_get_thread_group (THREAD_ENTRY * thread_p);
+
+extern bool resgrp_admit_request (CSS_CONN_ENTRY * conn);
+extern CSS_CONN_ENTRY *resgrp_end_request (THREAD_ENTRY * thread_p, int group_id, UINT64 elapsed_usec);
+extern int resgrp_remove_queued_requests (CSS_CONN_ENTRY * conn);
+
+extern int resgrp_start_query (THREAD_ENTRY * thread_p, RESGRP_QUERY_SLOT * slot);
+extern void resgrp_end_query (THREAD_ENTRY * thread_p, RESGRP_QUERY_SLOT * slot);
+
+extern int resgrp_charge_temp_pages (THREAD_ENTRY * thread_p, int group_id, int npages);
+extern void resgrp_release_temp_pages (int group_id, int npages);
+
+extern void resgrp_charge_page_read (THREAD_ENTRY * thread_p);
+extern void resgrp_pay_page_read_delay (THREAD_ENTRY * thread_p);
+
+#endif // _RESOURCE_GROUP_HPP_
@@ -81,6 +81,7 @@
 #include "heartbeat.h"
 #endif
 #include "dbtype.h"
+#include "resource_group.hpp"
 
 #define CSS_WAIT_COUNT 5	/* # of retry to connect to master */
 #define CSS_GOING_DOWN_IMMEDIATELY "Server going down immediately"
@@ -232,6 +233,7 @@ static bool css_check_ha_log_applier_done (void);
 static bool css_check_ha_log_applier_working (void);
 
 static void css_push_server_task (CSS_CONN_ENTRY & conn_ref);
+static void css_dispatch_server_task (CSS_CONN_ENTRY & conn_ref);
 static void css_stop_non_log_writer (THREAD_ENTRY & thread_ref, bool &, THREAD_ENTRY & stopper_thread_ref);
 static void css_stop_log_writer (THREAD_ENTRY & thread_ref, bool &);
 static void css_find_not_stopped (THREAD_ENTRY & thread_ref, bool & stop, bool is_log_writer, bool & found);
@@ -1324,6 +1326,13 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
 #define MAX_TASK_COUNT css_get_max_task_count ()
 #define MAX_CONNECTIONS css_get_max_connections ()
 
+  // define resource groups before any request is pushed
+  status = resgrp_initialize ((int) MAX_WORKERS);
+  if (status != NO_ERROR)
+    {
+      return status;
+    }
+
   // create request worker pool
   css_Server_request_worker_pool =
     cubthread::get_manager ()->create_worker_pool (MAX_WORKERS, MAX_TASK_COUNT, "transaction workers", NULL,
@@ -1423,6 +1432,7 @@ shutdown:
   // destroy thread worker pools
   thread_get_manager ()->destroy_worker_pool (css_Server_request_worker_pool);
   thread_get_manager ()->destroy_worker_pool (css_Connection_worker_pool);
+  resgrp_finalize ();
 
   if (!HA_DISABLED ())
     {
@@ -1763,7 +1773,7 @@ css_receive_data_from_client_with_timeout (CSS_CONN_ENTRY * conn, unsigned int e
 void
 css_end_server_request (CSS_CONN_ENTRY * conn)
 {
-  int r;
+  int r, queued_count;
 
   r = rmutex_lock (NULL, &conn->rmutex);
   assert (r == NO_ERROR);
@@ -1773,6 +1783,12 @@ css_end_server_request (CSS_CONN_ENTRY * conn)
 
   r = rmutex_unlock (NULL, &conn->rmutex);
   assert (r == NO_ERROR);
+
+  /* requests of the connection still queued by its resource group run now to find the connection closing */
+  for (queued_count = resgrp_remove_queued_requests (conn); queued_count > 0; queued_count--)
+    {
+      css_dispatch_server_task (*conn);
+    }
 }
 
 /*
@@ -2734,6 +2750,25 @@ css_push_server_task (CSS_CONN_ENTRY &conn_ref)
   //
   conn_ref.add_pending_request ();
 
+  if (!resgrp_admit_request (&conn_ref))
+    {
+      // all workers are busy; the request waits in the queue of its resource group until a worker picks it
+      return;
+    }
+
+  css_dispatch_server_task (conn_ref);
+}
+
+/*
+ * css_dispatch_server_task () - push a task for an admitted request of the connection on the server request worker
+ *                               pool
+ *
+ * return        : void
+ * conn_ref (in) : connection with a pending request
+ */
+static void
+css_dispatch_server_task (CSS_CONN_ENTRY &conn_ref)
+{
   thread_get_manager ()->push_task_on_core (css_Server_request_worker_pool, new css_server_task (conn_ref),
                                             static_cast<size_t> (conn_ref.idx), conn_ref.in_method);
 }
@@ -2747,6 +2782,11 @@ css_push_external_task (CSS_CONN_ENTRY *conn, cubthread::entry_task *task)
 void
 css_server_task::execute (context_type &thread_ref)
 {
+  // the group is read before the request; registering the client may change it, and the connection may be gone after
+  const int resource_group_id = m_conn.resource_group_id;
+  const auto start_time = std::chrono::steady_clock::now ();
+  CSS_CONN_ENTRY *next_conn;
+
   m_conn.start_request ();
 
   thread_ref.conn_entry = &m_conn;
@@ -2770,6 +2810,19 @@ css_server_task::execute (context_type &thread_ref)
 
   thread_ref.conn_entry = NULL;
   thread_ref.m_status = cubthread::entry::status::TS_FREE;
+
+  if (resgrp_is_enabled ())
+    {
+      UINT64 elapsed_usec =
+        std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start_time).count ();
+
+      // the finished request frees a worker for the next queued request
+      next_conn = resgrp_end_request (&thread_ref, resource_group_id, elapsed_usec);
+      if (next_conn != NULL)
+        {
+          css_dispatch_server_task (*next_conn);
+        }
+    }
 }
 
 void
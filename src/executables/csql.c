@@ -1463,6 +1463,18 @@ csql_do_session_cmd (char *line_read, CSQL_ARGUMENT * csql_arg)
 	}
       break;
 
+    case S_CMD_CLR_STMT_STATS:
+      if (stmtstat_reset () != NO_ERROR)
+	{
+	  csql_display_csql_err (0, 0);
+	  csql_check_server_down ();
+	}
+      else
+	{
+	  fprintf (csql_Output_fp, "Statement statistics are cleared.\n");
+	}
+      break;
+
     case S_CMD_SINGLELINE:
       if (!strcasecmp (argument, "on"))
 	{
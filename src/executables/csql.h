@@ -239,6 +239,7 @@ extern "C"
     S_CMD_HISTORY_LIST,
 
     S_CMD_TRACE,
+    S_CMD_CLR_STMT_STATS,
 
     S_CMD_SINGLELINE,
 
@@ -126,6 +126,7 @@ static SESSION_CMD_TABLE csql_Session_cmd_table[] = {
   {"historylist", S_CMD_HISTORY_LIST, CMD_EMPTY_FLAG},
 
   {"trace", S_CMD_TRACE, CMD_CHECK_CONNECT},
+  {"clear_stmt_stats", S_CMD_CLR_STMT_STATS, CMD_CHECK_CONNECT},
 
   {"singleline", S_CMD_SINGLELINE, CMD_EMPTY_FLAG},
 
@@ -676,7 +677,8 @@ csql_help_info (const char *command, int aucommit_flag)
       && (!strcasecmp (tok, "schema") || !strcasecmp (tok, "trigger") || !strcasecmp (tok, "deferred")
 	  || !strcasecmp (tok, "workspace") || !strcasecmp (tok, "lock") || !strcasecmp (tok, "stats")
 	  || !strcasecmp (tok, "logstat") || !strcasecmp (tok, "csstat") || !strcasecmp (tok, "plan")
-	  || !strcasecmp (tok, "qcache") || !strcasecmp (tok, "trantable") || !strcasecmp (tok, "ndv")))
+	  || !strcasecmp (tok, "qcache") || !strcasecmp (tok, "trantable") || !strcasecmp (tok, "ndv")
+	  || !strcasecmp (tok, "ash")))
     {
       int result;
 
@@ -65,6 +65,7 @@ public class ExecuteThread extends Thread {
     private static final int REQ_CODE_DESTROY = 0x10;
     private static final int REQ_CODE_END = 0x20;
     private static final int REQ_CODE_PREPARE_ARGS = 0x40;
+    private static final int REQ_CODE_INVOKE_SP_BATCH = 0x80;
 
     private static final int REQ_CODE_UTIL_PING = 0xDE;
     private static final int REQ_CODE_UTIL_STATUS = 0xEE;
@@ -183,6 +184,11 @@ public class ExecuteThread extends Thread {
                             processStoredProcedure();
                             break;
                         }
+                    case REQ_CODE_INVOKE_SP_BATCH:
+                        {
+                            processStoredProcedureBatch();
+                            break;
+                        }
                     case REQ_CODE_DESTROY:
                         {
                             destroyJDBCResources();
@@ -332,6 +338,88 @@ public class ExecuteThread extends Thread {
         setStatus(ExecuteThreadStatus.IDLE);
     }
 
+    /*
+     * invokes the procedures for each argument tuple of the request, in the order of the tuples,
+     * and sends the return values of all invocations in one result
+     */
+    private void processStoredProcedureBatch() throws Exception {
+        id = unpacker.unpackBigint();
+
+        setStatus(ExecuteThreadStatus.PARSE);
+
+        /* read the whole request first: server-side JDBC calls of the procedures reuse the read buffer */
+        int methodCount = unpacker.unpackInt();
+        String[] methodSigs = new String[methodCount];
+        int[][] argPos = new int[methodCount][];
+        int[][] argMode = new int[methodCount][];
+        int[][] argType = new int[methodCount][];
+        int[] returnTypes = new int[methodCount];
+        for (int m = 0; m < methodCount; m++) {
+            methodSigs[m] = unpacker.unpackCString();
+            int paramCount = unpacker.unpackInt();
+            argPos[m] = new int[paramCount];
+            argMode[m] = new int[paramCount];
+            argType[m] = new int[paramCount];
+            for (int i = 0; i < paramCount; i++) {
+                argPos[m][i] = unpacker.unpackInt();
+                argMode[m][i] = unpacker.unpackInt();
+                argType[m][i] = unpacker.unpackInt();
+            }
+            returnTypes[m] = unpacker.unpackInt();
+        }
+
+        int rowCount = unpacker.unpackInt();
+        Value[][] rows = new Value[rowCount][];
+        for (int r = 0; r < rowCount; r++) {
+            int argCount = unpacker.unpackInt();
+            rows[r] = readArguments(unpacker, new Value[argCount]);
+        }
+
+        Object[] results = new Object[rowCount * methodCount];
+        for (int r = 0; r < rowCount; r++) {
+            for (int m = 0; m < methodCount; m++) {
+                setStatus(ExecuteThreadStatus.PARSE);
+                Value[] methodArgs = new Value[argPos[m].length];
+                for (int i = 0; i < methodArgs.length; i++) {
+                    Value val = rows[r][argPos[m][i]];
+                    val.setMode(argMode[m][i]);
+                    val.setDbType(argType[m][i]);
+
+                    methodArgs[i] = val;
+                }
+                storedProcedure = new StoredProcedure(methodSigs[m], methodArgs, returnTypes[m]);
+
+                setStatus(ExecuteThreadStatus.INVOKE);
+                Value result = storedProcedure.invoke();
+
+                /* close server-side JDBC connection */
+                closeJdbcConnection();
+
+                if (result != null) {
+                    results[r * methodCount + m] =
+                            ValueUtilities.resolveValue(returnTypes[m], result);
+                }
+            }
+        }
+
+        /* send results */
+        setStatus(ExecuteThreadStatus.RESULT);
+
+        resultBuffer.clear(); /* prepare to put */
+        packer.setBuffer(resultBuffer);
+        for (int k = 0; k < results.length; k++) {
+            packer.packValue(results[k], returnTypes[k % methodCount], this.charSet);
+        }
+        resultBuffer = packer.getBuffer();
+
+        output.writeInt(REQ_CODE_RESULT);
+        output.writeInt(resultBuffer.position());
+        output.write(resultBuffer.array(), 0, resultBuffer.position());
+        output.flush();
+
+        setStatus(ExecuteThreadStatus.IDLE);
+    }
+
     private StoredProcedure makeStoredProcedure() throws Exception {
         String methodSig = unpacker.unpackCString();
         int paramCount = unpacker.unpackInt();
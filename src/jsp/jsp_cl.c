@@ -1483,6 +1483,7 @@ jsp_make_method_sig_list (PARSER_CONTEXT * parser, PT_NODE * node, method_sig_li
 	  }
 
 	sig->arg_info.result_type = sig_result_type;
+	sig->arg_info.is_deterministic = false;
 
 	sig_list.num_methods = 1;
       }
@@ -49,6 +49,7 @@ typedef enum
   SP_CODE_DESTROY = 0x10,
   // SP_CODE_END = 0x20,
   SP_CODE_PREPARE_ARGS = 0x40,
+  SP_CODE_INVOKE_BATCH = 0x80,
 
   SP_CODE_UTIL_PING = 0xDE,
   SP_CODE_UTIL_STATUS = 0xEE,
@@ -57,6 +57,7 @@ method_sig_node::pack (cubpacking::packer &serializator) const
 	  serializator.pack_int (arg_info.arg_type[i]);
 	}
       serializator.pack_int (arg_info.result_type);
+      serializator.pack_bool (arg_info.is_deterministic);
     }
 }
 
@@ -88,6 +89,7 @@ method_sig_node::get_packed_size (cubpacking::packer &serializator, std::size_t
 	  size += serializator.get_packed_int_size (size); /* method_sig->arg_info.arg_type[i] */
 	}
       size += serializator.get_packed_int_size (size); /* method_sig->arg_info.result_type */
+      size += serializator.get_packed_bool_size (size); /* method_sig->arg_info.is_deterministic */
     }
 
   return size;
@@ -144,6 +146,7 @@ method_sig_node::unpack (cubpacking::unpacker &deserializator)
 	}
 
       deserializator.unpack_int (arg_info.result_type);
+      deserializator.unpack_bool (arg_info.is_deterministic);
     }
 }
 
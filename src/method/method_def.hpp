@@ -106,6 +106,7 @@ struct method_arg_info
   int *arg_mode; /* IN, OUT, INOUT */
   int *arg_type; /* DB_TYPE */
   int result_type; /* DB_TYPE */
+  bool is_deterministic; /* same arguments always give the same result; results may be reused */
 
   method_arg_info () = default;
 };
@@ -25,6 +25,7 @@
 #error Belongs to server module
 #endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include <queue>
@@ -100,10 +101,15 @@ namespace cubmethod
       int get_return (cubthread::entry *thread_p, std::vector<std::reference_wrapper<DB_VALUE>> &arg_base,
 		      DB_VALUE &result) override;
 
+      /* results of a batch invocation sent by method_invoke_group::execute_batch (), tuple by tuple */
+      int get_batch_return (cubthread::entry *thread_p, std::vector<DB_VALUE> &results);
+
     private:
+      int wait_for_result (cubthread::entry *thread_p, const std::function<int ()> &result_handler);
       int alloc_response (cubthread::entry *thread_p);
       int receive_result (std::vector<std::reference_wrapper<DB_VALUE>> &arg_base,
 			  DB_VALUE &returnval);
+      int receive_batch_result (std::vector<DB_VALUE> &results);
       int receive_error ();
 
       int callback_dispatch (cubthread::entry &thread_ref);
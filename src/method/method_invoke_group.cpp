@@ -30,6 +30,7 @@
 #include "method_connection_sr.hpp"
 #include "method_connection_pool.hpp"
 #include "session.h"
+#include "system_parameter.h"
 
 #if defined (SA_MODE)
 #include "query_method.hpp"
@@ -53,9 +54,34 @@ namespace cubmethod
     // init runtime context
     session_get_method_runtime_context (thread_p, m_rctx);
 
+    bool is_batchable = is_for_scan && prm_get_integer_value (PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE) > 1;
+    m_is_deterministic = true;
+
     method_sig_node *sig = sig_list.method_sig;
     while (sig)
       {
+	if (sig->method_type == METHOD_TYPE_JAVA_SP)
+	  {
+	    /* out arguments and result sets are returned only by row-by-row invocation */
+	    for (int i = 0; i < sig->num_method_args; i++)
+	      {
+		if (sig->arg_info.arg_mode[i] != METHOD_ARG_MODE_IN)
+		  {
+		    is_batchable = false;
+		  }
+	      }
+	    if (sig->arg_info.result_type == DB_TYPE_RESULTSET)
+	      {
+		is_batchable = false;
+	      }
+	    m_is_deterministic = m_is_deterministic && sig->arg_info.is_deterministic;
+	  }
+	else
+	  {
+	    is_batchable = false;
+	    m_is_deterministic = false;
+	  }
+
 	method_invoke *mi = nullptr;
 
 	METHOD_TYPE type = sig->method_type;
@@ -79,6 +105,19 @@ namespace cubmethod
 	sig = sig->next;
       }
 
+    /*
+     * a batch invokes the methods for rows the scan may never return (LIMIT, early exit, an error of a previous row),
+     * so only methods declared deterministic in java_stored_procedure_deterministic_functions are batched
+     */
+    if (is_batchable && m_is_deterministic)
+      {
+	m_batch_methods.reserve (sig_list.num_methods);
+	for (sig = sig_list.method_sig; sig != nullptr; sig = sig->next)
+	  {
+	    m_batch_methods.emplace_back (sig);
+	  }
+      }
+
     DB_VALUE v;
     db_make_null (&v);
     m_result_vector.resize (sig_list.num_methods, v);
@@ -161,6 +200,18 @@ namespace cubmethod
     return m_is_for_scan;
   }
 
+  bool
+  method_invoke_group::is_batchable () const
+  {
+    return !m_batch_methods.empty ();
+  }
+
+  bool
+  method_invoke_group::is_deterministic () const
+  {
+    return m_is_deterministic;
+  }
+
   db_parameter_info *
   method_invoke_group::get_db_parameter_info () const
   {
@@ -249,6 +300,48 @@ namespace cubmethod
     return error;
   }
 
+  /*
+   * execute_batch () - invoke the methods for each of the argument tuples with one request to the Java SP server
+   *
+   * results (out): the result of each method for each tuple, tuple by tuple
+   *
+   * Note: the methods are invoked in the same order as by execute () called for each tuple.
+   */
+  int
+  method_invoke_group::execute_batch (std::vector<std::vector<DB_VALUE>> &arg_rows,
+				      const std::vector<bool> &arg_use_vec, std::vector<DB_VALUE> &results)
+  {
+    int error = NO_ERROR;
+
+    assert (is_batchable ());
+
+    DB_VALUE v;
+    db_make_null (&v);
+    results.resize (arg_rows.size () * m_batch_methods.size (), v);
+
+    cubmethod::header header (SP_CODE_INVOKE_BATCH, m_id);
+    cubmethod::invoke_java_batch arg (m_batch_methods, arg_rows, arg_use_vec);
+    error = mcon_send_data_to_java (get_socket (), header, arg);
+    if (error == NO_ERROR)
+      {
+	method_invoke_java *mi = static_cast<method_invoke_java *> (m_method_vector[0]);
+	error = mi->get_batch_return (m_thread_p, results);
+      }
+
+    if (m_rctx->is_interrupted ())
+      {
+	error = m_rctx->get_interrupt_id ();
+      }
+
+    if (error != NO_ERROR)
+      {
+	// if error is not interrupt reason, interrupt is not set
+	m_rctx->set_interrupt (error, (er_has_error () && er_msg ()) ? er_msg () : "");
+      }
+
+    return error;
+  }
+
   void
   method_invoke_group::begin ()
   {
@@ -40,6 +40,7 @@
 #include "method_connection_pool.hpp" /* cubmethod::connection */
 #include "method_def.hpp"	/* method_sig_node */
 #include "method_runtime_context.hpp" /* cubmethod::runtime_context */
+#include "method_struct_invoke.hpp" /* cubmethod::invoke_java */
 #include "method_struct_parameter_info.hpp" /* db_parameter_info */
 #include "mem_block.hpp"	/* cubmem::block, cubmem::extensible_block */
 #include "porting.h" /* SOCKET */
@@ -75,6 +76,8 @@ namespace cubmethod
       void begin ();
       int prepare (std::vector<std::reference_wrapper<DB_VALUE>> &arg_base, const std::vector<bool> &arg_use_vec);
       int execute (std::vector<std::reference_wrapper<DB_VALUE>> &arg_base);
+      int execute_batch (std::vector<std::vector<DB_VALUE>> &arg_rows, const std::vector<bool> &arg_use_vec,
+			 std::vector<DB_VALUE> &results);
       int reset (bool is_end_query);
       void destroy_resources ();
       void end ();
@@ -91,6 +94,8 @@ namespace cubmethod
 
       bool is_running () const;
       bool is_for_scan () const;
+      bool is_batchable () const;
+      bool is_deterministic () const;
 
       // cursor interface for method_invoke
       query_cursor *create_cursor (QUERY_ID query_id, bool oid_included);
@@ -114,6 +119,9 @@ namespace cubmethod
       runtime_context *m_rctx;
       bool m_is_running;
       bool m_is_for_scan;
+      bool m_is_deterministic;	/* every method is a deterministic java stored procedure */
+
+      std::vector <invoke_java> m_batch_methods;	/* requests of the methods if they can be invoked in batches */
 
       connection *m_connection;
       std::queue<cubmem::extensible_block> m_data_queue;
@@ -70,6 +70,26 @@ namespace cubmethod
   int
   method_invoke_java::get_return (cubthread::entry *thread_p, std::vector<std::reference_wrapper<DB_VALUE>> &arg_base,
 				  DB_VALUE &returnval)
+  {
+    db_make_null (&returnval);
+
+    return wait_for_result (thread_p, [&] ()
+    {
+      return receive_result (arg_base, returnval);
+    });
+  }
+
+  int
+  method_invoke_java::get_batch_return (cubthread::entry *thread_p, std::vector<DB_VALUE> &results)
+  {
+    return wait_for_result (thread_p, [&] ()
+    {
+      return receive_batch_result (results);
+    });
+  }
+
+  int
+  method_invoke_java::wait_for_result (cubthread::entry *thread_p, const std::function<int ()> &result_handler)
   {
     int start_code, error_code = NO_ERROR;
 
@@ -114,12 +134,11 @@ namespace cubmethod
 	  }
 	else if (start_code == SP_CODE_RESULT)
 	  {
-	    error_code = receive_result (arg_base, returnval);
+	    error_code = result_handler ();
 	  }
 	else if (start_code == SP_CODE_ERROR)
 	  {
 	    error_code = receive_error ();
-	    db_make_null (&returnval);
 	  }
 	else
 	  {
@@ -239,6 +258,30 @@ namespace cubmethod
     return error_code;
   }
 
+  int
+  method_invoke_java::receive_batch_result (std::vector<DB_VALUE> &results)
+  {
+    // check queue
+    if (m_group->get_data_queue().empty() == true)
+      {
+	return ER_FAILED;
+      }
+
+    cubmem::extensible_block &ext_blk = m_group->get_data_queue().front ();
+    packing_unpacker unpacker (ext_blk.get_ptr (), ext_blk.get_size ());
+
+    /* a result for each method of each argument tuple; out arguments are not returned */
+    dbvalue_java value_unpacker;
+    for (DB_VALUE &result : results)
+      {
+	db_make_null (&result);
+	value_unpacker.value = &result;
+	value_unpacker.unpack (unpacker);
+      }
+
+    return NO_ERROR;
+  }
+
   int
   method_invoke_java::receive_error ()
   {
@@ -20,18 +20,209 @@
 
 #include "dbtype.h" /* db_value_* */
 #include "list_file.h" /* qfile_ */
+#include "memory_hash.h" /* mht_valhash */
+#include "object_primitive.h" /* pr_ */
 #include "object_representation.h" /* OR_ */
 #include "method_runtime_context.hpp"
+#include "system_parameter.h"
+
+#include <climits>
+#include <cstring>
+
+/* memory for the results of deterministic methods of one scan */
+#define METHOD_RESULT_CACHE_MAX_SIZE (4 * 1024 * 1024)
 
 namespace cubscan
 {
   namespace method
   {
+//////////////////////////////////////////////////////////////////////////
+// Results of deterministic methods
+//////////////////////////////////////////////////////////////////////////
+
+    result_cache::result_cache (const std::vector<bool> &arg_use, int num_methods)
+      : m_num_methods (num_methods)
+      , m_memory_size (0)
+    {
+      for (int i = 0; i < (int) arg_use.size (); i++)
+	{
+	  if (arg_use[i])
+	    {
+	      m_arg_pos.push_back (i);
+	    }
+	}
+    }
+
+    result_cache::~result_cache ()
+    {
+      for (auto &it : m_entries)
+	{
+	  pr_clear_value_vector (it.second->args);
+	  pr_clear_value_vector (it.second->results);
+	}
+    }
+
+    /*
+     * get_hash () - hash the used arguments
+     *
+     * return: false if an argument cannot be compared exactly and the results must not be reused
+     */
+    bool
+    result_cache::get_hash (const std::vector<DB_VALUE> &args, std::size_t &hash) const
+    {
+      hash = 0;
+      for (int pos : m_arg_pos)
+	{
+	  const DB_VALUE *value = &args[pos];
+
+	  if (DB_IS_NULL (value))
+	    {
+	      hash = hash * 31;
+	      continue;
+	    }
+
+	  switch (DB_VALUE_TYPE (value))
+	    {
+	    case DB_TYPE_SHORT:
+	    case DB_TYPE_INTEGER:
+	    case DB_TYPE_BIGINT:
+	    case DB_TYPE_FLOAT:
+	    case DB_TYPE_DOUBLE:
+	    case DB_TYPE_NUMERIC:
+	    case DB_TYPE_DATE:
+	    case DB_TYPE_TIME:
+	    case DB_TYPE_TIMESTAMP:
+	    case DB_TYPE_DATETIME:
+	    case DB_TYPE_CHAR:
+	    case DB_TYPE_VARCHAR:
+	    case DB_TYPE_NCHAR:
+	    case DB_TYPE_VARNCHAR:
+	      hash = hash * 31 + mht_valhash (value, UINT_MAX);
+	      break;
+	    default:
+	      return false;
+	    }
+	}
+      return true;
+    }
+
+    bool
+    result_cache::is_same_args (const std::vector<DB_VALUE> &args, const entry &e) const
+    {
+      for (std::size_t i = 0; i < m_arg_pos.size (); i++)
+	{
+	  const DB_VALUE *value1 = &args[m_arg_pos[i]];
+	  const DB_VALUE *value2 = &e.args[i];
+
+	  if (DB_IS_NULL (value1) || DB_IS_NULL (value2))
+	    {
+	      if (DB_IS_NULL (value1) != DB_IS_NULL (value2))
+		{
+		  return false;
+		}
+	      continue;
+	    }
+	  if (DB_VALUE_TYPE (value1) != DB_VALUE_TYPE (value2))
+	    {
+	      return false;
+	    }
+	  if (TP_IS_CHAR_TYPE (DB_VALUE_TYPE (value1)))
+	    {
+	      /* strings equal by collation may still give different results */
+	      if (db_get_string_size (value1) != db_get_string_size (value2)
+		  || db_get_string_collation (value1) != db_get_string_collation (value2)
+		  || std::memcmp (db_get_string (value1), db_get_string (value2), db_get_string_size (value1)) != 0)
+		{
+		  return false;
+		}
+	    }
+	  else if (tp_value_compare (value1, value2, 0, 1) != DB_EQ)
+	    {
+	      return false;
+	    }
+	}
+      return true;
+    }
+
+    /*
+     * lookup () - copy the results of an earlier invocation with the same arguments
+     *
+     * return: true if found
+     * args (in): argument tuple
+     * results (out): a result for each method
+     */
+    bool
+    result_cache::lookup (const std::vector<DB_VALUE> &args, DB_VALUE *results)
+    {
+      std::size_t hash;
+
+      if (!get_hash (args, hash))
+	{
+	  return false;
+	}
+
+      auto range = m_entries.equal_range (hash);
+      for (auto it = range.first; it != range.second; ++it)
+	{
+	  if (is_same_args (args, *it->second))
+	    {
+	      for (int i = 0; i < m_num_methods; i++)
+		{
+		  pr_clone_value (&it->second->results[i], &results[i]);
+		}
+	      return true;
+	    }
+	}
+      return false;
+    }
+
+    /*
+     * store () - keep the results of an invocation while the cache is not full
+     *
+     * args (in): argument tuple
+     * results (in): a result for each method
+     */
+    void
+    result_cache::store (const std::vector<DB_VALUE> &args, const DB_VALUE *results)
+    {
+      std::size_t hash, size = 0;
+
+      if (m_memory_size >= METHOD_RESULT_CACHE_MAX_SIZE || !get_hash (args, hash))
+	{
+	  return;
+	}
+
+      std::unique_ptr<entry> e (new entry ());
+      e->args.resize (m_arg_pos.size ());
+      for (std::size_t i = 0; i < m_arg_pos.size (); i++)
+	{
+	  pr_clone_value (&args[m_arg_pos[i]], &e->args[i]);
+	  size += sizeof (DB_VALUE) + (DB_IS_NULL (&e->args[i]) ? 0 : pr_value_mem_size (&e->args[i]));
+	}
+      e->results.resize (m_num_methods);
+      for (int i = 0; i < m_num_methods; i++)
+	{
+	  pr_clone_value (&results[i], &e->results[i]);
+	  size += sizeof (DB_VALUE) + (DB_IS_NULL (&e->results[i]) ? 0 : pr_value_mem_size (&e->results[i]));
+	}
+
+      m_memory_size += size + sizeof (entry);
+      m_entries.emplace (hash, std::move (e));
+    }
+
+//////////////////////////////////////////////////////////////////////////
+// Method scan
+//////////////////////////////////////////////////////////////////////////
+
     scanner::scanner ()
       : m_thread_p (nullptr)
       , m_method_group (nullptr)
       , m_list_id (nullptr)
       , m_dbval_list (nullptr)
+      , m_batch_count (0)
+      , m_batch_pos (0)
+      , m_is_list_end (false)
+      , m_result_cache (nullptr)
     {
 
     }
@@ -86,6 +277,11 @@ namespace cubscan
 	  sig = sig->next;
 	}
 
+      if (m_result_cache == nullptr && m_method_group->is_deterministic ())
+	{
+	  m_result_cache = new (std::nothrow) result_cache (m_arg_use_vector, m_method_group->get_num_methods ());
+	}
+
       if (m_dbval_list == nullptr)
 	{
 	  m_dbval_list = (qproc_db_value_list *) db_private_alloc (thread_p,
@@ -105,6 +301,13 @@ namespace cubscan
     {
       close_value_array ();
       pr_clear_value_vector (m_arg_vector);
+      clear_batch ();
+
+      if (is_final)
+	{
+	  delete m_result_cache;
+	  m_result_cache = nullptr;
+	}
 
       if (is_final && m_method_group)
 	{
@@ -123,6 +326,7 @@ namespace cubscan
     {
       int error = NO_ERROR;
       error = qfile_open_list_scan (m_list_id, &m_scan_id);
+      m_is_list_end = false;
 
       // connect
       m_method_group->begin ();
@@ -144,23 +348,27 @@ namespace cubscan
     scanner::next_scan (val_list_node &vl)
     {
       SCAN_CODE scan_code = S_SUCCESS;
-
-      next_value_array (vl);
-
-      scan_code = get_single_tuple ();
-
+      DB_VALUE *results = nullptr;
       int error = NO_ERROR;
 
-      std::vector<std::reference_wrapper<DB_VALUE>> arg_wrapper (m_arg_vector.begin (), m_arg_vector.end ());
+      next_value_array (vl);
 
-      if (scan_code == S_SUCCESS && (error = m_method_group->prepare (arg_wrapper, m_arg_use_vector)) != NO_ERROR)
+      if (m_method_group->is_batchable ())
 	{
-	  scan_code = S_ERROR;
+	  if (m_batch_pos >= m_batch_count)
+	    {
+	      scan_code = invoke_next_batch (error);
+	    }
+	  if (scan_code == S_SUCCESS)
+	    {
+	      results = &m_batch_results[m_batch_pos * m_method_group->get_num_methods ()];
+	      m_batch_pos++;
+	    }
 	}
-
-      if (scan_code == S_SUCCESS && (error = m_method_group->execute (arg_wrapper)) != NO_ERROR)
+      else
 	{
-	  scan_code = S_ERROR;
+	  scan_code = invoke_single_tuple (error);
+	  results = m_row_results.data ();
 	}
 
       if (scan_code == S_SUCCESS)
@@ -172,19 +380,15 @@ namespace cubscan
 	      if (dbval_p == NULL)
 		{
 		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (DB_VALUE));
+		  pr_clear_value_vector (m_row_results);
 		  return S_ERROR;
 		}
 
 	      db_make_null (dbval_p);
-
-	      DB_VALUE &result = m_method_group->get_return_value (i);
-	      db_value_clone (&result, dbval_p);
+	      db_value_clone (&results[i], dbval_p);
 
 	      m_dbval_list[i].val = dbval_p;
-	      db_value_clear (&result);
 	    }
-
-	  m_method_group->reset (false);
 	}
       if (scan_code == S_ERROR)
 	{
@@ -202,10 +406,167 @@ namespace cubscan
 
       // clear
       pr_clear_value_vector (m_arg_vector);
+      pr_clear_value_vector (m_row_results);
 
       return scan_code;
     }
 
+    /*
+     * invoke_single_tuple () - invoke the methods for the next argument tuple
+     *
+     * return: scan code; the results are in m_row_results
+     * error (out): error of the invocation
+     */
+    SCAN_CODE
+    scanner::invoke_single_tuple (int &error)
+    {
+      SCAN_CODE scan_code = get_single_tuple ();
+      int num_methods = m_method_group->get_num_methods ();
+
+      if (scan_code != S_SUCCESS)
+	{
+	  return scan_code;
+	}
+
+      DB_VALUE null_val;
+      db_make_null (&null_val);
+      m_row_results.assign (num_methods, null_val);
+
+      if (m_result_cache != nullptr && m_result_cache->lookup (m_arg_vector, m_row_results.data ()))
+	{
+	  return S_SUCCESS;
+	}
+
+      std::vector<std::reference_wrapper<DB_VALUE>> arg_wrapper (m_arg_vector.begin (), m_arg_vector.end ());
+
+      if ((error = m_method_group->prepare (arg_wrapper, m_arg_use_vector)) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      if ((error = m_method_group->execute (arg_wrapper)) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      for (int i = 0; i < num_methods; i++)
+	{
+	  DB_VALUE &result = m_method_group->get_return_value (i);
+	  db_value_clone (&result, &m_row_results[i]);
+	  db_value_clear (&result);
+	}
+
+      if (m_result_cache != nullptr)
+	{
+	  m_result_cache->store (m_arg_vector, m_row_results.data ());
+	}
+
+      m_method_group->reset (false);
+      return S_SUCCESS;
+    }
+
+    /*
+     * invoke_next_batch () - read the next argument tuples and invoke the methods for all of them with one request
+     *
+     * return: scan code; the results are in m_batch_results
+     * error (out): error of the invocation
+     *
+     * Note: tuples whose results are found in the cache of deterministic methods are not sent.
+     */
+    SCAN_CODE
+    scanner::invoke_next_batch (int &error)
+    {
+      SCAN_CODE scan_code = S_SUCCESS;
+      std::size_t batch_size = (std::size_t) prm_get_integer_value (PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE);
+      int num_methods = m_method_group->get_num_methods ();
+      std::vector<std::vector<DB_VALUE>> arg_rows;
+      std::vector<std::size_t> invoked_tuples;	/* position in the batch of each tuple of arg_rows */
+      std::vector<DB_VALUE> results;
+
+      clear_batch ();
+
+      DB_VALUE null_val;
+      db_make_null (&null_val);
+
+      while (!m_is_list_end && m_batch_count < batch_size)
+	{
+	  scan_code = get_single_tuple ();
+	  if (scan_code == S_END)
+	    {
+	      m_is_list_end = true;
+	      break;
+	    }
+	  if (scan_code != S_SUCCESS)
+	    {
+	      break;
+	    }
+
+	  m_batch_results.resize ((m_batch_count + 1) * num_methods, null_val);
+	  if (m_result_cache != nullptr
+	      && m_result_cache->lookup (m_arg_vector, &m_batch_results[m_batch_count * num_methods]))
+	    {
+	      pr_clear_value_vector (m_arg_vector);
+	    }
+	  else
+	    {
+	      /* the tuple owns the argument values now */
+	      arg_rows.push_back (m_arg_vector);
+	      m_arg_vector.assign (m_arg_vector.size (), null_val);
+	      invoked_tuples.push_back (m_batch_count);
+	    }
+	  m_batch_count++;
+	}
+
+      if (scan_code != S_ERROR && !arg_rows.empty ())
+	{
+	  error = m_method_group->execute_batch (arg_rows, m_arg_use_vector, results);
+	  if (error == NO_ERROR)
+	    {
+	      for (std::size_t k = 0; k < invoked_tuples.size (); k++)
+		{
+		  DB_VALUE *tuple_results = &m_batch_results[invoked_tuples[k] * num_methods];
+
+		  for (int i = 0; i < num_methods; i++)
+		    {
+		      db_value_clone (&results[k * num_methods + i], &tuple_results[i]);
+		    }
+		  if (m_result_cache != nullptr)
+		    {
+		      m_result_cache->store (arg_rows[k], tuple_results);
+		    }
+		}
+	      m_method_group->reset (false);
+	    }
+	  else
+	    {
+	      scan_code = S_ERROR;
+	    }
+	}
+
+      for (std::vector<DB_VALUE> &args : arg_rows)
+	{
+	  pr_clear_value_vector (args);
+	}
+      pr_clear_value_vector (results);
+
+      if (scan_code == S_ERROR)
+	{
+	  clear_batch ();
+	  return S_ERROR;
+	}
+
+      return m_batch_count > 0 ? S_SUCCESS : S_END;
+    }
+
+    void
+    scanner::clear_batch ()
+    {
+      pr_clear_value_vector (m_batch_results);
+      m_batch_results.clear ();
+      m_batch_count = 0;
+      m_batch_pos = 0;
+    }
+
     int
     scanner::close_value_array ()
     {
@@ -26,6 +26,8 @@
 #endif /* !defined (SERVER_MODE) && !defined (SA_MODE) */
 
 #include <functional>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "dbtype_def.h" /* DB_VALUE */
@@ -52,6 +54,35 @@ namespace cubscan
 {
   namespace method
   {
+    /* results of deterministic methods by the arguments they use, kept for a query execution */
+    class result_cache
+    {
+      public:
+	result_cache (const std::vector<bool> &arg_use, int num_methods);
+	~result_cache ();
+
+	result_cache (const result_cache &) = delete;
+	result_cache &operator= (const result_cache &) = delete;
+
+	bool lookup (const std::vector<DB_VALUE> &args, DB_VALUE *results);
+	void store (const std::vector<DB_VALUE> &args, const DB_VALUE *results);
+
+      private:
+	struct entry
+	{
+	  std::vector<DB_VALUE> args;	/* copies of the used arguments */
+	  std::vector<DB_VALUE> results;	/* copies of the results, one for each method */
+	};
+
+	bool get_hash (const std::vector<DB_VALUE> &args, std::size_t &hash) const;
+	bool is_same_args (const std::vector<DB_VALUE> &args, const entry &e) const;
+
+	std::vector<int> m_arg_pos;	/* positions of the used arguments */
+	int m_num_methods;
+	std::unordered_multimap<std::size_t, std::unique_ptr<entry>> m_entries;
+	std::size_t m_memory_size;
+    };
+
     class scanner
     {
       public:
@@ -85,6 +116,14 @@ namespace cubscan
 
 	SCAN_CODE get_single_tuple ();
 
+//////////////////////////////////////////////////////////////////////////
+// invocation declarations
+//////////////////////////////////////////////////////////////////////////
+
+	SCAN_CODE invoke_single_tuple (int &error);
+	SCAN_CODE invoke_next_batch (int &error);
+	void clear_batch ();
+
       private:
 
 	cubthread::entry *m_thread_p; /* thread entry */
@@ -98,6 +137,14 @@ namespace cubscan
 	std::vector<bool> m_arg_use_vector;        /* arg is used for method, should be prepared */
 
 	qproc_db_value_list *m_dbval_list; /* result */
+
+	std::vector<DB_VALUE> m_row_results;	/* results of a tuple invoked alone */
+	std::vector<DB_VALUE> m_batch_results;	/* results of the tuples of a batch, tuple by tuple */
+	std::size_t m_batch_count;		/* tuples in the batch */
+	std::size_t m_batch_pos;		/* next tuple of the batch to return */
+	bool m_is_list_end;			/* every tuple of the list file has been read */
+
+	result_cache *m_result_cache;		/* for groups of deterministic methods */
     };
   }
 } // namespace cubscan
@@ -20,6 +20,7 @@
 
 #include <algorithm> /* std::for_each */
 
+#include "dbtype.h"		/* db_make_null */
 #include "object_representation.h"	/* OR_ */
 #include "method_struct_value.hpp"
 
@@ -234,4 +235,71 @@ namespace cubmethod
     size += serializator.get_packed_int_size (size); // return_type
     return size;
   }
+
+  invoke_java_batch::invoke_java_batch (const std::vector<invoke_java> &methods,
+					std::vector<std::vector<DB_VALUE>> &rows, const std::vector<bool> &arg_use)
+    : methods (methods), rows (rows), arg_use (arg_use)
+  {
+    //
+  }
+
+  void
+  invoke_java_batch::pack (cubpacking::packer &serializator) const
+  {
+    DB_VALUE null_val;
+    dbvalue_java dbvalue_wrapper;
+
+    db_make_null (&null_val);
+
+    serializator.pack_int (methods.size ());
+    for (const invoke_java &method : methods)
+      {
+	method.pack (serializator);
+      }
+
+    serializator.pack_int (rows.size ());
+    for (std::vector<DB_VALUE> &row : rows)
+      {
+	serializator.pack_int (row.size ());
+	for (size_t i = 0; i < row.size (); i++)
+	  {
+	    dbvalue_wrapper.value = arg_use[i] ? &row[i] : &null_val;
+	    dbvalue_wrapper.pack (serializator);
+	  }
+      }
+  }
+
+  void
+  invoke_java_batch::unpack (cubpacking::unpacker &deserializator)
+  {
+    // TODO: unpacking is not necessary
+    assert (false);
+  }
+
+  size_t
+  invoke_java_batch::get_packed_size (cubpacking::packer &serializator, std::size_t start_offset) const
+  {
+    DB_VALUE null_val;
+    dbvalue_java dbvalue_wrapper;
+
+    db_make_null (&null_val);
+
+    size_t size = serializator.get_packed_int_size (start_offset); // num_methods
+    for (const invoke_java &method : methods)
+      {
+	size += method.get_packed_size (serializator, size); // method
+      }
+
+    size += serializator.get_packed_int_size (size); // num_rows
+    for (std::vector<DB_VALUE> &row : rows)
+      {
+	size += serializator.get_packed_int_size (size); // arg count
+	for (size_t i = 0; i < row.size (); i++)
+	  {
+	    dbvalue_wrapper.value = arg_use[i] ? &row[i] : &null_val;
+	    size += dbvalue_wrapper.get_packed_size (serializator, size); // value
+	  }
+      }
+    return size;
+  }
 }
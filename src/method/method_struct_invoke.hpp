@@ -104,6 +104,24 @@ namespace cubmethod
     std::vector<int> arg_type;
     int result_type;
   };
+
+  /*
+  * request data to invoke java methods for each of a batch of argument tuples
+  */
+  struct invoke_java_batch : public cubpacking::packable_object
+  {
+    invoke_java_batch () = delete;
+    invoke_java_batch (const std::vector<invoke_java> &methods, std::vector<std::vector<DB_VALUE>> &rows,
+		       const std::vector<bool> &arg_use);
+
+    void pack (cubpacking::packer &serializator) const override;
+    void unpack (cubpacking::unpacker &deserializator) override;
+    size_t get_packed_size (cubpacking::packer &serializator, std::size_t start_offset) const override;
+
+    const std::vector<invoke_java> &methods;
+    std::vector<std::vector<DB_VALUE>> &rows;	/* argument tuples */
+    const std::vector<bool> &arg_use;		/* unused arguments are sent as null */
+  };
 } // namespace cubmethod
 
 #endif
@@ -0,0 +1,569 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_active_session_history.cpp - samples of what the active server threads are waiting on
+//
+
+#include "monitor_active_session_history.hpp"
+
+#include "db_date.h"
+#include "dbtype.h"
+#include "error_manager.h"
+#include "porting.h"
+#include "query_manager.h"
+#include "show_scan.h"
+#include "storage_common.h"
+#include "system_parameter.h"
+#include "thread_entry.hpp"
+#if defined (SERVER_MODE)
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_looper.hpp"
+#include "thread_manager.hpp"
+#include "vacuum.h"
+#endif // SERVER_MODE
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#define ASH_SCAN_COLUMN_COUNT 6
+
+/* SQL_IDs listed in the dump summary */
+#define ASH_DUMP_TOP_SQL_COUNT 10
+
+typedef enum
+{
+  ASH_EVENT_CPU = 0,		/* running or in a wait nobody publishes */
+  ASH_EVENT_PAGE_LATCH,		/* page latch wait */
+  ASH_EVENT_PAGE_BUFFER,	/* waiting for a victim buffer */
+  ASH_EVENT_LOCK,		/* lock wait */
+  ASH_EVENT_LOG_FLUSH,		/* waiting for the log writer */
+  ASH_EVENT_IO,			/* volume read, write or sync, double write buffer */
+  ASH_EVENT_CSECT,		/* critical section wait */
+  ASH_EVENT_NETWORK,		/* sending to or waiting for the client */
+  ASH_EVENT_OTHER,		/* other suspensions on the thread entry */
+
+  ASH_EVENT_COUNT
+} ASH_EVENT;
+
+static const char *ash_Event_names[ASH_EVENT_COUNT] = {
+  "CPU", "PAGE_LATCH", "PAGE_BUFFER", "LOCK", "LOG_FLUSH", "IO", "CSECT", "NETWORK", "OTHER"
+};
+
+typedef struct ash_sample ASH_SAMPLE;
+struct ash_sample
+{
+  INT64 sample_time;		/* milliseconds since the epoch */
+  UINT64 sql_id;		/* SQL_ID of the executing query as a number, 0 if none */
+  int thread_index;
+  int tran_index;
+  short thread_type;		/* thread_type */
+  short event;			/* ASH_EVENT */
+};
+
+/* ash_Samples[ash_Num_taken % ash_Capacity] is the slot of the next sample; all protected by ash_Mutex */
+static std::mutex ash_Mutex;
+static ASH_SAMPLE *ash_Samples = NULL;
+static int ash_Capacity = 0;
+static UINT64 ash_Num_taken = 0;
+
+#if defined (SERVER_MODE)
+static cubthread::daemon *ash_Sampler_daemon = NULL;
+#endif // SERVER_MODE
+
+static int ash_copy_samples (ASH_SAMPLE ** samples_out, int *count_out, UINT64 * num_taken_out);
+static void ash_format_sql_id (UINT64 sql_id, char *buf);
+static void ash_format_time (INT64 sample_time, char *buf, size_t buf_size);
+#if defined (SERVER_MODE)
+static bool ash_is_active (const cubthread::entry & thread_ref);
+static ASH_EVENT ash_get_event (const cubthread::entry & thread_ref);
+static void ash_sample_mapfunc (cubthread::entry & thread_ref, bool & stop_mapper, INT64 sample_time);
+static void ash_sample_execute (cubthread::entry & thread_ref);
+#endif // SERVER_MODE
+
+#if defined (SERVER_MODE)
+/*
+ * ash_is_active () - is the thread working for a transaction or for vacuum?
+ *
+ * return          : true to sample the thread
+ * thread_ref (in) : thread entry
+ */
+static bool
+ash_is_active (const cubthread::entry & thread_ref)
+{
+  if (thread_ref.m_status != cubthread::entry::status::TS_RUN
+      && thread_ref.m_status != cubthread::entry::status::TS_WAIT)
+    {
+      return false;
+    }
+
+  switch (thread_ref.type)
+    {
+    case TT_WORKER:
+    case TT_LOADDB:
+      return thread_ref.tran_index != NULL_TRAN_INDEX;
+    case TT_VACUUM_WORKER:
+      return thread_ref.vacuum_worker != NULL && thread_ref.vacuum_worker->state != VACUUM_WORKER_STATE_INACTIVE;
+    default:
+      return false;
+    }
+}
+
+/*
+ * ash_get_event () - what the thread is waiting on now
+ *
+ * return          : wait event
+ * thread_ref (in) : thread entry
+ *
+ * note: the fields are read without the entry lock, like SHOW THREADS does; a sample may be off by one transition.
+ */
+static ASH_EVENT
+ash_get_event (const cubthread::entry & thread_ref)
+{
+  if (thread_ref.m_status == cubthread::entry::status::TS_WAIT)
+    {
+      switch (thread_ref.resume_status)
+	{
+	case THREAD_PGBUF_SUSPENDED:
+	  return ASH_EVENT_PAGE_LATCH;
+	case THREAD_ALLOC_BCB_SUSPENDED:
+	  return ASH_EVENT_PAGE_BUFFER;
+	case THREAD_LOCK_SUSPENDED:
+	  return ASH_EVENT_LOCK;
+	case THREAD_LOGWR_SUSPENDED:
+	  return ASH_EVENT_LOG_FLUSH;
+	case THREAD_DWB_QUEUE_SUSPENDED:
+	  return ASH_EVENT_IO;
+	case THREAD_CSECT_READER_SUSPENDED:
+	case THREAD_CSECT_WRITER_SUSPENDED:
+	case THREAD_CSECT_PROMOTER_SUSPENDED:
+	  return ASH_EVENT_CSECT;
+	case THREAD_CSS_QUEUE_SUSPENDED:
+	  return ASH_EVENT_NETWORK;
+	default:
+	  return ASH_EVENT_OTHER;
+	}
+    }
+
+  switch (thread_ref.wait_event.load (std::memory_order_relaxed))
+    {
+    case THREAD_WAIT_EVENT_IO:
+      return ASH_EVENT_IO;
+    case THREAD_WAIT_EVENT_NETWORK:
+      return ASH_EVENT_NETWORK;
+    default:
+      return ASH_EVENT_CPU;
+    }
+}
+
+/*
+ * ash_sample_mapfunc () - record a sample of an active thread; mapped over all thread entries with ash_Mutex held
+ *
+ * thread_ref (in)   : thread entry
+ * stop_mapper (out) : ignored
+ * sample_time (in)  : time of this sampling round
+ */
+static void
+ash_sample_mapfunc (cubthread::entry & thread_ref, bool & stop_mapper, INT64 sample_time)
+{
+  ASH_SAMPLE *sample;
+
+  (void) stop_mapper;		// suppress unused warning
+
+  if (!ash_is_active (thread_ref))
+    {
+      return;
+    }
+
+  sample = &ash_Samples[ash_Num_taken % ash_Capacity];
+  sample->sample_time = sample_time;
+  sample->sql_id = thread_ref.sql_id.load (std::memory_order_relaxed);
+  sample->thread_index = thread_ref.index;
+  sample->tran_index = thread_ref.tran_index;
+  sample->thread_type = (short) thread_ref.type;
+  sample->event = (short) ash_get_event (thread_ref);
+
+  ash_Num_taken++;
+}
+
+/*
+ * ash_sample_execute () - sampling round of the active session history daemon
+ *
+ * thread_ref (in) : daemon thread entry
+ */
+static void
+ash_sample_execute (cubthread::entry & thread_ref)
+{
+  INT64 sample_time;
+
+  (void) thread_ref;		// suppress unused warning
+
+  // *INDENT-OFF*
+  sample_time = std::chrono::duration_cast<std::chrono::milliseconds>
+    (std::chrono::system_clock::now ().time_since_epoch ()).count ();
+
+  std::lock_guard<std::mutex> guard (ash_Mutex);
+  // *INDENT-ON*
+  thread_get_manager ()->map_entries (ash_sample_mapfunc, sample_time);
+}
+#endif // SERVER_MODE
+
+/*
+ * ash_daemon_init () - allocate the samples and start the sampler daemon, if active_session_history is on
+ */
+void
+ash_daemon_init (void)
+{
+#if defined (SERVER_MODE)
+  int capacity;
+
+  assert (ash_Sampler_daemon == NULL);
+
+  if (!prm_get_bool_value (PRM_ID_ACTIVE_SESSION_HISTORY))
+    {
+      return;
+    }
+
+  capacity = prm_get_integer_value (PRM_ID_ACTIVE_SESSION_HISTORY_SIZE);
+  ash_Samples = (ASH_SAMPLE *) malloc (capacity * sizeof (ASH_SAMPLE));
+  if (ash_Samples == NULL)
+    {
+      /* the server runs without samples */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, capacity * sizeof (ASH_SAMPLE));
+      return;
+    }
+  ash_Capacity = capacity;
+  ash_Num_taken = 0;
+
+  // *INDENT-OFF*
+  cubthread::looper looper =
+    cubthread::looper (std::chrono::milliseconds (prm_get_integer_value (PRM_ID_ACTIVE_SESSION_HISTORY_INTERVAL)));
+  // *INDENT-ON*
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (ash_sample_execute);
+
+  ash_Sampler_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "active_session_history");
+#endif // SERVER_MODE
+}
+
+/*
+ * ash_daemon_destroy () - stop the sampler daemon and free the samples
+ */
+void
+ash_daemon_destroy (void)
+{
+#if defined (SERVER_MODE)
+  if (ash_Sampler_daemon != NULL)
+    {
+      cubthread::get_manager ()->destroy_daemon (ash_Sampler_daemon);
+    }
+
+  // *INDENT-OFF*
+  std::lock_guard<std::mutex> guard (ash_Mutex);
+  // *INDENT-ON*
+  if (ash_Samples != NULL)
+    {
+      free_and_init (ash_Samples);
+    }
+  ash_Capacity = 0;
+  ash_Num_taken = 0;
+#endif // SERVER_MODE
+}
+
+/*
+ * ash_copy_samples () - copy the kept samples, oldest first, so that readers do not hold up the sampler
+ *
+ * return             : error code
+ * samples_out (out)  : malloc'ed copy or NULL if there are no samples; the caller frees it
+ * count_out (out)    : number of samples copied
+ * num_taken_out (out): number of samples taken since the server started
+ */
+static int
+ash_copy_samples (ASH_SAMPLE ** samples_out, int *count_out, UINT64 * num_taken_out)
+{
+  ASH_SAMPLE *samples;
+  int count, first;
+
+  *samples_out = NULL;
+  *count_out = 0;
+
+  // *INDENT-OFF*
+  std::lock_guard<std::mutex> guard (ash_Mutex);
+  // *INDENT-ON*
+
+  *num_taken_out = ash_Num_taken;
+  if (ash_Samples == NULL || ash_Num_taken == 0)
+    {
+      return NO_ERROR;
+    }
+
+  count = (int) MIN (ash_Num_taken, (UINT64) ash_Capacity);
+  samples = (ASH_SAMPLE *) malloc (count * sizeof (ASH_SAMPLE));
+  if (samples == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, count * sizeof (ASH_SAMPLE));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  /* the oldest sample is the next slot to be overwritten once the ring is full */
+  first = (count < ash_Capacity) ? 0 : (int) (ash_Num_taken % ash_Capacity);
+  memcpy (samples, ash_Samples + first, (count - first) * sizeof (ASH_SAMPLE));
+  memcpy (samples + (count - first), ash_Samples, first * sizeof (ASH_SAMPLE));
+
+  *samples_out = samples;
+  *count_out = count;
+  return NO_ERROR;
+}
+
+/*
+ * ash_format_sql_id () - print a SQL_ID published as a number the way qmgr_get_sql_id () prints it
+ *
+ * sql_id (in) : SQL_ID as a number
+ * buf (out)   : at least QMGR_SQL_ID_LENGTH + 1 characters
+ */
+static void
+ash_format_sql_id (UINT64 sql_id, char *buf)
+{
+  snprintf (buf, QMGR_SQL_ID_LENGTH + 1, "%0*llx", QMGR_SQL_ID_LENGTH, (unsigned long long) sql_id);
+}
+
+/*
+ * ash_format_time () - print a sample time as local time with milliseconds
+ */
+static void
+ash_format_time (INT64 sample_time, char *buf, size_t buf_size)
+{
+  time_t sec = (time_t) (sample_time / 1000);
+  struct tm tm_val;
+  size_t len;
+
+  localtime_r (&sec, &tm_val);
+  len = strftime (buf, buf_size, "%Y-%m-%d %H:%M:%S", &tm_val);
+  snprintf (buf + len, buf_size - len, ".%03d", (int) (sample_time % 1000));
+}
+
+/*
+ * ash_start_scan () - start scan function for show active session history
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ */
+int
+ash_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  ASH_SAMPLE *samples = NULL;
+  DB_VALUE *vals;
+  DB_DATETIME time_val;
+  time_t sec;
+  char sql_id_buf[QMGR_SQL_ID_LENGTH + 1];
+  int count, i, idx;
+  UINT64 num_taken;
+  int error = NO_ERROR;
+
+  *ptr = NULL;
+
+  error = ash_copy_samples (&samples, &count, &num_taken);
+  if (error != NO_ERROR || count == 0)
+    {
+      return error;
+    }
+
+  ctx = showstmt_alloc_array_context (thread_p, count, ASH_SCAN_COLUMN_COUNT);
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto exit;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  showstmt_free_array_context (thread_p, ctx);
+	  goto exit;
+	}
+
+      idx = 0;
+
+      /* Sample_time */
+      sec = (time_t) (samples[i].sample_time / 1000);
+      db_localdatetime_msec (&sec, (int) (samples[i].sample_time % 1000), &time_val);
+      db_make_datetime (&vals[idx], &time_val);
+      idx++;
+
+      /* Thread_index */
+      db_make_int (&vals[idx], samples[i].thread_index);
+      idx++;
+
+      /* Thread_type */
+      db_make_string (&vals[idx], thread_type_to_string ((thread_type) samples[i].thread_type));
+      idx++;
+
+      /* Tran_index */
+      db_make_int (&vals[idx], samples[i].tran_index);
+      idx++;
+
+      /* Wait_event */
+      db_make_string (&vals[idx], ash_Event_names[samples[i].event]);
+      idx++;
+
+      /* Sql_id */
+      if (samples[i].sql_id != 0)
+	{
+	  ash_format_sql_id (samples[i].sql_id, sql_id_buf);
+	  error = db_make_string_copy (&vals[idx], sql_id_buf);
+	  if (error != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      showstmt_free_array_context (thread_p, ctx);
+	      goto exit;
+	    }
+	}
+      else
+	{
+	  db_make_null (&vals[idx]);
+	}
+      idx++;
+
+      assert (idx == ASH_SCAN_COLUMN_COUNT);
+    }
+
+  *ptr = ctx;
+
+exit:
+  free_and_init (samples);
+  return error;
+}
+
+/*
+ * xash_dump () - dump the kept samples with a summary by wait event and by SQL_ID
+ *
+ * thread_p (in) : thread entry
+ * outfp (in)    : output file
+ */
+void
+xash_dump (THREAD_ENTRY * thread_p, FILE * outfp)
+{
+  ASH_SAMPLE *samples = NULL;
+  int count, i;
+  UINT64 num_taken;
+  int event_counts[ASH_EVENT_COUNT] = { 0 };
+  char sql_id_buf[QMGR_SQL_ID_LENGTH + 1];
+  char time_buf[32];
+
+  (void) thread_p;		// suppress unused warning
+
+  if (outfp == NULL)
+    {
+      outfp = stdout;
+    }
+
+  fprintf (outfp, "\n*** Active Session History ***\n");
+  if (!prm_get_bool_value (PRM_ID_ACTIVE_SESSION_HISTORY))
+    {
+      fprintf (outfp, "active_session_history is off.\n");
+      return;
+    }
+
+  if (ash_copy_samples (&samples, &count, &num_taken) != NO_ERROR)
+    {
+      fprintf (outfp, "Cannot copy the samples.\n");
+      return;
+    }
+
+  fprintf (outfp, "Sampling interval = %d msecs, samples kept = %d, samples taken = %llu\n",
+	   prm_get_integer_value (PRM_ID_ACTIVE_SESSION_HISTORY_INTERVAL), count, (unsigned long long) num_taken);
+  if (count == 0)
+    {
+      return;
+    }
+
+  ash_format_time (samples[0].sample_time, time_buf, sizeof (time_buf));
+  fprintf (outfp, "From %s", time_buf);
+  ash_format_time (samples[count - 1].sample_time, time_buf, sizeof (time_buf));
+  fprintf (outfp, " to %s\n", time_buf);
+
+  // *INDENT-OFF*
+  std::unordered_map<UINT64, int> sql_map;
+  // *INDENT-ON*
+
+  for (i = 0; i < count; i++)
+    {
+      event_counts[samples[i].event]++;
+      if (samples[i].sql_id != 0)
+	{
+	  sql_map[samples[i].sql_id]++;
+	}
+    }
+
+  fprintf (outfp, "\nWait event        Samples        %%\n");
+  for (i = 0; i < ASH_EVENT_COUNT; i++)
+    {
+      if (event_counts[i] > 0)
+	{
+	  fprintf (outfp, "%-12s %12d %8.2f\n", ash_Event_names[i], event_counts[i],
+		   100.0 * event_counts[i] / count);
+	}
+    }
+
+  /* the SQL_IDs with the most samples */
+  // *INDENT-OFF*
+  std::vector<std::pair<UINT64, int>> sql_counts (sql_map.begin (), sql_map.end ());
+  std::sort (sql_counts.begin (), sql_counts.end (),
+	     [] (const std::pair<UINT64, int> &a, const std::pair<UINT64, int> &b) { return a.second > b.second; });
+  // *INDENT-ON*
+
+  fprintf (outfp, "\nSQL_ID              Samples        %%\n");
+  for (i = 0; i < (int) sql_counts.size () && i < ASH_DUMP_TOP_SQL_COUNT; i++)
+    {
+      ash_format_sql_id (sql_counts[i].first, sql_id_buf);
+      fprintf (outfp, "%-13s %12d %8.2f\n", sql_id_buf, sql_counts[i].second, 100.0 * sql_counts[i].second / count);
+    }
+
+  fprintf (outfp, "\nSample time              Thread   Tran  Type           Wait event   SQL_ID\n");
+  for (i = 0; i < count; i++)
+    {
+      ash_format_time (samples[i].sample_time, time_buf, sizeof (time_buf));
+      if (samples[i].sql_id != 0)
+	{
+	  ash_format_sql_id (samples[i].sql_id, sql_id_buf);
+	}
+      else
+	{
+	  strcpy (sql_id_buf, "-");
+	}
+      fprintf (outfp, "%-23s %7d %6d  %-14s %-12s %s\n", time_buf, samples[i].thread_index, samples[i].tran_index,
+	       thread_type_to_string ((thread_type) samples[i].thread_type), ash_Event_names[samples[i].event],
+	       sql_id_buf);
+    }
+
+  free_and_init (samples);
+}
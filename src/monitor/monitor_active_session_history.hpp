@@ -0,0 +1,50 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_active_session_history.hpp - samples of what the active server threads are waiting on
+//
+//  When active_session_history is on, a daemon looks at every thread entry each
+//  active_session_history_interval_in_msecs and records one sample for each thread that works for a transaction or
+//  for vacuum. The sample has the wait event of the thread and the SQL_ID of the query it executes. Waits on the
+//  thread entry (page latch, page buffer victim, lock, log flush, critical section, client reply) are read from its
+//  resume status; volume I/O and sends to clients are published by the thread itself; anything else counts as CPU.
+//
+//  The last active_session_history_size samples are kept in a ring buffer. They are read by
+//  SHOW ACTIVE SESSION HISTORY and written to a file by ";info ash" of csql.
+//
+
+#ifndef _MONITOR_ACTIVE_SESSION_HISTORY_HPP_
+#define _MONITOR_ACTIVE_SESSION_HISTORY_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "dbtype_def.h"
+#include "thread_compat.hpp"
+
+#include <cstdio>
+
+extern void ash_daemon_init (void);
+extern void ash_daemon_destroy (void);
+
+extern int ash_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr);
+extern void xash_dump (THREAD_ENTRY * thread_p, FILE * outfp);
+
+#endif // _MONITOR_ACTIVE_SESSION_HISTORY_HPP_
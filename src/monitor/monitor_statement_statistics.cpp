@@ -0,0 +1,586 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_statement_statistics.cpp - resources used by the executions of each statement
+//
+
+#include "monitor_statement_statistics.hpp"
+
+#include "db_date.h"
+#include "dbtype.h"
+#include "error_manager.h"
+#include "porting.h"
+#include "query_manager.h"
+#include "sha1.h"
+#include "show_scan.h"
+#include "storage_common.h"
+#include "system_parameter.h"
+#include "xasl_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#define STMTSTAT_SCAN_COLUMN_COUNT 16
+
+/* the entries are split by key to keep the executing threads from waiting for each other */
+#define STMTSTAT_STRIPE_COUNT 16
+
+/* part of a full stripe that is dropped at once, so that the eviction is not repeated for every new statement */
+#define STMTSTAT_EVICT_RATIO 0.05
+
+/* bytes of the statement text kept with an entry */
+#define STMTSTAT_SQL_TEXT_LENGTH 1024
+
+typedef struct stmtstat_key STMTSTAT_KEY;
+struct stmtstat_key
+{
+  UINT64 sql_id;		/* SQL_ID of the statement as a number */
+  XASL_ID xasl_id;		/* plan of the statement; cache_flag is not used */
+};
+
+typedef struct stmtstat_entry STMTSTAT_ENTRY;
+struct stmtstat_entry
+{
+  STMTSTAT_KEY key;
+  INT64 calls;
+  INT64 errors;
+  INT64 total_usec;
+  INT64 max_usec;
+  INT64 cpu_usec;
+  INT64 rows;
+  THREAD_RESOURCE_USAGE usage;
+  INT64 last_call_msec;		/* milliseconds since the epoch */
+  char sql_text[STMTSTAT_SQL_TEXT_LENGTH + 1];
+};
+
+// *INDENT-OFF*
+struct stmtstat_key_hash
+{
+  size_t operator() (const STMTSTAT_KEY &key) const
+  {
+    return std::hash<UINT64> () (key.sql_id ^ ((UINT64) key.xasl_id.time_stored.sec << 20)
+				 ^ (UINT64) key.xasl_id.time_stored.usec);
+  }
+};
+
+struct stmtstat_key_equal
+{
+  bool operator() (const STMTSTAT_KEY &a, const STMTSTAT_KEY &b) const
+  {
+    /* keys are zeroed by stmtstat_make_key before they are filled */
+    return memcmp (&a, &b, sizeof (STMTSTAT_KEY)) == 0;
+  }
+};
+// *INDENT-ON*
+
+typedef struct stmtstat_stripe STMTSTAT_STRIPE;
+struct stmtstat_stripe
+{
+  std::mutex mutex;
+  // *INDENT-OFF*
+  std::vector<STMTSTAT_ENTRY> entries;
+  std::unordered_map<STMTSTAT_KEY, size_t, stmtstat_key_hash, stmtstat_key_equal> index;	/* key to entries */
+  // *INDENT-ON*
+};
+
+static STMTSTAT_STRIPE stmtstat_Stripes[STMTSTAT_STRIPE_COUNT];
+static size_t stmtstat_Stripe_capacity = 0;	/* 0 if statement_statistics is off */
+
+static INT64 stmtstat_get_thread_cpu_usec (void);
+static INT64 stmtstat_get_steady_usec (void);
+static void stmtstat_make_key (const XASL_CACHE_ENTRY * xasl_ent, STMTSTAT_KEY * key);
+static void stmtstat_copy_sql_text (const XASL_CACHE_ENTRY * xasl_ent, char *buf);
+static void stmtstat_evict (STMTSTAT_STRIPE & stripe);
+static int stmtstat_copy_entries (STMTSTAT_ENTRY ** entries_out, int *count_out);
+
+/*
+ * stmtstat_init () - size the table of statement statistics, if statement_statistics is on
+ */
+void
+stmtstat_init (void)
+{
+  int i;
+
+  if (!prm_get_bool_value (PRM_ID_STATEMENT_STATISTICS))
+    {
+      stmtstat_Stripe_capacity = 0;
+      return;
+    }
+
+  stmtstat_Stripe_capacity =
+    MAX (prm_get_integer_value (PRM_ID_STATEMENT_STATISTICS_SIZE) / STMTSTAT_STRIPE_COUNT, 1);
+  for (i = 0; i < STMTSTAT_STRIPE_COUNT; i++)
+    {
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> guard (stmtstat_Stripes[i].mutex);
+      // *INDENT-ON*
+      stmtstat_Stripes[i].entries.clear ();
+      stmtstat_Stripes[i].entries.reserve (stmtstat_Stripe_capacity);
+      stmtstat_Stripes[i].index.clear ();
+    }
+}
+
+/*
+ * stmtstat_final () - stop recording and free the table of statement statistics
+ */
+void
+stmtstat_final (void)
+{
+  int i;
+
+  stmtstat_Stripe_capacity = 0;
+  for (i = 0; i < STMTSTAT_STRIPE_COUNT; i++)
+    {
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> guard (stmtstat_Stripes[i].mutex);
+      std::vector<STMTSTAT_ENTRY> ().swap (stmtstat_Stripes[i].entries);
+      // *INDENT-ON*
+      stmtstat_Stripes[i].index.clear ();
+    }
+}
+
+/*
+ * stmtstat_get_thread_cpu_usec () - CPU time used by the calling thread
+ */
+static INT64
+stmtstat_get_thread_cpu_usec (void)
+{
+#if defined (WINDOWS)
+  return 0;
+#else /* WINDOWS */
+  struct timespec ts;
+
+  if (clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+    {
+      return 0;
+    }
+  return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+#endif /* !WINDOWS */
+}
+
+/*
+ * stmtstat_get_steady_usec () - microseconds of the steady clock
+ */
+static INT64
+stmtstat_get_steady_usec (void)
+{
+  // *INDENT-OFF*
+  return std::chrono::duration_cast<std::chrono::microseconds>
+    (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+  // *INDENT-ON*
+}
+
+/*
+ * stmtstat_start_query () - remember what the thread had used before executing a query
+ *
+ * thread_p (in)  : thread entry
+ * xasl_ent (in)  : XASL cache entry of the query or NULL
+ * snapshot (out) : what stmtstat_end_query needs
+ */
+void
+stmtstat_start_query (THREAD_ENTRY * thread_p, const XASL_CACHE_ENTRY * xasl_ent, STMTSTAT_SNAPSHOT * snapshot)
+{
+  snapshot->is_recording = false;
+
+  if (thread_p == NULL || xasl_ent == NULL || stmtstat_Stripe_capacity == 0)
+    {
+      return;
+    }
+
+  snapshot->usage = thread_p->resource_usage;
+  snapshot->start_cpu_usec = stmtstat_get_thread_cpu_usec ();
+  snapshot->start_usec = stmtstat_get_steady_usec ();
+  snapshot->is_recording = true;
+}
+
+/*
+ * stmtstat_make_key () - key of the entry of a cached plan
+ */
+static void
+stmtstat_make_key (const XASL_CACHE_ENTRY * xasl_ent, STMTSTAT_KEY * key)
+{
+  memset (key, 0, sizeof (*key));
+  key->sql_id = xasl_ent->sql_id;
+  key->xasl_id.sha1 = xasl_ent->xasl_id.sha1;
+  key->xasl_id.time_stored = xasl_ent->xasl_id.time_stored;
+}
+
+/*
+ * stmtstat_copy_sql_text () - keep the beginning of the statement text without cutting a UTF-8 character
+ *
+ * buf (out) : at least STMTSTAT_SQL_TEXT_LENGTH + 1 bytes
+ */
+static void
+stmtstat_copy_sql_text (const XASL_CACHE_ENTRY * xasl_ent, char *buf)
+{
+  const char *text = xasl_ent->sql_info.sql_user_text;
+  size_t len;
+
+  if (text == NULL)
+    {
+      text = EXEINFO_HASH_TEXT_STRING (&xasl_ent->sql_info);
+    }
+
+  len = strlen (text);
+  if (len > STMTSTAT_SQL_TEXT_LENGTH)
+    {
+      len = STMTSTAT_SQL_TEXT_LENGTH;
+      while (len > 0 && (((unsigned char) text[len]) & 0xC0) == 0x80)
+	{
+	  len--;
+	}
+    }
+  memcpy (buf, text, len);
+  buf[len] = '\0';
+}
+
+/*
+ * stmtstat_evict () - drop the entries of a full stripe with the least total elapsed time; stripe mutex is held
+ */
+static void
+stmtstat_evict (STMTSTAT_STRIPE & stripe)
+{
+  size_t keep, i;
+
+  keep = stripe.entries.size () - MAX ((size_t) (stripe.entries.size () * STMTSTAT_EVICT_RATIO), 1);
+
+  // *INDENT-OFF*
+  std::nth_element (stripe.entries.begin (), stripe.entries.begin () + keep, stripe.entries.end (),
+		    [] (const STMTSTAT_ENTRY & a, const STMTSTAT_ENTRY & b)
+		    {
+		      return a.total_usec > b.total_usec;
+		    });
+  // *INDENT-ON*
+  stripe.entries.resize (keep);
+
+  stripe.index.clear ();
+  for (i = 0; i < stripe.entries.size (); i++)
+    {
+      stripe.index[stripe.entries[i].key] = i;
+    }
+}
+
+/*
+ * stmtstat_end_query () - add an execution to the entry of its statement
+ *
+ * thread_p (in) : thread entry
+ * xasl_ent (in) : XASL cache entry of the query or NULL
+ * snapshot (in) : filled by stmtstat_start_query
+ * rows (in)     : rows of the result
+ * is_error (in) : did the execution fail?
+ */
+void
+stmtstat_end_query (THREAD_ENTRY * thread_p, const XASL_CACHE_ENTRY * xasl_ent, const STMTSTAT_SNAPSHOT * snapshot,
+		    INT64 rows, bool is_error)
+{
+  STMTSTAT_KEY key;
+  STMTSTAT_ENTRY *entry;
+  INT64 elapsed_usec, cpu_usec;
+  size_t entry_index;
+
+  if (thread_p == NULL || xasl_ent == NULL || !snapshot->is_recording || stmtstat_Stripe_capacity == 0)
+    {
+      return;
+    }
+
+  elapsed_usec = stmtstat_get_steady_usec () - snapshot->start_usec;
+  cpu_usec = stmtstat_get_thread_cpu_usec () - snapshot->start_cpu_usec;
+  stmtstat_make_key (xasl_ent, &key);
+
+  // *INDENT-OFF*
+  STMTSTAT_STRIPE &stripe = stmtstat_Stripes[stmtstat_key_hash () (key) % STMTSTAT_STRIPE_COUNT];
+  std::lock_guard<std::mutex> guard (stripe.mutex);
+
+  auto it = stripe.index.find (key);
+  // *INDENT-ON*
+  if (it != stripe.index.end ())
+    {
+      entry_index = it->second;
+    }
+  else
+    {
+      if (stripe.entries.size () >= stmtstat_Stripe_capacity)
+	{
+	  stmtstat_evict (stripe);
+	}
+
+      entry_index = stripe.entries.size ();
+      stripe.entries.emplace_back ();
+      entry = &stripe.entries[entry_index];
+      memset (entry, 0, sizeof (*entry));
+      entry->key = key;
+      stmtstat_copy_sql_text (xasl_ent, entry->sql_text);
+      stripe.index[key] = entry_index;
+    }
+
+  entry = &stripe.entries[entry_index];
+  entry->calls++;
+  if (is_error)
+    {
+      entry->errors++;
+    }
+  entry->total_usec += elapsed_usec;
+  entry->max_usec = MAX (entry->max_usec, elapsed_usec);
+  entry->cpu_usec += cpu_usec;
+  entry->rows += rows;
+  entry->usage.page_fetches += thread_p->resource_usage.page_fetches - snapshot->usage.page_fetches;
+  entry->usage.page_ioreads += thread_p->resource_usage.page_ioreads - snapshot->usage.page_ioreads;
+  entry->usage.temp_pages += thread_p->resource_usage.temp_pages - snapshot->usage.temp_pages;
+  entry->usage.lock_wait_usec += thread_p->resource_usage.lock_wait_usec - snapshot->usage.lock_wait_usec;
+  // *INDENT-OFF*
+  entry->last_call_msec = std::chrono::duration_cast<std::chrono::milliseconds>
+    (std::chrono::system_clock::now ().time_since_epoch ()).count ();
+  // *INDENT-ON*
+}
+
+/*
+ * xstmtstat_reset () - drop all entries of the statement statistics
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ */
+int
+xstmtstat_reset (THREAD_ENTRY * thread_p)
+{
+  int i;
+
+  (void) thread_p;		// suppress unused warning
+
+  for (i = 0; i < STMTSTAT_STRIPE_COUNT; i++)
+    {
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> guard (stmtstat_Stripes[i].mutex);
+      // *INDENT-ON*
+      stmtstat_Stripes[i].entries.clear ();
+      stmtstat_Stripes[i].index.clear ();
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stmtstat_copy_entries () - copy the entries of all stripes, so that readers do not hold up the executing threads
+ *
+ * return           : error code
+ * entries_out (out): malloc'ed copy or NULL if there are no entries; the caller frees it
+ * count_out (out)  : number of entries copied
+ */
+static int
+stmtstat_copy_entries (STMTSTAT_ENTRY ** entries_out, int *count_out)
+{
+  STMTSTAT_ENTRY *entries;
+  size_t capacity, count;
+  int i;
+
+  *entries_out = NULL;
+  *count_out = 0;
+
+  capacity = stmtstat_Stripe_capacity * STMTSTAT_STRIPE_COUNT;
+  if (capacity == 0)
+    {
+      return NO_ERROR;
+    }
+
+  entries = (STMTSTAT_ENTRY *) malloc (capacity * sizeof (STMTSTAT_ENTRY));
+  if (entries == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, capacity * sizeof (STMTSTAT_ENTRY));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  count = 0;
+  for (i = 0; i < STMTSTAT_STRIPE_COUNT; i++)
+    {
+      // *INDENT-OFF*
+      std::lock_guard<std::mutex> guard (stmtstat_Stripes[i].mutex);
+      // *INDENT-ON*
+      assert (count + stmtstat_Stripes[i].entries.size () <= capacity);
+      if (!stmtstat_Stripes[i].entries.empty ())
+	{
+	  memcpy (entries + count, stmtstat_Stripes[i].entries.data (),
+		  stmtstat_Stripes[i].entries.size () * sizeof (STMTSTAT_ENTRY));
+	  count += stmtstat_Stripes[i].entries.size ();
+	}
+    }
+
+  if (count == 0)
+    {
+      free_and_init (entries);
+    }
+
+  *entries_out = entries;
+  *count_out = (int) count;
+  return NO_ERROR;
+}
+
+/*
+ * stmtstat_start_scan () - start scan function for show statement statistics
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ */
+int
+stmtstat_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  STMTSTAT_ENTRY *entries = NULL;
+  STMTSTAT_ENTRY *entry;
+  DB_VALUE *vals;
+  DB_DATETIME time_val;
+  time_t sec;
+  char sql_id_buf[QMGR_SQL_ID_LENGTH + 1];
+  char xasl_id_buf[5 * 8 + 1];	/* the five words of the SHA-1 in hex */
+  int count, i, idx;
+  int error = NO_ERROR;
+
+  *ptr = NULL;
+
+  error = stmtstat_copy_entries (&entries, &count);
+  if (error != NO_ERROR || count == 0)
+    {
+      return error;
+    }
+
+  ctx = showstmt_alloc_array_context (thread_p, count, STMTSTAT_SCAN_COLUMN_COUNT);
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      goto exit;
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      entry = &entries[i];
+
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  showstmt_free_array_context (thread_p, ctx);
+	  goto exit;
+	}
+
+      idx = 0;
+
+      /* Sql_id, printed the way qmgr_get_sql_id () prints it */
+      snprintf (sql_id_buf, sizeof (sql_id_buf), "%0*llx", QMGR_SQL_ID_LENGTH, (unsigned long long) entry->key.sql_id);
+      error = db_make_string_copy (&vals[idx], sql_id_buf);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  showstmt_free_array_context (thread_p, ctx);
+	  goto exit;
+	}
+      idx++;
+
+      /* Xasl_id */
+      snprintf (xasl_id_buf, sizeof (xasl_id_buf), "%08x%08x%08x%08x%08x", SHA1_AS_ARGS (&entry->key.xasl_id.sha1));
+      error = db_make_string_copy (&vals[idx], xasl_id_buf);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  showstmt_free_array_context (thread_p, ctx);
+	  goto exit;
+	}
+      idx++;
+
+      /* Plan_time */
+      sec = (time_t) entry->key.xasl_id.time_stored.sec;
+      db_localdatetime_msec (&sec, entry->key.xasl_id.time_stored.usec / 1000, &time_val);
+      db_make_datetime (&vals[idx], &time_val);
+      idx++;
+
+      /* Calls */
+      db_make_bigint (&vals[idx], entry->calls);
+      idx++;
+
+      /* Errors */
+      db_make_bigint (&vals[idx], entry->errors);
+      idx++;
+
+      /* Total_time_msec */
+      db_make_double (&vals[idx], entry->total_usec / 1000.0);
+      idx++;
+
+      /* Mean_time_msec */
+      db_make_double (&vals[idx], entry->total_usec / 1000.0 / MAX (entry->calls, 1));
+      idx++;
+
+      /* Max_time_msec */
+      db_make_double (&vals[idx], entry->max_usec / 1000.0);
+      idx++;
+
+      /* Cpu_time_msec */
+      db_make_double (&vals[idx], entry->cpu_usec / 1000.0);
+      idx++;
+
+      /* Rows */
+      db_make_bigint (&vals[idx], entry->rows);
+      idx++;
+
+      /* Page_fetches */
+      db_make_bigint (&vals[idx], entry->usage.page_fetches);
+      idx++;
+
+      /* Page_ioreads */
+      db_make_bigint (&vals[idx], entry->usage.page_ioreads);
+      idx++;
+
+      /* Temp_pages */
+      db_make_bigint (&vals[idx], entry->usage.temp_pages);
+      idx++;
+
+      /* Lock_wait_msec */
+      db_make_double (&vals[idx], entry->usage.lock_wait_usec / 1000.0);
+      idx++;
+
+      /* Last_call_time */
+      sec = (time_t) (entry->last_call_msec / 1000);
+      db_localdatetime_msec (&sec, (int) (entry->last_call_msec % 1000), &time_val);
+      db_make_datetime (&vals[idx], &time_val);
+      idx++;
+
+      /* Sql_text */
+      error = db_make_string_copy (&vals[idx], entry->sql_text);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  showstmt_free_array_context (thread_p, ctx);
+	  goto exit;
+	}
+      idx++;
+
+      assert (idx == STMTSTAT_SCAN_COLUMN_COUNT);
+    }
+
+  *ptr = ctx;
+
+exit:
+  free_and_init (entries);
+  return error;
+}
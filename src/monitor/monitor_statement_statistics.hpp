@@ -0,0 +1,65 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// monitor_statement_statistics.hpp - resources used by the executions of each statement
+//
+//  When statement_statistics is on, every execution of a cached plan adds its elapsed time, CPU time, result rows and
+//  the resources counted on the thread entry (page fetches, page reads, temporary pages and lock wait) to the entry
+//  of its SQL_ID and XASL_ID, so a statement recompiled with a new plan gets an entry of its own. The table keeps at
+//  most statement_statistics_size entries; when it is full, the entries with the least total elapsed time are
+//  dropped to make room.
+//
+//  The table is read by SHOW STATEMENT STATISTICS and emptied by ";clear_stmt_stats" of csql. It is kept in memory
+//  only and starts over when the server restarts.
+//
+
+#ifndef _MONITOR_STATEMENT_STATISTICS_HPP_
+#define _MONITOR_STATEMENT_STATISTICS_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "dbtype_def.h"
+#include "thread_entry.hpp"
+
+struct xasl_cache_ent;
+
+/* what a thread had used when it started to execute a query */
+typedef struct stmtstat_snapshot STMTSTAT_SNAPSHOT;
+struct stmtstat_snapshot
+{
+  THREAD_RESOURCE_USAGE usage;
+  INT64 start_usec;		/* steady clock */
+  INT64 start_cpu_usec;		/* CPU time of the thread */
+  bool is_recording;
+};
+
+extern void stmtstat_init (void);
+extern void stmtstat_final (void);
+
+extern void stmtstat_start_query (THREAD_ENTRY * thread_p, const xasl_cache_ent * xasl_ent,
+				  STMTSTAT_SNAPSHOT * snapshot);
+extern void stmtstat_end_query (THREAD_ENTRY * thread_p, const xasl_cache_ent * xasl_ent,
+				const STMTSTAT_SNAPSHOT * snapshot, INT64 rows, bool is_error);
+
+extern int stmtstat_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr);
+extern int xstmtstat_reset (THREAD_ENTRY * thread_p);
+
+#endif // _MONITOR_STATEMENT_STATISTICS_HPP_
@@ -7279,7 +7279,7 @@ tp_value_cast_internal (const DB_VALUE * src, DB_VALUE * dest, const TP_DOMAIN *
 	      return (status);
 	    case DB_TYPE_JSON:
 	      if (desired_domain->json_validator != NULL
-		  && db_json_validate_doc (desired_domain->json_validator, src->data.json.document) != NO_ERROR)
+		  && db_json_validate_doc (desired_domain->json_validator, db_get_json_document (src)) != NO_ERROR)
 		{
 		  pr_clear_value (&src_replacement);
 		  ASSERT_ERROR ();
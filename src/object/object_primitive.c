@@ -16775,8 +16775,8 @@ mr_data_writeval_json (OR_BUF * buf, DB_VALUE * value)
 	}
     }
 
-  JSON_DOC *json_doc = db_get_json_document (value);
-  rc = db_json_serialize (*json_doc, *buf);
+  /* a document that was never materialized is written back from its serialized image */
+  rc = db_json_serialize (*value->data.json.document, *buf);
   if (rc != NO_ERROR)
     {
       ASSERT_ERROR ();
@@ -16801,7 +16801,8 @@ mr_data_readval_json (OR_BUF * buf, DB_VALUE * value, TP_DOMAIN * domain, int si
       return NO_ERROR;
     }
 
-  rc = db_json_deserialize (buf, doc);
+  /* the document is built only when it is needed; path extraction works on the serialized image */
+  rc = db_json_deserialize_lazy (buf, doc);
   if (rc != NO_ERROR)
     {
       ASSERT_ERROR ();
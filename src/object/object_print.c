@@ -688,6 +688,10 @@ help_print_info (const char *command, FILE * fpp)
     {
       thread_dump_cs_stat (fpp);
     }
+  else if (MATCH_TOKEN (buffer, "ash"))
+    {
+      ash_dump (fpp);
+    }
   else if (MATCH_TOKEN (buffer, "plan"))
     {
       qmgr_dump_query_plans (fpp);
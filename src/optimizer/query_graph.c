@@ -203,6 +203,7 @@ static void qo_estimate_statistics (MOP class_mop, CLASS_STATS *);
 static void qo_node_free (QO_NODE *);
 static void qo_node_dump (QO_NODE *, FILE *);
 static void qo_node_add_sarg (QO_NODE *, QO_TERM *);
+static void qo_node_apply_col_groups (QO_ENV * env, QO_NODE * node);
 
 static void qo_seg_free (QO_SEGMENT *);
 
@@ -4938,6 +4939,8 @@ grok_classes (QO_ENV * env, PT_NODE * p, QO_CLASS_INFO_ENTRY * info)
 	  info->self_allocated = 1;
 	  info->stats->n_attrs = 0;
 	  info->stats->attr_stats = NULL;
+	  info->stats->n_col_groups = 0;
+	  info->stats->col_groups = NULL;
 	  qo_estimate_statistics (info->mop, info->stats);
 	}
       else if (smclass->stats->heap_num_pages == 0)
@@ -6110,6 +6113,12 @@ qo_discover_edges (QO_ENV * env)
 	}
     }
 
+  /* correct the selectivity of the nodes for the correlated columns of the column groups statistics */
+  for (i = 0; i < env->nnodes; i++)
+    {
+      qo_node_apply_col_groups (env, QO_ENV_NODE (env, i));
+    }
+
   /*
    * Check some invariants.  If something has gone wrong during the
    * discovery phase to violate these invariants, it will mean certain
@@ -8243,6 +8252,137 @@ qo_node_add_sarg (QO_NODE * node, QO_TERM * sarg)
     }
 }
 
+/*
+ * qo_node_apply_col_groups () - Corrects the selectivity of the sargs of a node for the column groups statistics
+ *   return:
+ *   env(in):
+ *   node(in):
+ *
+ * Note: The selectivity of the equality sargs on all the columns of a group is taken from the number of distinct
+ *	 values of the group (or from its functional dependency when that is missing) instead of the product of their
+ *	 own selectivities, when the group says the columns are correlated. A sarg is used for one group only.
+ */
+static void
+qo_node_apply_col_groups (QO_ENV * env, QO_NODE * node)
+{
+  QO_CLASS_INFO_ENTRY *class_info_entryp;
+  CLASS_STATS *stats;
+  STATS_COL_GROUP *col_group;
+  QO_TERM *term, *group_terms[STATS_COL_GROUP_MAX_ATTRS];
+  QO_SEGMENT *seg;
+  BITSET used_terms;
+  BITSET_ITERATOR iter;
+  double sel, independent_sel, group_sel, last_sel, sel_limit;
+  int g, k, t;
+
+  if (QO_NODE_INFO (node) == NULL || QO_NODE_INFO_N (node) != 1 || !QO_NODE_INFO (node)->info[0].normal_class
+      || bitset_cardinality (&(QO_NODE_SARGS (node))) < 2)
+    {
+      return;
+    }
+
+  class_info_entryp = &QO_NODE_INFO (node)->info[0];
+  stats = QO_GET_CLASS_STATS (class_info_entryp);
+  if (stats == NULL || stats->n_col_groups <= 0)
+    {
+      return;
+    }
+
+  bitset_init (&used_terms, env);
+  sel = 1.0;
+
+  for (g = 0; g < stats->n_col_groups; g++)
+    {
+      col_group = &stats->col_groups[g];
+
+      for (k = 0; k < col_group->n_attrs; k++)
+	{
+	  group_terms[k] = NULL;
+	  for (t = bitset_iterate (&(QO_NODE_SARGS (node)), &iter); t != -1; t = bitset_next_member (&iter))
+	    {
+	      term = QO_ENV_TERM (env, t);
+	      if (BITSET_MEMBER (used_terms, t) || bitset_cardinality (&(QO_TERM_SEGS (term))) != 1
+		  || !QO_TERM_IS_FLAGED (term, QO_TERM_SINGLE_PRED) || !QO_TERM_IS_FLAGED (term, QO_TERM_EQUAL_OP)
+		  || QO_TERM_IS_FLAGED (term, QO_TERM_RANGELIST))
+		{
+		  continue;
+		}
+
+	      seg = QO_ENV_SEG (env, bitset_first_member (&(QO_TERM_SEGS (term))));
+	      if (QO_SEG_HEAD (seg) != node || QO_SEG_FUNC_INDEX (seg) || QO_SEG_NAME (seg) == NULL)
+		{
+		  continue;
+		}
+
+	      if (sm_att_id (class_info_entryp->mop, QO_SEG_NAME (seg)) == col_group->attr_ids[k])
+		{
+		  group_terms[k] = term;
+		  break;
+		}
+	    }
+
+	  if (group_terms[k] == NULL)
+	    {
+	      break;
+	    }
+	}
+
+      if (k < col_group->n_attrs)
+	{
+	  /* not every column of the group has an equality sarg */
+	  continue;
+	}
+
+      independent_sel = 1.0;
+      for (k = 0; k < col_group->n_attrs; k++)
+	{
+	  independent_sel *= QO_TERM_SELECTIVITY (group_terms[k]);
+	}
+
+      if (col_group->ndv > 0)
+	{
+	  group_sel = 1.0 / (double) col_group->ndv;
+	}
+      else
+	{
+	  /* the last column adds little to the others it depends on */
+	  last_sel = QO_TERM_SELECTIVITY (group_terms[col_group->n_attrs - 1]);
+	  group_sel = (independent_sel / last_sel) * (col_group->dependency + (1.0 - col_group->dependency) * last_sel);
+	}
+
+      if (group_sel <= independent_sel)
+	{
+	  /* the columns are not correlated */
+	  continue;
+	}
+
+      for (k = 0; k < col_group->n_attrs; k++)
+	{
+	  bitset_add (&used_terms, QO_TERM_IDX (group_terms[k]));
+	}
+      sel *= group_sel;
+    }
+
+  if (bitset_is_empty (&used_terms))
+    {
+      bitset_delset (&used_terms);
+      return;
+    }
+
+  for (t = bitset_iterate (&(QO_NODE_SARGS (node)), &iter); t != -1; t = bitset_next_member (&iter))
+    {
+      if (!BITSET_MEMBER (used_terms, t))
+	{
+	  sel *= QO_TERM_SELECTIVITY (QO_ENV_TERM (env, t));
+	}
+    }
+
+  sel_limit = (QO_NODE_NCARD (node) == 0) ? 0 : (1.0 / (double) QO_NODE_NCARD (node));
+  QO_NODE_SELECTIVITY (node) = MIN (MAX (sel, sel_limit), 1.0);
+
+  bitset_delset (&used_terms);
+}
+
 /*
  * qo_node_fprint () -
  *   return:
@@ -90,9 +90,26 @@
 #define QO_IS_LIMIT_NODE(env, node) \
   (BITSET_MEMBER (QO_ENV_SORT_LIMIT_NODES ((env)), QO_NODE_IDX ((node))))
 
+/* upper bound of (sub-graph, appended node) pairs examined by the dynamic programming join search of up to limit
+ * tables; it is the count of a star join, the largest search space among joins without cross products that are
+ * usual in practice: the center table with every subset of the others, plus each other table alone */
+#define QO_DP_MAX_JOIN_VISITS(limit) \
+  ((limit) < 2 ? (limit) : (((limit) - 1) << ((limit) - 2)) + (limit))
+
 typedef enum
 { JOIN_RIGHT_ORDER, JOIN_OPPOSITE_ORDER } JOIN_ORDER_TRY;
 
+/* join graph of a partition, with the nodes identified by their relative index (QO_NODE_REL_IDX) */
+typedef struct qo_dp_graph QO_DP_GRAPH;
+struct qo_dp_graph
+{
+  int n_nodes;
+  QO_NODE **rel_nodes;		/* partition nodes by relative index */
+  unsigned int *dep_masks;	/* nodes that must be joined before each node */
+  int n_edges;
+  unsigned int *edge_masks;	/* nodes of each join edge */
+};
+
 typedef int (*QO_WALK_FUNCTION) (QO_PLAN *, void *);
 
 static int infos_allocated = 0;
@@ -173,6 +190,11 @@ static void planner_visit_node (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_N
 static double planner_nodeset_join_cost (QO_PLANNER *, BITSET *);
 static void planner_permutate (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, QO_NODE *, BITSET *, BITSET *, BITSET *,
 			       BITSET *, BITSET *, BITSET *, BITSET *, int, int *);
+static int planner_dp_init_graph (QO_PLANNER *, QO_PARTITION *, BITSET *, QO_DP_GRAPH *);
+static void planner_dp_clear_graph (QO_DP_GRAPH *);
+static bool planner_dp_can_extend (QO_DP_GRAPH *, unsigned int, int);
+static int planner_dp_enum_subgraphs (QO_DP_GRAPH *, int, unsigned int *, int *);
+static QO_INFO *planner_dp_search (QO_PLANNER *, QO_PARTITION *, PT_HINT_ENUM, BITSET *, BITSET *);
 
 static QO_PLAN *qo_find_best_nljoin_inner_plan_on_info (QO_PLAN *, QO_INFO *, JOIN_TYPE, int);
 static QO_PLAN *qo_find_best_plan_on_info (QO_INFO *, QO_EQCLASS *, double);
@@ -7384,6 +7406,450 @@ planner_permutate (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   return;
 }
 
+/*
+ * planner_dp_init_graph () - build the join graph of a partition for the dynamic programming join search
+ *   return: NO_ERROR or error code
+ *   planner(in):
+ *   partition(in):
+ *   partition_terms(in): terms of the partition
+ *   graph(out):
+ */
+static int
+planner_dp_init_graph (QO_PLANNER * planner, QO_PARTITION * partition, BITSET * partition_terms, QO_DP_GRAPH * graph)
+{
+  int i, j, r;
+  BITSET_ITERATOR bi, bj;
+  QO_NODE *node;
+  QO_TERM *term;
+  BITSET dep_nodes;
+  size_t size;
+
+  memset (graph, 0, sizeof (QO_DP_GRAPH));
+
+  graph->n_nodes = bitset_cardinality (&(QO_PARTITION_NODES (partition)));
+
+  size = sizeof (QO_NODE *) * graph->n_nodes;
+  graph->rel_nodes = (QO_NODE **) malloc (size);
+  if (graph->rel_nodes == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  size = sizeof (unsigned int) * graph->n_nodes;
+  graph->dep_masks = (unsigned int *) malloc (size);
+  if (graph->dep_masks == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      planner_dp_clear_graph (graph);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  size = sizeof (unsigned int) * MAX (1, bitset_cardinality (partition_terms));
+  graph->edge_masks = (unsigned int *) malloc (size);
+  if (graph->edge_masks == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      planner_dp_clear_graph (graph);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = bitset_iterate (&(QO_PARTITION_NODES (partition)), &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      node = QO_ENV_NODE (planner->env, i);
+      graph->rel_nodes[QO_NODE_REL_IDX (node)] = node;
+    }
+
+  bitset_init (&dep_nodes, planner->env);
+
+  for (r = 0; r < graph->n_nodes; r++)
+    {
+      node = graph->rel_nodes[r];
+
+      bitset_assign (&dep_nodes, &(QO_NODE_DEP_SET (node)));
+      bitset_union (&dep_nodes, &(QO_NODE_OUTER_DEP_SET (node)));
+
+      graph->dep_masks[r] = 0;
+      for (j = bitset_iterate (&dep_nodes, &bj); j != -1; j = bitset_next_member (&bj))
+	{
+	  if (!BITSET_MEMBER (QO_PARTITION_NODES (partition), j))
+	    {
+	      /* depends on a node out of the partition; can never be joined, same as planner_permutate () */
+	      graph->dep_masks[r] = ~0U;
+	      break;
+	    }
+	  graph->dep_masks[r] |= 1U << QO_NODE_REL_IDX (QO_ENV_NODE (planner->env, j));
+	}
+    }
+
+  bitset_delset (&dep_nodes);
+
+  for (i = bitset_iterate (partition_terms, &bi); i != -1; i = bitset_next_member (&bi))
+    {
+      term = QO_ENV_TERM (planner->env, i);
+      if (!QO_IS_EDGE_TERM (term))
+	{
+	  continue;
+	}
+
+      graph->edge_masks[graph->n_edges] = 0;
+      for (j = bitset_iterate (&(QO_TERM_NODES (term)), &bj); j != -1; j = bitset_next_member (&bj))
+	{
+	  graph->edge_masks[graph->n_edges] |= 1U << QO_NODE_REL_IDX (QO_ENV_NODE (planner->env, j));
+	}
+      graph->n_edges++;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * planner_dp_clear_graph () -
+ *   return:
+ *   graph(in):
+ */
+static void
+planner_dp_clear_graph (QO_DP_GRAPH * graph)
+{
+  if (graph->rel_nodes)
+    {
+      free_and_init (graph->rel_nodes);
+    }
+  if (graph->dep_masks)
+    {
+      free_and_init (graph->dep_masks);
+    }
+  if (graph->edge_masks)
+    {
+      free_and_init (graph->edge_masks);
+    }
+}
+
+/*
+ * planner_dp_can_extend () - check whether a node can be appended to a connected sub-graph
+ *   return: true if the node is linked to the sub-graph by a join edge and all nodes it depends on are in the sub-graph
+ *   graph(in):
+ *   subgraph(in): bit pattern of relative node indexes
+ *   rel_idx(in): relative index of the node to append
+ */
+static bool
+planner_dp_can_extend (QO_DP_GRAPH * graph, unsigned int subgraph, int rel_idx)
+{
+  unsigned int node_bit, joined;
+  int e;
+
+  node_bit = 1U << rel_idx;
+  if (subgraph & node_bit)
+    {
+      return false;
+    }
+
+  if (graph->dep_masks[rel_idx] & ~subgraph)
+    {
+      return false;
+    }
+
+  joined = subgraph | node_bit;
+  for (e = 0; e < graph->n_edges; e++)
+    {
+      if ((graph->edge_masks[e] & node_bit) && (graph->edge_masks[e] & subgraph) && !(graph->edge_masks[e] & ~joined))
+	{
+	  return true;
+	}
+    }
+
+  /* currently, do not permit cross join plan */
+  return false;
+}
+
+/*
+ * planner_dp_enum_subgraphs () - enumerate the connected sub-graphs of the join graph
+ *   return: number of sub-graphs, or -1 if there are more than max_visits ways to build them
+ *   graph(in):
+ *   max_visits(in): upper bound of (sub-graph, appended node) pairs
+ *   subgraphs(out): bit patterns of the sub-graphs, in increasing size; must hold
+ *		     MIN (n_nodes + max_visits, 2^n_nodes) entries
+ *   level_start(out): level_start[k] is the position of the first sub-graph of k nodes; must hold n_nodes + 2 entries
+ *
+ * Note: Sub-graphs are grown like planner_permutate () grows its prefixes; starting from a node without dependencies
+ *       and appending one node at a time. Only the bit patterns are computed here, so the size of the search space
+ *       is known before the first plan is generated.
+ */
+static int
+planner_dp_enum_subgraphs (QO_DP_GRAPH * graph, int max_visits, unsigned int *subgraphs, int *level_start)
+{
+  unsigned char *found;
+  unsigned int subgraph, joined;
+  size_t size;
+  int r, k, s, count, n_visits;
+
+  size = ((size_t) 1 << graph->n_nodes) / 8 + 1;
+  found = (unsigned char *) calloc (size, 1);
+  if (found == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return -1;
+    }
+
+  count = 0;
+  n_visits = 0;
+
+  /* sub-graphs of a single node */
+  level_start[0] = level_start[1] = 0;
+  for (r = 0; r < graph->n_nodes; r++)
+    {
+      if (graph->dep_masks[r] == 0)
+	{
+	  subgraphs[count++] = 1U << r;
+	}
+    }
+
+  for (k = 1; k < graph->n_nodes; k++)
+    {
+      level_start[k + 1] = count;
+
+      for (s = level_start[k]; s < level_start[k + 1]; s++)
+	{
+	  subgraph = subgraphs[s];
+	  for (r = 0; r < graph->n_nodes; r++)
+	    {
+	      if (!planner_dp_can_extend (graph, subgraph, r))
+		{
+		  continue;
+		}
+
+	      if (++n_visits > max_visits)
+		{
+		  /* too large search space */
+		  free_and_init (found);
+		  return -1;
+		}
+
+	      joined = subgraph | (1U << r);
+	      if (found[joined >> 3] & (1 << (joined & 7)))
+		{
+		  continue;
+		}
+	      found[joined >> 3] |= (1 << (joined & 7));
+	      subgraphs[count++] = joined;
+	    }
+	}
+    }
+  level_start[graph->n_nodes + 1] = count;
+
+  free_and_init (found);
+
+  return count;
+}
+
+/*
+ * planner_dp_search () - dynamic programming join search over connected sub-graphs
+ *   return: info of the best total join plan, or NULL if the search space is too large or no plan was found
+ *   planner(in):
+ *   partition(in):
+ *   hint(in):
+ *   partition_terms(in): terms of the partition
+ *   remaining_subqueries(in):
+ *
+ * Note: Unlike planner_permutate (), the best plans of every connected sub-graph of k nodes are complete before any
+ *       sub-graph of k + 1 nodes is built, so each sub-graph is joined with each of its neighbor nodes only once. The
+ *       join plans themselves are still examined by planner_visit_node (), through the join_info vector which serves
+ *       as memo. The caller falls back to the partial join search when NULL is returned.
+ */
+static QO_INFO *
+planner_dp_search (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM hint, BITSET * partition_terms,
+		   BITSET * remaining_subqueries)
+{
+  QO_DP_GRAPH graph;
+  QO_INFO *head_info, *best_info;
+  QO_NODE *head_node;
+  QO_SUBQUERY *subq;
+  unsigned int *subgraphs = NULL;
+  int *level_start = NULL;
+  unsigned int subgraph, joined, all_nodes;
+  int i, k, r, s, n_subgraphs, max_visits;
+  size_t size;
+  BITSET_ITERATOR bi;
+  BITSET visited_nodes;
+  BITSET visited_rel_nodes;
+  BITSET visited_terms;
+  BITSET nested_path_nodes;
+  BITSET remaining_nodes;
+  BITSET remaining_terms;
+  BITSET dp_subqueries;
+
+  best_info = NULL;
+  planner->best_info = NULL;
+
+  if (planner_dp_init_graph (planner, partition, partition_terms, &graph) != NO_ERROR)
+    {
+      return NULL;
+    }
+
+  /* sized from optimizer_dp_join_limit, so that every join the caller sends here can be searched if it is not denser
+   * than a star join */
+  max_visits = QO_DP_MAX_JOIN_VISITS (MAX (prm_get_integer_value (PRM_ID_OPTIMIZER_DP_JOIN_LIMIT), graph.n_nodes));
+  size = sizeof (unsigned int) * MIN ((size_t) graph.n_nodes + max_visits, (size_t) 1 << graph.n_nodes);
+  subgraphs = (unsigned int *) malloc (size);
+  if (subgraphs == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      planner_dp_clear_graph (&graph);
+      return NULL;
+    }
+
+  size = sizeof (int) * (graph.n_nodes + 2);
+  level_start = (int *) malloc (size);
+  if (level_start == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      free_and_init (subgraphs);
+      planner_dp_clear_graph (&graph);
+      return NULL;
+    }
+
+  n_subgraphs = planner_dp_enum_subgraphs (&graph, max_visits, subgraphs, level_start);
+  if (n_subgraphs < 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "planner_dp_search: more than %d join visits for %d tables,"
+		    " falling back to the partial join search\n", max_visits, graph.n_nodes);
+      if (planner->env->dump_enable)
+	{
+	  fprintf (stdout, "\nDP join search: more than %d join visits for %d tables, partial join search used\n",
+		   max_visits, graph.n_nodes);
+	}
+    }
+
+  all_nodes = (1U << graph.n_nodes) - 1;
+  if (n_subgraphs <= 0 || subgraphs[n_subgraphs - 1] != all_nodes)
+    {
+      /* too large search space, or there is no way to join all nodes without cross join */
+      free_and_init (level_start);
+      free_and_init (subgraphs);
+      planner_dp_clear_graph (&graph);
+      return NULL;
+    }
+
+  bitset_init (&visited_nodes, planner->env);
+  bitset_init (&visited_rel_nodes, planner->env);
+  bitset_init (&visited_terms, planner->env);
+  bitset_init (&nested_path_nodes, planner->env);
+  bitset_init (&remaining_nodes, planner->env);
+  bitset_init (&remaining_terms, planner->env);
+  bitset_init (&dp_subqueries, planner->env);
+
+  for (k = 2; k <= graph.n_nodes; k++)
+    {
+      /* planner_visit_node () stops at sub-graphs of join_unit nodes */
+      planner->join_unit = k;
+
+      for (s = level_start[k]; s < level_start[k + 1]; s++)
+	{
+	  joined = subgraphs[s];
+
+	  for (r = 0; r < graph.n_nodes; r++)
+	    {
+	      if (!(joined & (1U << r)))
+		{
+		  continue;
+		}
+
+	      /* join the sub-graph without r (the outer) with r (the inner) */
+	      subgraph = joined & ~(1U << r);
+	      if (!planner_dp_can_extend (&graph, subgraph, r))
+		{
+		  continue;
+		}
+
+	      BITSET_CLEAR (visited_nodes);
+	      BITSET_CLEAR (visited_rel_nodes);
+	      head_node = NULL;
+	      for (i = 0; i < graph.n_nodes; i++)
+		{
+		  if (subgraph & (1U << i))
+		    {
+		      bitset_add (&visited_nodes, QO_NODE_IDX (graph.rel_nodes[i]));
+		      bitset_add (&visited_rel_nodes, i);
+		      if (head_node == NULL)
+			{
+			  head_node = graph.rel_nodes[i];
+			}
+		    }
+		}
+
+	      if (k == 2)
+		{
+		  if (graph.dep_masks[QO_NODE_REL_IDX (head_node)] != 0)
+		    {
+		      /* can not be the outermost node */
+		      continue;
+		    }
+		  head_info = planner->node_info[QO_NODE_IDX (head_node)];
+		}
+	      else
+		{
+		  head_info = planner->join_info[QO_INFO_INDEX (QO_PARTITION_M_OFFSET (partition), visited_rel_nodes)];
+		}
+	      if (head_info == NULL || qo_find_best_plan_on_info (head_info, QO_UNORDERED, 1.0) == NULL)
+		{
+		  /* the sub-graph could not be planned */
+		  continue;
+		}
+
+	      bitset_assign (&visited_terms, &(head_info->terms));
+	      bitset_assign (&remaining_terms, partition_terms);
+	      bitset_difference (&remaining_terms, &visited_terms);
+
+	      bitset_assign (&remaining_nodes, &(QO_PARTITION_NODES (partition)));
+	      bitset_difference (&remaining_nodes, &visited_nodes);
+
+	      /* subqueries already pinned to the sub-graph */
+	      bitset_assign (&dp_subqueries, remaining_subqueries);
+	      for (i = bitset_iterate (remaining_subqueries, &bi); i != -1; i = bitset_next_member (&bi))
+		{
+		  subq = &planner->subqueries[i];
+		  if (bitset_subset (&visited_nodes, &(subq->nodes)) && bitset_subset (&visited_terms, &(subq->terms)))
+		    {
+		      bitset_remove (&dp_subqueries, i);
+		    }
+		}
+
+	      BITSET_CLEAR (nested_path_nodes);
+
+	      (void) planner_visit_node (planner, partition, hint, head_node, graph.rel_nodes[r], &visited_nodes,
+					 &visited_rel_nodes, &visited_terms, &nested_path_nodes, &remaining_nodes,
+					 &remaining_terms, &dp_subqueries, 0);
+	    }
+
+	  if (k < graph.n_nodes)
+	    {
+	      /* sub-graph plans are not total join plans */
+	      planner->best_info = NULL;
+	    }
+	}
+    }
+
+  if (planner->best_info != NULL && qo_find_best_plan_on_info (planner->best_info, QO_UNORDERED, 1.0) != NULL)
+    {
+      best_info = planner->best_info;
+    }
+  planner->best_info = NULL;
+
+  bitset_delset (&visited_nodes);
+  bitset_delset (&visited_rel_nodes);
+  bitset_delset (&visited_terms);
+  bitset_delset (&nested_path_nodes);
+  bitset_delset (&remaining_nodes);
+  bitset_delset (&remaining_terms);
+  bitset_delset (&dp_subqueries);
+
+  free_and_init (level_start);
+  free_and_init (subgraphs);
+  planner_dp_clear_graph (&graph);
+
+  return best_info;
+}
+
 /*
  * qo_planner_search () -
  *   return:
@@ -8337,6 +8803,10 @@ qo_clean_planner (QO_PLANNER * planner)
  * 38..          | 2
  * -------------------------------------------
  * Refer Sybase Ataptive Server
+ *
+ * Joins of 5 to optimizer_dp_join_limit tables are first tried with the dynamic programming search over connected
+ * sub-graphs (planner_dp_search); the table above applies when its search space is larger than the one of a star
+ * join of optimizer_dp_join_limit tables (QO_DP_MAX_JOIN_VISITS).
  */
 
 /*
@@ -8350,7 +8820,7 @@ static QO_INFO *
 qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET * remaining_subqueries)
 {
   QO_ENV *env;
-  int i, nodes_cnt, node_idx;
+  int i, nodes_cnt, node_idx, join_unit;
   PT_NODE *tree;
   PT_HINT_ENUM hint;
   QO_TERM *term;
@@ -8413,6 +8883,22 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
       planner->join_unit = (nodes_cnt <= 25) ? MIN (4, nodes_cnt) : (nodes_cnt <= 37) ? 3 : 2;
     }
 
+  /* STEP 0: for mid-sized joins, do the dynamic programming join search over connected sub-graphs. Small joins are
+   * already searched exhaustively by planner_permutate (); too large ones fall back to the partial join search. */
+  if (planner->join_unit < nodes_cnt && nodes_cnt <= prm_get_integer_value (PRM_ID_OPTIMIZER_DP_JOIN_LIMIT))
+    {
+      join_unit = planner->join_unit;
+
+      planner->best_info = planner_dp_search (planner, partition, hint, &remaining_terms, remaining_subqueries);
+      if (planner->best_info)
+	{
+	  goto end;
+	}
+
+      /* restore #tables consider at a time */
+      planner->join_unit = join_unit;
+    }
+
   /* STEP 1: do join search with visited nodes */
 
   node = NULL;			/* init */
@@ -8490,6 +8976,8 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
 
     }
 
+end:
+
   bitset_delset (&visited_rel_nodes);
   bitset_delset (&visited_nodes);
   bitset_delset (&visited_terms);
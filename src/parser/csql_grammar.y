@@ -1525,6 +1525,7 @@ int g_original_buffer_len;
 %token <cptr> HASH
 %token <cptr> HEADER
 %token <cptr> HEAP
+%token <cptr> HISTORY
 %token <cptr> HOST
 %token <cptr> IFNULL
 %token <cptr> INACTIVE
@@ -7727,6 +7728,14 @@ show_type
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| ACTIVE SESSION HISTORY
+		{{
+			$$ = SHOWSTMT_ACTIVE_SESSION_HISTORY;
+		}}
+	| STATEMENT STATISTICS
+		{{
+			$$ = SHOWSTMT_STATEMENT_STATISTICS;
+		}}
 	;
 
 show_type_of_like
@@ -7769,6 +7778,14 @@ show_type_of_where
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| ACTIVE SESSION HISTORY
+		{{
+			$$ = SHOWSTMT_ACTIVE_SESSION_HISTORY;
+		}}
+	| STATEMENT STATISTICS
+		{{
+			$$ = SHOWSTMT_STATEMENT_STATISTICS;
+		}}
 	;
 
 show_type_arg1
@@ -22590,6 +22607,7 @@ identifier
 	| HASH                   {{ DBG_TRACE_GRAMMAR(identifier, | HASH               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| HEADER                 {{ DBG_TRACE_GRAMMAR(identifier, | HEADER             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| HEAP                   {{ DBG_TRACE_GRAMMAR(identifier, | HEAP               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}        
+	| HISTORY                {{ DBG_TRACE_GRAMMAR(identifier, | HISTORY            ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| HOST                   {{ DBG_TRACE_GRAMMAR(identifier, | HOST               ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| IFNULL                 {{ DBG_TRACE_GRAMMAR(identifier, | IFNULL             ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
 	| INACTIVE               {{ DBG_TRACE_GRAMMAR(identifier, | INACTIVE           ); SET_CPTR_2_PTNAME($$, $1, @$.buffer_pos);  }}
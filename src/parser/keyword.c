@@ -218,6 +218,7 @@ static KEYWORD_RECORD keywords[] = {
   {HAVING, "HAVING", 0},
   {HEADER, "HEADER", 1},
   {HEAP, "HEAP", 1},
+  {HISTORY, "HISTORY", 1},
   {HOUR_, "HOUR", 0},
   {HOUR_MINUTE, "HOUR_MINUTE", 0},
   {HOUR_MILLISECOND, "HOUR_MILLISECOND", 0},
@@ -2935,7 +2935,7 @@ pt_bind_helper (PARSER_CONTEXT * parser, PT_NODE * node, DB_VALUE * val, int *da
       dt = parser_new_node (parser, PT_DATA_TYPE);
       if (dt)
 	{
-	  json_body = db_json_get_json_body_from_document (*val->data.json.document);
+	  json_body = db_json_get_json_body_from_document (*db_get_json_document (val));
 	  if (db_json_validate_json (json_body) != NO_ERROR)
 	    {
 	      assert (false);
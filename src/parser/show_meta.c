@@ -88,6 +88,8 @@ static SHOWSTMT_METADATA *metadata_of_full_timezones (void);
 static SHOWSTMT_METADATA *metadata_of_tran_tables (void);
 static SHOWSTMT_METADATA *metadata_of_threads (void);
 static SHOWSTMT_METADATA *metadata_of_page_buffer_status (void);
+static SHOWSTMT_METADATA *metadata_of_active_session_history (void);
+static SHOWSTMT_METADATA *metadata_of_statement_statistics (void);
 
 static SHOWSTMT_METADATA *
 metadata_of_volume_header (void)
@@ -733,6 +735,63 @@ metadata_of_page_buffer_status (void)
   return &md;
 }
 
+static SHOWSTMT_METADATA *
+metadata_of_active_session_history (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Sample_time", "datetime"},
+    {"Thread_index", "int"},
+    {"Thread_type", "varchar(16)"},
+    {"Tran_index", "int"},
+    {"Wait_event", "varchar(16)"},
+    {"Sql_id", "varchar(13)"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {1, ORDER_ASC},
+    {2, ORDER_ASC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_ACTIVE_SESSION_HISTORY, true /* only_for_dba */ , "show active session history",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
+static SHOWSTMT_METADATA *
+metadata_of_statement_statistics (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Sql_id", "varchar(13)"},
+    {"Xasl_id", "varchar(40)"},
+    {"Plan_time", "datetime"},
+    {"Calls", "bigint"},
+    {"Errors", "bigint"},
+    {"Total_time_msec", "double"},
+    {"Mean_time_msec", "double"},
+    {"Max_time_msec", "double"},
+    {"Cpu_time_msec", "double"},
+    {"Rows", "bigint"},
+    {"Page_fetches", "bigint"},
+    {"Page_ioreads", "bigint"},
+    {"Temp_pages", "bigint"},
+    {"Lock_wait_msec", "double"},
+    {"Last_call_time", "datetime"},
+    {"Sql_text", "varchar(1024)"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {6, ORDER_DESC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_STATEMENT_STATISTICS, true /* only_for_dba */ , "show statement statistics",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -975,6 +1034,8 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
   show_Metas[SHOWSTMT_PAGE_BUFFER_STATUS] = metadata_of_page_buffer_status ();
+  show_Metas[SHOWSTMT_ACTIVE_SESSION_HISTORY] = metadata_of_active_session_history ();
+  show_Metas[SHOWSTMT_STATEMENT_STATISTICS] = metadata_of_statement_statistics ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
@@ -569,6 +569,7 @@ static XASL_NODE *pt_build_do_stmt_aptr_list (PARSER_CONTEXT * parser, PT_NODE *
 
 static METHOD_SIG_LIST *pt_to_method_sig_list (PARSER_CONTEXT * parser, PT_NODE * node_list,
 					       PT_NODE * subquery_as_attr_list);
+static bool pt_is_deterministic_java_sp (const char *sp_name);
 
 static int pt_is_subquery (PT_NODE * node);
 
@@ -3791,6 +3792,52 @@ pt_to_method_arglist (PARSER_CONTEXT * parser, PT_NODE * target, PT_NODE * node_
 }
 
 
+/*
+ * pt_is_deterministic_java_sp () - is the java stored procedure listed in java_stored_procedure_deterministic_functions?
+ *   return: true if the results of the procedure may be reused for the same arguments
+ *   sp_name(in): name of the stored procedure
+ */
+static bool
+pt_is_deterministic_java_sp (const char *sp_name)
+{
+  const char *sp_list = prm_get_string_value (PRM_ID_JAVA_STORED_PROCEDURE_DETERMINISTIC_FUNCTIONS);
+  const char *p, *start;
+  char name[DB_MAX_IDENTIFIER_LENGTH];
+  int len;
+
+  if (sp_list == NULL || sp_name == NULL)
+    {
+      return false;
+    }
+
+  for (p = sp_list; *p != '\0';)
+    {
+      while (*p == ',' || isspace ((unsigned char) *p))
+	{
+	  p++;
+	}
+      start = p;
+      while (*p != '\0' && *p != ',' && !isspace ((unsigned char) *p))
+	{
+	  p++;
+	}
+      len = CAST_STRLEN (p - start);
+      if (len == 0 || len >= DB_MAX_IDENTIFIER_LENGTH)
+	{
+	  continue;
+	}
+
+      memcpy (name, start, len);
+      name[len] = '\0';
+      if (intl_identifier_casecmp (name, sp_name) == 0)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
 /*
  * pt_to_method_sig_list () - converts a parse expression tree list of
  *                            method calls to method signature list
@@ -3849,6 +3896,7 @@ pt_to_method_sig_list (PARSER_CONTEXT * parser, PT_NODE * node_list, PT_NODE * s
 	    {
 	      (*tail)->class_name = NULL;
 	      (*tail)->method_type = METHOD_TYPE_JAVA_SP;
+	      (*tail)->arg_info.is_deterministic = pt_is_deterministic_java_sp ((*tail)->method_name);
 
 	      int num_args = (*tail)->num_method_args;
 	      (*tail)->arg_info.arg_mode = regu_int_array_alloc (num_args);
@@ -5528,7 +5528,8 @@ db_evaluate_json_extract (DB_VALUE * result, DB_VALUE * const *args, int num_arg
       return NO_ERROR;
     }
 
-  error_code = db_value_to_json_doc (*args[0], false, source_doc);
+  /* the source is only read by path; a document fetched from disk is not built */
+  error_code = db_value_to_json_doc (*args[0], false, source_doc, true);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
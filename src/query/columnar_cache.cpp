@@ -0,0 +1,1121 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// columnar_cache.cpp - in-memory columnar copies of read-mostly classes
+//
+
+#include "columnar_cache.hpp"
+
+#include "dbtype.h"
+#include "error_manager.h"
+#include "heap_file.h"
+#include "log_impl.h"
+#include "mvcc.h"
+#include "object_primitive.h"
+#include "object_representation_sr.h"
+#include "query_evaluator.h"
+#include "system_parameter.h"
+
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+
+using namespace cubquery;
+
+#define COLCACHE_MAX_CLASSES 64
+
+/* seconds to wait before building again the table of a class that could not be cached */
+#define COLCACHE_RETRY_INTERVAL 10
+
+/* rows read between two checks of the cache size limit while building */
+#define COLCACHE_SIZE_CHECK_ROWS 1024
+
+typedef struct colcache_entry COLCACHE_ENTRY;
+struct colcache_entry
+{
+  OID class_oid;		/* set once, before the entry is counted in colcache_Num_entries */
+  std::atomic<std::uint64_t> version;	/* incremented on each modification of the class */
+  std::mutex mutex;		/* protects the fields below */
+  std::shared_ptr<const columnar_table> table;
+  bool is_building;
+  time_t retry_time;
+};
+
+struct colcache_scan
+{
+  struct attr_map
+  {
+    HEAP_CACHE_ATTRINFO *attr_info;
+    std::vector<const column_vector *> columns;	/* column of each attr_info value */
+  };
+
+  ~colcache_scan ()
+  {
+    eval_batch_pred_clear (&batch_pred);
+  }
+
+  std::shared_ptr<const columnar_table> table;
+  attr_map maps[2];		/* predicate and rest attributes */
+  std::int64_t row;		/* current row; -1 or row count when outside the table */
+
+  EVAL_BATCH_PRED batch_pred;	/* conjuncts of the scan predicate evaluated a batch of rows at a time */
+  std::vector<EVAL_BATCH_COLUMN> batch_columns;	/* column of each batch term */
+  std::int64_t batch;		/* batch of rows of selection; -1 if none */
+  UINT64 selection[EVAL_BATCH_WORDS];
+};
+
+static COLCACHE_ENTRY colcache_Entries[COLCACHE_MAX_CLASSES];
+static std::atomic<int> colcache_Num_entries (0);
+static std::mutex colcache_Entries_mutex;
+
+static std::vector<std::string> colcache_Class_names;
+static std::atomic<std::uint64_t> colcache_Memory_size (0);
+
+static bool colcache_is_listed_class (THREAD_ENTRY * thread_p, const OID * class_oid, bool & is_listed);
+static COLCACHE_ENTRY *colcache_find_entry (const OID * class_oid);
+static COLCACHE_ENTRY *colcache_add_entry (const OID * class_oid);
+static int colcache_get_table (THREAD_ENTRY * thread_p, COLCACHE_ENTRY * entry, const HFID * hfid,
+			       std::shared_ptr<const columnar_table> &table_out);
+static bool colcache_reserve_memory (std::size_t size, std::uint64_t max_size);
+static int colcache_build_table (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid,
+				 std::unique_ptr<columnar_table> &table_out);
+static bool colcache_map_attributes (const columnar_table & table, HEAP_CACHE_ATTRINFO * attr_info,
+				     colcache_scan::attr_map & map);
+
+namespace cubquery
+{
+  column_vector::column_vector (ATTR_ID attrid, DB_TYPE type, int precision, int scale, column_kind kind)
+    : m_attrid (attrid)
+    , m_type (type)
+    , m_precision (precision)
+    , m_scale (scale)
+    , m_kind (kind)
+    , m_nulls ()
+    , m_ints ()
+    , m_doubles ()
+    , m_codes ()
+    , m_dictionary ()
+    , m_count (0)
+    , m_dictionary_bytes (0)
+    , m_codes_by_key ()
+  {
+  }
+
+  column_vector::~column_vector ()
+  {
+    for (DB_VALUE &value : m_dictionary)
+      {
+	pr_clear_value (&value);
+      }
+  }
+
+  bool
+  column_vector::is_supported_type (DB_TYPE type, column_kind &kind)
+  {
+    switch (type)
+      {
+      case DB_TYPE_SHORT:
+      case DB_TYPE_INTEGER:
+      case DB_TYPE_BIGINT:
+      case DB_TYPE_DATE:
+      case DB_TYPE_TIME:
+      case DB_TYPE_TIMESTAMP:
+      case DB_TYPE_DATETIME:
+	kind = column_kind::INT64;
+	return true;
+
+      case DB_TYPE_FLOAT:
+      case DB_TYPE_DOUBLE:
+	kind = column_kind::DOUBLE;
+	return true;
+
+      case DB_TYPE_CHAR:
+      case DB_TYPE_VARCHAR:
+      case DB_TYPE_NUMERIC:
+	kind = column_kind::DICTIONARY;
+	return true;
+
+      default:
+	return false;
+      }
+  }
+
+  void
+  column_vector::append_null_bit (bool is_null)
+  {
+    if (m_count % 64 == 0)
+      {
+	m_nulls.push_back (0);
+      }
+    if (is_null)
+      {
+	m_nulls.back () |= ((std::uint64_t) 1) << (m_count % 64);
+      }
+    m_count++;
+  }
+
+  int
+  column_vector::append (const DB_VALUE &value)
+  {
+    bool is_null = DB_IS_NULL (&value);
+    std::int64_t int_value = 0;
+    double double_value = 0;
+
+    append_null_bit (is_null);
+
+    switch (m_kind)
+      {
+      case column_kind::INT64:
+	if (!is_null && !eval_batch_encode_int64 (&value, &int_value))
+	  {
+	    assert (false);
+	  }
+	m_ints.push_back (int_value);
+	break;
+
+      case column_kind::DOUBLE:
+	if (!is_null)
+	  {
+	    double_value = (m_type == DB_TYPE_FLOAT) ? db_get_float (&value) : db_get_double (&value);
+	  }
+	m_doubles.push_back (double_value);
+	break;
+
+      case column_kind::DICTIONARY:
+	if (is_null)
+	  {
+	    m_codes.push_back (-1);
+	  }
+	else
+	  {
+	    std::string key;
+
+	    if (m_type == DB_TYPE_NUMERIC)
+	      {
+		key.assign ((const char *) db_get_numeric (&value), DB_NUMERIC_BUF_SIZE);
+	      }
+	    else
+	      {
+		key.assign (db_get_string (&value), db_get_string_size (&value));
+	      }
+
+	    auto found = m_codes_by_key.find (key);
+	    if (found != m_codes_by_key.end ())
+	      {
+		m_codes.push_back (found->second);
+	      }
+	    else
+	      {
+		DB_VALUE copy;
+
+		if (pr_clone_value (&value, &copy) != NO_ERROR)
+		  {
+		    ASSERT_ERROR ();
+		    return er_errid ();
+		  }
+		m_dictionary.push_back (copy);
+		m_dictionary_bytes += key.size ();
+
+		std::int32_t code = (std::int32_t) (m_dictionary.size () - 1);
+		m_codes_by_key.emplace (std::move (key), code);
+		m_codes.push_back (code);
+	      }
+	  }
+	break;
+      }
+
+    return NO_ERROR;
+  }
+
+  void
+  column_vector::end_append ()
+  {
+    /* the key map is only needed to find duplicates while building */
+    std::unordered_map<std::string, std::int32_t> ().swap (m_codes_by_key);
+    m_nulls.shrink_to_fit ();
+    m_ints.shrink_to_fit ();
+    m_doubles.shrink_to_fit ();
+    m_codes.shrink_to_fit ();
+  }
+
+  void
+  column_vector::get_value (std::size_t row, DB_VALUE &value) const
+  {
+    if (is_null (row))
+      {
+	(void) db_value_domain_init (&value, m_type, m_precision, m_scale);
+	return;
+      }
+
+    switch (m_kind)
+      {
+      case column_kind::INT64:
+      {
+	std::int64_t int_value = m_ints[row];
+
+	switch (m_type)
+	  {
+	  case DB_TYPE_SHORT:
+	    db_make_short (&value, (DB_C_SHORT) int_value);
+	    break;
+	  case DB_TYPE_INTEGER:
+	    db_make_int (&value, (int) int_value);
+	    break;
+	  case DB_TYPE_BIGINT:
+	    db_make_bigint (&value, (DB_BIGINT) int_value);
+	    break;
+	  case DB_TYPE_DATE:
+	  {
+	    DB_DATE date = (DB_DATE) int_value;
+	    db_value_put_encoded_date (&value, &date);
+	  }
+	  break;
+	  case DB_TYPE_TIME:
+	  {
+	    DB_TIME time = (DB_TIME) int_value;
+	    db_value_put_encoded_time (&value, &time);
+	  }
+	  break;
+	  case DB_TYPE_TIMESTAMP:
+	    db_make_timestamp (&value, (DB_TIMESTAMP) int_value);
+	    break;
+	  case DB_TYPE_DATETIME:
+	  {
+	    DB_DATETIME datetime;
+	    datetime.date = (unsigned int) (int_value >> 32);
+	    datetime.time = (unsigned int) (int_value & 0xFFFFFFFF);
+	    db_make_datetime (&value, &datetime);
+	  }
+	  break;
+	  default:
+	    assert (false);
+	    break;
+	  }
+      }
+      break;
+
+      case column_kind::DOUBLE:
+	if (m_type == DB_TYPE_FLOAT)
+	  {
+	    db_make_float (&value, (float) m_doubles[row]);
+	  }
+	else
+	  {
+	    db_make_double (&value, m_doubles[row]);
+	  }
+	break;
+
+      case column_kind::DICTIONARY:
+	/* peek the dictionary value; the table outlives the scan that reads it */
+	value = m_dictionary[m_codes[row]];
+	value.need_clear = false;
+	break;
+      }
+  }
+
+  std::size_t
+  column_vector::get_memory_size () const
+  {
+    return (m_nulls.size () * sizeof (std::uint64_t) + m_ints.size () * sizeof (std::int64_t)
+	    + m_doubles.size () * sizeof (double) + m_codes.size () * sizeof (std::int32_t)
+	    + m_dictionary.size () * sizeof (DB_VALUE) + m_dictionary_bytes);
+  }
+
+  columnar_table::columnar_table (const HFID &hfid, REPR_ID repr_id)
+    : m_hfid (hfid)
+    , m_repr_id (repr_id)
+    , m_oids ()
+    , m_columns ()
+    , m_memory_size (0)
+  {
+  }
+
+  columnar_table::~columnar_table ()
+  {
+    colcache_Memory_size -= m_memory_size;
+  }
+
+  const column_vector *
+  columnar_table::get_column (ATTR_ID attrid) const
+  {
+    for (const std::unique_ptr<column_vector> &column : m_columns)
+      {
+	if (column->m_attrid == attrid)
+	  {
+	    return column.get ();
+	  }
+      }
+    return NULL;
+  }
+}
+
+/*
+ * colcache_initialize () - read the list of classes to be cached
+ *   return: NO_ERROR
+ *   thread_p(in): thread entry
+ */
+int
+colcache_initialize (THREAD_ENTRY * thread_p)
+{
+  const char *class_list = prm_get_string_value (PRM_ID_COLUMNAR_CACHE_CLASSES);
+  std::string name;
+
+  colcache_Class_names.clear ();
+  colcache_Num_entries = 0;
+  colcache_Memory_size = 0;
+
+  if (class_list == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  for (const char *p = class_list;; p++)
+    {
+      if (*p == ',' || *p == '\0')
+	{
+	  if (!name.empty ())
+	    {
+	      colcache_Class_names.push_back (name);
+	      name.clear ();
+	    }
+	  if (*p == '\0')
+	    {
+	      break;
+	    }
+	}
+      else if (!isspace ((unsigned char) *p))
+	{
+	  name.push_back ((char) tolower ((unsigned char) *p));
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * colcache_finalize () - drop all columnar tables
+ *   return: void
+ *   thread_p(in): thread entry
+ */
+void
+colcache_finalize (THREAD_ENTRY * thread_p)
+{
+  int num_entries = colcache_Num_entries;
+
+  for (int i = 0; i < num_entries; i++)
+    {
+      std::lock_guard<std::mutex> lock (colcache_Entries[i].mutex);
+      colcache_Entries[i].table.reset ();
+    }
+
+  colcache_Num_entries = 0;
+  colcache_Class_names.clear ();
+}
+
+/*
+ * colcache_class_modified () - drop the columnar table of a modified class
+ *   return: void
+ *   class_oid(in): class of the inserted, updated or deleted object
+ *
+ * Note: called by heap after every object change. It must be called after the heap record is changed, so that a
+ *	 table being built either sees the change and fails the visibility check, or is refused when published.
+ */
+void
+colcache_class_modified (const OID * class_oid)
+{
+  COLCACHE_ENTRY *entry;
+
+  if (colcache_Num_entries == 0)
+    {
+      return;
+    }
+
+  entry = colcache_find_entry (class_oid);
+  if (entry == NULL)
+    {
+      return;
+    }
+
+  entry->version++;
+
+  std::lock_guard<std::mutex> lock (entry->mutex);
+  entry->table.reset ();
+}
+
+/*
+ * colcache_is_listed_class () - is class in columnar_cache_classes?
+ *   return: false on error
+ *   thread_p(in): thread entry
+ *   class_oid(in): class identifier
+ *   is_listed(out): true if the class should be cached
+ *
+ * Note: names may be given with or without the owner name.
+ */
+static bool
+colcache_is_listed_class (THREAD_ENTRY * thread_p, const OID * class_oid, bool & is_listed)
+{
+  char *class_name = NULL;
+  const char *simple_name;
+
+  is_listed = false;
+
+  if (heap_get_class_name (thread_p, class_oid, &class_name) != NO_ERROR || class_name == NULL)
+    {
+      return false;
+    }
+
+  simple_name = strchr (class_name, '.');
+  simple_name = (simple_name != NULL) ? simple_name + 1 : class_name;
+
+  for (const std::string &name : colcache_Class_names)
+    {
+      const char *compared = (name.find ('.') != std::string::npos) ? class_name : simple_name;
+
+      if (strcasecmp (name.c_str (), compared) == 0)
+	{
+	  is_listed = true;
+	  break;
+	}
+    }
+
+  free_and_init (class_name);
+  return true;
+}
+
+static COLCACHE_ENTRY *
+colcache_find_entry (const OID * class_oid)
+{
+  int num_entries = colcache_Num_entries;
+
+  for (int i = 0; i < num_entries; i++)
+    {
+      if (OID_EQ (&colcache_Entries[i].class_oid, class_oid))
+	{
+	  return &colcache_Entries[i];
+	}
+    }
+
+  return NULL;
+}
+
+static COLCACHE_ENTRY *
+colcache_add_entry (const OID * class_oid)
+{
+  COLCACHE_ENTRY *entry;
+  std::lock_guard<std::mutex> lock (colcache_Entries_mutex);
+
+  entry = colcache_find_entry (class_oid);
+  if (entry != NULL)
+    {
+      return entry;
+    }
+
+  if (colcache_Num_entries >= COLCACHE_MAX_CLASSES)
+    {
+      return NULL;
+    }
+
+  entry = &colcache_Entries[colcache_Num_entries];
+  COPY_OID (&entry->class_oid, class_oid);
+  entry->version = 0;
+  entry->table.reset ();
+  entry->is_building = false;
+  entry->retry_time = 0;
+
+  /* publish the entry only after it is initialized */
+  colcache_Num_entries++;
+
+  return entry;
+}
+
+/*
+ * colcache_get_table () - get the columnar table of a class, building it if needed
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   entry(in): cache entry of class
+ *   hfid(in): heap file of class
+ *   table_out(out): columnar table or empty if the class cannot be served from memory now
+ */
+static int
+colcache_get_table (THREAD_ENTRY * thread_p, COLCACHE_ENTRY * entry, const HFID * hfid,
+		    std::shared_ptr<const columnar_table> &table_out)
+{
+  std::unique_ptr<columnar_table> built;
+  std::uint64_t version;
+  int error_code;
+
+  {
+    std::lock_guard<std::mutex> lock (entry->mutex);
+
+    if (entry->table != NULL)
+      {
+	table_out = entry->table;
+	return NO_ERROR;
+      }
+    if (entry->is_building || time (NULL) < entry->retry_time)
+      {
+	/* somebody else is building it or it failed recently; read the heap meanwhile */
+	return NO_ERROR;
+      }
+
+    entry->is_building = true;
+    version = entry->version;
+  }
+
+  error_code = colcache_build_table (thread_p, &entry->class_oid, hfid, built);
+
+  std::lock_guard<std::mutex> lock (entry->mutex);
+
+  entry->is_building = false;
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  if (built == NULL || version != entry->version)
+    {
+      /* not all records were visible to everyone, the cache is full or the class changed while building; a table
+       * dropped here gives back the memory it reserved */
+      entry->retry_time = time (NULL) + COLCACHE_RETRY_INTERVAL;
+      return NO_ERROR;
+    }
+
+  /* the memory of the table was reserved when it was built */
+  entry->table.reset (built.release ());
+  table_out = entry->table;
+
+  return NO_ERROR;
+}
+
+/*
+ * colcache_build_table () - read all objects of class into a new columnar table
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   class_oid(in): class identifier
+ *   hfid(in): heap file of class
+ *   table_out(out): new table or empty if the class cannot be cached now
+ */
+static int
+colcache_build_table (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid,
+		      std::unique_ptr<columnar_table> &table_out)
+{
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes = RECDES_INITIALIZER;
+  MVCC_REC_HEADER mvcc_header;
+  MVCCID oldest_visible;
+  OID oid;
+  SCAN_CODE scan_code;
+  std::uint64_t max_size;
+  std::unique_ptr<columnar_table> table;
+  bool is_attrinfo_started = false;
+  bool is_scancache_started = false;
+  bool is_cacheable = true;
+  int error_code = NO_ERROR;
+
+  table_out.reset ();
+
+  error_code = heap_attrinfo_start (thread_p, class_oid, -1, NULL, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto end;
+    }
+  is_attrinfo_started = true;
+
+  table.reset (new columnar_table (*hfid, attr_info.last_classrepr->id));
+  for (int i = 0; i < attr_info.num_values; i++)
+    {
+      HEAP_ATTRVALUE *value = &attr_info.values[i];
+      column_kind kind;
+
+      if (value->attr_type != HEAP_INSTANCE_ATTR
+	  || !column_vector::is_supported_type (value->last_attrepr->type, kind))
+	{
+	  continue;
+	}
+
+      table->m_columns.emplace_back (new column_vector (value->attrid, value->last_attrepr->type,
+				     value->last_attrepr->domain->precision,
+				     value->last_attrepr->domain->scale, kind));
+    }
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid, class_oid, true, false, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto end;
+    }
+  is_scancache_started = true;
+
+  max_size = prm_get_bigint_value (PRM_ID_COLUMNAR_CACHE_MAX_SIZE);
+  oldest_visible = log_Gl.mvcc_table.get_global_oldest_visible ();
+
+  /* no snapshot: every version in heap is returned and its visibility is checked below */
+  OID_SET_NULL (&oid);
+  while ((scan_code = heap_next (thread_p, hfid, (OID *) class_oid, &oid, &recdes, &scan_cache, PEEK)) == S_SUCCESS)
+    {
+      error_code = or_mvcc_get_header (&recdes, &mvcc_header);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
+	}
+
+      if (MVCC_IS_HEADER_DELID_VALID (&mvcc_header))
+	{
+	  if (MVCC_ID_PRECEDES (MVCC_GET_DELID (&mvcc_header), oldest_visible))
+	    {
+	      /* deleted for everyone */
+	      continue;
+	    }
+	  is_cacheable = false;
+	  break;
+	}
+      if (MVCC_IS_HEADER_INSID_NOT_ALL_VISIBLE (&mvcc_header)
+	  && !MVCC_ID_PRECEDES (MVCC_GET_INSID (&mvcc_header), oldest_visible))
+	{
+	  /* some snapshots may not see this version */
+	  is_cacheable = false;
+	  break;
+	}
+
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto end;
+	}
+
+      for (std::unique_ptr<column_vector> &column : table->m_columns)
+	{
+	  DB_VALUE *dbvalue = heap_attrinfo_access (column->m_attrid, &attr_info);
+
+	  assert (dbvalue != NULL);
+	  error_code = column->append (*dbvalue);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	}
+      table->m_oids.push_back (oid);
+
+      if (table->m_oids.size () % COLCACHE_SIZE_CHECK_ROWS == 0)
+	{
+	  std::size_t size = table->m_oids.size () * sizeof (OID);
+
+	  for (std::unique_ptr<column_vector> &column : table->m_columns)
+	    {
+	      size += column->get_memory_size ();
+	    }
+	  if (colcache_Memory_size + size > max_size)
+	    {
+	      is_cacheable = false;
+	      break;
+	    }
+	}
+    }
+
+  if (is_cacheable && scan_code == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  if (is_cacheable)
+    {
+      std::size_t size;
+
+      table->m_oids.shrink_to_fit ();
+      size = table->m_oids.size () * sizeof (OID);
+      for (std::unique_ptr<column_vector> &column : table->m_columns)
+	{
+	  column->end_append ();
+	  size += column->get_memory_size ();
+	}
+      if (colcache_reserve_memory (size, max_size))
+	{
+	  /* from now on, the destructor of table gives the memory back */
+	  table->m_memory_size = size;
+	}
+      else
+	{
+	  is_cacheable = false;
+	}
+    }
+
+  if (is_cacheable)
+    {
+      table_out = std::move (table);
+    }
+
+end:
+  if (is_scancache_started)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (is_attrinfo_started)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+
+  if (table != NULL)
+    {
+      /* not handed out; nothing was reserved */
+      table->m_memory_size = 0;
+    }
+
+  return error_code;
+}
+
+/*
+ * colcache_reserve_memory () - account the memory of a new table in the cache size if it fits
+ *   return: true if reserved, false if the cache would grow beyond max_size
+ *   size(in): memory of table
+ *   max_size(in): columnar_cache_max_size
+ */
+static bool
+colcache_reserve_memory (std::size_t size, std::uint64_t max_size)
+{
+  std::uint64_t current = colcache_Memory_size.load ();
+
+  do
+    {
+      if (current + size > max_size)
+	{
+	  return false;
+	}
+    }
+  while (!colcache_Memory_size.compare_exchange_weak (current, current + size));
+
+  return true;
+}
+
+/*
+ * colcache_map_attributes () - find the column of each attribute read by a scan
+ *   return: false if an attribute is not cached
+ *   table(in): columnar table
+ *   attr_info(in): attribute cache of scan
+ *   map(out): columns matching attr_info values
+ */
+static bool
+colcache_map_attributes (const columnar_table & table, HEAP_CACHE_ATTRINFO * attr_info, colcache_scan::attr_map & map)
+{
+  map.attr_info = attr_info;
+  map.columns.clear ();
+
+  if (attr_info == NULL || attr_info->num_values <= 0)
+    {
+      return true;
+    }
+
+  if (attr_info->last_classrepr == NULL || attr_info->last_classrepr->id != table.m_repr_id)
+    {
+      /* the class changed since the table was built */
+      return false;
+    }
+
+  for (int i = 0; i < attr_info->num_values; i++)
+    {
+      const column_vector *column;
+
+      if (attr_info->values[i].attr_type != HEAP_INSTANCE_ATTR)
+	{
+	  return false;
+	}
+
+      column = table.get_column (attr_info->values[i].attrid);
+      if (column == NULL)
+	{
+	  return false;
+	}
+      map.columns.push_back (column);
+    }
+
+  return true;
+}
+
+/*
+ * colcache_scan_start () - start reading a class from its columnar table
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   class_oid(in): scanned class
+ *   hfid(in): heap file of class
+ *   pred_attr_info(in): attributes read for the scan predicate
+ *   rest_attr_info(in): other attributes read by the scan
+ *   scan_out(out): columnar scan or NULL if the heap must be read
+ */
+int
+colcache_scan_start (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid,
+		     HEAP_CACHE_ATTRINFO * pred_attr_info, HEAP_CACHE_ATTRINFO * rest_attr_info,
+		     COLCACHE_SCAN ** scan_out)
+{
+  COLCACHE_ENTRY *entry;
+  std::shared_ptr<const columnar_table> table;
+  COLCACHE_SCAN *scan;
+  int error_code;
+
+  *scan_out = NULL;
+
+  if (colcache_Class_names.empty () || OID_ISNULL (class_oid) || mvcc_is_mvcc_disabled_class (class_oid))
+    {
+      return NO_ERROR;
+    }
+
+  entry = colcache_find_entry (class_oid);
+  if (entry == NULL)
+    {
+      bool is_listed;
+
+      if (!colcache_is_listed_class (thread_p, class_oid, is_listed))
+	{
+	  /* not fatal; read the heap */
+	  er_clear ();
+	  return NO_ERROR;
+	}
+      if (!is_listed)
+	{
+	  return NO_ERROR;
+	}
+
+      entry = colcache_add_entry (class_oid);
+      if (entry == NULL)
+	{
+	  return NO_ERROR;
+	}
+    }
+
+  error_code = colcache_get_table (thread_p, entry, hfid, table);
+  if (error_code != NO_ERROR || table == NULL)
+    {
+      return error_code;
+    }
+
+  if (!HFID_EQ (&table->m_hfid, hfid))
+    {
+      return NO_ERROR;
+    }
+
+  scan = new COLCACHE_SCAN ();
+  if (!colcache_map_attributes (*table, pred_attr_info, scan->maps[0])
+      || !colcache_map_attributes (*table, rest_attr_info, scan->maps[1]))
+    {
+      delete scan;
+      return NO_ERROR;
+    }
+
+  scan->table = std::move (table);
+  scan->row = -1;
+  scan->batch_pred.terms = NULL;
+  scan->batch_pred.num_terms = 0;
+  scan->batch_pred.is_complete = false;
+  scan->batch = -1;
+  *scan_out = scan;
+
+  return NO_ERROR;
+}
+
+/*
+ * colcache_scan_reset () - position the scan before the first row in the scan direction
+ *   return: void
+ *   scan(in): columnar scan
+ *   forward(in): scan direction
+ */
+void
+colcache_scan_reset (COLCACHE_SCAN * scan, bool forward)
+{
+  scan->row = forward ? -1 : (std::int64_t) scan->table->get_row_count ();
+}
+
+/*
+ * colcache_scan_set_filter () - evaluate the simple conjuncts of the scan predicate on batches of rows
+ *   return: void
+ *   scan(in): columnar scan
+ *   pred(in): scan predicate
+ *
+ * Note: comparisons, ranges and IN lists on integer, date/time and floating point columns are evaluated directly on
+ *	 the column vectors, EVAL_BATCH_SIZE rows at a time. colcache_scan_next then skips the rows that do not
+ *	 satisfy them.
+ */
+void
+colcache_scan_set_filter (COLCACHE_SCAN * scan, const PRED_EXPR * pred)
+{
+  const column_vector *column;
+
+  eval_batch_pred_clear (&scan->batch_pred);
+  scan->batch_columns.clear ();
+  scan->batch = -1;
+
+  if (eval_batch_pred_init (pred, &scan->batch_pred) <= 0)
+    {
+      er_clear ();
+      return;
+    }
+
+  scan->batch_columns.resize (scan->batch_pred.num_terms);
+  for (int i = 0; i < scan->batch_pred.num_terms; i++)
+    {
+      EVAL_BATCH_COLUMN &batch_column = scan->batch_columns[i];
+
+      batch_column.ints = NULL;
+      batch_column.doubles = NULL;
+
+      column = scan->table->get_column (scan->batch_pred.terms[i].attrid);
+      if (column == NULL)
+	{
+	  /* not an attribute of the class */
+	  scan->batch_pred.terms[i].is_active = false;
+	  scan->batch_pred.is_complete = false;
+	  batch_column.type = DB_TYPE_NULL;
+	  batch_column.nulls = NULL;
+	  continue;
+	}
+
+      batch_column.type = column->m_type;
+      batch_column.nulls = column->m_nulls.data ();
+      if (column->m_kind == column_kind::INT64)
+	{
+	  batch_column.ints = (const INT64 *) column->m_ints.data ();
+	}
+      else if (column->m_kind == column_kind::DOUBLE)
+	{
+	  batch_column.doubles = column->m_doubles.data ();
+	}
+    }
+}
+
+/*
+ * colcache_scan_next () - move to the next row
+ *   return: S_SUCCESS, S_END or S_ERROR
+ *   thread_p(in): thread entry
+ *   scan(in): columnar scan
+ *   forward(in): scan direction
+ *   use_filter(in): skip the rows that do not satisfy the filter set by colcache_scan_set_filter
+ *   vd(in): value descriptor of the scan predicate
+ *   oid(out): object identifier of the row
+ *   skipped_rows(out): number of rows skipped by the filter
+ *   is_qualified(out): true if the row is known to satisfy the whole scan predicate
+ */
+SCAN_CODE
+colcache_scan_next (THREAD_ENTRY * thread_p, COLCACHE_SCAN * scan, bool forward, bool use_filter, val_descr * vd,
+		    OID * oid, INT64 * skipped_rows, bool * is_qualified)
+{
+  std::int64_t row_count = (std::int64_t) scan->table->get_row_count ();
+  std::int64_t batch, bit;
+
+  *skipped_rows = 0;
+  *is_qualified = false;
+  use_filter = use_filter && forward && scan->batch_pred.num_terms > 0;
+
+  while (true)
+    {
+      scan->row += forward ? 1 : -1;
+      if (scan->row < 0 || scan->row >= row_count)
+	{
+	  scan->row = forward ? row_count : -1;
+	  return S_END;
+	}
+
+      if (!use_filter)
+	{
+	  break;
+	}
+
+      batch = scan->row / EVAL_BATCH_SIZE;
+      if (batch != scan->batch)
+	{
+	  std::int64_t start = batch * EVAL_BATCH_SIZE;
+	  int count = (int) MIN (row_count - start, EVAL_BATCH_SIZE);
+
+	  if (eval_batch_pred_select (thread_p, &scan->batch_pred, vd, scan->batch_columns.data (), (int) start, count,
+				      scan->selection) != NO_ERROR)
+	    {
+	      scan->batch = -1;
+	      return S_ERROR;
+	    }
+	  scan->batch = batch;
+	}
+
+      bit = scan->row % EVAL_BATCH_SIZE;
+      if ((scan->selection[bit / 64] & (((UINT64) 1) << (bit % 64))) != 0)
+	{
+	  *is_qualified = scan->batch_pred.is_complete;
+	  break;
+	}
+      (*skipped_rows)++;
+    }
+
+  COPY_OID (oid, &scan->table->m_oids[scan->row]);
+  return S_SUCCESS;
+}
+
+/*
+ * colcache_scan_read_dbvalues () - read the values of current row into an attribute cache
+ *   return: error code
+ *   scan(in): columnar scan
+ *   attr_info(in/out): predicate or rest attribute cache given to colcache_scan_start
+ *
+ * Note: this replaces heap_attrinfo_read_dbvalues for the columnar scan.
+ */
+int
+colcache_scan_read_dbvalues (COLCACHE_SCAN * scan, HEAP_CACHE_ATTRINFO * attr_info)
+{
+  colcache_scan::attr_map *map;
+
+  if (attr_info == NULL || attr_info->num_values <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  map = (attr_info == scan->maps[0].attr_info) ? &scan->maps[0] : &scan->maps[1];
+  assert (map->attr_info == attr_info);
+
+  for (int i = 0; i < attr_info->num_values; i++)
+    {
+      HEAP_ATTRVALUE *value = &attr_info->values[i];
+
+      if (value->state != HEAP_UNINIT_ATTRVALUE)
+	{
+	  (void) pr_clear_value (&value->dbvalue);
+	}
+      map->columns[i]->get_value ((std::size_t) scan->row, value->dbvalue);
+      value->state = HEAP_READ_ATTRVALUE;
+    }
+
+  COPY_OID (&attr_info->inst_oid, &scan->table->m_oids[scan->row]);
+
+  return NO_ERROR;
+}
+
+/*
+ * colcache_scan_end () - release the columnar table read by scan
+ *   return: void
+ *   scan(in/out): columnar scan, set to NULL
+ */
+void
+colcache_scan_end (COLCACHE_SCAN ** scan)
+{
+  if (*scan != NULL)
+    {
+      delete *scan;
+      *scan = NULL;
+    }
+}
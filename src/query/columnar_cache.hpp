@@ -0,0 +1,150 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// columnar_cache.hpp - in-memory columnar copies of read-mostly classes
+//
+//  Classes listed in the columnar_cache_classes system parameter may be kept in memory as column vectors. The vectors
+//  are built from a heap scan the first time a listed class is scanned and are served to later heap scans of the
+//  class instead of reading and decoding heap records.
+//
+//  Fixed size numeric and date/time attributes are stored as plain 64-bit integer or double vectors. Strings and
+//  numerics are dictionary encoded. Attributes of other types are not cached; scans that need them read the heap.
+//  Partitions are cached when listed by their own names. The simple conjuncts of the scan predicate are evaluated on
+//  the column vectors a batch of rows at a time (see eval_batch_pred_select); this is the only user of the batch
+//  evaluation, so classes that are not cached keep the row by row evaluation.
+//
+//  MVCC: a columnar table is only built when every heap record is visible to all transactions (insert MVCCID older
+//  than the oldest visible MVCCID and no recent delete). Such a table holds the same rows for every snapshot, as
+//  long as the class is not modified afterwards. Every insert, update or delete of the class drops the table and
+//  changes the class version; a table built concurrently with a modification is never published. Scans that already
+//  hold a table keep using it: their snapshots cannot see the modification.
+//
+
+#ifndef _COLUMNAR_CACHE_HPP_
+#define _COLUMNAR_CACHE_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "dbtype_def.h"
+#include "heap_attrinfo.h"
+#include "query_evaluator.h"
+#include "storage_common.h"
+#include "thread_compat.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cubquery
+{
+  enum class column_kind
+  {
+    INT64,			/* SHORT, INTEGER, BIGINT, DATE, TIME, TIMESTAMP and DATETIME */
+    DOUBLE,			/* FLOAT and DOUBLE */
+    DICTIONARY			/* CHAR, VARCHAR and NUMERIC; codes index the dictionary */
+  };
+
+  class column_vector
+  {
+    public:
+      column_vector (ATTR_ID attrid, DB_TYPE type, int precision, int scale, column_kind kind);
+      ~column_vector ();
+
+      column_vector (const column_vector &) = delete;
+      column_vector &operator= (const column_vector &) = delete;
+
+      static bool is_supported_type (DB_TYPE type, column_kind &kind);
+
+      int append (const DB_VALUE &value);
+      void end_append ();
+      void get_value (std::size_t row, DB_VALUE &value) const;
+
+      bool is_null (std::size_t row) const
+      {
+	return (m_nulls[row / 64] & (((std::uint64_t) 1) << (row % 64))) != 0;
+      }
+
+      std::size_t get_memory_size () const;
+
+      ATTR_ID m_attrid;
+      DB_TYPE m_type;
+      int m_precision;
+      int m_scale;
+      column_kind m_kind;
+
+      std::vector<std::uint64_t> m_nulls;	/* null bitmap, one bit per row */
+      std::vector<std::int64_t> m_ints;	/* values of INT64 columns */
+      std::vector<double> m_doubles;	/* values of DOUBLE columns */
+      std::vector<std::int32_t> m_codes;	/* dictionary codes of DICTIONARY columns */
+      std::vector<DB_VALUE> m_dictionary;	/* distinct values of DICTIONARY columns, owned by the column */
+
+    private:
+      void append_null_bit (bool is_null);
+
+      std::size_t m_count;
+      std::size_t m_dictionary_bytes;
+      std::unordered_map<std::string, std::int32_t> m_codes_by_key;	/* only used while building */
+  };
+
+  class columnar_table
+  {
+    public:
+      columnar_table (const HFID &hfid, REPR_ID repr_id);
+      ~columnar_table ();
+
+      columnar_table (const columnar_table &) = delete;
+      columnar_table &operator= (const columnar_table &) = delete;
+
+      const column_vector *get_column (ATTR_ID attrid) const;
+      std::size_t get_row_count () const
+      {
+	return m_oids.size ();
+      }
+
+      HFID m_hfid;
+      REPR_ID m_repr_id;
+      std::vector<OID> m_oids;
+      std::vector<std::unique_ptr<column_vector>> m_columns;
+      std::size_t m_memory_size;	/* reserved in the global cache size, given back by the destructor */
+  };
+}
+
+/* cursor of a heap scan that reads a columnar table instead of the heap file */
+typedef struct colcache_scan COLCACHE_SCAN;
+
+extern int colcache_initialize (THREAD_ENTRY * thread_p);
+extern void colcache_finalize (THREAD_ENTRY * thread_p);
+
+extern void colcache_class_modified (const OID * class_oid);
+
+extern int colcache_scan_start (THREAD_ENTRY * thread_p, const OID * class_oid, const HFID * hfid,
+				HEAP_CACHE_ATTRINFO * pred_attr_info, HEAP_CACHE_ATTRINFO * rest_attr_info,
+				COLCACHE_SCAN ** scan_out);
+extern void colcache_scan_reset (COLCACHE_SCAN * scan, bool forward);
+extern void colcache_scan_set_filter (COLCACHE_SCAN * scan, const PRED_EXPR * pred);
+extern SCAN_CODE colcache_scan_next (THREAD_ENTRY * thread_p, COLCACHE_SCAN * scan, bool forward, bool use_filter,
+				     val_descr * vd, OID * oid, INT64 * skipped_rows, bool * is_qualified);
+extern int colcache_scan_read_dbvalues (COLCACHE_SCAN * scan, HEAP_CACHE_ATTRINFO * attr_info);
+extern void colcache_scan_end (COLCACHE_SCAN ** scan);
+
+#endif // _COLUMNAR_CACHE_HPP_
@@ -33,16 +33,22 @@
 
 #include "list_file.h"
 
-#include "binaryheap.h"
 #include "db_value_printer.hpp"
 #include "dbtype.h"
 #include "error_manager.h"
+#include "language_support.h"
 #include "log_append.hpp"
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "query_manager.h"
 #include "query_opfunc.h"
 #include "stream_to_xasl.h"
+#include "system_parameter.h"
+#if defined (SERVER_MODE)
+#include "boot_sr.h"
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#endif /* SERVER_MODE */
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"	// for thread_sleep
 #include "xasl.h"
@@ -81,11 +87,11 @@ static int rv;
   while (0)
 #endif
 
-typedef struct qfile_cleanup_candidate QFILE_CACHE_CLEANUP_CANDIDATE;
-struct qfile_cleanup_candidate
+typedef struct qfile_list_cache_clock_args QFILE_LIST_CACHE_CLOCK_ARGS;
+struct qfile_list_cache_clock_args
 {
-  QFILE_LIST_CACHE_ENTRY *qcache;
-  double weight;
+  int target_entries;		/* stop evicting when the cache has no more entries than this */
+  int target_pages;		/* and no more pages than this */
 };
 
 typedef SCAN_CODE (*ADVANCE_FUCTION) (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID *, QFILE_TUPLE_RECORD *,
@@ -96,12 +102,15 @@ typedef struct qfile_list_cache QFILE_LIST_CACHE;
 struct qfile_list_cache
 {
   MHT_TABLE **list_hts;		/* array of memory hash tables for list cache; pool for list_ht of XASL_CACHE_ENTRY */
+  pthread_mutex_t *list_ht_mutexes;	/* latch of each list_ht; a list_ht is a partition of the cache */
+  XASL_CACHE_ENTRY **list_ht_owners;	/* XASL cache entry owning each list_ht; NULL if the list_ht is free */
+  pthread_mutex_t free_list_mutex;	/* protects free_ht_list, next_ht_no, list_ht_owners and the entry pool */
   int *free_ht_list;		/* array of freed hash tables */
   int next_ht_no;		/* the next freed hash table number */
   unsigned int n_hts;		/* number of elements of list_hts */
+  unsigned int clock_hand;	/* the next list_ht swept by the cleanup daemon */
   int n_entries;		/* total number of cache entries */
   int n_pages;			/* total number of pages used by the cache */
-  unsigned int lookup_counter;	/* counter of cache lookup */
   unsigned int hit_counter;	/* counter of cache hit */
   unsigned int miss_counter;	/* counter of cache miss */
   unsigned int full_counter;	/* counter of cache full & replacement */
@@ -160,7 +169,14 @@ struct qfile_list_cache_entry_pool
  */
 
 /* list cache and related information */
-static QFILE_LIST_CACHE qfile_List_cache = { NULL, NULL, 0, 0, 0, 0, 0, 0, 0, 0 };
+static QFILE_LIST_CACHE qfile_List_cache = {
+  NULL, NULL, NULL, PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#if defined (SERVER_MODE)
+/* evicts list cache entries when the cache is full */
+static cubthread::daemon *qfile_List_cache_cleanup_daemon = NULL;
+#endif /* SERVER_MODE */
 
 /* information of candidates to be removed from XASL cache */
 static QFILE_LIST_CACHE_CANDIDATE qfile_List_cache_candidate = { 0, 0, 0, 0, NULL, NULL, NULL, 0, 0, false };
@@ -272,6 +288,8 @@ static void qfile_add_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_C
 static void qfile_delete_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_CACHE_ENTRY * lent);
 static int qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data);
 static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, void *args);
+static int qfile_end_use_of_list_cache_entry_internal (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent,
+						       bool marker);
 static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
 
 static int qfile_get_list_cache_entry_size_for_allocate (int nparam);
@@ -282,137 +300,185 @@ static DB_VALUE *qfile_get_list_cache_entry_param_values (QFILE_LIST_CACHE_ENTRY
 static int qfile_compare_with_null_value (int o0, int o1, SUBKEY_INFO key_info);
 static int qfile_compare_with_interpolation_domain (char *fp0, char *fp1, SUBKEY_INFO * subkey,
 						    SORTKEY_INFO * key_info);
+static int qfile_make_string_sort_key (SUBKEY_INFO * subkey, char *field_data, int field_length, char *key,
+				       int key_size);
+static bool qfile_can_use_string_sort_key (TP_DOMAIN * domain);
 
 #if defined(SERVER_MODE)
-static BH_CMP_RESULT
-qfile_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg)
+/*
+ * qfile_list_cache_clock_sweep () - Give the entry a second chance or evict it
+ *                                   Used by mht_map_no_key() function
+ *   return: NO_ERROR to continue the sweep, ER_FAILED to stop it
+ *   data(in)   : a list cache entry
+ *   args(in)   : QFILE_LIST_CACHE_CLOCK_ARGS
+ *
+ * Note: The caller holds the latch of the list_ht of the entry.
+ */
+static int
+qfile_list_cache_clock_sweep (THREAD_ENTRY * thread_p, void *data, void *args)
 {
-  double left_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) left)->weight;
-  double right_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) right)->weight;
+  QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
+  QFILE_LIST_CACHE_CLOCK_ARGS *clock_args = (QFILE_LIST_CACHE_CLOCK_ARGS *) args;
+
+  assert (lent != NULL && lent->xcache_entry != NULL);
 
-  if (left_weight < right_weight)
+  if (lent->last_ta_idx > 0)
     {
-      return BH_LT;
+      /* exclude in-transaction */
+      return NO_ERROR;
     }
-  else if (left_weight == right_weight)
+
+  if (lent->clock_referenced)
     {
-      return BH_EQ;
+      /* used since the last sweep; spare it this time */
+      lent->clock_referenced = false;
+      return NO_ERROR;
     }
-  else
+
+  (void) qfile_delete_list_cache_entry (thread_p, lent);
+
+  if (qfile_List_cache.n_entries <= clock_args->target_entries && qfile_List_cache.n_pages <= clock_args->target_pages)
     {
-      return BH_GT;
+      /* enough room was made */
+      return ER_FAILED;
     }
+
+  return NO_ERROR;
 }
 
-static int
+/*
+ * qfile_list_cache_cleanup () - Evict the list cache entries down to 80% of
+ *                               the entry and page limits
+ *   return:
+ *
+ * Note: The clock hand goes around the list_hts latching one at a time, so
+ *       lookups of the other queries are not blocked while it sweeps. The
+ *       first pass over an entry clears its reference bit, and an entry that
+ *       is found unreferenced again is deleted.
+ */
+static void
 qfile_list_cache_cleanup (THREAD_ENTRY * thread_p)
 {
-  BINARY_HEAP *bh = NULL;
-  QFILE_CACHE_CLEANUP_CANDIDATE candidate;
-  int candidate_index;
-  unsigned int i, n;
-
-  struct timeval current_time;
-  int cleanup_count = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES) * 8 / 10;
-  int cleanup_pages = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES) * 8 / 10;
+  QFILE_LIST_CACHE_CLOCK_ARGS clock_args;
+  int max_entries = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES);
+  int max_pages = prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES);
+  unsigned int ht_no, n;
 
-  if (cleanup_count < 1)
+  if (qfile_List_cache.n_hts == 0
+      || (qfile_List_cache.n_entries < max_entries && qfile_List_cache.n_pages < max_pages))
     {
-      cleanup_count = 1;
-    }
-
-  if (cleanup_pages < 1)
-    {
-      cleanup_pages = 1;
+      return;
     }
 
-  bh =
-    bh_create (thread_p, cleanup_count, sizeof (QFILE_CACHE_CLEANUP_CANDIDATE), qfile_compare_cleanup_candidates, NULL);
+  clock_args.target_entries = MAX (max_entries * 8 / 10, 1);
+  clock_args.target_pages = MAX (max_pages * 8 / 10, 1);
 
-  if (bh == NULL)
+  /* two rounds are enough to evict any entry which is not in use */
+  for (n = 0; n < 2 * qfile_List_cache.n_hts; n++)
     {
-      return ER_FAILED;
-    }
-
-  gettimeofday (&current_time, NULL);
+      if (qfile_List_cache.n_entries <= clock_args.target_entries
+	  && qfile_List_cache.n_pages <= clock_args.target_pages)
+	{
+	  break;
+	}
 
-  /* Collect candidates for cleanup. */
-  for (n = 0; n < qfile_List_cache.n_hts; n++)
-    {
-      MHT_TABLE *ht;
-      HENTRY_PTR *hvector;
-      HENTRY_PTR hentry;
-      INT64 page_ref;
-      INT64 lru_sec;
+      ht_no = qfile_List_cache.clock_hand;
+      qfile_List_cache.clock_hand = (ht_no + 1) % qfile_List_cache.n_hts;
 
-      ht = qfile_List_cache.list_hts[n];
-      for (hvector = ht->table, i = 0; i < ht->size; hvector++, i++)
+      pthread_mutex_lock (&qfile_List_cache.list_ht_mutexes[ht_no]);
+      if (qfile_List_cache.list_ht_owners[ht_no] != NULL)
 	{
-	  if (*hvector != NULL)
-	    {
-	      /* Go over the linked list */
-	      for (hentry = *hvector; hentry != NULL; hentry = hentry->next)
-		{
-		  candidate.qcache = (QFILE_LIST_CACHE_ENTRY *) hentry->data;
-		  assert (candidate.qcache);
-		  assert (candidate.qcache->xcache_entry);
-		  if (candidate.qcache->last_ta_idx > 0)
-		    {
-		      // exclude in-transaction
-		      continue;
-		    }
-		  page_ref = candidate.qcache->list_id.page_cnt + 1;
-		  lru_sec = current_time.tv_sec - candidate.qcache->time_last_used.tv_sec + 1;
-		  candidate.weight = (double) (candidate.qcache->ref_count + 1) / (double) (page_ref * lru_sec);
-		  (void) bh_try_insert (bh, &candidate, NULL);
-		}
-	    }
+	  (void) mht_map_no_key (thread_p, qfile_List_cache.list_hts[ht_no], qfile_list_cache_clock_sweep, &clock_args);
 	}
+      pthread_mutex_unlock (&qfile_List_cache.list_ht_mutexes[ht_no]);
     }
+}
 
-  /* need to sort before traverse */
-  bh_to_sorted_array (bh);
-
-  /* traverse for weight ordering, from light weight to heavy weight */
-  for (candidate_index = 0; candidate_index < bh->element_count; candidate_index++)
+// *INDENT-OFF*
+static void
+qfile_list_cache_cleanup_daemon_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_SERVER_RESTARTED ())
     {
-      bh_element_at (bh, candidate_index, &candidate);
-      qfile_delete_list_cache_entry (thread_p, candidate.qcache);
-      if (qfile_List_cache.n_entries <= cleanup_count)
-	{
-	  if (qfile_List_cache.n_pages <= cleanup_pages)
-	    {
-	      break;
-	    }
-	}
+      // wait for boot to finish
+      return;
     }
 
-  bh_destroy (thread_p, bh);
+  qfile_list_cache_cleanup (&thread_ref);
+}
 
-  return NO_ERROR;
+/*
+ * qfile_list_cache_cleanup_daemon_init () - initialize list cache cleanup daemon
+ */
+static void
+qfile_list_cache_cleanup_daemon_init ()
+{
+  assert (qfile_List_cache_cleanup_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::seconds (1));
+  cubthread::entry_callable_task *daemon_task =
+    new cubthread::entry_callable_task (std::bind (qfile_list_cache_cleanup_daemon_execute, std::placeholders::_1));
+
+  qfile_List_cache_cleanup_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+									      "list_cache_cleanup");
 }
-#endif
+// *INDENT-ON*
+#endif /* SERVER_MODE */
 
+/*
+ * qcache_get_new_ht_no () - Get the list_ht of the XASL cache entry,
+ *                           assigning a free one if it has none yet
+ *   return: list_ht number, or -1 if all of them are in use
+ *   xasl(in)   :
+ */
 int
-qcache_get_new_ht_no (THREAD_ENTRY * thread_p)
+qcache_get_new_ht_no (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl)
 {
-  int ht_no = -1;
+  int ht_no;
+
+  pthread_mutex_lock (&qfile_List_cache.free_list_mutex);
 
-  if (qfile_List_cache.next_ht_no >= 0)
+  /* check again; a concurrent lookup of the same query may have assigned one */
+  ht_no = xasl->list_ht_no;
+  if (ht_no < 0 && qfile_List_cache.next_ht_no >= 0)
     {
       ht_no = qfile_List_cache.next_ht_no;
       qfile_List_cache.next_ht_no = qfile_List_cache.free_ht_list[qfile_List_cache.next_ht_no];
+      qfile_List_cache.list_ht_owners[ht_no] = xasl;
+      xasl->list_ht_no = ht_no;
     }
 
+  pthread_mutex_unlock (&qfile_List_cache.free_list_mutex);
+
   return ht_no;
 }
 
+/*
+ * qcache_free_ht_no () - Return the list_ht to the free list
+ *   return:
+ *   ht_no(in)  :
+ *
+ * Note: The caller holds the latch of the list_ht.
+ */
 void
 qcache_free_ht_no (THREAD_ENTRY * thread_p, int ht_no)
 {
+  XASL_CACHE_ENTRY *owner;
+
   (void) mht_clear (qfile_List_cache.list_hts[ht_no], NULL, NULL);
+
+  pthread_mutex_lock (&qfile_List_cache.free_list_mutex);
+
+  owner = qfile_List_cache.list_ht_owners[ht_no];
+  if (owner != NULL && owner->list_ht_no == ht_no)
+    {
+      owner->list_ht_no = -1;
+    }
+  qfile_List_cache.list_ht_owners[ht_no] = NULL;
   qfile_List_cache.free_ht_list[ht_no] = qfile_List_cache.next_ht_no;
   qfile_List_cache.next_ht_no = ht_no;
+
+  pthread_mutex_unlock (&qfile_List_cache.free_list_mutex);
 }
 
 /* qfile_modify_type_list () -
@@ -3187,6 +3253,30 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
 	  field_length =
 	    ((QFILE_GET_TUPLE_VALUE_FLAG (field_data) == V_BOUND) ? QFILE_GET_TUPLE_VALUE_LENGTH (field_data) : 0);
 
+	  if (field_length > 0 && key_info_p->key[i].use_sort_key && !key_info_p->key[i].use_cmp_dom)
+	    {
+	      /* store the sort key of the string instead of the value */
+	      field_length =
+		qfile_make_string_sort_key (&key_info_p->key[i], field_data + QFILE_TUPLE_VALUE_HEADER_SIZE,
+					    field_length, data + QFILE_TUPLE_VALUE_HEADER_SIZE,
+					    key_record_p->area_size - length - QFILE_TUPLE_VALUE_HEADER_SIZE);
+	      if (field_length < 0)
+		{
+		  return SORT_ERROR_OCCURRED;
+		}
+
+	      length += QFILE_TUPLE_VALUE_HEADER_SIZE + field_length;
+
+	      if (length <= key_record_p->area_size)
+		{
+		  QFILE_PUT_TUPLE_VALUE_FLAG (data, V_BOUND);
+		  QFILE_PUT_TUPLE_VALUE_LENGTH (data, field_length);
+		}
+
+	      data += QFILE_TUPLE_VALUE_HEADER_SIZE + field_length;
+	      continue;
+	    }
+
 	  length += QFILE_TUPLE_VALUE_HEADER_SIZE + field_length;
 
 	  if (length <= key_record_p->area_size)
@@ -3564,6 +3654,7 @@ qfile_compare_partial_sort_record (const void *pk0, const void *pk1, void *arg)
   SORT_REC *k0, *k1;
   int i, n;
   int o0, o1;
+  int l0, l1;
   int order;
   char *d0, *d1;
   char *fp0, *fp1;		/* sort_key field pointer */
@@ -3608,6 +3699,15 @@ qfile_compare_partial_sort_record (const void *pk0, const void *pk1, void *arg)
 	    {
 	      order = qfile_compare_with_interpolation_domain (fp0, fp1, &key_info_p->key[i], key_info_p);
 	    }
+	  else if (key_info_p->key[i].use_sort_key)
+	    {
+	      /* sort keys of strings: no key is a prefix of another */
+	      l0 = QFILE_GET_TUPLE_VALUE_LENGTH (fp0);
+	      l1 = QFILE_GET_TUPLE_VALUE_LENGTH (fp1);
+	      order =
+		memcmp (fp0 + QFILE_TUPLE_VALUE_HEADER_LENGTH, fp1 + QFILE_TUPLE_VALUE_HEADER_LENGTH, MIN (l0, l1));
+	      order = (order != 0) ? ((order > 0) ? 1 : -1) : ((l0 == l1) ? 0 : ((l0 > l1) ? 1 : -1));
+	    }
 	  else
 	    {
 	      d0 = fp0 + QFILE_TUPLE_VALUE_HEADER_LENGTH;
@@ -3728,6 +3828,70 @@ qfile_compare_with_null_value (int o0, int o1, SUBKEY_INFO key_info)
     }
 }
 
+/*
+ * qfile_can_use_string_sort_key () - can the values of the domain be sorted by the sort keys of their collation
+ *   return: true if P_sort_key may hold the sort keys of the values
+ *   domain(in): domain of the sort column
+ */
+static bool
+qfile_can_use_string_sort_key (TP_DOMAIN * domain)
+{
+  LANG_COLLATION *lang_coll;
+
+  if (!prm_get_bool_value (PRM_ID_SORT_NORMALIZED_STRING_KEYS) || TP_DOMAIN_TYPE (domain) != DB_TYPE_VARCHAR
+      || TP_DOMAIN_COLLATION_FLAG (domain) != TP_DOMAIN_COLL_NORMAL)
+    {
+      return false;
+    }
+
+  lang_coll = lang_get_collation (TP_DOMAIN_COLLATION (domain));
+  return (lang_coll != NULL && lang_coll->sort_key != NULL);
+}
+
+/*
+ * qfile_make_string_sort_key () - write the sort key of a string value of a tuple
+ *   return: size of the sort key (aligned) or error code
+ *   subkey(in): sort column
+ *   field_data(in): value of the column in the tuple (after the value header)
+ *   field_length(in): size of the value
+ *   key(out): only the first key_size bytes are written
+ *   key_size(in): size available in key
+ *
+ * Note: The sort key is built once per record, so the string is not walked
+ *       for its collation weights on each comparison.
+ */
+static int
+qfile_make_string_sort_key (SUBKEY_INFO * subkey, char *field_data, int field_length, char *key, int key_size)
+{
+  LANG_COLLATION *lang_coll;
+  DB_VALUE value;
+  OR_BUF buf;
+  int length, aligned_length, i;
+  int error;
+
+  or_init (&buf, field_data, field_length);
+  error = subkey->col_dom->type->data_readval (&buf, &value, subkey->col_dom, -1, false, NULL, 0);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error;
+    }
+
+  lang_coll = lang_get_collation (TP_DOMAIN_COLLATION (subkey->col_dom));
+  length =
+    lang_coll->sort_key (lang_coll, (const unsigned char *) db_get_string (&value), db_get_string_size (&value),
+			 prm_get_bool_value (PRM_ID_IGNORE_TRAILING_SPACE), (unsigned char *) key, MAX (key_size, 0));
+  pr_clear_value (&value);
+
+  aligned_length = DB_ALIGN (length, MAX_ALIGNMENT);
+  for (i = length; i < aligned_length && i < key_size; i++)
+    {
+      key[i] = 0;
+    }
+
+  return aligned_length;
+}
+
 /* qfile_get_estimated_pages_for_sorting () -
  *   return:
  *   listid(in):
@@ -3840,6 +4004,7 @@ qfile_initialize_sort_key_info (SORTKEY_INFO * key_info_p, SORT_LIST * list_p, Q
 
 	  subkey->is_desc = (p->s_order == S_ASC) ? 0 : 1;
 	  subkey->is_nulls_first = (p->s_nulls == S_NULLS_LAST) ? 0 : 1;
+	  subkey->use_sort_key = (key_info_p->use_original && qfile_can_use_string_sort_key (subkey->col_dom));
 
 	  if (key_info_p->use_original)
 	    {
@@ -3865,6 +4030,7 @@ qfile_initialize_sort_key_info (SORTKEY_INFO * key_info_p, SORT_LIST * list_p, Q
 	  subkey->sort_f = types->domp[i]->type->get_data_cmpdisk_function ();
 	  subkey->is_desc = 0;
 	  subkey->is_nulls_first = 1;
+	  subkey->use_sort_key = false;
 	}
     }
 
@@ -4970,6 +5136,7 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
 	  (void) mht_map_no_key (thread_p, qfile_List_cache.list_hts[i], qfile_free_list_cache_entry,
 				 qfile_List_cache.list_hts[i]);
 	  (void) mht_clear (qfile_List_cache.list_hts[i], NULL, NULL);
+	  qfile_List_cache.list_ht_owners[i] = NULL;
 	  qfile_List_cache.free_ht_list[i] = i + 1;
 	}
       qfile_List_cache.free_ht_list[i - 1] = -1;
@@ -4979,12 +5146,21 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
       /* create */
       qfile_List_cache.n_hts = prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_ENTRIES) + 10;
       qfile_List_cache.list_hts = (MHT_TABLE **) calloc (qfile_List_cache.n_hts, sizeof (MHT_TABLE *));
+      qfile_List_cache.list_ht_mutexes = (pthread_mutex_t *) calloc (qfile_List_cache.n_hts, sizeof (pthread_mutex_t));
+      qfile_List_cache.list_ht_owners =
+	(XASL_CACHE_ENTRY **) calloc (qfile_List_cache.n_hts, sizeof (XASL_CACHE_ENTRY *));
       qfile_List_cache.free_ht_list = (int *) calloc (qfile_List_cache.n_hts, sizeof (int));
-      if (qfile_List_cache.list_hts == NULL)
+      if (qfile_List_cache.list_hts == NULL || qfile_List_cache.list_ht_mutexes == NULL
+	  || qfile_List_cache.list_ht_owners == NULL || qfile_List_cache.free_ht_list == NULL)
 	{
 	  goto error;
 	}
 
+      for (i = 0; i < qfile_List_cache.n_hts; i++)
+	{
+	  pthread_mutex_init (&qfile_List_cache.list_ht_mutexes[i], NULL);
+	}
+
       for (i = 0; i < qfile_List_cache.n_hts; i++)
 	{
 	  qfile_List_cache.list_hts[i] =
@@ -4999,9 +5175,10 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
       qfile_List_cache.free_ht_list[i - 1] = -1;
     }
 
+  qfile_List_cache.next_ht_no = 0;
+  qfile_List_cache.clock_hand = 0;
   qfile_List_cache.n_entries = 0;
   qfile_List_cache.n_pages = 0;
-  qfile_List_cache.lookup_counter = 0;
   qfile_List_cache.hit_counter = 0;
   qfile_List_cache.miss_counter = 0;
   qfile_List_cache.full_counter = 0;
@@ -5033,6 +5210,13 @@ qfile_initialize_list_cache (THREAD_ENTRY * thread_p)
       pent->s.next = -1;
     }
 
+#if defined (SERVER_MODE)
+  if (qfile_List_cache_cleanup_daemon == NULL)
+    {
+      qfile_list_cache_cleanup_daemon_init ();
+    }
+#endif /* SERVER_MODE */
+
   csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
 
   return NO_ERROR;
@@ -5052,6 +5236,21 @@ error:
 	  mht_destroy (qfile_List_cache.list_hts[i]);
 	}
       free_and_init (qfile_List_cache.list_hts);
+    }
+  if (qfile_List_cache.list_ht_mutexes)
+    {
+      for (i = 0; i < qfile_List_cache.n_hts; i++)
+	{
+	  pthread_mutex_destroy (&qfile_List_cache.list_ht_mutexes[i]);
+	}
+      free_and_init (qfile_List_cache.list_ht_mutexes);
+    }
+  if (qfile_List_cache.list_ht_owners)
+    {
+      free_and_init (qfile_List_cache.list_ht_owners);
+    }
+  if (qfile_List_cache.free_ht_list)
+    {
       free_and_init (qfile_List_cache.free_ht_list);
     }
   qfile_List_cache.n_hts = 0;
@@ -5075,6 +5274,10 @@ qfile_finalize_list_cache (THREAD_ENTRY * thread_p)
       return NO_ERROR;
     }
 
+#if defined (SERVER_MODE)
+  cubthread::get_manager ()->destroy_daemon (qfile_List_cache_cleanup_daemon);
+#endif /* SERVER_MODE */
+
   if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
     {
       return ER_FAILED;
@@ -5093,10 +5296,25 @@ qfile_finalize_list_cache (THREAD_ENTRY * thread_p)
       free_and_init (qfile_List_cache.list_hts);
     }
 
+  if (qfile_List_cache.list_ht_mutexes)
+    {
+      for (i = 0; i < qfile_List_cache.n_hts; i++)
+	{
+	  pthread_mutex_destroy (&qfile_List_cache.list_ht_mutexes[i]);
+	}
+      free_and_init (qfile_List_cache.list_ht_mutexes);
+    }
+
+  if (qfile_List_cache.list_ht_owners)
+    {
+      free_and_init (qfile_List_cache.list_ht_owners);
+    }
+
   if (qfile_List_cache.free_ht_list)
     {
       free_and_init (qfile_List_cache.free_ht_list);
     }
+  qfile_List_cache.n_hts = 0;
 
   /* list cache entry pool */
   if (qfile_List_cache_entry_pool.pool)
@@ -5120,30 +5338,33 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry
   int rc;
   int cnt;
   int list_ht_no;
+  pthread_mutex_t *ht_mutex;
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (QFILE_IS_LIST_CACHE_DISABLED || qfile_List_cache.n_hts == 0)
     {
-      goto end;
+      return NO_ERROR;
     }
 
-  if (QFILE_IS_LIST_CACHE_DISABLED || xcache_entry->list_ht_no < 0)
+  list_ht_no = xcache_entry->list_ht_no;
+  if (list_ht_no < 0)
     {
-      goto end;
+      return NO_ERROR;
     }
 
-  if (qfile_List_cache.n_hts == 0)
+  ht_mutex = &qfile_List_cache.list_ht_mutexes[list_ht_no];
+  pthread_mutex_lock (ht_mutex);
+
+  if (qfile_List_cache.list_ht_owners[list_ht_no] != xcache_entry)
     {
+      /* the list_ht has been freed in the meantime */
       goto end;
     }
 
-  list_ht_no = xcache_entry->list_ht_no;
-
   if (qfile_get_list_cache_number_of_entries (list_ht_no) == 0)
     {
       /* if no entries, to invalidate free the entry here */
       if (invalidate)
 	{
-	  xcache_entry->list_ht_no = -1;
 	  qcache_free_ht_no (thread_p, list_ht_no);
 	}
       goto end;
@@ -5157,11 +5378,14 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry
 			&invalidate);
       if (rc != NO_ERROR)
 	{
-	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+	  pthread_mutex_unlock (ht_mutex);
 	  thread_sleep (10);	/* 10 msec */
-	  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+	  pthread_mutex_lock (ht_mutex);
+
+	  if (qfile_List_cache.list_ht_owners[list_ht_no] != xcache_entry)
 	    {
-	      return ER_FAILED;
+	      rc = NO_ERROR;
+	      break;
 	    }
 	}
     }
@@ -5174,7 +5398,7 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry
     }
 
 end:
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+  pthread_mutex_unlock (ht_mutex);
 
   return NO_ERROR;
 }
@@ -5187,10 +5411,26 @@ end:
 static QFILE_LIST_CACHE_ENTRY *
 qfile_allocate_list_cache_entry (int req_size)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
   QFILE_POOLED_LIST_CACHE_ENTRY *pent = NULL;
 
-  if (req_size > RESERVED_SIZE_FOR_LIST_CACHE_ENTRY || qfile_List_cache_entry_pool.free_list == -1)
+  if (req_size <= RESERVED_SIZE_FOR_LIST_CACHE_ENTRY)
+    {
+      pthread_mutex_lock (&qfile_List_cache.free_list_mutex);
+      if (qfile_List_cache_entry_pool.free_list != -1)
+	{
+	  /* get one from the pool */
+	  assert ((qfile_List_cache_entry_pool.free_list <= qfile_List_cache_entry_pool.n_entries)
+		  && (qfile_List_cache_entry_pool.free_list >= 0));
+	  pent = &qfile_List_cache_entry_pool.pool[qfile_List_cache_entry_pool.free_list];
+
+	  assert (pent->s.next <= qfile_List_cache_entry_pool.n_entries && pent->s.next >= -1);
+	  qfile_List_cache_entry_pool.free_list = pent->s.next;
+	  pent->s.next = -1;
+	}
+      pthread_mutex_unlock (&qfile_List_cache.free_list_mutex);
+    }
+
+  if (pent == NULL)
     {
       /* malloc from the heap if required memory size is bigger than reserved, or the pool is exhausted */
       pent = (QFILE_POOLED_LIST_CACHE_ENTRY *) malloc (req_size + ADDITION_FOR_POOLED_LIST_CACHE_ENTRY);
@@ -5204,17 +5444,6 @@ qfile_allocate_list_cache_entry (int req_size)
 	  er_log_debug (ARG_FILE_LINE, "ls_alloc_list_cache_ent: allocation failed\n");
 	}
     }
-  else
-    {
-      /* get one from the pool */
-      assert ((qfile_List_cache_entry_pool.free_list <= qfile_List_cache_entry_pool.n_entries)
-	      && (qfile_List_cache_entry_pool.free_list >= 0));
-      pent = &qfile_List_cache_entry_pool.pool[qfile_List_cache_entry_pool.free_list];
-
-      assert (pent->s.next <= qfile_List_cache_entry_pool.n_entries && pent->s.next >= -1);
-      qfile_List_cache_entry_pool.free_list = pent->s.next;
-      pent->s.next = -1;
-    }
 
   /* initialize */
   if (pent)
@@ -5241,7 +5470,6 @@ qfile_allocate_list_cache_entry (int req_size)
 static int
 qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
   QFILE_POOLED_LIST_CACHE_ENTRY *pent;
   QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
   HL_HEAPID old_pri_heap_id;
@@ -5276,14 +5504,16 @@ qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
     {
       /* return it back to the pool */
       (void) memset (&pent->s.entry, 0, sizeof (QFILE_LIST_CACHE_ENTRY));
-      pent->s.next = qfile_List_cache_entry_pool.free_list;
 
 #if !defined (NDEBUG)
       idx = (int) (pent - qfile_List_cache_entry_pool.pool);
       assert (idx <= qfile_List_cache_entry_pool.n_entries && idx >= 0);
 #endif
 
+      pthread_mutex_lock (&qfile_List_cache.free_list_mutex);
+      pent->s.next = qfile_List_cache_entry_pool.free_list;
       qfile_List_cache_entry_pool.free_list = CAST_BUFLEN (pent - qfile_List_cache_entry_pool.pool);
+      pthread_mutex_unlock (&qfile_List_cache.free_list_mutex);
     }
 
   return NO_ERROR;
@@ -5398,34 +5628,30 @@ qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp)
 {
   unsigned int i;
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
-    {
-      return ER_FAILED;
-    }
-
   if (!fp)
     {
       fp = stdout;
     }
 
+  /* lookups are not counted by themselves; every one of them ends in a hit or a miss */
   fprintf (fp,
 	   "LIST_CACHE {\n  n_hts %d\n  n_entries %d  n_pages %d\n"
 	   "  lookup_counter %d\n  hit_counter %d\n  miss_counter %d\n  full_counter %d\n}\n",
 	   qfile_List_cache.n_hts, qfile_List_cache.n_entries, qfile_List_cache.n_pages,
-	   qfile_List_cache.lookup_counter, qfile_List_cache.hit_counter, qfile_List_cache.miss_counter,
-	   qfile_List_cache.full_counter);
+	   qfile_List_cache.hit_counter + qfile_List_cache.miss_counter, qfile_List_cache.hit_counter,
+	   qfile_List_cache.miss_counter, qfile_List_cache.full_counter);
 
   for (i = 0; i < qfile_List_cache.n_hts; i++)
     {
+      pthread_mutex_lock (&qfile_List_cache.list_ht_mutexes[i]);
       if (mht_count (qfile_List_cache.list_hts[i]) > 0)
 	{
 	  fprintf (fp, "\nlist_hts[%d] %p\n", i, (void *) qfile_List_cache.list_hts[i]);
 	  (void) mht_dump (thread_p, fp, qfile_List_cache.list_hts[i], true, qfile_print_list_cache_entry, NULL);
 	}
+      pthread_mutex_unlock (&qfile_List_cache.list_ht_mutexes[i]);
     }
 
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-
   return NO_ERROR;
 }
 
@@ -5478,7 +5704,7 @@ qfile_dump_list_cache (THREAD_ENTRY * thread_p, const char *fname)
 static int
 qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data)
 {
-  /* this function should be called within CSECT_QPROC_LIST_CACHE */
+  /* this function should be called holding the latch of the list_ht of the entry */
   QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
   int error_code = ER_FAILED;
   bool invalidate;
@@ -5493,8 +5719,8 @@ qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data)
   ht_no = lent->list_ht_no;
 
   /* update counter */
-  qfile_List_cache.n_entries--;
-  qfile_List_cache.n_pages -= lent->list_id.page_cnt;
+  ATOMIC_INC_32 (&qfile_List_cache.n_entries, -1);
+  ATOMIC_INC_32 (&qfile_List_cache.n_pages, -lent->list_id.page_cnt);
 
   /* remove the entry from the hash table */
   if (mht_rem2 (qfile_List_cache.list_hts[lent->list_ht_no], &lent->param_values, lent, NULL, NULL) != NO_ERROR)
@@ -5536,7 +5762,6 @@ qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data)
       /* this hash table has no entries and invalidated
        * it needs to free
        */
-      lent->xcache_entry->list_ht_no = -1;
       qcache_free_ht_no (thread_p, ht_no);
     }
 
@@ -5566,7 +5791,7 @@ qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, vo
       lent->invalidate = *((bool *) args);
     }
 
-  return qfile_end_use_of_list_cache_entry (thread_p, lent, true);
+  return qfile_end_use_of_list_cache_entry_internal (thread_p, lent, true);
 }
 
 /*
@@ -5583,8 +5808,9 @@ QFILE_LIST_CACHE_ENTRY *
 qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl, const DB_VALUE_ARRAY * params,
 			       bool * result_cached)
 {
-  QFILE_LIST_CACHE_ENTRY *lent;
+  QFILE_LIST_CACHE_ENTRY *lent = NULL;
   int tran_index;
+  int list_ht_no;
 #if defined(SERVER_MODE)
   TRAN_ISOLATION tran_isolation;
 #if defined(WINDOWS)
@@ -5611,24 +5837,29 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl,
       return NULL;
     }
 
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  list_ht_no = xasl->list_ht_no;
+  if (list_ht_no < 0)
     {
-      return NULL;
-    }
-
-  if (xasl->list_ht_no < 0)
-    {
-      if ((xasl->list_ht_no = qcache_get_new_ht_no (thread_p)) < 0)
+      if ((list_ht_no = qcache_get_new_ht_no (thread_p, xasl)) < 0)
 	{
-	  goto end;
+	  ATOMIC_INC_32 (&qfile_List_cache.miss_counter, 1);	/* counter */
+	  return NULL;
 	}
     }
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
+  /* only the lookups and updates of the same query contend for this latch */
+  pthread_mutex_lock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
+
+  if (qfile_List_cache.list_ht_owners[list_ht_no] != xasl)
+    {
+      /* the list_ht has been freed by an invalidation in the meantime */
+      goto end;
+    }
+
   /* look up the hash table with the key */
-  lent = (QFILE_LIST_CACHE_ENTRY *) mht_get (qfile_List_cache.list_hts[xasl->list_ht_no], params);
-  qfile_List_cache.lookup_counter++;	/* counter */
+  lent = (QFILE_LIST_CACHE_ENTRY *) mht_get (qfile_List_cache.list_hts[list_ht_no], params);
 
   if (lent)
     {
@@ -5685,21 +5916,21 @@ qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl,
 
       (void) gettimeofday (&lent->time_last_used, NULL);
       lent->ref_count++;
+      lent->clock_referenced = true;
     }
 
 end:
+  pthread_mutex_unlock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
 
   if (*result_cached)
     {
-      qfile_List_cache.hit_counter++;	/* counter */
+      ATOMIC_INC_32 (&qfile_List_cache.hit_counter, 1);	/* counter */
     }
   else
     {
-      qfile_List_cache.miss_counter++;	/* counter */
+      ATOMIC_INC_32 (&qfile_List_cache.miss_counter, 1);	/* counter */
     }
 
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-
   if (*result_cached)
     {
       return lent;
@@ -5762,12 +5993,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
     {
       return NULL;
     }
-  if (qfile_List_cache.n_hts == 0)
-    {
-      return NULL;
-    }
-
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (qfile_List_cache.n_hts == 0 || list_ht_no < 0)
     {
       return NULL;
     }
@@ -5777,6 +6003,15 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   tran_isolation = logtb_find_isolation (tran_index);
 #endif /* SERVER_MODE */
 
+  pthread_mutex_lock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
+
+  if (qfile_List_cache.list_ht_owners[list_ht_no] != xasl)
+    {
+      /* the list_ht has been freed by an invalidation in the meantime */
+      lent = NULL;
+      goto end;
+    }
+
   /*
    * The other competing thread which is running the same query
    * already updated this entry after that this and the thread had failed
@@ -5801,8 +6036,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
       /* check in-use by other transaction */
       if (lent->last_ta_idx > 0)
 	{
-	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-	  return lent;
+	  goto end;
 	}
 
       /* the entry that is in the cache is same with mine; do not duplicate the cache entry */
@@ -5828,6 +6062,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
 
       (void) gettimeofday (&lent->time_last_used, NULL);
       lent->ref_count++;
+      lent->clock_referenced = true;
 
 #endif /* SERVER_MODE */
     }
@@ -5844,10 +6079,13 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   if (qfile_List_cache.n_entries >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES)
       || qfile_List_cache.n_pages >= prm_get_integer_value (PRM_ID_LIST_MAX_QUERY_CACHE_PAGES))
     {
-      if (qfile_list_cache_cleanup (thread_p) != NO_ERROR)
+      /* do not cache this result; let the cleanup daemon make room for the next ones */
+      ATOMIC_INC_32 (&qfile_List_cache.full_counter, 1);	/* counter */
+      if (qfile_List_cache_cleanup_daemon != NULL)
 	{
-	  goto end;
+	  qfile_List_cache_cleanup_daemon->wakeup ();
 	}
+      goto end;
     }
 #endif
 
@@ -5898,6 +6136,7 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
   (void) gettimeofday (&lent->time_created, NULL);
   (void) gettimeofday (&lent->time_last_used, NULL);
   lent->ref_count = 0;
+  lent->clock_referenced = true;
   lent->deletion_marker = false;
   lent->invalidate = false;
   lent->xcache_entry = xasl;
@@ -5943,11 +6182,11 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no, const DB
     }
 
   /* update counter */
-  qfile_List_cache.n_entries++;
-  qfile_List_cache.n_pages += lent->list_id.page_cnt;
+  ATOMIC_INC_32 (&qfile_List_cache.n_entries, 1);
+  ATOMIC_INC_32 (&qfile_List_cache.n_pages, lent->list_id.page_cnt);
 
 end:
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+  pthread_mutex_unlock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
 
   return lent;
 }
@@ -5960,6 +6199,39 @@ end:
  */
 int
 qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker)
+{
+  int list_ht_no;
+  int error_code;
+
+  if (QFILE_IS_LIST_CACHE_DISABLED)
+    {
+      return ER_FAILED;
+    }
+  if (lent == NULL || qfile_List_cache.n_hts == 0)
+    {
+      return ER_FAILED;
+    }
+
+  /* the entry stays in its list_ht while this transaction uses it */
+  list_ht_no = lent->list_ht_no;
+
+  pthread_mutex_lock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
+  error_code = qfile_end_use_of_list_cache_entry_internal (thread_p, lent, marker);
+  pthread_mutex_unlock (&qfile_List_cache.list_ht_mutexes[list_ht_no]);
+
+  return error_code;
+}
+
+/*
+ * qfile_end_use_of_list_cache_entry_internal () - End use of list cache entry
+ *   return:
+ *   lent(in/out)   :
+ *   marker(in) :
+ *
+ * Note: The caller holds the latch of the list_ht of the entry.
+ */
+static int
+qfile_end_use_of_list_cache_entry_internal (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker)
 {
   int tran_index;
   bool invalidate = false;
@@ -5979,12 +6251,7 @@ qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENT
     {
       return ER_FAILED;
     }
-  if (lent == NULL || qfile_List_cache.n_hts == 0)
-    {
-      return ER_FAILED;
-    }
-
-  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+  if (lent == NULL)
     {
       return ER_FAILED;
     }
@@ -6055,8 +6322,6 @@ qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENT
     }
 #endif
 
-  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
-
   return NO_ERROR;
 }
 
@@ -97,6 +97,7 @@ struct qfile_list_cache_entry
   struct timeval time_created;	/* when this entry created */
   struct timeval time_last_used;	/* when this entry used lastly */
   int ref_count;		/* how many times this query used */
+  bool clock_referenced;	/* reference bit for the CLOCK eviction of the cleanup daemon */
   bool deletion_marker;		/* this entry will be deleted if marker set */
   bool invalidate;		/* related xcache entry is erased */
 };
@@ -166,7 +167,7 @@ QFILE_LIST_CACHE_ENTRY *qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p,
 QFILE_LIST_CACHE_ENTRY *qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int list_ht_no,
 						       const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id,
 						       XASL_CACHE_ENTRY * xasl);
-int qcache_get_new_ht_no (THREAD_ENTRY * thread_p);
+int qcache_get_new_ht_no (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xasl);
 void qcache_free_ht_no (THREAD_ENTRY * thread_p, int ht_no);
 
 int qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker);
@@ -40,6 +40,7 @@
 #include "xasl_aggregate.hpp"
 #include "statistics.h"
 
+#include <climits>
 #include <cmath>
 
 using namespace cubquery;
@@ -1950,6 +1951,7 @@ qdata_alloc_agg_hkey (cubthread::entry *thread_p, int val_cnt, bool alloc_vals)
 
   key->val_count = val_cnt;
   key->free_values = alloc_vals;
+  key->values_in_block = false;
   return key;
 }
 
@@ -1968,7 +1970,15 @@ qdata_free_agg_hkey (cubthread::entry *thread_p, aggregate_hash_key *key)
       return;
     }
 
-  if (key->values != NULL)
+  if (key->values_in_block)
+    {
+      /* only the data of the values was allocated apart */
+      for (i = 0; i < key->val_count; i++)
+	{
+	  pr_clear_value (key->values[i]);
+	}
+    }
+  else if (key->values != NULL)
     {
       if (key->free_values)
 	{
@@ -2255,6 +2265,31 @@ qdata_agg_hkey_compare (aggregate_hash_key *ckey1, aggregate_hash_key *ckey2, in
   return DB_EQ;
 }
 
+/*
+ * aggregate_hash_key_hash () - hash of aggregate key for aggregate_hash_table
+ *   returns: hash value
+ *   key(in): key
+ */
+unsigned int
+cubquery::aggregate_hash_key_hash::operator() (aggregate_hash_key *const &key) const
+{
+  /* the table maps the full hash value to its slots */
+  return qdata_hash_agg_hkey (key, UINT_MAX);
+}
+
+/*
+ * aggregate_hash_key_equal () - equality of aggregate keys for aggregate_hash_table
+ *   returns: true if equal, false otherwise
+ *   key1(in): first key
+ *   key2(in): second key
+ */
+bool
+cubquery::aggregate_hash_key_equal::operator() (aggregate_hash_key *const &key1,
+    aggregate_hash_key *const &key2) const
+{
+  return qdata_agg_hkey_eq (key1, key2) != 0;
+}
+
 /*
  * qdata_agg_hkey_eq () - check equality of two aggregate keys
  *   returns: true if equal, false otherwise
@@ -2277,29 +2312,47 @@ qdata_agg_hkey_eq (const void *key1, const void *key2)
  *   returns: pointer to new aggregate hash key
  *   thread_p(in): thread
  *   key(in): source key
+ *
+ * NOTE: The copy is kept in the hash table for each group; the structure, the value array and the values are
+ *       allocated in one block.
  */
 aggregate_hash_key *
 qdata_copy_agg_hkey (cubthread::entry *thread_p, aggregate_hash_key *key)
 {
   aggregate_hash_key *new_key = NULL;
+  DB_VALUE *new_values;
+  size_t size;
   int i = 0;
 
-  if (key)
+  if (key == NULL)
     {
-      /* make a copy */
-      new_key = qdata_alloc_agg_hkey (thread_p, key->val_count, false);
+      return NULL;
     }
 
-  if (new_key)
+  size = sizeof (aggregate_hash_key) + key->val_count * (sizeof (DB_VALUE *) + sizeof (DB_VALUE));
+  new_key = (aggregate_hash_key *) db_private_alloc (thread_p, size);
+  if (new_key == NULL)
     {
-      /* copy values */
-      new_key->val_count = key->val_count;
-      for (i = 0; i < key->val_count; i++)
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
+    }
+
+  new_key->values = (DB_VALUE **) (new_key + 1);
+  new_values = (DB_VALUE *) (new_key->values + key->val_count);
+  new_key->val_count = key->val_count;
+  new_key->free_values = true;
+  new_key->values_in_block = true;
+
+  /* copy values */
+  for (i = 0; i < key->val_count; i++)
+    {
+      new_key->values[i] = &new_values[i];
+      if (pr_clone_value (key->values[i], new_key->values[i]) != NO_ERROR)
 	{
-	  new_key->values[i] = pr_copy_value (key->values[i]);
+	  new_key->val_count = i;
+	  qdata_free_agg_hkey (thread_p, new_key);
+	  return NULL;
 	}
-
-      new_key->free_values = true;
     }
 
   return new_key;
@@ -2632,12 +2685,12 @@ qdata_load_agg_hentry_from_list (cubthread::entry *thread_p, qfile_list_scan_id
  * NOTE: This function will clear the hash table!
  */
 int
-qdata_save_agg_htable_to_list (cubthread::entry *thread_p, mht_table *hash_table, qfile_list_id *tuple_list_id,
-			       qfile_list_id *partial_list_id, db_value *temp_dbval_array)
+qdata_save_agg_htable_to_list (cubthread::entry *thread_p, aggregate_hash_table *hash_table,
+			       qfile_list_id *tuple_list_id, qfile_list_id *partial_list_id, db_value *temp_dbval_array)
 {
   aggregate_hash_key *key = NULL;
   aggregate_hash_value *value = NULL;
-  HENTRY_PTR head;
+  aggregate_hash_table::index_type index;
   int rc;
 
   /* check nulls */
@@ -2646,11 +2699,10 @@ qdata_save_agg_htable_to_list (cubthread::entry *thread_p, mht_table *hash_table
       return ER_FAILED;
     }
 
-  head = hash_table->act_head;
-  while (head != NULL)
+  for (index = 0; index < hash_table->count (); index++)
     {
-      key = (aggregate_hash_key *) head->key;
-      value = (aggregate_hash_value *) head->data;
+      key = hash_table->get_key (index);
+      value = hash_table->get_value (index);
 
       /* dump first tuple to unsorted list */
       if (value->first_tuple.tpl != NULL)
@@ -2671,17 +2723,14 @@ qdata_save_agg_htable_to_list (cubthread::entry *thread_p, mht_table *hash_table
 	      return rc;
 	    }
 	}
-
-      /* next */
-      head = head->act_next;
     }
 
   /* clear hash table; memory will no longer be used */
-  rc = mht_clear (hash_table, qdata_free_agg_hentry, (void *) thread_p);
-  if (rc != NO_ERROR)
+  for (index = 0; index < hash_table->count (); index++)
     {
-      return rc;
+      (void) qdata_free_agg_hentry (hash_table->get_key (index), hash_table->get_value (index), (void *) thread_p);
     }
+  hash_table->clear ();
 
   /* all ok */
   return NO_ERROR;
@@ -32,12 +32,13 @@
 #include "storage_common.h"   // AGGREGATE_HASH_STATE, SCAN_CODE
 #include "db_function.hpp"  // FUNC_CODE
 #include "heap_file.h"
+#include "open_hash_table.hpp"
 
 #include <vector>
 
 // forward definitions
 struct db_value;
-struct mht_table;
+struct qmgr_memory_grant;
 struct tp_domain;
 struct val_descr;
 
@@ -66,18 +67,36 @@ namespace cubquery
     int val_count;		/* key size */
     bool free_values;		/* true if values need to be freed */
     db_value **values;		/* value array */
+    bool values_in_block;	/* values and value array are allocated with the structure */
   };
 
+  struct aggregate_hash_key_hash
+  {
+    unsigned int operator() (aggregate_hash_key *const &key) const;
+  };
+
+  struct aggregate_hash_key_equal
+  {
+    bool operator() (aggregate_hash_key *const &key1, aggregate_hash_key *const &key2) const;
+  };
+
+  using aggregate_hash_table =
+	  cubbase::open_hash_table<aggregate_hash_key *, aggregate_hash_value *, aggregate_hash_key_hash,
+	  aggregate_hash_key_equal>;
 
   struct aggregate_hash_context
   {
     /* hash table stuff */
-    mht_table *hash_table;	/* memory hash table for hash aggregate eval */
+    aggregate_hash_table *hash_table;	/* memory hash table for hash aggregate eval */
     aggregate_hash_key *temp_key;	/* temporary key used for fetch */
     AGGREGATE_HASH_STATE state;	/* state of hash aggregation */
     tp_domain **key_domains;	/* hash key domains */
     cubxasl::aggregate_accumulator_domain **accumulator_domains;	/* accumulator domains */
 
+    /* memory limit stuff */
+    qmgr_memory_grant *memory_grant;	/* memory granted by the query memory broker */
+    UINT64 mem_limit;		/* size of the hash table kept in memory */
+
     /* runtime statistics stuff */
     int hash_size;		/* hash table size */
     int group_count;		/* groups processed in hash table */
@@ -155,7 +174,8 @@ int qdata_load_agg_hentry_from_tuple (cubthread::entry *thread_p, QFILE_TUPLE tu
 SCAN_CODE qdata_load_agg_hentry_from_list (cubthread::entry *thread_p, qfile_list_scan_id *list_scan_id,
     cubquery::aggregate_hash_key *key, cubquery::aggregate_hash_value *value,
     tp_domain **key_dom, cubxasl::aggregate_accumulator_domain **acc_dom);
-int qdata_save_agg_htable_to_list (cubthread::entry *thread_p, mht_table *hash_table, qfile_list_id *tuple_list_id,
-				   qfile_list_id *partial_list_id, db_value *temp_dbval_array);
+int qdata_save_agg_htable_to_list (cubthread::entry *thread_p, cubquery::aggregate_hash_table *hash_table,
+				   qfile_list_id *tuple_list_id, qfile_list_id *partial_list_id,
+				   db_value *temp_dbval_array);
 
 #endif // _QUERY_AGGREGATE_HPP_
@@ -31,6 +31,7 @@
 #include "system_parameter.h"
 #include "dbtype.h"
 #if defined (SERVER_MODE)
+#include "subquery_memo.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
 #endif // SERVER_MODE
 #include "xasl.h"
@@ -2930,6 +2931,19 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
       json_object_set_new (proc, "time", json_integer (TO_MSEC (xasl_p->xasl_stats.elapsed_time)));
       json_object_set_new (proc, "fetch", json_integer (xasl_p->xasl_stats.fetches));
       json_object_set_new (proc, "ioread", json_integer (xasl_p->xasl_stats.ioreads));
+      if (xasl_p->sq_memo != NULL)
+	{
+	  UINT64 hits, misses;
+	  bool is_disabled;
+	  json_t *memo;
+
+	  sq_memo_get_stats (xasl_p->sq_memo, &hits, &misses, &is_disabled);
+	  memo = json_object ();
+	  json_object_set_new (memo, "hit", json_integer (hits));
+	  json_object_set_new (memo, "miss", json_integer (misses));
+	  json_object_set_new (memo, "disabled", json_boolean (is_disabled));
+	  json_object_set_new (proc, "memo", memo);
+	}
       break;
 
     case UNION_PROC:
@@ -3217,9 +3231,19 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
     case DELETE_PROC:
     case CONNECTBY_PROC:
     case BUILD_SCHEMA_PROC:
-      fprintf (fp, "%s (time: %d, fetch: %lld, ioread: %lld)\n", qdump_xasl_type_string (xasl_p),
+      fprintf (fp, "%s (time: %d, fetch: %lld, ioread: %lld", qdump_xasl_type_string (xasl_p),
 	       TO_MSEC (xasl_p->xasl_stats.elapsed_time), (long long int) xasl_p->xasl_stats.fetches,
 	       (long long int) xasl_p->xasl_stats.ioreads);
+      if (xasl_p->sq_memo != NULL)
+	{
+	  UINT64 hits, misses;
+	  bool is_disabled;
+
+	  sq_memo_get_stats (xasl_p->sq_memo, &hits, &misses, &is_disabled);
+	  fprintf (fp, ", memo hit: %lld, memo miss: %lld%s", (long long int) hits, (long long int) misses,
+		   is_disabled ? ", memo: disabled" : "");
+	}
+      fprintf (fp, ")\n");
       indent += 2;
       break;
 
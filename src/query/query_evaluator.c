@@ -43,6 +43,9 @@
 #include "thread_entry.hpp"
 #include "xasl_predicate.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #define UNKNOWN_CARD   -2	/* Unknown cardinality of a set member */
 
 static DB_LOGICAL eval_negative (DB_LOGICAL res);
@@ -1841,7 +1844,7 @@ eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID *
 	      if (et_comp->lhs->type == TYPE_LIST_ID)
 		{
 		  /* execute linked query */
-		  EXECUTE_REGU_VARIABLE_XASL (thread_p, et_comp->lhs, vd);
+		  EXECUTE_REGU_VARIABLE_XASL_FOR_USE (thread_p, et_comp->lhs, vd, SUBQUERY_RESULT_EXISTS);
 		  if (CHECK_REGU_VARIABLE_XASL_STATUS (et_comp->lhs) != XASL_SUCCESS)
 		    {
 		      result = V_ERROR;
@@ -1849,7 +1852,7 @@ eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID *
 		    }
 
 		  srlist_id = et_comp->lhs->value.srlist_id;
-		  result = ((srlist_id->list_id->tuple_cnt > 0) ? V_TRUE : V_FALSE);
+		  result = (qexec_subquery_has_rows (et_comp->lhs->xasl, srlist_id->list_id) ? V_TRUE : V_FALSE);
 		}
 	      else
 		{
@@ -2211,7 +2214,7 @@ eval_pred_comp2 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
   if (et_comp->lhs->type == TYPE_LIST_ID)
     {
       /* execute linked query */
-      EXECUTE_REGU_VARIABLE_XASL (thread_p, et_comp->lhs, vd);
+      EXECUTE_REGU_VARIABLE_XASL_FOR_USE (thread_p, et_comp->lhs, vd, SUBQUERY_RESULT_EXISTS);
       if (CHECK_REGU_VARIABLE_XASL_STATUS (et_comp->lhs) != XASL_SUCCESS)
 	{
 	  return V_ERROR;
@@ -2221,7 +2224,7 @@ eval_pred_comp2 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd,
 	  QFILE_SORTED_LIST_ID *srlist_id;
 
 	  srlist_id = et_comp->lhs->value.srlist_id;
-	  return (srlist_id->list_id->tuple_cnt > 0) ? V_TRUE : V_FALSE;
+	  return qexec_subquery_has_rows (et_comp->lhs->xasl, srlist_id->list_id) ? V_TRUE : V_FALSE;
 	}
     }
   else
@@ -2972,3 +2975,671 @@ eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, FILTER_INFO * filter
 
   return ev_res;
 }
+
+/*
+ * eval_batch_encode_int64 () - encode a fixed size integer or date/time value as a 64-bit integer
+ *   return: false if the value type has no 64-bit integer encoding
+ *   value(in): non-null value
+ *   encoded(out): encoded value
+ *
+ * Note: the encoding keeps the order of values of the same type; DATETIME is encoded as date << 32 | time.
+ */
+bool
+eval_batch_encode_int64 (const DB_VALUE * value, INT64 * encoded)
+{
+  const DB_DATETIME *datetime;
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      *encoded = db_get_short (value);
+      return true;
+    case DB_TYPE_INTEGER:
+      *encoded = db_get_int (value);
+      return true;
+    case DB_TYPE_BIGINT:
+      *encoded = db_get_bigint (value);
+      return true;
+    case DB_TYPE_DATE:
+      *encoded = *db_get_date (value);
+      return true;
+    case DB_TYPE_TIME:
+      *encoded = *db_get_time (value);
+      return true;
+    case DB_TYPE_TIMESTAMP:
+      *encoded = *db_get_timestamp (value);
+      return true;
+    case DB_TYPE_DATETIME:
+      datetime = db_get_datetime (value);
+      *encoded = (((INT64) datetime->date) << 32) | datetime->time;
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_batch_is_constant () - can the regu variable be fetched once for a whole scan?
+ *   return: true for literals and host variables
+ *   regu(in): regu variable
+ */
+static bool
+eval_batch_is_constant (const regu_variable_node * regu)
+{
+  return regu != NULL && (regu->type == TYPE_DBVAL || regu->type == TYPE_POS_VALUE);
+}
+
+/*
+ * eval_batch_make_term () - convert an evaluation term to a batch term
+ *   return: false if the term cannot be evaluated in batch
+ *   pr(in): predicate term
+ *   term(out): batch term
+ */
+static bool
+eval_batch_make_term (const PRED_EXPR * pr, EVAL_BATCH_TERM * term)
+{
+  const COMP_EVAL_TERM *et_comp;
+  const ALSM_EVAL_TERM *et_alsm;
+  regu_variable_node *attr, *constant;
+  bool is_swapped;
+
+  memset (term, 0, sizeof (*term));
+  term->is_active = true;
+
+  if (pr->type != T_EVAL_TERM)
+    {
+      return false;
+    }
+
+  if (pr->pe.m_eval_term.et_type == T_ALSM_EVAL_TERM)
+    {
+      /* attr IN (constants) */
+      et_alsm = &pr->pe.m_eval_term.et.et_alsm;
+      if (et_alsm->eq_flag != F_SOME || et_alsm->rel_op != R_EQ || et_alsm->elem == NULL
+	  || et_alsm->elem->type != TYPE_ATTR_ID || !eval_batch_is_constant (et_alsm->elemset))
+	{
+	  return false;
+	}
+
+      term->type = EVAL_BATCH_IN;
+      term->attrid = et_alsm->elem->value.attr_descr.id;
+      term->op = EVAL_BATCH_EQ;
+      term->operand = et_alsm->elemset;
+      return true;
+    }
+
+  if (pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.m_eval_term.et.et_comp;
+  if (et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return false;
+    }
+
+  if (et_comp->lhs->type == TYPE_ATTR_ID && eval_batch_is_constant (et_comp->rhs))
+    {
+      attr = et_comp->lhs;
+      constant = et_comp->rhs;
+      is_swapped = false;
+    }
+  else if (et_comp->rhs->type == TYPE_ATTR_ID && eval_batch_is_constant (et_comp->lhs))
+    {
+      attr = et_comp->rhs;
+      constant = et_comp->lhs;
+      is_swapped = true;
+    }
+  else
+    {
+      return false;
+    }
+
+  switch (et_comp->rel_op)
+    {
+    case R_EQ:
+      term->op = EVAL_BATCH_EQ;
+      break;
+    case R_NE:
+      term->op = EVAL_BATCH_NE;
+      break;
+    case R_LT:
+      term->op = is_swapped ? EVAL_BATCH_GT : EVAL_BATCH_LT;
+      break;
+    case R_LE:
+      term->op = is_swapped ? EVAL_BATCH_GE : EVAL_BATCH_LE;
+      break;
+    case R_GT:
+      term->op = is_swapped ? EVAL_BATCH_LT : EVAL_BATCH_GT;
+      break;
+    case R_GE:
+      term->op = is_swapped ? EVAL_BATCH_LE : EVAL_BATCH_GE;
+      break;
+    default:
+      return false;
+    }
+
+  term->type = EVAL_BATCH_COMPARE;
+  term->attrid = attr->value.attr_descr.id;
+  term->operand = constant;
+  return true;
+}
+
+// *INDENT-OFF*
+/*
+ * eval_batch_collect_terms () - collect the batch terms of a conjunction
+ *   return: void
+ *   pr(in): predicate
+ *   terms(in/out): batch terms
+ *   is_complete(in/out): set to false if a conjunct is not a batch term
+ */
+static void
+eval_batch_collect_terms (const PRED_EXPR * pr, std::vector<EVAL_BATCH_TERM> &terms, bool &is_complete)
+{
+  EVAL_BATCH_TERM term;
+
+  /* 'pt_to_pred_expr()' will generate right-linear tree */
+  while (pr->type == T_PRED && pr->pe.m_pred.bool_op == B_AND)
+    {
+      eval_batch_collect_terms (pr->pe.m_pred.lhs, terms, is_complete);
+      pr = pr->pe.m_pred.rhs;
+    }
+
+  if (eval_batch_make_term (pr, &term))
+    {
+      terms.push_back (term);
+    }
+  else
+    {
+      is_complete = false;
+    }
+}
+// *INDENT-ON*
+
+/*
+ * eval_batch_pred_init () - find the conjuncts of a scan predicate that can be evaluated in batch
+ *   return: number of batch terms
+ *   pr(in): scan predicate
+ *   batch_pred(out): batch predicate; must be cleared with eval_batch_pred_clear
+ *
+ * Note: BETWEEN is generated as two comparisons; the lower and upper bounds of the same attribute are joined into
+ *	 one range term.
+ */
+int
+eval_batch_pred_init (const PRED_EXPR * pr, EVAL_BATCH_PRED * batch_pred)
+{
+  // *INDENT-OFF*
+  std::vector<EVAL_BATCH_TERM> terms;
+  // *INDENT-ON*
+  bool is_complete = true;
+  size_t i, j;
+
+  batch_pred->terms = NULL;
+  batch_pred->num_terms = 0;
+  batch_pred->is_complete = false;
+
+  if (pr == NULL)
+    {
+      return 0;
+    }
+
+  eval_batch_collect_terms (pr, terms, is_complete);
+
+  /* join lower and upper bounds of the same attribute */
+  for (i = 0; i < terms.size (); i++)
+    {
+      if (terms[i].type != EVAL_BATCH_COMPARE || (terms[i].op != EVAL_BATCH_GT && terms[i].op != EVAL_BATCH_GE))
+	{
+	  continue;
+	}
+      for (j = 0; j < terms.size (); j++)
+	{
+	  if (terms[j].type == EVAL_BATCH_COMPARE && terms[j].attrid == terms[i].attrid
+	      && (terms[j].op == EVAL_BATCH_LT || terms[j].op == EVAL_BATCH_LE))
+	    {
+	      terms[i].type = EVAL_BATCH_RANGE;
+	      terms[i].upper = terms[j].operand;
+	      terms[i].upper_op = terms[j].op;
+	      terms.erase (terms.begin () + j);
+	      if (j < i)
+		{
+		  i--;
+		}
+	      break;
+	    }
+	}
+    }
+
+  if (terms.empty ())
+    {
+      return 0;
+    }
+
+  batch_pred->terms = (EVAL_BATCH_TERM *) malloc (terms.size () * sizeof (EVAL_BATCH_TERM));
+  if (batch_pred->terms == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, terms.size () * sizeof (EVAL_BATCH_TERM));
+      return 0;
+    }
+  memcpy (batch_pred->terms, terms.data (), terms.size () * sizeof (EVAL_BATCH_TERM));
+  batch_pred->num_terms = (int) terms.size ();
+  batch_pred->is_complete = is_complete;
+
+  return batch_pred->num_terms;
+}
+
+/*
+ * eval_batch_pred_clear () - free a batch predicate
+ *   return: void
+ *   batch_pred(in/out): batch predicate
+ */
+void
+eval_batch_pred_clear (EVAL_BATCH_PRED * batch_pred)
+{
+  int i;
+
+  for (i = 0; i < batch_pred->num_terms; i++)
+    {
+      if (batch_pred->terms[i].in_ints != NULL)
+	{
+	  free_and_init (batch_pred->terms[i].in_ints);
+	}
+      if (batch_pred->terms[i].in_doubles != NULL)
+	{
+	  free_and_init (batch_pred->terms[i].in_doubles);
+	}
+    }
+  if (batch_pred->terms != NULL)
+    {
+      free_and_init (batch_pred->terms);
+    }
+  batch_pred->num_terms = 0;
+  batch_pred->is_complete = false;
+}
+
+/*
+ * eval_batch_convert_constant () - convert a constant to the representation of a column
+ *   return: false if the comparison would need a coercion that is not exact in batch
+ *   value(in): non-null constant
+ *   column(in): compared column
+ *   int_value(out): value for integer columns
+ *   double_value(out): value for FLOAT and DOUBLE columns
+ */
+static bool
+eval_batch_convert_constant (const DB_VALUE * value, const EVAL_BATCH_COLUMN * column, INT64 * int_value,
+			     double *double_value)
+{
+  DB_TYPE type = DB_VALUE_TYPE (value);
+
+  switch (column->type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+      return (type == DB_TYPE_SHORT || type == DB_TYPE_INTEGER || type == DB_TYPE_BIGINT)
+	&& eval_batch_encode_int64 (value, int_value);
+
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      return type == column->type && eval_batch_encode_int64 (value, int_value);
+
+    case DB_TYPE_FLOAT:
+      /* float columns are compared as float; no other type converts exactly */
+      if (type != DB_TYPE_FLOAT)
+	{
+	  return false;
+	}
+      *double_value = db_get_float (value);
+      return true;
+
+    case DB_TYPE_DOUBLE:
+      switch (type)
+	{
+	case DB_TYPE_DOUBLE:
+	  *double_value = db_get_double (value);
+	  return true;
+	case DB_TYPE_FLOAT:
+	  *double_value = db_get_float (value);
+	  return true;
+	case DB_TYPE_SHORT:
+	  *double_value = db_get_short (value);
+	  return true;
+	case DB_TYPE_INTEGER:
+	  *double_value = db_get_int (value);
+	  return true;
+	default:
+	  return false;
+	}
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * eval_batch_prepare_term () - fetch and convert the constants of a term
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   term(in/out): batch term; deactivated if its constants cannot be compared in batch
+ *   vd(in): value descriptor for host variables
+ *   column(in): compared column
+ */
+static int
+eval_batch_prepare_term (THREAD_ENTRY * thread_p, EVAL_BATCH_TERM * term, val_descr * vd,
+			 const EVAL_BATCH_COLUMN * column)
+{
+  DB_VALUE *peek_val = NULL;
+  DB_VALUE element;
+  DB_SET *set;
+  int i, size;
+
+  term->is_prepared = true;
+
+  if (fetch_peek_dbval (thread_p, term->operand, vd, NULL, NULL, NULL, &peek_val) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return er_errid ();
+    }
+  if (db_value_is_null (peek_val))
+    {
+      term->is_always_false = true;
+      return NO_ERROR;
+    }
+
+  if (term->type == EVAL_BATCH_IN)
+    {
+      if (!TP_IS_SET_TYPE (DB_VALUE_TYPE (peek_val)))
+	{
+	  term->is_active = false;
+	  return NO_ERROR;
+	}
+
+      set = db_get_set (peek_val);
+      size = db_set_size (set);
+      term->in_ints = (INT64 *) malloc (MAX (size, 1) * sizeof (INT64));
+      term->in_doubles = (double *) malloc (MAX (size, 1) * sizeof (double));
+      if (term->in_ints == NULL || term->in_doubles == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, MAX (size, 1) * sizeof (INT64));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+
+      term->in_count = 0;
+      for (i = 0; i < size; i++)
+	{
+	  if (db_set_get (set, i, &element) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return er_errid ();
+	    }
+	  if (DB_IS_NULL (&element))
+	    {
+	      /* never equal */
+	      continue;
+	    }
+	  if (!eval_batch_convert_constant (&element, column, &term->in_ints[term->in_count],
+					    &term->in_doubles[term->in_count]))
+	    {
+	      pr_clear_value (&element);
+	      term->is_active = false;
+	      return NO_ERROR;
+	    }
+	  pr_clear_value (&element);
+	  term->in_count++;
+	}
+
+      std::sort (term->in_ints, term->in_ints + term->in_count);
+      std::sort (term->in_doubles, term->in_doubles + term->in_count);
+      return NO_ERROR;
+    }
+
+  if (!eval_batch_convert_constant (peek_val, column, &term->ints[0], &term->doubles[0]))
+    {
+      term->is_active = false;
+      return NO_ERROR;
+    }
+
+  if (term->type == EVAL_BATCH_RANGE)
+    {
+      if (fetch_peek_dbval (thread_p, term->upper, vd, NULL, NULL, NULL, &peek_val) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+      if (db_value_is_null (peek_val))
+	{
+	  term->is_always_false = true;
+	  return NO_ERROR;
+	}
+      if (!eval_batch_convert_constant (peek_val, column, &term->ints[1], &term->doubles[1]))
+	{
+	  term->is_active = false;
+	  return NO_ERROR;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+// *INDENT-OFF*
+/*
+ * eval_batch_select_kernel () - clear the selection bits of values that do not satisfy a condition
+ *
+ * Note: the inner loop has no branches so that it can be vectorized by the compiler.
+ */
+template <typename T, typename Cond>
+static void
+eval_batch_select_kernel (const T * values, int count, Cond cond, UINT64 * selection)
+{
+  int word, i, n;
+
+  for (word = 0; word * 64 < count; word++)
+    {
+      const T *v = values + word * 64;
+      UINT64 bits = 0;
+
+      n = MIN (64, count - word * 64);
+      for (i = 0; i < n; i++)
+	{
+	  bits |= ((UINT64) cond (v[i])) << i;
+	}
+      selection[word] &= bits;
+    }
+}
+
+template <typename T>
+static void
+eval_batch_select_compare (const T * values, int count, EVAL_BATCH_OP op, T operand, UINT64 * selection)
+{
+  switch (op)
+    {
+    case EVAL_BATCH_EQ:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v == operand; }, selection);
+      break;
+    case EVAL_BATCH_NE:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v != operand; }, selection);
+      break;
+    case EVAL_BATCH_LT:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v < operand; }, selection);
+      break;
+    case EVAL_BATCH_LE:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v <= operand; }, selection);
+      break;
+    case EVAL_BATCH_GT:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v > operand; }, selection);
+      break;
+    case EVAL_BATCH_GE:
+      eval_batch_select_kernel (values, count, [operand] (T v) { return v >= operand; }, selection);
+      break;
+    }
+}
+
+template <typename T>
+static void
+eval_batch_select_range (const T * values, int count, EVAL_BATCH_OP lower_op, T lower, EVAL_BATCH_OP upper_op,
+			 T upper, UINT64 * selection)
+{
+  if (lower_op == EVAL_BATCH_GE && upper_op == EVAL_BATCH_LE)
+    {
+      eval_batch_select_kernel (values, count, [lower, upper] (T v) { return (v >= lower) & (v <= upper); },
+				selection);
+    }
+  else if (lower_op == EVAL_BATCH_GE)
+    {
+      eval_batch_select_kernel (values, count, [lower, upper] (T v) { return (v >= lower) & (v < upper); },
+				selection);
+    }
+  else if (upper_op == EVAL_BATCH_LE)
+    {
+      eval_batch_select_kernel (values, count, [lower, upper] (T v) { return (v > lower) & (v <= upper); },
+				selection);
+    }
+  else
+    {
+      eval_batch_select_kernel (values, count, [lower, upper] (T v) { return (v > lower) & (v < upper); },
+				selection);
+    }
+}
+
+template <typename T>
+static void
+eval_batch_select_in (const T * values, int count, const T * in_values, int in_count, UINT64 * selection)
+{
+  if (in_count <= 8)
+    {
+      /* short lists are cheaper to compare one by one */
+      eval_batch_select_kernel (values, count, [in_values, in_count] (T v)
+        {
+          bool found = false;
+          for (int k = 0; k < in_count; k++)
+            {
+              found |= (v == in_values[k]);
+            }
+          return found;
+        }, selection);
+    }
+  else
+    {
+      eval_batch_select_kernel (values, count, [in_values, in_count] (T v)
+        {
+          return std::binary_search (in_values, in_values + in_count, v);
+        }, selection);
+    }
+}
+// *INDENT-ON*
+
+/*
+ * eval_batch_pred_select () - evaluate the batch terms of a predicate on a batch of rows
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   batch_pred(in/out): batch predicate; terms that cannot be evaluated in batch are deactivated
+ *   vd(in): value descriptor for host variables
+ *   columns(in): column of each term, values starting at row 0
+ *   start(in): first row of the batch; a multiple of 64
+ *   count(in): number of rows of the batch; up to EVAL_BATCH_SIZE
+ *   selection(out): bit i is set if row start + i may satisfy the predicate
+ *
+ * Note: a row is selected only if every active term is true for it; false and unknown (null) results both clear the
+ *	 row. Rows that are selected must still be evaluated with the full predicate unless batch_pred->is_complete.
+ */
+int
+eval_batch_pred_select (THREAD_ENTRY * thread_p, EVAL_BATCH_PRED * batch_pred, val_descr * vd,
+			const EVAL_BATCH_COLUMN * columns, int start, int count, UINT64 * selection)
+{
+  EVAL_BATCH_TERM *term;
+  const EVAL_BATCH_COLUMN *column;
+  int i, word, num_words;
+  int error_code;
+
+  assert (start % 64 == 0);
+  assert (count > 0 && count <= EVAL_BATCH_SIZE);
+
+  num_words = (count + 63) / 64;
+  for (word = 0; word < num_words; word++)
+    {
+      selection[word] = ~((UINT64) 0);
+    }
+  if (count % 64 != 0)
+    {
+      selection[num_words - 1] = (((UINT64) 1) << (count % 64)) - 1;
+    }
+
+  for (i = 0; i < batch_pred->num_terms; i++)
+    {
+      term = &batch_pred->terms[i];
+      column = &columns[i];
+
+      if (term->is_active && column->ints == NULL && column->doubles == NULL)
+	{
+	  /* the attribute is not stored as fixed size values */
+	  term->is_active = false;
+	}
+      if (term->is_active && !term->is_prepared)
+	{
+	  error_code = eval_batch_prepare_term (thread_p, term, vd, column);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+      if (!term->is_active)
+	{
+	  batch_pred->is_complete = false;
+	  continue;
+	}
+
+      if (term->is_always_false)
+	{
+	  memset (selection, 0, num_words * sizeof (UINT64));
+	  return NO_ERROR;
+	}
+
+      if (column->ints != NULL)
+	{
+	  const INT64 *values = column->ints + start;
+
+	  switch (term->type)
+	    {
+	    case EVAL_BATCH_COMPARE:
+	      eval_batch_select_compare (values, count, term->op, term->ints[0], selection);
+	      break;
+	    case EVAL_BATCH_RANGE:
+	      eval_batch_select_range (values, count, term->op, term->ints[0], term->upper_op, term->ints[1],
+				       selection);
+	      break;
+	    case EVAL_BATCH_IN:
+	      eval_batch_select_in (values, count, (const INT64 *) term->in_ints, term->in_count, selection);
+	      break;
+	    }
+	}
+      else
+	{
+	  const double *values = column->doubles + start;
+
+	  switch (term->type)
+	    {
+	    case EVAL_BATCH_COMPARE:
+	      eval_batch_select_compare (values, count, term->op, term->doubles[0], selection);
+	      break;
+	    case EVAL_BATCH_RANGE:
+	      eval_batch_select_range (values, count, term->op, term->doubles[0], term->upper_op, term->doubles[1],
+				       selection);
+	      break;
+	    case EVAL_BATCH_IN:
+	      eval_batch_select_in (values, count, (const double *) term->in_doubles, term->in_count, selection);
+	      break;
+	    }
+	}
+
+      /* comparisons with null are unknown */
+      for (word = 0; word < num_words; word++)
+	{
+	  selection[word] &= ~column->nulls[start / 64 + word];
+	}
+    }
+
+  return NO_ERROR;
+}
@@ -132,6 +132,78 @@ struct filter_info
   // *INDENT-ON*
 };
 
+/*
+ * batch evaluation of simple scan predicates over column vectors
+ *
+ * Only columnar cache scans (classes listed in columnar_cache_classes, see columnar_cache.hpp) have column vectors.
+ * Heap and list file scans decode one record at a time and still evaluate their predicates row by row.
+ */
+
+#define EVAL_BATCH_SIZE 1024	/* rows evaluated together; a multiple of 64 */
+#define EVAL_BATCH_WORDS (EVAL_BATCH_SIZE / 64)	/* words of a selection bitmap */
+
+typedef enum
+{
+  EVAL_BATCH_COMPARE,		/* attribute compared to a constant */
+  EVAL_BATCH_RANGE,		/* attribute between two constants */
+  EVAL_BATCH_IN			/* attribute equal to one of a set of constants */
+} EVAL_BATCH_TERM_TYPE;
+
+typedef enum
+{
+  EVAL_BATCH_EQ,
+  EVAL_BATCH_NE,
+  EVAL_BATCH_LT,
+  EVAL_BATCH_LE,
+  EVAL_BATCH_GT,
+  EVAL_BATCH_GE
+} EVAL_BATCH_OP;
+
+/* column values of a batch; fixed size values only */
+typedef struct eval_batch_column EVAL_BATCH_COLUMN;
+struct eval_batch_column
+{
+  DB_TYPE type;			/* attribute type */
+  const INT64 *ints;		/* values encoded by eval_batch_encode_int64 or NULL */
+  const double *doubles;	/* FLOAT and DOUBLE values or NULL */
+  const UINT64 *nulls;		/* null bitmap, one bit per value */
+};
+
+typedef struct eval_batch_term EVAL_BATCH_TERM;
+struct eval_batch_term
+{
+  EVAL_BATCH_TERM_TYPE type;
+  ATTR_ID attrid;		/* compared attribute */
+  EVAL_BATCH_OP op;		/* operator against operand (lower bound for range) */
+  EVAL_BATCH_OP upper_op;	/* operator against upper bound of range */
+  regu_variable_node *operand;	/* constant, lower bound or set of constants */
+  regu_variable_node *upper;	/* upper bound of range */
+  bool is_active;		/* false if the constants cannot be compared in batch */
+
+  /* constants converted to the column representation on first use */
+  bool is_prepared;
+  bool is_always_false;		/* a compared constant is null */
+  INT64 ints[2];
+  double doubles[2];
+  INT64 *in_ints;		/* sorted IN constants */
+  double *in_doubles;
+  int in_count;
+};
+
+typedef struct eval_batch_pred EVAL_BATCH_PRED;
+struct eval_batch_pred
+{
+  EVAL_BATCH_TERM *terms;
+  int num_terms;
+  bool is_complete;		/* the predicate is exactly the conjunction of all active terms */
+};
+
+extern bool eval_batch_encode_int64 (const DB_VALUE * value, INT64 * encoded);
+extern int eval_batch_pred_init (const PRED_EXPR * pr, EVAL_BATCH_PRED * batch_pred);
+extern void eval_batch_pred_clear (EVAL_BATCH_PRED * batch_pred);
+extern int eval_batch_pred_select (THREAD_ENTRY * thread_p, EVAL_BATCH_PRED * batch_pred, val_descr * vd,
+				   const EVAL_BATCH_COLUMN * columns, int start, int count, UINT64 * selection);
+
 extern DB_LOGICAL eval_pred (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
 extern DB_LOGICAL eval_pred_comp0 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
 extern DB_LOGICAL eval_pred_comp1 (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, val_descr * vd, OID * obj_oid);
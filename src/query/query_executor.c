@@ -65,6 +65,7 @@
 #include "db_date.h"
 #include "btree_load.h"
 #include "query_dump.h"
+#include "subquery_memo.hpp"
 #if defined (SERVER_MODE)
 #include "jansson.h"
 #endif /* defined (SERVER_MODE) */
@@ -81,6 +82,7 @@
 #include "xasl_analytic.hpp"
 #include "xasl_predicate.hpp"
 
+#include <new>
 #include <vector>
 
 // XASL_STATE
@@ -90,6 +92,7 @@ struct xasl_state
   VAL_DESCR vd;			/* Value Descriptor */
   QUERY_ID query_id;		/* Query associated with XASL */
   int qp_xasl_line;		/* Error line */
+  bool use_subquery_memo;	/* memoize correlated subqueries; the query does not modify data */
 };
 
 #define GOTO_EXIT_ON_ERROR \
@@ -127,6 +130,9 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* minimum memory granted for hash aggregate evaluation; with less, group by is sort based only */
+#define HASH_AGGREGATE_MIN_MEMORY_SIZE                  (32 * 1024)
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -682,7 +688,7 @@ static int qexec_clear_regu_variable_list (THREAD_ENTRY * thread_p, XASL_NODE *
 static void qexec_clear_pred_xasl (THREAD_ENTRY * thread_p, PRED_EXPR * pred);
 
 #if defined(SERVER_MODE)
-static void qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static void qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_ID query_id);
 #endif /* SERVER_MODE */
 
 static int qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc, XASL_STATE * xasl_state);
@@ -2330,6 +2336,12 @@ qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final)
 	  db_private_free_and_init (thread_p, xasl->topn_items);
 	}
 
+      if (xasl->sq_memo != NULL)
+	{
+	  sq_memo_destroy (xasl->sq_memo);
+	  xasl->sq_memo = NULL;
+	}
+
       // clear trace stats
       memset (&xasl->orderby_stats, 0, sizeof (ORDERBY_STATS));
       memset (&xasl->groupby_stats, 0, sizeof (GROUPBY_STATS));
@@ -3747,8 +3759,7 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   AGGREGATE_HASH_CONTEXT *context = proc->agg_hash_context;
   AGGREGATE_HASH_KEY *key = context->temp_key;
   AGGREGATE_HASH_VALUE *value;
-  HENTRY_PTR hentry;
-  static UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  cubquery::aggregate_hash_table::index_type index;
   int rc = NO_ERROR;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
@@ -3772,8 +3783,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
     }
 
   /* probe hash table */
-  value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
-  if (value == NULL)
+  index = context->hash_table->find (key);
+  if (index == cubquery::aggregate_hash_table::NULL_INDEX)
     {
       AGGREGATE_HASH_KEY *new_key;
       AGGREGATE_HASH_VALUE *new_value;
@@ -3824,7 +3835,13 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	}
 
       /* add to hash table */
-      mht_put (context->hash_table, (void *) new_key, (void *) new_value);
+      rc = context->hash_table->insert (new_key, new_value);
+      if (rc != NO_ERROR)
+	{
+	  qdata_free_agg_hkey (thread_p, new_key);
+	  qdata_free_agg_hvalue (thread_p, new_value);
+	  return rc;
+	}
 
       /* count new group and tuple; we're not aggregating the tuple just yet but the count is used for statistic
        * computations */
@@ -3837,6 +3854,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
     }
   else
     {
+      value = context->hash_table->get_value (index);
+
       /* no need to output tuple */
       *output_tuple = false;
 
@@ -3864,17 +3883,17 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
     }
 
   /* keep hash table within memory limit */
-  while (context->hash_size > (int) mem_limit)
+  while ((UINT64) context->hash_size > context->mem_limit)
     {
       /* get least recently used entry */
-      hentry = context->hash_table->lru_head;
-      if (hentry == NULL)
+      index = context->hash_table->lru_first ();
+      if (index == cubquery::aggregate_hash_table::NULL_INDEX)
 	{
 	  /* should not get here */
 	  return ER_FAILED;
 	}
-      key = (AGGREGATE_HASH_KEY *) hentry->key;
-      value = (AGGREGATE_HASH_VALUE *) hentry->data;
+      key = context->hash_table->get_key (index);
+      value = context->hash_table->get_value (index);
 
       /* add key/accumulators to partial list */
       rc = qdata_save_agg_hentry_to_list (thread_p, key, value, context->temp_dbval_array, context->part_list_id);
@@ -3901,7 +3920,8 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
       /* remove entry */
       context->hash_size -= qdata_get_agg_hkey_size (key);
       context->hash_size -= qdata_get_agg_hvalue_size (value, false);
-      mht_rem (context->hash_table, key, qdata_free_agg_hentry, NULL);
+      context->hash_table->erase (index);
+      qdata_free_agg_hentry (key, value, NULL);
     }
 
   /* check very high selectivity case */
@@ -3916,6 +3936,7 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	  /* dump hash table to list file, no need to keep it in memory */
 	  qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
 					 context->temp_dbval_array);
+	  qmgr_release_memory_grant (context->memory_grant);
 
 #if !defined(NDEBUG)
 	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
@@ -4531,14 +4552,15 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       else if (gbstate.agg_hash_context->part_list_id->tuple_cnt == 0
 	       && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
 	{
-	  HENTRY_PTR head = gbstate.agg_hash_context->hash_table->act_head;
+	  cubquery::aggregate_hash_table *hash_table = gbstate.agg_hash_context->hash_table;
+	  cubquery::aggregate_hash_table::index_type index;
 	  AGGREGATE_HASH_VALUE *value = NULL;
 
 	  /* empty unsorted list and empty partial list; we can generate the output from the hash table */
-	  while (head)
+	  for (index = 0; index < hash_table->count (); index++)
 	    {
 	      /* load entry into aggregate list */
-	      value = (AGGREGATE_HASH_VALUE *) head->data;
+	      value = hash_table->get_value (index);
 	      if (value == NULL)
 		{
 		  /* should not happen */
@@ -4561,8 +4583,6 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
 	      /* finalize */
 	      qexec_gby_finalize_group_dim (thread_p, &gbstate, NULL);
 
-	      /* next entry */
-	      head = head->act_next;
 	      gbstate.input_recs += value->tuple_count + 1;
 	    }
 
@@ -4584,7 +4604,7 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
 
   /* unsorted list is not empty; dump hash table to partial list */
   if (gbstate.hash_eligible && gbstate.agg_hash_context->tuple_count > 0
-      && mht_count (gbstate.agg_hash_context->hash_table) > 0)
+      && gbstate.agg_hash_context->hash_table->count () > 0)
     {
       /* reopen unsorted list to accept new tuples */
       if (qfile_reopen_list_as_append_mode (thread_p, list_id) != NO_ERROR)
@@ -13630,6 +13650,68 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
   return error;
 }
 
+/*
+ * qexec_execute_subquery () - execute a subquery linked to a regu variable
+ *   return: NO_ERROR, or ER_code
+ *   xasl(in)   : subquery
+ *   xstate(in) : XASL state information
+ *   result_use(in) : how the result of the subquery is read
+ *
+ * Note: the results of correlated scalar and EXISTS subqueries are memoized by their correlated values, for the
+ *	 length of one execution of a query that does not modify data (see subquery_memo.hpp).
+ */
+int
+qexec_execute_subquery (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate,
+			SUBQUERY_RESULT_USE result_use)
+{
+  SQ_MEMO_LOOKUP_RESULT lookup = SQ_MEMO_BYPASS;
+  int error;
+
+  if (result_use != SUBQUERY_RESULT_LIST && xstate->use_subquery_memo)
+    {
+      if (xasl->sq_memo == NULL)
+	{
+	  xasl->sq_memo = sq_memo_create (thread_p, xasl, result_use);
+	}
+      if (xasl->sq_memo != NULL)
+	{
+	  lookup = sq_memo_lookup (thread_p, xasl->sq_memo, xasl, result_use);
+	  if (lookup == SQ_MEMO_HIT)
+	    {
+	      xasl->status = XASL_SUCCESS;
+	      return NO_ERROR;
+	    }
+	}
+    }
+
+  error = qexec_execute_mainblock (thread_p, xasl, xstate, NULL);
+  if (error == NO_ERROR && lookup == SQ_MEMO_MISS)
+    {
+      sq_memo_store (thread_p, xasl->sq_memo, xasl);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_subquery_has_rows () - does an EXISTS subquery executed by qexec_execute_subquery have a row?
+ *   return: true if the subquery result is not empty
+ *   xasl(in)   : subquery
+ *   list_id(in): list file of the subquery
+ */
+bool
+qexec_subquery_has_rows (xasl_node * xasl, qfile_list_id * list_id)
+{
+  bool has_rows;
+
+  if (xasl != NULL && xasl->sq_memo != NULL && sq_memo_get_restored_exists (xasl->sq_memo, &has_rows))
+    {
+      return has_rows;
+    }
+
+  return list_id->tuple_cnt > 0;
+}
+
 /*
  * qexec_check_limit_clause () - checks validity of limit clause
  *   return: NO_ERROR, or ER_code
@@ -14929,6 +15011,22 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
   /* initialize error line */
   xasl_state.qp_xasl_line = 0;
 
+  /* results of correlated subqueries may be reused only while the statement does not change what they read */
+  switch (xasl->type)
+    {
+    case BUILDLIST_PROC:
+    case BUILDVALUE_PROC:
+    case UNION_PROC:
+    case DIFFERENCE_PROC:
+    case INTERSECTION_PROC:
+    case MERGELIST_PROC:
+      xasl_state.use_subquery_memo = prm_get_bigint_value (PRM_ID_MAX_SUBQUERY_MEMO_SIZE) > 0;
+      break;
+    default:
+      xasl_state.use_subquery_memo = false;
+      break;
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   if (logtb_find_current_isolation (thread_p) >= TRAN_REP_READ)
     {
@@ -14951,7 +15049,7 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
 #if defined(SERVER_MODE)
       if (thread_is_on_trace (thread_p))
 	{
-	  qexec_set_xasl_trace_to_session (thread_p, xasl);
+	  qexec_set_xasl_trace_to_session (thread_p, xasl, xasl_state.query_id);
 	}
 #endif
 
@@ -19927,6 +20025,7 @@ qexec_initialize_analytic_state (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analy
 	  if (i >= interpolation_func_sort_prefix_len && TP_IS_STRING_TYPE (TP_DOMAIN_TYPE (subkey->col_dom)))
 	    {
 	      subkey->use_cmp_dom = true;
+	      subkey->use_sort_key = false;
 	    }
 	}
     }
@@ -24862,14 +24961,19 @@ qexec_clear_regu_variable_list (THREAD_ENTRY * thread_p, XASL_NODE * xasl_p, REG
  * qexec_set_xasl_trace_to_session() - save query trace to session
  *   return:
  *   xasl(in): sort direction ascending or descending
+ *   query_id(in): query identifier; its memory grants are traced
  */
 static void
-qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl, QUERY_ID query_id)
 {
   size_t sizeloc;
   char *trace_str = NULL;
   FILE *fp;
-  json_t *trace;
+  json_t *trace, *grant;
+  UINT64 grant_size, grant_peak_size;
+  int grant_reduced_count;
+
+  qmgr_get_query_memory_grant_stats (thread_p, query_id, &grant_size, &grant_peak_size, &grant_reduced_count);
 
   if (thread_p->trace_format == QUERY_TRACE_TEXT)
     {
@@ -24877,6 +24981,8 @@ qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
       if (fp)
 	{
 	  qdump_print_stats_text (fp, xasl, 0);
+	  fprintf (fp, "  MEMORY GRANT (current: %lld, peak: %lld, reduced: %d)\n", (long long int) grant_size,
+		   (long long int) grant_peak_size, grant_reduced_count);
 	  port_close_memstream (fp, &trace_str, &sizeloc);
 	}
     }
@@ -24884,6 +24990,12 @@ qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
     {
       trace = json_object ();
       qdump_print_stats_json (xasl, trace);
+
+      grant = json_object ();
+      json_object_set_new (grant, "current", json_integer (grant_size));
+      json_object_set_new (grant, "peak", json_integer (grant_peak_size));
+      json_object_set_new (grant, "reduced", json_integer (grant_reduced_count));
+      json_object_set_new (trace, "MEMORY GRANT", grant);
       trace_str = json_dumps (trace, JSON_INDENT (2) | JSON_PRESERVE_ORDER);
 
       json_object_clear (trace);
@@ -24964,6 +25076,7 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   REGU_VARIABLE_LIST regu_list;
   AGGREGATE_TYPE *agg_list;
   int value_count = 0, i = 0, error_code = NO_ERROR;
+  UINT64 mem_limit;
 
   if (!proc->g_hash_eligible)
     {
@@ -24985,6 +25098,8 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->curr_part_value = NULL;
   proc->agg_hash_context->sort_key.key = NULL;
   proc->agg_hash_context->sort_key.nkeys = 0;
+  proc->agg_hash_context->memory_grant = NULL;
+  proc->agg_hash_context->mem_limit = 0;
 
   /*
    * create temporary dbvalue array
@@ -25138,16 +25253,15 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   /*
    * create hash table
    */
-  proc->agg_hash_context->hash_table =
-    mht_create ("Hash aggregate evaluation", HASH_AGGREGATE_DEFAULT_TABLE_SIZE, qdata_hash_agg_hkey, qdata_agg_hkey_eq);
+  proc->agg_hash_context->hash_table = new (std::nothrow) cubquery::aggregate_hash_table ();
   if (proc->agg_hash_context->hash_table == NULL)
     {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (cubquery::aggregate_hash_table));
       goto exit_on_error;
     }
-  else
+  if (proc->agg_hash_context->hash_table->init (HASH_AGGREGATE_DEFAULT_TABLE_SIZE) != NO_ERROR)
     {
-      /* we need the least recently used list */
-      proc->agg_hash_context->hash_table->build_lru_list = true;
+      goto exit_on_error;
     }
 
   /*
@@ -25197,6 +25311,26 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->sorted_count = 0;
   proc->agg_hash_context->state = HS_ACCEPT_ALL;
 
+  /*
+   * ask the query memory broker for the hash table memory
+   */
+  proc->agg_hash_context->memory_grant =
+    (QMGR_MEMORY_GRANT *) db_private_alloc (thread_p, sizeof (QMGR_MEMORY_GRANT));
+  if (proc->agg_hash_context->memory_grant == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QMGR_MEMORY_GRANT));
+      goto exit_on_error;
+    }
+  mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  proc->agg_hash_context->mem_limit =
+    qmgr_request_memory_grant (thread_p, xasl_state->query_id, MIN (mem_limit, HASH_AGGREGATE_MIN_MEMORY_SIZE),
+			       mem_limit, false, proc->agg_hash_context->memory_grant);
+  if (proc->agg_hash_context->mem_limit == 0)
+    {
+      /* denied; aggregate by sorting */
+      proc->agg_hash_context->state = HS_REJECT_ALL;
+    }
+
   /* all ok */
   return NO_ERROR;
 
@@ -25255,8 +25389,13 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
   /* free entries and hash table */
   if (proc->agg_hash_context->hash_table != NULL)
     {
-      (void) mht_clear (proc->agg_hash_context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
-      mht_destroy (proc->agg_hash_context->hash_table);
+      cubquery::aggregate_hash_table *hash_table = proc->agg_hash_context->hash_table;
+
+      for (cubquery::aggregate_hash_table::index_type i = 0; i < hash_table->count (); i++)
+	{
+	  (void) qdata_free_agg_hentry (hash_table->get_key (i), hash_table->get_value (i), (void *) thread_p);
+	}
+      delete hash_table;
 
       proc->agg_hash_context->hash_table = NULL;
     }
@@ -25320,6 +25459,14 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context->tuple_recdes.area_size = 0;
     }
 
+  /* give back the memory of the hash table */
+  if (proc->agg_hash_context->memory_grant != NULL)
+    {
+      qmgr_release_memory_grant (proc->agg_hash_context->memory_grant);
+      db_private_free_and_init (thread_p, proc->agg_hash_context->memory_grant);
+    }
+  proc->agg_hash_context->mem_limit = 0;
+
   /* reinit counters */
   proc->agg_hash_context->hash_size = 0;
   proc->agg_hash_context->group_count = 0;
@@ -54,6 +54,14 @@ using XASL_STATE = xasl_state;
 
 #define QEXEC_NULL_COMMAND_ID   -1	/* Invalid command identifier */
 
+/* how the result of a subquery linked to a regu variable is read */
+typedef enum
+{
+  SUBQUERY_RESULT_LIST,		/* the result list file is read */
+  SUBQUERY_RESULT_VALUE,	/* only the single tuple values are read */
+  SUBQUERY_RESULT_EXISTS	/* only the existence of a result row is read */
+} SUBQUERY_RESULT_USE;
+
 typedef struct upddel_class_instances_lock_info UPDDEL_CLASS_INSTANCE_LOCK_INFO;
 struct upddel_class_instances_lock_info
 {
@@ -77,6 +85,9 @@ extern qfile_list_id *qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node *
 					   const DB_VALUE * dbval_ptr, QUERY_ID query_id);
 extern int qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate,
 				    UPDDEL_CLASS_INSTANCE_LOCK_INFO * p_class_instance_lock_info);
+extern int qexec_execute_subquery (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate,
+				   SUBQUERY_RESULT_USE result_use);
+extern bool qexec_subquery_has_rows (xasl_node * xasl, qfile_list_id * list_id);
 extern int qexec_start_mainblock_iterations (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state * xstate);
 extern int qexec_clear_xasl (THREAD_ENTRY * thread_p, xasl_node * xasl, bool is_final);
 extern int qexec_clear_pred_context (THREAD_ENTRY * thread_p, pred_expr_with_context * pred_filter,
@@ -29,6 +29,9 @@
 
 #include "regu_var.hpp"
 
+// forward definitions
+struct qmgr_memory_grant;
+
 #define MAKE_TUPLE_POSTION(tuple_pos, simple_pos, scan_id_p) \
   do \
     { \
@@ -125,6 +128,7 @@ struct hash_list_scan
   HASH_METHOD hash_list_scan_type;	/* IN_MEM, HYBRID or HASH_FILE */
   unsigned int curr_hash_key;	/* current hash key */
   bool need_coerce_type;	/* Are the types of probe and build different? */
+  qmgr_memory_grant *memory_grant;	/* memory granted for the memory hash table */
 };
 
 HASH_SCAN_KEY *qdata_alloc_hscan_key (THREAD_ENTRY * thread_p, int val_cnt, bool alloc_vals);
@@ -47,6 +47,10 @@
 #include "thread_entry.hpp"
 #include "xasl_cache.h"
 #include "xasl_unpack_info.hpp"
+#include "monitor_statement_statistics.hpp"
+#if defined (SERVER_MODE)
+#include "resource_group.hpp"
+#endif /* SERVER_MODE */
 
 #if !defined (SERVER_MODE)
 
@@ -63,8 +67,6 @@ extern int method_Num_method_jsp_calls;
 
 #define QMGR_NUM_TEMP_FILE_LISTS        (TEMP_FILE_MEMBUF_NUM_TYPES)
 
-#define QMGR_SQL_ID_LENGTH      13
-
 /* We have two valid types of membuf used by temporary file. */
 #define QMGR_IS_VALID_MEMBUF_TYPE(m)    ((m) == TEMP_FILE_MEMBUF_NORMAL || (m) == TEMP_FILE_MEMBUF_KEY_BUFFER)
 
@@ -160,6 +162,7 @@ static OID_BLOCK_LIST *qmgr_allocate_oid_block (THREAD_ENTRY * thread_p);
 static void qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block);
 static int qmgr_init_external_file_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 static PAGE_PTR qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid, QMGR_TEMP_FILE * vfid);
+static void qmgr_release_temp_file_charge (QMGR_TEMP_FILE * tfile_vfid_p);
 static int qmgr_free_query_temp_file_helper (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * query_p);
 static int qmgr_free_query_temp_file (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * qptr, int tran_idx);
 static QMGR_TEMP_FILE *qmgr_allocate_tempfile_with_buffer (int num_buffer_pages);
@@ -343,6 +346,9 @@ qmgr_allocate_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry
   query_p->query_flag = 0;
   query_p->is_holdable = false;
   query_p->includes_tde_class = false;
+  query_p->mem_grant_size = 0;
+  query_p->mem_grant_peak_size = 0;
+  query_p->mem_grant_reduced_count = 0;
 
 #if defined (NDEBUG)
   /* just a safe guard for a release build. I don't expect it will be hit. */
@@ -1141,6 +1147,11 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
   XASL_NODE *xasl_p;
   XASL_UNPACK_INFO *xasl_buf_info;
   QFILE_LIST_ID *list_id;
+#if defined (SERVER_MODE)
+  RESGRP_QUERY_SLOT resgrp_slot;
+#endif
+  STMTSTAT_SNAPSHOT stmtstat_snapshot;
+  UINT64 saved_sql_id;
 
   assert (query_p != NULL);
   assert (tran_entry_p != NULL);
@@ -1186,8 +1197,30 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
       XASL_SET_FLAG (xasl_p, XASL_RETURN_GENERATED_KEYS);
     }
 
+#if defined (SERVER_MODE)
+  /* wait while the resource group of the client executes its max_queries queries */
+  if (resgrp_start_query (thread_p, &resgrp_slot) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+#endif
+
+  /* publish the SQL_ID for the active session history while the query runs; keep the one of an outer execution */
+  saved_sql_id = thread_p->sql_id.load (std::memory_order_relaxed);
+  if (query_p->xasl_ent != NULL)
+    {
+      thread_p->sql_id.store (query_p->xasl_ent->sql_id, std::memory_order_relaxed);
+    }
+
   /* execute the query with the value list, if any */
+  stmtstat_start_query (thread_p, query_p->xasl_ent, &stmtstat_snapshot);
   query_p->list_id = qexec_execute_query (thread_p, xasl_p, dbval_count, dbvals_p, query_p->query_id);
+  stmtstat_end_query (thread_p, query_p->xasl_ent, &stmtstat_snapshot,
+		      (query_p->list_id != NULL) ? query_p->list_id->tuple_cnt : 0, query_p->errid < 0);
+  thread_p->sql_id.store (saved_sql_id, std::memory_order_relaxed);
+#if defined (SERVER_MODE)
+  resgrp_end_query (thread_p, &resgrp_slot);
+#endif
   thread_p->no_logging = false;
   thread_p->no_supplemental_log = false;
 
@@ -2540,7 +2573,7 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
     }
 
   /* first page, return memory buffer instead real temp file page */
-  if (tfile_vfid_p->membuf != NULL && tfile_vfid_p->membuf_last < tfile_vfid_p->membuf_npages - 1)
+  if (tfile_vfid_p->membuf != NULL && tfile_vfid_p->membuf_last < tfile_vfid_p->membuf_granted_npages - 1)
     {
       vpid_p->volid = NULL_VOLID;
       vpid_p->pageid = ++(tfile_vfid_p->membuf_last);
@@ -2623,9 +2656,27 @@ qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_F
   PAGE_PTR page_p = NULL;
 
   VPID_SET_NULL (vpid_p);
+
+#if defined (SERVER_MODE)
+  /* the page counts in the temp space quota of the resource group of the query */
+  if (tmp_vfid_p->resgrp_charged_npages == 0)
+    {
+      tmp_vfid_p->resgrp_id = resgrp_get_thread_group (thread_p);
+    }
+  if (resgrp_charge_temp_pages (thread_p, tmp_vfid_p->resgrp_id, 1) != NO_ERROR)
+    {
+      return NULL;
+    }
+  tmp_vfid_p->resgrp_charged_npages++;
+#endif /* SERVER_MODE */
+
   if (file_alloc (thread_p, &tmp_vfid_p->temp_vfid, qmgr_init_external_file_page, NULL, vpid_p, &page_p) != NO_ERROR)
     {
       ASSERT_ERROR ();
+#if defined (SERVER_MODE)
+      resgrp_release_temp_pages (tmp_vfid_p->resgrp_id, 1);
+      tmp_vfid_p->resgrp_charged_npages--;
+#endif /* SERVER_MODE */
       return NULL;
     }
   assert (page_p != NULL);
@@ -2633,6 +2684,23 @@ qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_F
   return page_p;
 }
 
+/*
+ * qmgr_release_temp_file_charge () - give back the pages of the temp file to the quota of its resource group
+ *   return: void
+ *   tfile_vfid_p(in): temp file whose pages are retired or left to the list cache
+ */
+static void
+qmgr_release_temp_file_charge (QMGR_TEMP_FILE * tfile_vfid_p)
+{
+#if defined (SERVER_MODE)
+  if (tfile_vfid_p->resgrp_charged_npages > 0)
+    {
+      resgrp_release_temp_pages (tfile_vfid_p->resgrp_id, tfile_vfid_p->resgrp_charged_npages);
+    }
+#endif /* SERVER_MODE */
+  tfile_vfid_p->resgrp_charged_npages = 0;
+}
+
 static QMGR_TEMP_FILE *
 qmgr_allocate_tempfile_with_buffer (int num_buffer_pages)
 {
@@ -2697,9 +2765,13 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
   VFID_SET_NULL (&tfile_vfid_p->temp_vfid);
   tfile_vfid_p->temp_file_type = FILE_TEMP;
   tfile_vfid_p->membuf_npages = num_buffer_pages;
+  tfile_vfid_p->membuf_granted_npages = 0;
+  QMGR_MEMORY_GRANT_INIT (&tfile_vfid_p->membuf_grant);
   tfile_vfid_p->membuf_type = membuf_type;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
+  tfile_vfid_p->resgrp_id = 0;
+  tfile_vfid_p->resgrp_charged_npages = 0;
   tfile_vfid_p->membuf_last = -1;
 
   page_p = (PAGE_PTR) ((PAGE_PTR) tfile_vfid_p->membuf
@@ -2741,6 +2813,12 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
       tfile_vfid_p->tde_encrypted = true;
     }
 
+  /* the memory buffer is used as far as the broker grants it; the file spills to disk after the granted pages */
+  tfile_vfid_p->membuf_granted_npages =
+    (int) (qmgr_request_memory_grant (thread_p, query_id, 0, (UINT64) num_buffer_pages * DB_PAGESIZE, false,
+				      &tfile_vfid_p->membuf_grant) / DB_PAGESIZE);
+  qmgr_shrink_memory_grant (&tfile_vfid_p->membuf_grant, (UINT64) tfile_vfid_p->membuf_granted_npages * DB_PAGESIZE);
+
   /* chain allocated tfile_vfid to the query_entry */
   temp = query_p->temp_vfid;
   query_p->temp_vfid = tfile_vfid_p;
@@ -2803,9 +2881,13 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   tfile_vfid_p->membuf_last = prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_PAGES) - 1;
   tfile_vfid_p->membuf = NULL;
   tfile_vfid_p->membuf_npages = 0;
+  tfile_vfid_p->membuf_granted_npages = 0;
+  QMGR_MEMORY_GRANT_INIT (&tfile_vfid_p->membuf_grant);
   tfile_vfid_p->membuf_type = TEMP_FILE_MEMBUF_NONE;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
+  tfile_vfid_p->resgrp_id = 0;
+  tfile_vfid_p->resgrp_charged_npages = 0;
 
   /* Find the query entry and chain the created temp file to the entry */
 
@@ -2926,6 +3008,9 @@ qmgr_free_temp_file_list (THREAD_ENTRY * thread_p, QMGR_TEMP_FILE * tfile_vfid_p
       temp = tfile_vfid_p;
       tfile_vfid_p = tfile_vfid_p->next;
 
+      /* pages of a result kept by the list cache are not charged to the resource group any more */
+      qmgr_release_temp_file_charge (temp);
+
       if (temp->temp_file_type != FILE_QUERY_AREA)
 	{
 	  qmgr_put_temp_file_into_list (temp);
@@ -3076,6 +3161,8 @@ qmgr_free_list_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP_
 	    }
 	}
 
+      qmgr_release_temp_file_charge (tfile_vfid_p);
+
       if (tfile_vfid_p->temp_file_type != FILE_QUERY_AREA)
 	{
 	  qmgr_put_temp_file_into_list (tfile_vfid_p);
@@ -3372,6 +3459,9 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
 
   temp_file_p->membuf_last = -1;
 
+  qmgr_release_memory_grant (&temp_file_p->membuf_grant);
+  temp_file_p->membuf_granted_npages = 0;
+
   if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
     {
       temp_file_list_p = &qmgr_Query_table.temp_file_list[temp_file_p->membuf_type];
@@ -3398,7 +3488,7 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
 
 /*
  * qmgr_get_temp_file_membuf_pages () -
- *   return: number of membuf pages belonging to the temporary file
+ *   return: number of membuf pages the temporary file may use
  *   temp_file_list_p(in): temporary file
  */
 int
@@ -3409,7 +3499,7 @@ qmgr_get_temp_file_membuf_pages (QMGR_TEMP_FILE * temp_file_p)
     {
       return -1;
     }
-  return temp_file_p->membuf_npages;
+  return temp_file_p->membuf_granted_npages;
 }
 
 #if defined (SERVER_MODE)
@@ -3536,6 +3626,28 @@ qmgr_get_sql_id (THREAD_ENTRY * thread_p, char **sql_id_buf, char *query, size_t
   return NO_ERROR;
 }
 
+/*
+ * qmgr_get_sql_id_value () - SQL_ID of a query as a number
+ *   return: the SQL_ID digits of qmgr_get_sql_id () as an integer, or 0 on error
+ *   query(in):
+ *   sql_len(in):
+ *
+ *   note : this is what executing threads publish for the active session history; it needs no allocation and is
+ *          printed back with "%013llx".
+ */
+UINT64
+qmgr_get_sql_id_value (const char *query, size_t sql_len)
+{
+  char hashstring[32 + 1] = { '\0' };
+
+  if (crypt_md5_buffer_hex (query, sql_len, hashstring) != NO_ERROR)
+    {
+      return 0;
+    }
+
+  return (UINT64) strtoull (hashstring + 32 - QMGR_SQL_ID_LENGTH, NULL, 16);
+}
+
 /* qmgr_get_rand_buf() : return the drand48_data reference
  * thread_p(in):
  */
@@ -3561,6 +3673,11 @@ qmgr_get_current_query_id (THREAD_ENTRY * thread_p)
   QUERY_ID query_id = NULL_QUERY_ID;
   int tran_index;
 
+  if (qmgr_Query_table.tran_entries_p == NULL)
+    {
+      return query_id;
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
 
@@ -3598,3 +3715,366 @@ qmgr_get_query_sql_user_text (THREAD_ENTRY * thread_p, QUERY_ID query_id, int tr
 
   return query_str;
 }
+
+/*
+ *       		     QUERY MEMORY BROKER
+ *
+ * Sort buffers, hash GROUP BY tables, hash list scan tables and temp file memory buffers are granted by the broker
+ * against the global max_query_memory_size budget. Each operator asks for the size it would like to use, as estimated
+ * from its input, and for the minimum size it can work with. Grants are reduced to what is left of the budget; when
+ * not even the minimum is left, the request is queued (first come, first served) for at most
+ * query_memory_grant_wait_time_in_msecs and denied afterwards. While requests are queued, the others are only given
+ * what exceeds the minimum sizes of the queued ones. Operators spill to disk or fall back to a cheaper method with the
+ * memory they are given.
+ *
+ * A zero budget does not limit the grants; they are still accounted per query.
+ */
+
+typedef struct qmgr_memory_grant_waiter QMGR_MEMORY_GRANT_WAITER;
+struct qmgr_memory_grant_waiter
+{
+  QMGR_MEMORY_GRANT_WAITER *next;
+  UINT64 min_size;
+};
+
+typedef struct qmgr_memory_broker QMGR_MEMORY_BROKER;
+struct qmgr_memory_broker
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;		/* signaled when memory is released or the head waiter leaves the queue */
+  UINT64 granted_size;		/* memory granted to all operators; grown under mutex, shrunk atomically */
+  QMGR_MEMORY_GRANT_WAITER *waiters_head;
+  QMGR_MEMORY_GRANT_WAITER *waiters_tail;
+};
+
+static QMGR_MEMORY_BROKER qmgr_Memory_broker = {
+  PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, NULL, NULL
+};
+
+static UINT64 qmgr_get_available_query_memory (UINT64 budget);
+static UINT64 qmgr_get_queued_min_size (void);
+#if defined (SERVER_MODE)
+static bool qmgr_wait_memory_grant (THREAD_ENTRY * thread_p, UINT64 budget, UINT64 min_size);
+#endif /* SERVER_MODE */
+static void qmgr_charge_memory_grant (QMGR_MEMORY_GRANT * grant, INT64 delta, bool is_reduced);
+
+/*
+ * qmgr_get_available_query_memory () - memory left in the budget
+ *   return: available bytes
+ *   budget(in): max_query_memory_size
+ */
+static UINT64
+qmgr_get_available_query_memory (UINT64 budget)
+{
+  UINT64 granted_size = ATOMIC_LOAD_64 (&qmgr_Memory_broker.granted_size);
+
+  return (budget > granted_size) ? budget - granted_size : 0;
+}
+
+/*
+ * qmgr_get_queued_min_size () - memory the queued requests need at least
+ *   return: sum of the minimum sizes of the waiters
+ *
+ * Note: broker mutex must be held.
+ */
+static UINT64
+qmgr_get_queued_min_size (void)
+{
+  QMGR_MEMORY_GRANT_WAITER *waiter_p;
+  UINT64 min_size = 0;
+
+  for (waiter_p = qmgr_Memory_broker.waiters_head; waiter_p != NULL; waiter_p = waiter_p->next)
+    {
+      min_size += waiter_p->min_size;
+    }
+
+  return min_size;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * qmgr_wait_memory_grant () - queue a request until min_size is available and it is at the head of the queue
+ *   return: true if min_size became available, false on timeout or interrupt
+ *   thread_p(in):
+ *   budget(in): max_query_memory_size
+ *   min_size(in): minimum size of the request
+ *
+ * Note: broker mutex must be held; it is released while waiting.
+ */
+static bool
+qmgr_wait_memory_grant (THREAD_ENTRY * thread_p, UINT64 budget, UINT64 min_size)
+{
+  QMGR_MEMORY_GRANT_WAITER waiter, *waiter_p, *prev_p;
+  struct timeval now;
+  struct timespec to;
+  INT64 deadline_msecs, now_msecs;
+  bool is_admitted = false, dummy;
+
+  waiter.next = NULL;
+  waiter.min_size = min_size;
+  if (qmgr_Memory_broker.waiters_tail != NULL)
+    {
+      qmgr_Memory_broker.waiters_tail->next = &waiter;
+    }
+  else
+    {
+      qmgr_Memory_broker.waiters_head = &waiter;
+    }
+  qmgr_Memory_broker.waiters_tail = &waiter;
+
+  gettimeofday (&now, NULL);
+  now_msecs = (INT64) now.tv_sec * 1000 + now.tv_usec / 1000;
+  deadline_msecs = now_msecs + prm_get_integer_value (PRM_ID_QUERY_MEMORY_GRANT_WAIT_TIME_IN_MSECS);
+
+  while (true)
+    {
+      if (qmgr_Memory_broker.waiters_head == &waiter && qmgr_get_available_query_memory (budget) >= min_size)
+	{
+	  is_admitted = true;
+	  break;
+	}
+      if (now_msecs >= deadline_msecs || logtb_is_interrupted (thread_p, true, &dummy))
+	{
+	  break;
+	}
+
+      /* wake up at least every 100 msecs to check interrupts */
+      now_msecs = MIN (deadline_msecs, now_msecs + 100);
+      to.tv_sec = (time_t) (now_msecs / 1000);
+      to.tv_nsec = (long) (now_msecs % 1000) * 1000000;
+      (void) pthread_cond_timedwait (&qmgr_Memory_broker.cond, &qmgr_Memory_broker.mutex, &to);
+
+      gettimeofday (&now, NULL);
+      now_msecs = (INT64) now.tv_sec * 1000 + now.tv_usec / 1000;
+    }
+
+  /* leave the queue */
+  for (prev_p = NULL, waiter_p = qmgr_Memory_broker.waiters_head; waiter_p != &waiter; waiter_p = waiter_p->next)
+    {
+      prev_p = waiter_p;
+    }
+  if (prev_p != NULL)
+    {
+      prev_p->next = waiter.next;
+    }
+  else
+    {
+      qmgr_Memory_broker.waiters_head = waiter.next;
+    }
+  if (qmgr_Memory_broker.waiters_tail == &waiter)
+    {
+      qmgr_Memory_broker.waiters_tail = prev_p;
+    }
+
+  /* the next waiter may be admitted now */
+  pthread_cond_broadcast (&qmgr_Memory_broker.cond);
+
+  return is_admitted;
+}
+#endif /* SERVER_MODE */
+
+/*
+ * qmgr_charge_memory_grant () - account a change of a grant to its query entry
+ *   return: void
+ *   grant(in/out):
+ *   delta(in): size change in bytes
+ *   is_reduced(in): true if the grant is smaller than requested
+ */
+static void
+qmgr_charge_memory_grant (QMGR_MEMORY_GRANT * grant, INT64 delta, bool is_reduced)
+{
+  QMGR_QUERY_ENTRY *query_p = grant->query_p;
+  UINT64 current_size, peak_size;
+
+  /* query entries are recycled; do not charge the entry if it was reused by another query */
+  if (query_p == NULL || query_p->query_id != grant->query_id)
+    {
+      return;
+    }
+
+  if (delta < 0 && ATOMIC_LOAD_64 (&query_p->mem_grant_size) < (UINT64) (-delta))
+    {
+      /* the entry was reset meanwhile */
+      ATOMIC_STORE_64 (&query_p->mem_grant_size, 0);
+    }
+  else
+    {
+      current_size = ATOMIC_INC_64 (&query_p->mem_grant_size, delta);
+      do
+	{
+	  peak_size = ATOMIC_LOAD_64 (&query_p->mem_grant_peak_size);
+	}
+      while (current_size > peak_size && !ATOMIC_CAS_64 (&query_p->mem_grant_peak_size, peak_size, current_size));
+    }
+
+  if (is_reduced)
+    {
+      ATOMIC_INC_32 (&query_p->mem_grant_reduced_count, 1);
+    }
+}
+
+/*
+ * qmgr_request_memory_grant () - ask the query memory broker for memory
+ *   return: granted bytes; 0 if the request is denied
+ *   thread_p(in):
+ *   query_id(in): query charged with the grant, or NULL_QUERY_ID
+ *   min_size(in): minimum size the operator can use
+ *   desired_size(in): size the operator would like to use
+ *   can_wait(in): true to queue the request when min_size is not available
+ *   grant(out): the grant; must be released with qmgr_release_memory_grant
+ *
+ * Note: the grant is between min_size and desired_size, or zero. A request with min_size of zero never waits and
+ *       is only given what the queued requests do not need.
+ */
+UINT64
+qmgr_request_memory_grant (THREAD_ENTRY * thread_p, QUERY_ID query_id, UINT64 min_size, UINT64 desired_size,
+			   bool can_wait, QMGR_MEMORY_GRANT * grant)
+{
+  UINT64 budget = prm_get_bigint_value (PRM_ID_MAX_QUERY_MEMORY_SIZE);
+  UINT64 granted_size = 0, available_size, queued_min_size;
+  QMGR_TRAN_ENTRY *tran_entry_p;
+
+  assert (grant != NULL && min_size <= desired_size);
+
+  QMGR_MEMORY_GRANT_INIT (grant);
+  if (desired_size == 0)
+    {
+      return 0;
+    }
+
+  if (budget == 0)
+    {
+      /* not limited; only accounted */
+      granted_size = desired_size;
+      ATOMIC_INC_64 (&qmgr_Memory_broker.granted_size, granted_size);
+    }
+  else if (min_size <= budget)
+    {
+      pthread_mutex_lock (&qmgr_Memory_broker.mutex);
+
+      available_size = qmgr_get_available_query_memory (budget);
+      if (qmgr_Memory_broker.waiters_head == NULL && available_size >= min_size)
+	{
+	  granted_size = MIN (desired_size, available_size);
+	}
+      else if (min_size == 0)
+	{
+	  /* do not take the memory of the requests that were queued first */
+	  queued_min_size = qmgr_get_queued_min_size ();
+	  granted_size = (available_size > queued_min_size) ? MIN (desired_size, available_size - queued_min_size) : 0;
+	}
+#if defined (SERVER_MODE)
+      else if (can_wait && qmgr_wait_memory_grant (thread_p, budget, min_size))
+	{
+	  /* leave to the next waiters what they need at least */
+	  available_size = qmgr_get_available_query_memory (budget);
+	  queued_min_size = qmgr_get_queued_min_size ();
+	  granted_size = MAX (min_size, (available_size > queued_min_size) ? available_size - queued_min_size : 0);
+	  granted_size = MIN (desired_size, MIN (granted_size, available_size));
+	}
+#endif /* SERVER_MODE */
+      ATOMIC_INC_64 (&qmgr_Memory_broker.granted_size, granted_size);
+
+      pthread_mutex_unlock (&qmgr_Memory_broker.mutex);
+    }
+
+  if (query_id != NULL_QUERY_ID && qmgr_Query_table.tran_entries_p != NULL)
+    {
+      tran_entry_p = &qmgr_Query_table.tran_entries_p[LOG_FIND_THREAD_TRAN_INDEX (thread_p)];
+
+      pthread_mutex_lock (&tran_entry_p->mutex);
+      grant->query_p = qmgr_find_query_entry (tran_entry_p->query_entry_list_p, query_id);
+      pthread_mutex_unlock (&tran_entry_p->mutex);
+    }
+  grant->query_id = query_id;
+  grant->size = granted_size;
+
+  qmgr_charge_memory_grant (grant, (INT64) granted_size, granted_size < desired_size);
+
+  return granted_size;
+}
+
+/*
+ * qmgr_shrink_memory_grant () - give back part of a grant
+ *   return: void
+ *   grant(in/out):
+ *   new_size(in): size the operator keeps
+ */
+void
+qmgr_shrink_memory_grant (QMGR_MEMORY_GRANT * grant, UINT64 new_size)
+{
+  UINT64 released_size;
+
+  assert (grant != NULL);
+
+  if (new_size >= grant->size)
+    {
+      return;
+    }
+  released_size = grant->size - new_size;
+
+  ATOMIC_INC_64 (&qmgr_Memory_broker.granted_size, -(INT64) released_size);
+
+  /* waiters that miss this wake up also check the budget periodically */
+  if (qmgr_Memory_broker.waiters_head != NULL)
+    {
+      pthread_mutex_lock (&qmgr_Memory_broker.mutex);
+      pthread_cond_broadcast (&qmgr_Memory_broker.cond);
+      pthread_mutex_unlock (&qmgr_Memory_broker.mutex);
+    }
+
+  grant->size = new_size;
+  qmgr_charge_memory_grant (grant, -(INT64) released_size, false);
+}
+
+/*
+ * qmgr_release_memory_grant () - give back a grant
+ *   return: void
+ *   grant(in/out):
+ */
+void
+qmgr_release_memory_grant (QMGR_MEMORY_GRANT * grant)
+{
+  assert (grant != NULL);
+
+  qmgr_shrink_memory_grant (grant, 0);
+  QMGR_MEMORY_GRANT_INIT (grant);
+}
+
+/*
+ * qmgr_get_query_memory_grant_stats () - memory granted to the operators of a query
+ *   return: void
+ *   thread_p(in):
+ *   query_id(in):
+ *   current_size(out): memory currently granted
+ *   peak_size(out): peak of the granted memory
+ *   reduced_count(out): number of grants smaller than requested or denied
+ */
+void
+qmgr_get_query_memory_grant_stats (THREAD_ENTRY * thread_p, QUERY_ID query_id, UINT64 * current_size,
+				   UINT64 * peak_size, int *reduced_count)
+{
+  QMGR_TRAN_ENTRY *tran_entry_p;
+  QMGR_QUERY_ENTRY *query_p = NULL;
+
+  *current_size = 0;
+  *peak_size = 0;
+  *reduced_count = 0;
+
+  if (qmgr_Query_table.tran_entries_p == NULL)
+    {
+      return;
+    }
+
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[LOG_FIND_THREAD_TRAN_INDEX (thread_p)];
+
+  pthread_mutex_lock (&tran_entry_p->mutex);
+  query_p = qmgr_find_query_entry (tran_entry_p->query_entry_list_p, query_id);
+  if (query_p != NULL)
+    {
+      *current_size = ATOMIC_LOAD_64 (&query_p->mem_grant_size);
+      *peak_size = ATOMIC_LOAD_64 (&query_p->mem_grant_peak_size);
+      *reduced_count = ATOMIC_INC_32 (&query_p->mem_grant_reduced_count, 0);
+    }
+  pthread_mutex_unlock (&tran_entry_p->mutex);
+}
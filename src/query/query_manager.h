@@ -49,6 +49,8 @@ struct xasl_cache_ent;
 
 #define NULL_PAGEID_IN_PROGRESS -2
 
+#define QMGR_SQL_ID_LENGTH      13
+
 typedef enum
 {
   TEMP_FILE_MEMBUF_NONE = -1,
@@ -72,6 +74,28 @@ typedef enum
   QMGR_TRAN_TERMINATED		/* Terminated transaction */
 } QMGR_TRAN_STATUS;
 
+/*
+ * Memory granted by the query memory broker to one operator of a query (sort buffers, hash tables, temp file
+ * memory buffers). The grant is charged to the global max_query_memory_size budget and to the query entry until it
+ * is released.
+ */
+typedef struct qmgr_memory_grant QMGR_MEMORY_GRANT;
+struct qmgr_memory_grant
+{
+  struct qmgr_query_entry *query_p;	/* query entry charged with the grant; NULL if none */
+  QUERY_ID query_id;		/* identifier of the query when the grant was made */
+  UINT64 size;			/* granted bytes; 0 if nothing is granted */
+};
+
+#define QMGR_MEMORY_GRANT_INIT(grant) \
+  do \
+    { \
+      (grant)->query_p = NULL; \
+      (grant)->query_id = NULL_QUERY_ID; \
+      (grant)->size = 0; \
+    } \
+  while (0)
+
 typedef struct qmgr_temp_file QMGR_TEMP_FILE;
 struct qmgr_temp_file
 {
@@ -82,9 +106,13 @@ struct qmgr_temp_file
   int membuf_last;
   PAGE_PTR *membuf;
   int membuf_npages;
+  int membuf_granted_npages;	/* membuf pages the query memory broker allows the file to use */
+  QMGR_MEMORY_GRANT membuf_grant;
   QMGR_TEMP_FILE_MEMBUF_TYPE membuf_type;
   bool preserved;		/* if temp file is preserved */
   bool tde_encrypted;		/* whether the file of temp_vfid has to be encrypted when flushing (TDE) */
+  int resgrp_id;		/* resource group charged for the pages of temp_vfid */
+  int resgrp_charged_npages;	/* pages of temp_vfid charged to the resource group */
 };
 
 /*
@@ -137,6 +165,9 @@ struct qmgr_query_entry
   QUERY_FLAG query_flag;
   bool is_holdable;		/* true if this query should be available */
   bool includes_tde_class;	/* true if this query include some tde class. It is from xasl node */
+  UINT64 mem_grant_size;	/* memory currently granted to the operators of the query */
+  UINT64 mem_grant_peak_size;	/* peak of mem_grant_size */
+  int mem_grant_reduced_count;	/* number of grants smaller than requested or denied */
 };
 
 extern QMGR_QUERY_ENTRY *qmgr_get_query_entry (THREAD_ENTRY * thread_p, QUERY_ID query_id, int trans_ind);
@@ -171,8 +202,16 @@ extern void qmgr_set_query_error (THREAD_ENTRY * thread_p, QUERY_ID query_id);
 extern void qmgr_setup_empty_list_file (char *page_buf);
 extern int qmgr_get_temp_file_membuf_pages (QMGR_TEMP_FILE * temp_file_p);
 extern int qmgr_get_sql_id (THREAD_ENTRY * thread_p, char **sql_id_buf, char *query, size_t sql_len);
+extern UINT64 qmgr_get_sql_id_value (const char *query, size_t sql_len);
 extern struct drand48_data *qmgr_get_rand_buf (THREAD_ENTRY * thread_p);
 extern QUERY_ID qmgr_get_current_query_id (THREAD_ENTRY * thread_p);
 extern char *qmgr_get_query_sql_user_text (THREAD_ENTRY * thread_p, QUERY_ID query_id, int tran_index);
 
+extern UINT64 qmgr_request_memory_grant (THREAD_ENTRY * thread_p, QUERY_ID query_id, UINT64 min_size,
+					 UINT64 desired_size, bool can_wait, QMGR_MEMORY_GRANT * grant);
+extern void qmgr_shrink_memory_grant (QMGR_MEMORY_GRANT * grant, UINT64 new_size);
+extern void qmgr_release_memory_grant (QMGR_MEMORY_GRANT * grant);
+extern void qmgr_get_query_memory_grant_stats (THREAD_ENTRY * thread_p, QUERY_ID query_id, UINT64 * current_size,
+					       UINT64 * peak_size, int *reduced_count);
+
 #endif /* _QUERY_MANAGER_H_ */
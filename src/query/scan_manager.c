@@ -51,6 +51,7 @@
 #include "xasl.h"
 #include "query_hash_scan.h"
 #include "statistics.h"
+#include "columnar_cache.hpp"
 
 #if !defined(SERVER_MODE)
 #define pthread_mutex_init(a, b)
@@ -172,6 +173,7 @@ static int scan_init_index_key_limit (THREAD_ENTRY * thread_p, INDX_SCAN_ID * is
 				      VAL_DESCR * vd);
 static SCAN_CODE scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static SCAN_CODE scan_next_columnar_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_index_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
@@ -206,7 +208,8 @@ static int scan_key_compare (DB_VALUE * val1, DB_VALUE * val2, int num_index_ter
 static SCAN_CODE scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
-static HASH_METHOD check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_type);
+static HASH_METHOD check_hash_list_scan (THREAD_ENTRY * thread_p, LLIST_SCAN_ID * llsidp, int *val_cnt,
+					 int hash_list_scan_type);
 
 /*
  * scan_init_iss () - initialize index skip scan structure
@@ -749,8 +752,9 @@ scan_init_indx_coverage (THREAD_ENTRY * thread_p, int coverage_enabled, valptr_l
       goto exit_on_error;
     }
 
+  /* zero if the query memory broker did not grant a memory buffer */
   num_membuf_pages = qmgr_get_temp_file_membuf_pages (indx_cov->list_id->tfile_vfid);
-  assert (num_membuf_pages > 0);
+  assert (num_membuf_pages >= 0);
 
   if (max_key_len > 0 && num_membuf_pages > 0)
     {
@@ -2863,6 +2867,8 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
 
+  hsidp->colscan = NULL;
+
   /* for scampling statistics. */
   if (scan_type == S_HEAP_SAMPLING_SCAN && !is_partition_table)
     {
@@ -3696,9 +3702,10 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   llsidp->hlsid.build_regu_list = regu_list_build;
   llsidp->hlsid.probe_regu_list = regu_list_probe;
   llsidp->hlsid.need_coerce_type = false;
+  llsidp->hlsid.memory_grant = NULL;
 
   /* check if hash list scan is possible? */
-  llsidp->hlsid.hash_list_scan_type = check_hash_list_scan (llsidp, &val_cnt, hash_list_scan_yn);
+  llsidp->hlsid.hash_list_scan_type = check_hash_list_scan (thread_p, llsidp, &val_cnt, hash_list_scan_yn);
   if (llsidp->hlsid.hash_list_scan_type != HASH_METH_NOT_USE)
     {
       bool on_trace;
@@ -4138,6 +4145,25 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      if (scan_id->type == S_HEAP_SCAN && !scan_id->grouped && !scan_id->mvcc_select_lock_needed
+	  && scan_id->scan_op_type == S_SELECT && mvcc_snapshot != NULL)
+	{
+	  /* read the columnar copy of the class if there is one */
+	  colcache_scan_end (&hsidp->colscan);
+	  ret =
+	    colcache_scan_start (thread_p, &hsidp->cls_oid, &hsidp->hfid, hsidp->pred_attrs.attr_cache,
+				 hsidp->rest_attrs.attr_cache, &hsidp->colscan);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	  if (hsidp->colscan != NULL)
+	    {
+	      colcache_scan_set_filter (hsidp->colscan, hsidp->scan_pred.pred_expr);
+	      colcache_scan_reset (hsidp->colscan, scan_id->direction == S_FORWARD);
+	      scan_id->scan_stats.columnar = true;
+	    }
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4381,6 +4407,10 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
 	{
 	  s_id->position = (s_id->direction == S_FORWARD) ? S_BEFORE : S_AFTER;
 	  OID_SET_NULL (&s_id->s.hsid.curr_oid);
+	  if (s_id->s.hsid.colscan != NULL)
+	    {
+	      colcache_scan_reset (s_id->s.hsid.colscan, s_id->direction == S_FORWARD);
+	    }
 	}
       break;
 
@@ -4689,6 +4719,8 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	}
 
+      colcache_scan_end (&hsidp->colscan);
+
       /* switch scan direction for further iterations */
       if (scan_id->direction == S_FORWARD)
 	{
@@ -4922,6 +4954,12 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  qdata_free_hscan_key (thread_p, llsidp->hlsid.temp_new_key, llsidp->hlsid.temp_new_key->val_count);
 	  llsidp->hlsid.temp_new_key = NULL;
 	}
+      /* give back the memory of the hash table */
+      if (llsidp->hlsid.memory_grant != NULL)
+	{
+	  qmgr_release_memory_grant (llsidp->hlsid.memory_grant);
+	  db_private_free_and_init (thread_p, llsidp->hlsid.memory_grant);
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -5159,6 +5197,131 @@ scan_next_scan_local (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   return status;
 }
 
+/*
+ * scan_next_columnar_scan () - The heap scan is moved to the next row of the columnar copy of the class.
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *
+ * Note: The rows of a columnar table are visible to every snapshot, so there is no record to read, check or lock.
+ *	 The attribute caches are filled from the column vectors and the data filter is evaluated on them.
+ *	 When only qualified rows are wanted, the simple conjuncts of the predicate are first evaluated on whole
+ *	 batches of rows and the rows they reject are skipped. If the batch terms cover the whole predicate, the rows
+ *	 they select are not evaluated again.
+ */
+static SCAN_CODE
+scan_next_columnar_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp;
+  FILTER_INFO data_filter;
+  SCAN_CODE sp_scan;
+  DB_LOGICAL ev_res;
+  regu_variable_list_node *p;
+  INT64 skipped_rows;
+  bool is_qualified;
+
+  hsidp = &scan_id->s.hsid;
+
+  /* no scan attributes: the predicate values are read from the columns, not by eval_data_filter */
+  scan_init_filter_info (&data_filter, &hsidp->scan_pred, NULL, scan_id->val_list, scan_id->vd, &hsidp->cls_oid, 0,
+			 NULL, NULL, NULL);
+
+  if (data_filter.val_list)
+    {
+      for (p = data_filter.scan_pred->regu_list; p; p = p->next)
+	{
+	  if (DB_NEED_CLEAR (p->value.vfetch_to))
+	    {
+	      pr_clear_value (p->value.vfetch_to);
+	    }
+	}
+    }
+
+  while (1)
+    {
+      sp_scan =
+	colcache_scan_next (thread_p, hsidp->colscan, scan_id->direction == S_FORWARD,
+			    scan_id->qualification == QPROC_QUALIFIED, scan_id->vd, &hsidp->curr_oid, &skipped_rows,
+			    &is_qualified);
+      scan_id->scan_stats.read_rows += skipped_rows;
+      if (sp_scan != S_SUCCESS)
+	{
+	  return sp_scan;
+	}
+
+      scan_id->scan_stats.read_rows++;
+
+      if (hsidp->scan_pred.regu_list != NULL
+	  && colcache_scan_read_dbvalues (hsidp->colscan, hsidp->pred_attrs.attr_cache) != NO_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      if (is_qualified)
+	{
+	  /* the batch filter evaluated the whole predicate; only fetch the predicate values */
+	  if (data_filter.val_list != NULL
+	      && fetch_val_list (thread_p, hsidp->scan_pred.regu_list, scan_id->vd, &hsidp->cls_oid, &hsidp->curr_oid,
+				 NULL, PEEK) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	  ev_res = V_TRUE;
+	}
+      else
+	{
+	  ev_res = eval_data_filter (thread_p, &hsidp->curr_oid, NULL, NULL, &data_filter);
+	  if (ev_res == V_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	}
+
+      if (scan_id->qualification == QPROC_NOT_QUALIFIED)
+	{
+	  if (ev_res != V_FALSE)	/* V_TRUE || V_UNKNOWN */
+	    {
+	      continue;		/* qualified, continue to the next tuple */
+	    }
+	}
+      else if (scan_id->qualification == QPROC_QUALIFIED_OR_NOT)
+	{
+	  if (ev_res == V_TRUE)
+	    {
+	      scan_id->qualification = QPROC_QUALIFIED;
+	    }
+	  else if (ev_res == V_FALSE)
+	    {
+	      scan_id->qualification = QPROC_NOT_QUALIFIED;
+	    }
+	}
+      else if (ev_res != V_TRUE)	/* V_FALSE || V_UNKNOWN */
+	{
+	  continue;		/* not qualified, continue to the next tuple */
+	}
+
+      scan_id->scan_stats.qualified_rows++;
+
+      if (hsidp->rest_regu_list)
+	{
+	  if (colcache_scan_read_dbvalues (hsidp->colscan, hsidp->rest_attrs.attr_cache) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+
+	  if (scan_id->val_list)
+	    {
+	      if (fetch_val_list (thread_p, hsidp->rest_regu_list, scan_id->vd, &hsidp->cls_oid, &hsidp->curr_oid, NULL,
+				  PEEK) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	    }
+	}
+
+      return S_SUCCESS;
+    }
+}
+
 typedef enum
 {
   OBJ_GET_WITHOUT_LOCK = 0,
@@ -5191,6 +5354,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   regu_variable_list_node *p;
 
   hsidp = &scan_id->s.hsid;
+  if (hsidp->colscan != NULL)
+    {
+      return scan_next_columnar_scan (thread_p, scan_id);
+    }
+
   if (scan_id->mvcc_select_lock_needed)
     {
       p_current_oid = &current_oid;
@@ -7810,6 +7978,10 @@ scan_print_stats_json (SCAN_ID * scan_id, json_t * scan_stats)
 	    {
 	      json_object_set_new (scan_stats, "noscan", scan);
 	    }
+	  else if (scan_id->scan_stats.columnar)
+	    {
+	      json_object_set_new (scan_stats, "columnar", scan);
+	    }
 	  else
 	    {
 	      json_object_set_new (scan_stats, "heap", scan);
@@ -7902,6 +8074,10 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
 	{
 	  fprintf (fp, "(noscan");	/* aggregate optimization is not a scan */
 	}
+      else if (scan_id->scan_stats.columnar)
+	{
+	  fprintf (fp, "(columnar");
+	}
       else
 	{
 	  fprintf (fp, "(heap");
@@ -8415,6 +8591,7 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
 /*
  * check_hash_list_scan () - Check if hash list scan is possible
  *   return: int  1: in-memory 2: hybrid in-memory
+ *   thread_p (in):
  *   llsidp (in): list scan id pointer
  *   node :
  *      1. count of tuple of list file > 0
@@ -8425,12 +8602,13 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
  *      6. list file from dptr is not allowed
 */
 static HASH_METHOD
-check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn)
+check_hash_list_scan (THREAD_ENTRY * thread_p, LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn)
 {
   int build_cnt;
   regu_variable_list_node *build, *probe;
   DB_TYPE vtype1, vtype2;
   UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+  UINT64 in_mem_size, hybrid_size, desired_size, min_size, granted_size;
 
   assert (hash_list_scan_yn == 0 || hash_list_scan_yn == 1);
   /* no_hash_list_scan sql hint check */
@@ -8488,19 +8666,43 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
     {
       return HASH_METH_NOT_USE;
     }
-  else if ((UINT64) llsidp->list_id->page_cnt * DB_PAGESIZE <= mem_limit)
+
+  /* bytes of 1 row = sizeof(HENTRY_HLS) + sizeof(QFILE_TUPLE_SIMPLE_POS) = 44 bytes (64bit) */
+  /* HENTRY_HLS = pointer(8bytes) * 4 = 32 bytes */
+  /* SIMPLE_POS = pageid(4bytes) + volid(2bytes) + padding(2bytes) + offset(4bytes) = 12 bytes */
+  in_mem_size = (UINT64) llsidp->list_id->page_cnt * DB_PAGESIZE;
+  hybrid_size = (UINT64) llsidp->list_id->tuple_cnt * (sizeof (HENTRY_HLS) + sizeof (QFILE_TUPLE_SIMPLE_POS));
+  if (in_mem_size > mem_limit && hybrid_size > mem_limit)
+    {
+      return HASH_METH_HASH_FILE;
+    }
+
+  /* the memory hash table must be granted by the query memory broker; with less than the hybrid table needs, the
+   * hash table is kept in a file */
+  llsidp->hlsid.memory_grant = (QMGR_MEMORY_GRANT *) db_private_alloc (thread_p, sizeof (QMGR_MEMORY_GRANT));
+  if (llsidp->hlsid.memory_grant == NULL)
+    {
+      return HASH_METH_HASH_FILE;
+    }
+  desired_size = (in_mem_size <= mem_limit) ? in_mem_size : hybrid_size;
+  min_size = (hybrid_size <= mem_limit) ? MIN (hybrid_size, desired_size) : desired_size;
+  granted_size =
+    qmgr_request_memory_grant (thread_p, llsidp->list_id->query_id, min_size, desired_size, false,
+			       llsidp->hlsid.memory_grant);
+
+  if (in_mem_size <= mem_limit && granted_size >= in_mem_size)
     {
       return HASH_METH_IN_MEM;
     }
-  else if ((UINT64) llsidp->list_id->tuple_cnt * (sizeof (HENTRY_HLS) + sizeof (QFILE_TUPLE_SIMPLE_POS)) <= mem_limit)
+  else if (hybrid_size <= mem_limit && granted_size >= hybrid_size)
     {
-      /* bytes of 1 row = sizeof(HENTRY_HLS) + sizeof(QFILE_TUPLE_SIMPLE_POS) = 44 bytes (64bit) */
-      /* HENTRY_HLS = pointer(8bytes) * 4 = 32 bytes */
-      /* SIMPLE_POS = pageid(4bytes) + volid(2bytes) + padding(2bytes) + offset(4bytes) = 12 bytes */
+      qmgr_shrink_memory_grant (llsidp->hlsid.memory_grant, hybrid_size);
       return HASH_METH_HYBRID;
     }
   else
     {
+      qmgr_release_memory_grant (llsidp->hlsid.memory_grant);
+      db_private_free_and_init (thread_p, llsidp->hlsid.memory_grant);
       return HASH_METH_HASH_FILE;
     }
 
@@ -100,6 +100,8 @@ struct dblink_scan_id
   SCAN_PRED scan_pred;		/* scan predicates(filters) */
 };
 
+struct colcache_scan;
+
 typedef struct heap_scan_id HEAP_SCAN_ID;
 struct heap_scan_id
 {
@@ -118,6 +120,7 @@ struct heap_scan_id
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
   sampling_info sampling;	/* for sampling statistics */
+  struct colcache_scan *colscan;	/* columnar table read instead of the heap file, if any */
 };				/* Regular Heap File Scan Identifier */
 
 typedef struct heap_page_scan_id HEAP_PAGE_SCAN_ID;
@@ -321,6 +324,7 @@ struct scan_stats
   /* for heap & list scan */
   UINT64 read_rows;		/* # of rows read */
   UINT64 qualified_rows;	/* # of rows qualified by data filter */
+  bool columnar;		/* heap scan read from the columnar cache */
 
   /* for btree scan */
   UINT64 read_keys;		/* # of keys read */
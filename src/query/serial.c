@@ -40,6 +40,8 @@
 #include "slotted_page.h"
 #include "dbtype.h"
 #include "xasl_cache.h"
+#include "system_parameter.h"
+#include "thread_manager.hpp"
 
 #if !defined(SERVER_MODE)
 #define pthread_mutex_init(a, b)
@@ -71,6 +73,9 @@ typedef enum
 
 #define NCACHE_OBJECTS 100
 
+/* number of serials for which one thread can keep a prefetched range */
+#define SERIAL_PREFETCH_SLOTS 4
+
 #define NOT_FOUND -1
 
 typedef struct serial_entry SERIAL_CACHE_ENTRY;
@@ -94,6 +99,24 @@ struct serial_entry
   struct serial_entry *next;
 };
 
+/*
+ * Range of values of a cached serial reserved by one thread (see serial_prefetch_count). The range is taken from the
+ * cache entry under cache_pool_mutex; its values are then handed out by the owner thread alone, without any latch.
+ */
+typedef struct serial_prefetch_range SERIAL_PREFETCH_RANGE;
+struct serial_prefetch_range
+{
+  OID oid;			/* serial object identifier, null if the slot is free */
+  int version;			/* serial_Cache_pool.version when the range was taken */
+  int remaining;		/* number of values not handed out yet */
+
+  DB_VALUE cur_val;		/* last value handed out */
+  DB_VALUE inc_val;
+  DB_VALUE max_val;
+  DB_VALUE min_val;
+  DB_VALUE cyclic;
+};
+
 typedef struct serial_cache_area SERIAL_CACHE_AREA;
 struct serial_cache_area
 {
@@ -112,10 +135,15 @@ struct serial_cache_pool
 
   OID db_serial_class_oid;
   pthread_mutex_t cache_pool_mutex;
+
+  SERIAL_PREFETCH_RANGE *prefetch_ranges;	/* SERIAL_PREFETCH_SLOTS ranges for each thread */
+  int num_prefetch_threads;
+  volatile int version;		/* incremented by every decache; invalidates all prefetched ranges */
+  volatile bool has_uncached_serials;	/* serials without cache were cached for prefetching */
 };
 
 SERIAL_CACHE_POOL serial_Cache_pool = { NULL, NULL, NULL,
-  {NULL_PAGEID, NULL_SLOTID, NULL_VOLID}, PTHREAD_MUTEX_INITIALIZER
+  {NULL_PAGEID, NULL_SLOTID, NULL_VOLID}, PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, false
 };
 
 #if defined (SERVER_MODE)
@@ -127,8 +155,15 @@ int serial_Num_attrs = -1;
 
 static int xserial_get_current_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OID * serial_oidp);
 static int xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OID * serial_oidp,
-					    int num_alloc);
+					    int num_alloc, bool is_cache_locked);
 static int serial_get_next_cached_value (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc);
+static bool serial_get_next_prefetched_value (THREAD_ENTRY * thread_p, const OID * serial_oidp, int num_alloc,
+					      DB_VALUE * result_num);
+static bool serial_can_prefetch (SERIAL_CACHE_ENTRY * entry, int num_alloc);
+static bool serial_uses_cache (int cached_num);
+static int serial_prefetch_range (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc,
+				  DB_VALUE * result_num);
+static SERIAL_PREFETCH_RANGE *serial_get_prefetch_slots (THREAD_ENTRY * thread_p);
 static int serial_update_cur_val_of_serial (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc);
 static int serial_update_serial_object (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, RECDES * recdesc,
 					HEAP_CACHE_ATTRINFO * attr_info, const OID * serial_class_oidp,
@@ -165,7 +200,7 @@ xserial_get_current_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const
   assert (oid_p != NULL);
   assert (result_num != NULL);
 
-  if (cached_num <= 1)
+  if (!serial_uses_cache (cached_num))
     {
       /* not used serial cache */
       ret = xserial_get_current_value_internal (thread_p, result_num, oid_p);
@@ -306,10 +341,15 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       return ER_FAILED;
     }
 
-  if (cached_num <= 1)
+  if (!serial_uses_cache (cached_num))
     {
       /* not used serial cache */
-      ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc);
+      ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc, false);
+    }
+  else if (serial_get_next_prefetched_value (thread_p, oid_p, num_alloc, result_num))
+    {
+      /* served from the range prefetched by this thread */
+      assert (ret == NO_ERROR);
     }
   else
     {
@@ -321,7 +361,15 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       is_cache_mutex_locked = true;
 
       entry = (SERIAL_CACHE_ENTRY *) mht_get (serial_Cache_pool.ht, oid_p);
-      if (entry != NULL)
+      if (entry != NULL && serial_can_prefetch (entry, num_alloc))
+	{
+	  ret = serial_prefetch_range (thread_p, entry, num_alloc, result_num);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+      else if (entry != NULL)
 	{
 	  ret = serial_get_next_cached_value (thread_p, entry, num_alloc);
 	  if (ret != NO_ERROR)
@@ -369,7 +417,7 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
 		}
 	      else
 		{
-		  ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc);
+		  ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc, true);
 		  assert (is_oid_locked == true);
 		  (void) lock_unlock_object (thread_p, oid_p, &serial_Cache_pool.db_serial_class_oid, X_LOCK, true);
 		  is_oid_locked = false;
@@ -496,6 +544,225 @@ serial_get_next_cached_value (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entr
   return NO_ERROR;
 }
 
+/*
+ * serial_get_prefetch_slots () - get the prefetched ranges of current thread
+ *   return: array of SERIAL_PREFETCH_SLOTS ranges, or NULL if prefetching is not available
+ */
+static SERIAL_PREFETCH_RANGE *
+serial_get_prefetch_slots (THREAD_ENTRY * thread_p)
+{
+  int thread_index;
+
+  if (serial_Cache_pool.prefetch_ranges == NULL)
+    {
+      return NULL;
+    }
+
+  thread_index = thread_get_entry_index (thread_p);
+  if (thread_index < 0 || thread_index >= serial_Cache_pool.num_prefetch_threads)
+    {
+      return NULL;
+    }
+
+  return &serial_Cache_pool.prefetch_ranges[thread_index * SERIAL_PREFETCH_SLOTS];
+}
+
+/*
+ * serial_get_next_prefetched_value () - get next value from the range prefetched by current thread
+ *   return: true if the value was served from the range, false if the serial cache must be used
+ *   serial_oidp(in)  :
+ *   num_alloc(in)    :
+ *   result_num(out)  :
+ *
+ * Note: no latch is needed, the ranges of a thread are only accessed by the thread itself.
+ */
+static bool
+serial_get_next_prefetched_value (THREAD_ENTRY * thread_p, const OID * serial_oidp, int num_alloc,
+				  DB_VALUE * result_num)
+{
+  SERIAL_PREFETCH_RANGE *slots, *range;
+  DB_VALUE next_val;
+  int i;
+
+  if (prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT) <= 0)
+    {
+      return false;
+    }
+
+  slots = serial_get_prefetch_slots (thread_p);
+  if (slots == NULL)
+    {
+      return false;
+    }
+
+  for (i = 0; i < SERIAL_PREFETCH_SLOTS; i++)
+    {
+      range = &slots[i];
+      if (!OID_EQ (&range->oid, serial_oidp))
+	{
+	  continue;
+	}
+
+      if (range->version != ATOMIC_INC_32 (&serial_Cache_pool.version, 0))
+	{
+	  /* serial was altered or dropped; the rest of the range is lost */
+	  OID_SET_NULL (&range->oid);
+	  range->remaining = 0;
+	  return false;
+	}
+
+      if (range->remaining < num_alloc)
+	{
+	  return false;
+	}
+
+      if (serial_get_nth_value (&range->inc_val, &range->cur_val, &range->min_val, &range->max_val, &range->cyclic,
+				num_alloc, &next_val) != NO_ERROR)
+	{
+	  /* let the serial cache report the error */
+	  er_clear ();
+	  return false;
+	}
+
+      pr_clone_value (&next_val, &range->cur_val);
+      range->remaining -= num_alloc;
+
+      pr_clone_value (&range->cur_val, result_num);
+      return true;
+    }
+
+  return false;
+}
+
+/*
+ * serial_can_prefetch () - can the next values of a cached serial be served from per-thread ranges
+ *   return: true if ranges can be prefetched
+ *   entry(in)        :
+ *   num_alloc(in)    :
+ *
+ * Note: cyclic serials are excluded because a range could wrap around in the middle.
+ *       Near the end of the serial the range could cross max_val (min_val for a negative increment), so values are
+ *       then taken from the cache entry one allocation at a time, as without prefetching.
+ */
+static bool
+serial_can_prefetch (SERIAL_CACHE_ENTRY * entry, int num_alloc)
+{
+  int prefetch_count = prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT);
+  DB_VALUE end_val;
+
+  if (serial_Cache_pool.prefetch_ranges == NULL || num_alloc >= prefetch_count || entry->cached_num <= 1
+      || db_get_int (&entry->cyclic) != 0)
+    {
+      return false;
+    }
+
+  /* reserving prefetch_count values moves last_cached_val by less than prefetch_count + cached_num values */
+  if (prefetch_count > DB_INT32_MAX - entry->cached_num
+      || serial_get_nth_value (&entry->inc_val, &entry->last_cached_val, &entry->min_val, &entry->max_val,
+			       &entry->cyclic, prefetch_count + entry->cached_num, &end_val) != NO_ERROR)
+    {
+      /* too close to the end of the serial */
+      er_clear ();
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * serial_uses_cache () - are the values of a serial taken through the serial cache
+ *   return: true to look for the cache entry of the serial
+ *   cached_num(in)   : cached_num of the serial
+ *
+ * Note: with prefetching, serials without cache get a cache entry too (see xserial_get_next_value_internal). Once one
+ *       did, they all keep looking for their entry, even if prefetching is turned off meanwhile.
+ */
+static bool
+serial_uses_cache (int cached_num)
+{
+  if (cached_num > 1)
+    {
+      return true;
+    }
+
+  return (serial_Cache_pool.has_uncached_serials
+	  || (serial_Cache_pool.prefetch_ranges != NULL && prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT) > 1));
+}
+
+/*
+ * serial_prefetch_range () - reserve a range of values of a cached serial for current thread and get next value
+ *   return: NO_ERROR, or ER_status
+ *   entry(in/out)    : serial cache entry, cache_pool_mutex must be held
+ *   num_alloc(in)    :
+ *   result_num(out)  :
+ *
+ * Note: the range is reserved like a single allocation of serial_prefetch_count values, so db_serial is updated
+ *       only when the cache entry is exhausted, in multiples of cached_num.
+ */
+static int
+serial_prefetch_range (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, int num_alloc, DB_VALUE * result_num)
+{
+  SERIAL_PREFETCH_RANGE *slots, *range = NULL;
+  int prefetch_count = prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT);
+  int version = ATOMIC_INC_32 (&serial_Cache_pool.version, 0);
+  DB_VALUE start_val;
+  int error, i;
+
+  assert (serial_can_prefetch (entry, num_alloc));
+
+  slots = serial_get_prefetch_slots (thread_p);
+  if (slots == NULL)
+    {
+      error = serial_get_next_cached_value (thread_p, entry, num_alloc);
+      if (error == NO_ERROR)
+	{
+	  pr_clone_value (&entry->cur_val, result_num);
+	}
+      return error;
+    }
+
+  /* reuse the slot of this serial, otherwise the one with fewest values left */
+  for (i = 0; i < SERIAL_PREFETCH_SLOTS; i++)
+    {
+      if (OID_EQ (&slots[i].oid, &entry->oid))
+	{
+	  range = &slots[i];
+	  break;
+	}
+      if (range == NULL || OID_ISNULL (&slots[i].oid) || slots[i].version != version
+	  || slots[i].remaining < range->remaining)
+	{
+	  range = &slots[i];
+	}
+    }
+
+  pr_clone_value (&entry->cur_val, &start_val);
+
+  error = serial_get_next_cached_value (thread_p, entry, prefetch_count);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* the range is (start_val, entry->cur_val] */
+  COPY_OID (&range->oid, &entry->oid);
+  range->version = version;
+  range->remaining = prefetch_count;
+  pr_clone_value (&start_val, &range->cur_val);
+  pr_clone_value (&entry->inc_val, &range->inc_val);
+  pr_clone_value (&entry->max_val, &range->max_val);
+  pr_clone_value (&entry->min_val, &range->min_val);
+  pr_clone_value (&entry->cyclic, &range->cyclic);
+
+  if (!serial_get_next_prefetched_value (thread_p, &entry->oid, num_alloc, result_num))
+    {
+      assert (false);
+      return ER_FAILED;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * serial_update_cur_val_of_serial () -
  *                cur_val of db_serial is updated to last_cached_val of entry
@@ -629,9 +896,12 @@ exit_on_error:
  *   return: NO_ERROR, or ER_status
  *   result_num(out)    :
  *   serial_oidp(in)    :
+ *   num_alloc(in)    :
+ *   is_cache_locked(in) : cache_pool_mutex is held; a serial without cache may then be cached for prefetching
  */
 static int
-xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OID * serial_oidp, int num_alloc)
+xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OID * serial_oidp, int num_alloc,
+				 bool is_cache_locked)
 {
   int ret = NO_ERROR;
   HEAP_SCANCACHE scan_cache;
@@ -652,6 +922,7 @@ xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num,
   SERIAL_CACHE_ENTRY *entry = NULL;
   ATTR_ID attrid;
   OID serial_class_oid;
+  bool is_uncached_serial = false;
 
   bool is_started;
 
@@ -758,6 +1029,14 @@ xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num,
 
   db_make_null (&last_val);
 
+  if (cached_num <= 1 && is_cache_locked && db_get_int (&cyclic) == 0 && serial_Cache_pool.prefetch_ranges != NULL
+      && prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT) > 1)
+    {
+      /* prefetching serves serials without cache too, e.g. AUTO_INCREMENT; the cache entry is as big as a range */
+      cached_num = prm_get_integer_value (PRM_ID_SERIAL_PREFETCH_COUNT);
+      is_uncached_serial = true;
+    }
+
   is_started = db_get_int (&started);
 
   if (db_get_int (&started) == 0)
@@ -882,6 +1161,11 @@ xserial_get_next_value_internal (THREAD_ENTRY * thread_p, DB_VALUE * result_num,
 	      pr_share_value (&next_val, &cur_val);
 	      serial_set_cache_entry (entry, &inc_val, &cur_val, &min_val, &max_val, &started, &cyclic, &last_val,
 				      cached_num);
+	      if (is_uncached_serial)
+		{
+		  /* serials without cache must keep looking for their entry */
+		  serial_Cache_pool.has_uncached_serials = true;
+		}
 	    }
 	}
     }
@@ -1131,6 +1415,25 @@ serial_initialize_cache_pool (THREAD_ENTRY * thread_p)
 
   pthread_mutex_init (&serial_Cache_pool.cache_pool_mutex, NULL);
 
+  serial_Cache_pool.num_prefetch_threads = (int) thread_num_total_threads ();
+  serial_Cache_pool.prefetch_ranges =
+    (SERIAL_PREFETCH_RANGE *) malloc (serial_Cache_pool.num_prefetch_threads * SERIAL_PREFETCH_SLOTS
+				      * sizeof (SERIAL_PREFETCH_RANGE));
+  if (serial_Cache_pool.prefetch_ranges == NULL)
+    {
+      /* not critical, values are taken from the serial cache */
+      serial_Cache_pool.num_prefetch_threads = 0;
+    }
+  else
+    {
+      for (i = 0; i < (unsigned int) (serial_Cache_pool.num_prefetch_threads * SERIAL_PREFETCH_SLOTS); i++)
+	{
+	  OID_SET_NULL (&serial_Cache_pool.prefetch_ranges[i].oid);
+	  serial_Cache_pool.prefetch_ranges[i].version = 0;
+	  serial_Cache_pool.prefetch_ranges[i].remaining = 0;
+	}
+    }
+
   serial_Cache_pool.ht = mht_create ("Serial cache pool hash table", NCACHE_OBJECTS * 8, oid_hash, oid_compare_equals);
   if (serial_Cache_pool.ht == NULL)
     {
@@ -1172,6 +1475,12 @@ serial_finalize_cache_pool (void)
       free_and_init (tmp_area);
     }
 
+  if (serial_Cache_pool.prefetch_ranges != NULL)
+    {
+      free_and_init (serial_Cache_pool.prefetch_ranges);
+      serial_Cache_pool.num_prefetch_threads = 0;
+    }
+
   pthread_mutex_destroy (&serial_Cache_pool.cache_pool_mutex);
 
   serial_Num_attrs = -1;
@@ -1425,6 +1734,9 @@ xserial_decache (THREAD_ENTRY * thread_p, OID * oidp)
     {
       mht_rem (serial_Cache_pool.ht, oidp, NULL, NULL);
 
+      /* ranges already prefetched by threads must not be used anymore */
+      ATOMIC_INC_32 (&serial_Cache_pool.version, 1);
+
       OID_SET_NULL (&entry->oid);
       serial_clear_value (entry);
       entry->next = serial_Cache_pool.free_list;
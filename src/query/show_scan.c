@@ -60,6 +60,8 @@
 #include "server_support.h"
 #include "dbtype.h"
 #include "thread_manager.hpp"
+#include "monitor_active_session_history.hpp"
+#include "monitor_statement_statistics.hpp"
 
 typedef SCAN_CODE (*NEXT_SCAN_FUNC) (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt,
 				     void *ctx);
@@ -234,6 +236,18 @@ showstmt_scan_init (void)
   req->next_func = showstmt_array_next_scan;
   req->end_func = showstmt_array_end_scan;
 
+  req = &show_Requests[SHOWSTMT_ACTIVE_SESSION_HISTORY];
+  req->show_type = SHOWSTMT_ACTIVE_SESSION_HISTORY;
+  req->start_func = ash_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
+  req = &show_Requests[SHOWSTMT_STATEMENT_STATISTICS];
+  req->show_type = SHOWSTMT_STATEMENT_STATISTICS;
+  req->start_func = stmtstat_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
   /* append to init other show statement scan function here */
 
 
@@ -1789,6 +1789,7 @@ stx_build_xasl_node (THREAD_ENTRY * thread_p, char *ptr, XASL_NODE * xasl)
   ptr = or_unpack_int (ptr, (int *) &xasl->ordbynum_flag);
 
   xasl->topn_items = NULL;
+  xasl->sq_memo = NULL;
 
   ptr = or_unpack_int (ptr, &offset);
   if (offset == 0)
@@ -2502,6 +2503,7 @@ stx_build_method_sig (THREAD_ENTRY * thread_p, char *ptr, METHOD_SIG * method_si
 {
   int offset;
   int num_args, n;
+  int is_deterministic;
   XASL_UNPACK_INFO *xasl_unpack_info = get_xasl_unpack_info_ptr (thread_p);
 
   method_sig->method_name = stx_restore_string (thread_p, ptr);
@@ -2551,6 +2553,8 @@ stx_build_method_sig (THREAD_ENTRY * thread_p, char *ptr, METHOD_SIG * method_si
 	}
 
       ptr = or_unpack_int (ptr, &method_sig->arg_info.result_type);
+      ptr = or_unpack_int (ptr, &is_deterministic);
+      method_sig->arg_info.is_deterministic = (is_deterministic != 0);
     }
   else				/* method */
     {
@@ -0,0 +1,849 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// subquery_memo.cpp - results of correlated subqueries memoized by their correlated values
+//
+
+#include "subquery_memo.hpp"
+
+#include "dbtype.h"
+#include "list_file.h"
+#include "memory_hash.h"
+#include "object_domain.h"
+#include "object_primitive.h"
+#include "regu_var.hpp"
+#include "system_parameter.h"
+#include "xasl.h"
+#include "xasl_aggregate.hpp"
+#include "xasl_predicate.hpp"
+
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/* lookups between two checks of the hit ratio */
+#define SQ_MEMO_CHECK_LOOKUPS 1024
+
+/* a memo with a lower hit ratio is disabled */
+#define SQ_MEMO_MIN_HIT_PERCENT 20
+
+typedef struct sq_memo_entry SQ_MEMO_ENTRY;
+struct sq_memo_entry
+{
+  ~sq_memo_entry ()
+  {
+    for (DB_VALUE &value : key)
+      {
+	pr_clear_value (&value);
+      }
+    for (DB_VALUE &value : result)
+      {
+	pr_clear_value (&value);
+      }
+  }
+
+  std::vector<DB_VALUE> key;	/* copies of the correlated values */
+  std::vector<DB_VALUE> result;	/* copies of the single tuple values */
+  bool has_rows;		/* for EXISTS subqueries */
+};
+
+struct sq_memo
+{
+  SUBQUERY_RESULT_USE result_use;
+  std::vector<DB_VALUE *> key_values;	/* correlated values read by the subquery */
+
+  std::unordered_multimap<std::size_t, std::unique_ptr<SQ_MEMO_ENTRY>> entries;	/* by hash of key */
+  std::size_t memory_size;
+  std::size_t max_memory_size;
+
+  std::size_t lookup_hash;	/* hash of the key of the last miss */
+  int restored_has_rows;	/* EXISTS result restored by the last lookup; -1 if the subquery was executed */
+
+  UINT64 hits;
+  UINT64 misses;
+  bool is_disabled;
+};
+
+/* what the walker found in a subquery tree */
+struct sq_memo_analysis
+{
+  std::unordered_set<const xasl_node *> nodes;
+  std::unordered_set<const DB_VALUE *> produced_values;	/* values written by the subquery */
+  std::vector<DB_VALUE *> read_values;	/* values read by TYPE_CONSTANT regu variables */
+  bool is_eligible;
+};
+
+static void sq_memo_analyze_xasl (const xasl_node * xasl, sq_memo_analysis & analysis);
+static void sq_memo_analyze_spec (const ACCESS_SPEC_TYPE * spec, sq_memo_analysis & analysis);
+static void sq_memo_analyze_pred (const PRED_EXPR * pred, sq_memo_analysis & analysis);
+static void sq_memo_analyze_regu (const REGU_VARIABLE * regu, sq_memo_analysis & analysis);
+static void sq_memo_analyze_regu_list (const regu_variable_list_node * regu_list, sq_memo_analysis & analysis);
+static void sq_memo_analyze_val_list (const VAL_LIST * val_list, sq_memo_analysis & analysis);
+static bool sq_memo_is_deterministic_opcode (OPERATOR_TYPE opcode);
+static bool sq_memo_is_supported_key (const DB_VALUE * value);
+static bool sq_memo_key_value_equal (const DB_VALUE * value1, const DB_VALUE * value2);
+static std::size_t sq_memo_key_entry_size (const std::vector<DB_VALUE> &values);
+static void sq_memo_disable (SQ_MEMO * memo);
+
+/*
+ * sq_memo_analyze_val_list () - values of a value list are produced by the subquery
+ */
+static void
+sq_memo_analyze_val_list (const VAL_LIST * val_list, sq_memo_analysis & analysis)
+{
+  if (val_list == NULL)
+    {
+      return;
+    }
+  for (QPROC_DB_VALUE_LIST value = val_list->valp; value != NULL; value = value->next)
+    {
+      analysis.produced_values.insert (value->val);
+    }
+}
+
+/*
+ * sq_memo_is_deterministic_opcode () - does the operator return the same value for the same operands within a query,
+ *					without side effects?
+ */
+static bool
+sq_memo_is_deterministic_opcode (OPERATOR_TYPE opcode)
+{
+  switch (opcode)
+    {
+    case T_RAND:
+    case T_DRAND:
+    case T_RANDOM:
+    case T_DRANDOM:
+    case T_SYS_GUID:
+    case T_NEXT_VALUE:
+    case T_CURRENT_VALUE:
+    case T_INCR:
+    case T_DECR:
+    case T_ROW_COUNT:
+    case T_LAST_INSERT_ID:
+    case T_EVALUATE_VARIABLE:
+    case T_DEFINE_VARIABLE:
+    case T_EXEC_STATS:
+    case T_TRACE_STATS:
+    case T_SLEEP:
+    case T_LIST_DBS:
+    case T_PRIOR:
+    case T_QPRIOR:
+    case T_CONNECT_BY_ROOT:
+    case T_SYS_CONNECT_BY_PATH:
+      return false;
+    default:
+      return true;
+    }
+}
+
+/*
+ * sq_memo_analyze_regu () - walk a regu variable tree
+ */
+static void
+sq_memo_analyze_regu (const REGU_VARIABLE * regu, sq_memo_analysis & analysis)
+{
+  if (regu == NULL || !analysis.is_eligible)
+    {
+      return;
+    }
+
+  if (regu->vfetch_to != NULL)
+    {
+      analysis.produced_values.insert (regu->vfetch_to);
+    }
+  if (regu->xasl != NULL)
+    {
+      /* nested subquery */
+      sq_memo_analyze_xasl (regu->xasl, analysis);
+    }
+
+  switch (regu->type)
+    {
+    case TYPE_CONSTANT:
+      if (regu->value.dbvalptr != NULL)
+	{
+	  analysis.read_values.push_back (regu->value.dbvalptr);
+	}
+      break;
+
+    case TYPE_ORDERBY_NUM:
+      analysis.produced_values.insert (regu->value.dbvalptr);
+      break;
+
+    case TYPE_INARITH:
+    case TYPE_OUTARITH:
+      if (regu->value.arithptr == NULL || !sq_memo_is_deterministic_opcode (regu->value.arithptr->opcode))
+	{
+	  analysis.is_eligible = false;
+	  return;
+	}
+      analysis.produced_values.insert (regu->value.arithptr->value);
+      sq_memo_analyze_regu (regu->value.arithptr->leftptr, analysis);
+      sq_memo_analyze_regu (regu->value.arithptr->rightptr, analysis);
+      sq_memo_analyze_regu (regu->value.arithptr->thirdptr, analysis);
+      sq_memo_analyze_pred (regu->value.arithptr->pred, analysis);
+      break;
+
+    case TYPE_FUNC:
+      if (regu->value.funcp == NULL || regu->value.funcp->ftype == F_GENERIC || regu->value.funcp->ftype == F_VID
+	  || regu->value.funcp->ftype == F_BENCHMARK)
+	{
+	  analysis.is_eligible = false;
+	  return;
+	}
+      analysis.produced_values.insert (regu->value.funcp->value);
+      sq_memo_analyze_regu_list (regu->value.funcp->operand, analysis);
+      break;
+
+    case TYPE_REGUVAL_LIST:
+      for (const REGU_VALUE_ITEM * item = regu->value.reguval_list->regu_list; item != NULL; item = item->next)
+	{
+	  sq_memo_analyze_regu (item->value, analysis);
+	}
+      break;
+
+    case TYPE_REGU_VAR_LIST:
+      sq_memo_analyze_regu_list (regu->value.regu_var_list, analysis);
+      break;
+
+    default:
+      /* attributes, list positions, host variables and literals */
+      break;
+    }
+}
+
+/*
+ * sq_memo_analyze_regu_list () - walk a list of regu variables
+ */
+static void
+sq_memo_analyze_regu_list (const regu_variable_list_node * regu_list, sq_memo_analysis & analysis)
+{
+  for (; regu_list != NULL && analysis.is_eligible; regu_list = regu_list->next)
+    {
+      sq_memo_analyze_regu (&regu_list->value, analysis);
+    }
+}
+
+/*
+ * sq_memo_analyze_pred () - walk a predicate
+ */
+static void
+sq_memo_analyze_pred (const PRED_EXPR * pred, sq_memo_analysis & analysis)
+{
+  if (pred == NULL || !analysis.is_eligible)
+    {
+      return;
+    }
+
+  switch (pred->type)
+    {
+    case T_PRED:
+      sq_memo_analyze_pred (pred->pe.m_pred.lhs, analysis);
+      sq_memo_analyze_pred (pred->pe.m_pred.rhs, analysis);
+      break;
+
+    case T_EVAL_TERM:
+      switch (pred->pe.m_eval_term.et_type)
+	{
+	case T_COMP_EVAL_TERM:
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_comp.lhs, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_comp.rhs, analysis);
+	  break;
+	case T_ALSM_EVAL_TERM:
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_alsm.elem, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_alsm.elemset, analysis);
+	  break;
+	case T_LIKE_EVAL_TERM:
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_like.src, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_like.pattern, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_like.esc_char, analysis);
+	  break;
+	case T_RLIKE_EVAL_TERM:
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_rlike.src, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_rlike.pattern, analysis);
+	  sq_memo_analyze_regu (pred->pe.m_eval_term.et.et_rlike.case_sensitive, analysis);
+	  break;
+	default:
+	  analysis.is_eligible = false;
+	  break;
+	}
+      break;
+
+    case T_NOT_TERM:
+      sq_memo_analyze_pred (pred->pe.m_not_term, analysis);
+      break;
+
+    default:
+      analysis.is_eligible = false;
+      break;
+    }
+}
+
+/*
+ * sq_memo_analyze_spec () - walk the access specifications of a subquery block
+ *
+ * Note: only heap, index and list file scans are known to the walker.
+ */
+static void
+sq_memo_analyze_spec (const ACCESS_SPEC_TYPE * spec, sq_memo_analysis & analysis)
+{
+  for (; spec != NULL && analysis.is_eligible; spec = spec->next)
+    {
+      sq_memo_analyze_pred (spec->where_key, analysis);
+      sq_memo_analyze_pred (spec->where_pred, analysis);
+      sq_memo_analyze_pred (spec->where_range, analysis);
+
+      switch (spec->type)
+	{
+	case TARGET_CLASS:
+	  {
+	    const CLS_SPEC_TYPE *cls_node = &spec->s.cls_node;
+
+	    if (spec->access != ACCESS_METHOD_SEQUENTIAL && spec->access != ACCESS_METHOD_INDEX)
+	      {
+		analysis.is_eligible = false;
+		return;
+	      }
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_list_key, analysis);
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_list_pred, analysis);
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_list_rest, analysis);
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_list_range, analysis);
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_val_list, analysis);
+	    sq_memo_analyze_regu_list (cls_node->cls_regu_list_reserved, analysis);
+	    if (cls_node->cls_output_val_list != NULL)
+	      {
+		sq_memo_analyze_regu_list (cls_node->cls_output_val_list->valptrp, analysis);
+	      }
+	    for (int i = 0; i < cls_node->num_attrs_reserved; i++)
+	      {
+		analysis.produced_values.insert (cls_node->cache_reserved[i]);
+	      }
+	  }
+	  break;
+
+	case TARGET_LIST:
+	  sq_memo_analyze_regu_list (spec->s.list_node.list_regu_list_pred, analysis);
+	  sq_memo_analyze_regu_list (spec->s.list_node.list_regu_list_rest, analysis);
+	  sq_memo_analyze_regu_list (spec->s.list_node.list_regu_list_build, analysis);
+	  sq_memo_analyze_regu_list (spec->s.list_node.list_regu_list_probe, analysis);
+	  sq_memo_analyze_xasl (spec->s.list_node.xasl_node, analysis);
+	  break;
+
+	default:
+	  analysis.is_eligible = false;
+	  return;
+	}
+
+      if (spec->indexptr != NULL)
+	{
+	  const KEY_INFO *key_info = &spec->indexptr->key_info;
+
+	  for (int i = 0; i < key_info->key_cnt; i++)
+	    {
+	      sq_memo_analyze_regu (key_info->key_ranges[i].key1, analysis);
+	      sq_memo_analyze_regu (key_info->key_ranges[i].key2, analysis);
+	    }
+	  sq_memo_analyze_regu (key_info->key_limit_l, analysis);
+	  sq_memo_analyze_regu (key_info->key_limit_u, analysis);
+	  sq_memo_analyze_regu (spec->indexptr->iss_range.key1, analysis);
+	  sq_memo_analyze_regu (spec->indexptr->iss_range.key2, analysis);
+	}
+    }
+}
+
+/*
+ * sq_memo_analyze_xasl () - walk a subquery block and the blocks it depends on
+ *
+ * Note: plain selects, aggregate selects without GROUP BY and their joins are known to the walker; any other block
+ *	 type makes the subquery ineligible.
+ */
+static void
+sq_memo_analyze_xasl (const xasl_node * xasl, sq_memo_analysis & analysis)
+{
+  if (xasl == NULL || !analysis.is_eligible || !analysis.nodes.insert (xasl).second)
+    {
+      return;
+    }
+
+  if (xasl->bptr_list != NULL || xasl->fptr_list != NULL || xasl->connect_by_ptr != NULL
+      || xasl->merge_spec != NULL || XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
+    {
+      analysis.is_eligible = false;
+      return;
+    }
+
+  switch (xasl->type)
+    {
+    case BUILDLIST_PROC:
+      if (xasl->proc.buildlist.groupby_list != NULL || xasl->proc.buildlist.a_eval_list != NULL
+	  || xasl->proc.buildlist.eptr_list != NULL)
+	{
+	  analysis.is_eligible = false;
+	  return;
+	}
+      break;
+
+    case BUILDVALUE_PROC:
+      sq_memo_analyze_pred (xasl->proc.buildvalue.having_pred, analysis);
+      analysis.produced_values.insert (xasl->proc.buildvalue.grbynum_val);
+      for (const AGGREGATE_TYPE * agg = xasl->proc.buildvalue.agg_list; agg != NULL; agg = agg->next)
+	{
+	  if (QPROC_IS_INTERPOLATION_FUNC (agg) || agg->function == PT_CUME_DIST || agg->function == PT_PERCENT_RANK)
+	    {
+	      analysis.is_eligible = false;
+	      return;
+	    }
+	  analysis.produced_values.insert (agg->accumulator.value);
+	  analysis.produced_values.insert (agg->accumulator.value2);
+	  sq_memo_analyze_regu_list (agg->operands, analysis);
+	}
+      if (xasl->proc.buildvalue.outarith_list != NULL)
+	{
+	  const ARITH_TYPE *arith = xasl->proc.buildvalue.outarith_list;
+
+	  if (!sq_memo_is_deterministic_opcode (arith->opcode))
+	    {
+	      analysis.is_eligible = false;
+	      return;
+	    }
+	  analysis.produced_values.insert (arith->value);
+	  sq_memo_analyze_regu (arith->leftptr, analysis);
+	  sq_memo_analyze_regu (arith->rightptr, analysis);
+	  sq_memo_analyze_regu (arith->thirdptr, analysis);
+	  sq_memo_analyze_pred (arith->pred, analysis);
+	}
+      break;
+
+    case SCAN_PROC:
+      break;
+
+    default:
+      analysis.is_eligible = false;
+      return;
+    }
+
+  sq_memo_analyze_val_list (xasl->val_list, analysis);
+  sq_memo_analyze_val_list (xasl->single_tuple, analysis);
+  analysis.produced_values.insert (xasl->instnum_val);
+  analysis.produced_values.insert (xasl->save_instnum_val);
+  analysis.produced_values.insert (xasl->ordbynum_val);
+
+  if (xasl->outptr_list != NULL)
+    {
+      sq_memo_analyze_regu_list (xasl->outptr_list->valptrp, analysis);
+    }
+  sq_memo_analyze_spec (xasl->spec_list, analysis);
+  sq_memo_analyze_pred (xasl->after_join_pred, analysis);
+  sq_memo_analyze_pred (xasl->if_pred, analysis);
+  sq_memo_analyze_pred (xasl->instnum_pred, analysis);
+  sq_memo_analyze_pred (xasl->ordbynum_pred, analysis);
+  sq_memo_analyze_regu (xasl->orderby_limit, analysis);
+  sq_memo_analyze_regu (xasl->limit_offset, analysis);
+  sq_memo_analyze_regu (xasl->limit_row_count, analysis);
+
+  for (const xasl_node * xptr = xasl->aptr_list; xptr != NULL; xptr = xptr->next)
+    {
+      sq_memo_analyze_xasl (xptr, analysis);
+    }
+  for (const xasl_node * xptr = xasl->dptr_list; xptr != NULL; xptr = xptr->next)
+    {
+      sq_memo_analyze_xasl (xptr, analysis);
+    }
+  sq_memo_analyze_xasl (xasl->scan_ptr, analysis);
+}
+
+/*
+ * sq_memo_create () - create the memo of a correlated subquery
+ *   return: memo; disabled if the subquery cannot be memoized, NULL if out of memory
+ *   thread_p(in): thread entry
+ *   xasl(in): subquery linked to a regu variable
+ *   result_use(in): how the result of the subquery is read
+ */
+SQ_MEMO *
+sq_memo_create (THREAD_ENTRY * thread_p, xasl_node * xasl, SUBQUERY_RESULT_USE result_use)
+{
+  sq_memo_analysis analysis;
+  SQ_MEMO *memo;
+
+  memo = new (std::nothrow) SQ_MEMO ();
+  if (memo == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (SQ_MEMO));
+      return NULL;
+    }
+
+  memo->result_use = result_use;
+  memo->memory_size = 0;
+  memo->max_memory_size = (std::size_t) prm_get_bigint_value (PRM_ID_MAX_SUBQUERY_MEMO_SIZE);
+  memo->lookup_hash = 0;
+  memo->restored_has_rows = -1;
+  memo->hits = 0;
+  memo->misses = 0;
+  memo->is_disabled = true;
+
+  if (memo->max_memory_size == 0)
+    {
+      return memo;
+    }
+  if (result_use == SUBQUERY_RESULT_VALUE && (!xasl->is_single_tuple || xasl->single_tuple == NULL))
+    {
+      return memo;
+    }
+  if (result_use == SUBQUERY_RESULT_EXISTS && xasl->list_id == NULL)
+    {
+      return memo;
+    }
+  if (result_use == SUBQUERY_RESULT_LIST)
+    {
+      /* list files are not memoized */
+      return memo;
+    }
+
+  analysis.is_eligible = true;
+  sq_memo_analyze_xasl (xasl, analysis);
+  if (!analysis.is_eligible)
+    {
+      return memo;
+    }
+
+  // *INDENT-OFF*
+  std::unordered_set<const DB_VALUE *> added_values;
+  // *INDENT-ON*
+  for (DB_VALUE * value:analysis.read_values)
+    {
+      if (analysis.produced_values.find (value) == analysis.produced_values.end ()
+	  && added_values.insert (value).second)
+	{
+	  memo->key_values.push_back (value);
+	}
+    }
+
+  memo->is_disabled = false;
+  return memo;
+}
+
+/*
+ * sq_memo_destroy () - free a memo and the results it holds
+ */
+void
+sq_memo_destroy (SQ_MEMO * memo)
+{
+  delete memo;
+}
+
+/*
+ * sq_memo_is_supported_key () - can the value be compared exactly?
+ */
+static bool
+sq_memo_is_supported_key (const DB_VALUE * value)
+{
+  if (DB_IS_NULL (value))
+    {
+      return true;
+    }
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_OID:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * sq_memo_key_value_equal () - are two correlated values the same value?
+ *
+ * Note: strings are compared as bytes; values that are equal by collation may give a subquery different results.
+ */
+static bool
+sq_memo_key_value_equal (const DB_VALUE * value1, const DB_VALUE * value2)
+{
+  if (DB_IS_NULL (value1) || DB_IS_NULL (value2))
+    {
+      return DB_IS_NULL (value1) && DB_IS_NULL (value2);
+    }
+  if (DB_VALUE_TYPE (value1) != DB_VALUE_TYPE (value2))
+    {
+      return false;
+    }
+
+  switch (DB_VALUE_TYPE (value1))
+    {
+    case DB_TYPE_FLOAT:
+      {
+	float f1 = db_get_float (value1), f2 = db_get_float (value2);
+	return std::memcmp (&f1, &f2, sizeof (float)) == 0;
+      }
+    case DB_TYPE_DOUBLE:
+      {
+	double d1 = db_get_double (value1), d2 = db_get_double (value2);
+	return std::memcmp (&d1, &d2, sizeof (double)) == 0;
+      }
+    case DB_TYPE_NUMERIC:
+      return (DB_VALUE_PRECISION (value1) == DB_VALUE_PRECISION (value2)
+	      && DB_VALUE_SCALE (value1) == DB_VALUE_SCALE (value2)
+	      && std::memcmp (db_get_numeric (value1), db_get_numeric (value2), DB_NUMERIC_BUF_SIZE) == 0);
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return (db_get_string_collation (value1) == db_get_string_collation (value2)
+	      && db_get_string_size (value1) == db_get_string_size (value2)
+	      && std::memcmp (db_get_string (value1), db_get_string (value2), db_get_string_size (value1)) == 0);
+    default:
+      return tp_value_compare (value1, value2, 0, 1) == DB_EQ;
+    }
+}
+
+/*
+ * sq_memo_key_entry_size () - memory used by copies of values
+ */
+static std::size_t
+sq_memo_key_entry_size (const std::vector<DB_VALUE> &values)
+{
+  std::size_t size = 0;
+
+  for (const DB_VALUE &value : values)
+    {
+      size += sizeof (DB_VALUE);
+      if (!DB_IS_NULL (&value) && pr_is_variable_type (DB_VALUE_TYPE (&value)))
+	{
+	  size += pr_value_mem_size (&value);
+	}
+    }
+  return size;
+}
+
+/*
+ * sq_memo_disable () - stop memoizing a subquery and free the stored results
+ */
+static void
+sq_memo_disable (SQ_MEMO * memo)
+{
+  memo->is_disabled = true;
+  memo->entries.clear ();
+  memo->memory_size = 0;
+  memo->restored_has_rows = -1;
+}
+
+/*
+ * sq_memo_lookup () - restore the result of a subquery executed earlier with the same correlated values
+ *   return: SQ_MEMO_HIT if the result was restored, SQ_MEMO_MISS if the subquery must be executed and its result
+ *	     given to sq_memo_store, SQ_MEMO_BYPASS if it must be executed only
+ *   thread_p(in): thread entry
+ *   memo(in): memo of the subquery
+ *   xasl(in): subquery
+ *   result_use(in): how the result of the subquery is read
+ */
+SQ_MEMO_LOOKUP_RESULT
+sq_memo_lookup (THREAD_ENTRY * thread_p, SQ_MEMO * memo, xasl_node * xasl, SUBQUERY_RESULT_USE result_use)
+{
+  std::size_t hash = 0;
+  UINT64 lookups;
+
+  memo->restored_has_rows = -1;
+
+  if (memo->is_disabled)
+    {
+      return SQ_MEMO_BYPASS;
+    }
+  if (result_use != memo->result_use)
+    {
+      /* the subquery is read in more than one way */
+      sq_memo_disable (memo);
+      return SQ_MEMO_BYPASS;
+    }
+
+  lookups = memo->hits + memo->misses;
+  if (lookups > 0 && lookups % SQ_MEMO_CHECK_LOOKUPS == 0 && memo->hits * 100 < lookups * SQ_MEMO_MIN_HIT_PERCENT)
+    {
+      /* the outer rows rarely repeat the correlated values */
+      sq_memo_disable (memo);
+      return SQ_MEMO_BYPASS;
+    }
+
+  for (DB_VALUE * value : memo->key_values)
+    {
+      if (!sq_memo_is_supported_key (value))
+	{
+	  return SQ_MEMO_BYPASS;
+	}
+      hash = hash * 31 + (DB_IS_NULL (value) ? 0 : mht_valhash (value, UINT_MAX));
+    }
+
+  // *INDENT-OFF*
+  auto range = memo->entries.equal_range (hash);
+  for (auto it = range.first; it != range.second; ++it)
+    {
+      SQ_MEMO_ENTRY *entry = it->second.get ();
+      std::size_t i;
+
+      for (i = 0; i < memo->key_values.size (); i++)
+	{
+	  if (!sq_memo_key_value_equal (memo->key_values[i], &entry->key[i]))
+	    {
+	      break;
+	    }
+	}
+      if (i < memo->key_values.size ())
+	{
+	  continue;
+	}
+
+      /* found */
+      if (memo->result_use == SUBQUERY_RESULT_EXISTS)
+	{
+	  memo->restored_has_rows = entry->has_rows ? 1 : 0;
+	}
+      else
+	{
+	  QPROC_DB_VALUE_LIST value_list = xasl->single_tuple->valp;
+
+	  for (i = 0; i < entry->result.size () && value_list != NULL; i++, value_list = value_list->next)
+	    {
+	      pr_clear_value (value_list->val);
+	      if (pr_clone_value (&entry->result[i], value_list->val) != NO_ERROR)
+		{
+		  ASSERT_ERROR ();
+		  er_clear ();
+		  return SQ_MEMO_BYPASS;
+		}
+	    }
+	}
+      memo->hits++;
+      return SQ_MEMO_HIT;
+    }
+  // *INDENT-ON*
+
+  memo->misses++;
+  memo->lookup_hash = hash;
+  return SQ_MEMO_MISS;
+}
+
+/*
+ * sq_memo_store () - store the result of a subquery execution after a miss
+ *   return: void
+ *   thread_p(in): thread entry
+ *   memo(in): memo of the subquery
+ *   xasl(in): executed subquery
+ *
+ * Note: the correlated values did not change since the lookup. Results are not stored once the memo is full.
+ */
+void
+sq_memo_store (THREAD_ENTRY * thread_p, SQ_MEMO * memo, xasl_node * xasl)
+{
+  // *INDENT-OFF*
+  std::unique_ptr<SQ_MEMO_ENTRY> entry (new (std::nothrow) SQ_MEMO_ENTRY ());
+  // *INDENT-ON*
+  std::size_t size;
+  DB_VALUE copy;
+
+  if (memo->is_disabled || entry == NULL)
+    {
+      return;
+    }
+
+  entry->key.reserve (memo->key_values.size ());
+  for (DB_VALUE * value : memo->key_values)
+    {
+      if (pr_clone_value (value, &copy) != NO_ERROR)
+	{
+	  er_clear ();
+	  return;
+	}
+      entry->key.push_back (copy);
+    }
+
+  if (memo->result_use == SUBQUERY_RESULT_EXISTS)
+    {
+      entry->has_rows = xasl->list_id->tuple_cnt > 0;
+    }
+  else
+    {
+      entry->has_rows = false;
+      entry->result.reserve (xasl->single_tuple->val_cnt);
+      for (QPROC_DB_VALUE_LIST value_list = xasl->single_tuple->valp; value_list != NULL;
+	   value_list = value_list->next)
+	{
+	  if (pr_clone_value (value_list->val, &copy) != NO_ERROR)
+	    {
+	      er_clear ();
+	      return;
+	    }
+	  entry->result.push_back (copy);
+	}
+    }
+
+  size = sizeof (SQ_MEMO_ENTRY) + sq_memo_key_entry_size (entry->key) + sq_memo_key_entry_size (entry->result);
+  if (memo->memory_size + size > memo->max_memory_size)
+    {
+      /* full; keep serving the stored results */
+      return;
+    }
+
+  memo->memory_size += size;
+  memo->entries.emplace (memo->lookup_hash, std::move (entry));
+}
+
+/*
+ * sq_memo_get_restored_exists () - get the EXISTS result restored by the last lookup
+ *   return: false if the subquery was executed and its list file holds the result
+ *   memo(in): memo of an EXISTS subquery
+ *   has_rows(out): restored result
+ */
+bool
+sq_memo_get_restored_exists (const SQ_MEMO * memo, bool * has_rows)
+{
+  if (memo->restored_has_rows < 0)
+    {
+      return false;
+    }
+  *has_rows = memo->restored_has_rows != 0;
+  return true;
+}
+
+/*
+ * sq_memo_get_stats () - get the memo statistics shown in the query trace
+ */
+void
+sq_memo_get_stats (const SQ_MEMO * memo, UINT64 * hits, UINT64 * misses, bool * is_disabled)
+{
+  *hits = memo->hits;
+  *misses = memo->misses;
+  *is_disabled = memo->is_disabled;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// subquery_memo.hpp - results of correlated subqueries memoized by their correlated values
+//
+//  A correlated subquery linked to a regu variable is executed again for each row of the outer query. When the outer
+//  rows repeat the values the subquery is correlated on, the memo of the subquery returns the result of an earlier
+//  execution instead. Scalar subqueries memoize their single tuple values and EXISTS subqueries whether they have a
+//  row.
+//
+//  The correlated values are found once per execution by walking the subquery XASL tree: they are the values read by
+//  TYPE_CONSTANT regu variables that are not produced inside the subquery. Subqueries whose shape is not fully known
+//  to the walker, or which call non-deterministic or side-effecting operators, are never memoized.
+//
+//  A memo lives for one execution of the outer query and is bounded by max_subquery_memo_size. It disables itself
+//  when its hit ratio is too low to pay for building the keys.
+//
+
+#ifndef _SUBQUERY_MEMO_HPP_
+#define _SUBQUERY_MEMO_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "dbtype_def.h"
+#include "query_executor.h"
+#include "thread_compat.hpp"
+
+// forward definitions
+struct xasl_node;
+
+typedef struct sq_memo SQ_MEMO;
+
+typedef enum
+{
+  SQ_MEMO_HIT,			/* the result of the subquery was restored from the memo */
+  SQ_MEMO_MISS,			/* the subquery must be executed; its result can be stored */
+  SQ_MEMO_BYPASS		/* the subquery must be executed; its result is not stored */
+} SQ_MEMO_LOOKUP_RESULT;
+
+extern SQ_MEMO *sq_memo_create (THREAD_ENTRY * thread_p, xasl_node * xasl, SUBQUERY_RESULT_USE result_use);
+extern void sq_memo_destroy (SQ_MEMO * memo);
+
+extern SQ_MEMO_LOOKUP_RESULT sq_memo_lookup (THREAD_ENTRY * thread_p, SQ_MEMO * memo, xasl_node * xasl,
+					     SUBQUERY_RESULT_USE result_use);
+extern void sq_memo_store (THREAD_ENTRY * thread_p, SQ_MEMO * memo, xasl_node * xasl);
+extern bool sq_memo_get_restored_exists (const SQ_MEMO * memo, bool * has_rows);
+
+extern void sq_memo_get_stats (const SQ_MEMO * memo, UINT64 * hits, UINT64 * misses, bool * is_disabled);
+
+#endif // _SUBQUERY_MEMO_HPP_
@@ -155,6 +155,8 @@ typedef struct xasl_stat XASL_STATS;
 typedef struct topn_tuple TOPN_TUPLE;
 typedef struct topn_tuples TOPN_TUPLES;
 
+typedef struct sq_memo SQ_MEMO;
+
 // *INDENT-OFF*
 namespace cubquery
 {
@@ -501,6 +503,10 @@ struct cte_proc_node
 #define XASL_CLEAR_FLAG(x, f)       (x)->flag &= (int) ~(f)
 
 #define EXECUTE_REGU_VARIABLE_XASL(thread_p, r, v) \
+  EXECUTE_REGU_VARIABLE_XASL_FOR_USE (thread_p, r, v, \
+				      ((r)->type == TYPE_CONSTANT ? SUBQUERY_RESULT_VALUE : SUBQUERY_RESULT_LIST))
+
+#define EXECUTE_REGU_VARIABLE_XASL_FOR_USE(thread_p, r, v, use) \
   do \
     { \
       XASL_NODE *_x = (r)->xasl; \
@@ -514,7 +520,7 @@ struct cte_proc_node
 	      if ((_x)->status == XASL_CLEARED || (_x)->status == XASL_INITIALIZED) \
 		{ \
 		  /* execute xasl query */ \
-		  if (qexec_execute_mainblock ((thread_p), _x, (v)->xasl_state, NULL) != NO_ERROR) \
+		  if (qexec_execute_subquery ((thread_p), _x, (v)->xasl_state, (use)) != NO_ERROR) \
 		    { \
 		      (_x)->status = XASL_FAILURE; \
 		    } \
@@ -1077,6 +1083,7 @@ struct xasl_node
   TOPN_TUPLES *topn_items;	/* top-n tuples for orderby limit */
 
   XASL_STATUS status;		/* current status */
+  SQ_MEMO *sq_memo;		/* results of a correlated subquery by correlated values; per execution */
 
   int query_in_progress;	/* flag which tells if the query is currently executing.  Used by
 				 * qmgr_clear_trans_wakeup() to determine how much of the xasl tree to clean up. */
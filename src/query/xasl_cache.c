@@ -452,6 +452,7 @@ xcache_entry_init (void *entry)
   xcache_entry->sql_info.sql_hash_text = NULL;
   xcache_entry->sql_info.sql_user_text = NULL;
   xcache_entry->sql_info.sql_plan_text = NULL;
+  xcache_entry->sql_id = 0;
 
   XASL_ID_SET_NULL (&xcache_entry->xasl_id);
   xcache_entry->stream.xasl_id = NULL;
@@ -1364,6 +1365,7 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
   struct timeval time_stored;
   size_t sql_hash_text_len = 0, sql_user_text_len = 0, sql_plan_text_len = 0;
   char *strbuf = NULL;
+  UINT64 sql_id;
 
   assert (xcache_entry != NULL && *xcache_entry == NULL);
   assert (stream != NULL);
@@ -1436,6 +1438,9 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
       sql_plan_text = strbuf;
     }
 
+  /* computed once here so that executions can publish it without hashing the text again */
+  sql_id = qmgr_get_sql_id_value (sql_hash_text, sql_hash_text_len - 1);
+
   /* save stored time */
   (void) gettimeofday (&time_stored, NULL);
   CACHE_TIME_MAKE (&stream->xasl_id->time_stored, &time_stored);
@@ -1473,6 +1478,7 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
       (*xcache_entry)->sql_info.sql_hash_text = sql_hash_text;
       (*xcache_entry)->sql_info.sql_user_text = sql_user_text;
       (*xcache_entry)->sql_info.sql_plan_text = sql_plan_text;
+      (*xcache_entry)->sql_id = sql_id;
       (*xcache_entry)->stream = *stream;
       (*xcache_entry)->time_last_rt_check = (INT64) time_stored.tv_sec;
       (*xcache_entry)->time_last_used = time_stored;
@@ -101,6 +101,7 @@ struct xasl_cache_ent
 
 
   EXECUTION_INFO sql_info;	/* cache entry hash key, user input string & plan */
+  UINT64 sql_id;		/* SQL_ID of sql_hash_text as a number (see qmgr_get_sql_id_value) */
   int xasl_header_flag;		/* XASL header info */
   XCACHE_RELATED_OBJECT *related_objects;	/* List of objects referenced by XASL cache entry.
 						 * Objects can be:
@@ -5751,6 +5751,7 @@ xts_process_method_sig (char *ptr, const METHOD_SIG * method_sig, int count)
 	}
 
       ptr = or_pack_int (ptr, method_sig->arg_info.result_type);
+      ptr = or_pack_int (ptr, method_sig->arg_info.is_deterministic ? 1 : 0);
     }
   else
     {
@@ -7499,7 +7500,8 @@ xts_sizeof_method_sig (const METHOD_SIG * method_sig)
     {
       size += ((method_sig->num_method_args * OR_INT_SIZE)	/* arg_mode */
 	       + (method_sig->num_method_args * OR_INT_SIZE)	/* arg_type */
-	       + (OR_INT_SIZE));	/* result type */
+	       + (OR_INT_SIZE)	/* result type */
+	       + (OR_INT_SIZE));	/* is_deterministic */
     }
   else
     {
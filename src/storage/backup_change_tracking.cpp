@@ -0,0 +1,824 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// backup_change_tracking.cpp - bitmaps of the pages changed since the last backups, read by incremental backups
+//
+
+#include "backup_change_tracking.hpp"
+
+#include "error_manager.h"
+#include "log_impl.h"
+#include "log_volids.hpp"
+#include "porting.h"
+#include "system_parameter.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+/* change maps of the backup levels incremental backups are based on: full (0) and big increment (1) */
+#define BCT_NUM_MAPS 2
+
+/* the bitmap of a volume is allocated in chunks, when the first page of the chunk is written */
+#define BCT_CHUNK_NPAGES_LOG2 18
+#define BCT_CHUNK_NPAGES (1 << BCT_CHUNK_NPAGES_LOG2)
+#define BCT_CHUNK_NWORDS (BCT_CHUNK_NPAGES / 64)
+
+#define BCT_FILE_MAGIC "CUBBCT"
+#define BCT_FILE_VERSION 1
+
+typedef std::atomic<std::uint64_t> BCT_WORD;
+
+typedef enum
+{
+  BCT_MAP_INVALID = 0,		/* the map does not list every changed page; not used by backups */
+  BCT_MAP_BUILDING,		/* the map is rebuilt by the backup in progress */
+  BCT_MAP_VALID			/* the map lists every page changed since ref_lsa */
+} BCT_MAP_STATE;
+
+typedef struct bct_map BCT_MAP;
+struct bct_map
+{
+  std::atomic<BCT_WORD *> *chunks;	/* directory of bct_Num_chunks bitmap chunks */
+  std::atomic<int> state;	/* BCT_MAP_STATE */
+  LOG_LSA ref_lsa;		/* checkpoint LSA of the backup that built the map */
+};
+
+typedef struct bct_volume BCT_VOLUME;
+struct bct_volume
+{
+  BCT_MAP maps[BCT_NUM_MAPS];
+};
+
+typedef struct bct_file_header BCT_FILE_HEADER;
+struct bct_file_header
+{
+  char magic[8];
+  INT32 version;
+  INT32 io_pagesize;
+  INT64 db_creation;
+  INT32 is_clean;		/* saved by a clean shutdown; otherwise pages written after the save are not listed */
+  INT32 num_volumes;
+};
+
+static bool bct_Enabled = false;
+static int bct_Num_chunks = 0;
+static std::atomic<BCT_VOLUME *> *bct_Volumes = NULL;	/* indexed by volume identifier */
+static char bct_File_name[PATH_MAX];
+
+/* map rebuilt by the backup in progress, and the checkpoint LSA of the backup */
+static int bct_Build_map = -1;
+static LOG_LSA bct_Build_lsa = LSA_INITIALIZER;
+
+static BCT_VOLUME *bct_get_volume (VOLID volid, bool create);
+static BCT_WORD *bct_get_chunk (BCT_MAP * map, int chunk_index, bool create);
+static int bct_set_bit (BCT_MAP * map, PAGEID pageid);
+static bool bct_test_bit (BCT_MAP * map, PAGEID pageid);
+static void bct_clear_map (BCT_MAP * map);
+static void bct_invalidate_all (void);
+static const LOG_LSA *bct_get_backup_lsa (int map_index);
+static int bct_read_file (FILE * fp);
+static int bct_save (THREAD_ENTRY * thread_p, bool is_clean);
+
+/*
+ * bct_initialize () - start tracking the pages written to permanent volumes
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   log_path(in): directory of the change tracking file
+ *   log_prefix(in): prefix of the log volumes
+ *
+ * Note: called before the page buffer may write pages of the volumes. The maps are invalid until bct_load.
+ */
+int
+bct_initialize (THREAD_ENTRY * thread_p, const char *log_path, const char *log_prefix)
+{
+  fileio_make_change_tracking_name (bct_File_name, log_path, log_prefix);
+
+  bct_Enabled = prm_get_bool_value (PRM_ID_BACKUP_CHANGE_TRACKING);
+  if (!bct_Enabled)
+    {
+      /* pages written from now on are not tracked; a saved file would miss them */
+      if (fileio_is_volume_exist (bct_File_name))
+	{
+	  fileio_unformat (thread_p, bct_File_name);
+	}
+      return NO_ERROR;
+    }
+
+  bct_Num_chunks = VOL_MAX_NPAGES (IO_PAGESIZE) / BCT_CHUNK_NPAGES + 1;
+  bct_Volumes = new (std::nothrow) std::atomic<BCT_VOLUME *>[LOG_MAX_DBVOLID + 1] ();
+  if (bct_Volumes == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (LOG_MAX_DBVOLID + 1) * sizeof (BCT_VOLUME *));
+      bct_Enabled = false;
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  bct_Build_map = -1;
+  return NO_ERROR;
+}
+
+/*
+ * bct_load () - load the change maps saved by the last shutdown
+ *   return: void
+ *   thread_p(in): thread entry
+ *   is_restore(in): the database was just restored from a backup
+ *
+ * Note: called after the log header is loaded. The saved file is then marked as not clean, so that the maps are not
+ *       used after a crash.
+ */
+void
+bct_load (THREAD_ENTRY * thread_p, bool is_restore)
+{
+  FILE *fp;
+
+  if (!bct_Enabled)
+    {
+      return;
+    }
+
+  if (!is_restore)
+    {
+      fp = fopen (bct_File_name, "rb");
+      if (fp != NULL)
+	{
+	  if (bct_read_file (fp) != NO_ERROR)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "bct_load: change maps in %s cannot be used\n", bct_File_name);
+	      bct_invalidate_all ();
+	    }
+	  fclose (fp);
+	}
+    }
+
+  if (bct_save (thread_p, false) != NO_ERROR)
+    {
+      /* a clean file left in place would be trusted after a crash */
+      (void) remove (bct_File_name);
+    }
+}
+
+/*
+ * bct_finalize () - stop tracking changes
+ *   return: void
+ *   thread_p(in): thread entry
+ *   is_clean_shutdown(in): every page was flushed; the maps are saved
+ */
+void
+bct_finalize (THREAD_ENTRY * thread_p, bool is_clean_shutdown)
+{
+  VOLID volid;
+  int i, c;
+
+  if (!bct_Enabled)
+    {
+      return;
+    }
+
+  if (is_clean_shutdown)
+    {
+      (void) bct_save (thread_p, true);
+    }
+
+  bct_Enabled = false;
+
+  for (volid = 0; volid <= LOG_MAX_DBVOLID; volid++)
+    {
+      BCT_VOLUME *volume = bct_Volumes[volid].load ();
+
+      if (volume == NULL)
+	{
+	  continue;
+	}
+      for (i = 0; i < BCT_NUM_MAPS; i++)
+	{
+	  for (c = 0; c < bct_Num_chunks; c++)
+	    {
+	      delete[] volume->maps[i].chunks[c].load ();
+	    }
+	  delete[] volume->maps[i].chunks;
+	}
+      delete volume;
+    }
+
+  delete[] bct_Volumes;
+  bct_Volumes = NULL;
+}
+
+/*
+ * bct_mark_page () - record that a page was written to its volume
+ *   return: void
+ *   vpid(in): page identifier
+ *
+ * Note: called by the page buffer after the page is written or added to the double write buffer.
+ */
+void
+bct_mark_page (const VPID * vpid)
+{
+  BCT_VOLUME *volume;
+  int i;
+
+  if (!bct_Enabled || vpid->volid < LOG_DBFIRST_VOLID)
+    {
+      return;
+    }
+
+  volume = bct_get_volume (vpid->volid, true);
+  if (volume == NULL)
+    {
+      /* no memory; the volume has no maps and is backed up as without change tracking */
+      return;
+    }
+
+  for (i = 0; i < BCT_NUM_MAPS; i++)
+    {
+      if (bct_set_bit (&volume->maps[i], vpid->pageid) != NO_ERROR)
+	{
+	  volume->maps[i].state = BCT_MAP_INVALID;
+	}
+    }
+}
+
+/*
+ * bct_begin_backup () - clear the change map rebuilt by a backup
+ *   return: void
+ *   thread_p(in): thread entry
+ *   level(in): backup level
+ *   chkpt_lsa(in): checkpoint LSA of the backup; the next incremental backups copy the pages newer than it
+ *
+ * Note: must be called before the volumes are flushed for the backup.
+ */
+void
+bct_begin_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_LEVEL level, const LOG_LSA * chkpt_lsa)
+{
+  VOLID volid;
+
+  bct_Build_map = -1;
+  if (!bct_Enabled || level >= BCT_NUM_MAPS)
+    {
+      /* level 2 backups are not the base of other backups */
+      return;
+    }
+
+  bct_Build_map = level;
+  LSA_COPY (&bct_Build_lsa, chkpt_lsa);
+
+  for (volid = LOG_DBFIRST_VOLID; volid != NULL_VOLID; volid = fileio_find_next_perm_volume (thread_p, volid))
+    {
+      BCT_VOLUME *volume = bct_get_volume (volid, true);
+
+      if (volume == NULL)
+	{
+	  continue;
+	}
+      volume->maps[level].state = BCT_MAP_BUILDING;
+      bct_clear_map (&volume->maps[level]);
+    }
+}
+
+/*
+ * bct_end_backup () - publish the change map rebuilt by a backup
+ *   return: void
+ *   thread_p(in): thread entry
+ *   is_success(in): the backup completed and its LSA was recorded in the log header
+ */
+void
+bct_end_backup (THREAD_ENTRY * thread_p, bool is_success)
+{
+  VOLID volid;
+  int expected;
+
+  if (!bct_Enabled || bct_Build_map < 0)
+    {
+      bct_Build_map = -1;
+      return;
+    }
+
+  for (volid = LOG_DBFIRST_VOLID; volid <= LOG_MAX_DBVOLID; volid++)
+    {
+      BCT_VOLUME *volume = bct_Volumes[volid].load ();
+      BCT_MAP *map;
+
+      if (volume == NULL)
+	{
+	  continue;
+	}
+
+      map = &volume->maps[bct_Build_map];
+      LSA_COPY (&map->ref_lsa, &bct_Build_lsa);
+      expected = BCT_MAP_BUILDING;
+      /* a map that could not be updated meanwhile stays invalid */
+      (void) map->state.compare_exchange_strong (expected, is_success ? BCT_MAP_VALID : BCT_MAP_INVALID);
+
+      if (is_success && bct_Build_map == FILEIO_BACKUP_FULL_LEVEL)
+	{
+	  /* a full backup resets the last level 1 backup */
+	  volume->maps[FILEIO_BACKUP_BIG_INCREMENT_LEVEL].state = BCT_MAP_INVALID;
+	}
+    }
+
+  bct_Build_map = -1;
+}
+
+/*
+ * bct_can_use_change_map () - can an incremental backup of the volume read only the pages of its change map?
+ *   return: true if the map lists every page changed since backup_lsa
+ *   volid(in): volume identifier
+ *   level(in): level of the backup
+ *   backup_lsa(in): LSA of the backup the incremental backup is based on
+ */
+bool
+bct_can_use_change_map (VOLID volid, FILEIO_BACKUP_LEVEL level, const LOG_LSA * backup_lsa)
+{
+  BCT_VOLUME *volume;
+  BCT_MAP *map;
+
+  if (!bct_Enabled || volid < LOG_DBFIRST_VOLID || level == FILEIO_BACKUP_FULL_LEVEL
+      || level > FILEIO_BACKUP_SMALL_INCREMENT_LEVEL)
+    {
+      return false;
+    }
+
+  volume = bct_get_volume (volid, false);
+  if (volume == NULL)
+    {
+      return false;
+    }
+
+  map = &volume->maps[level - 1];
+  return map->state == BCT_MAP_VALID && !LSA_ISNULL (backup_lsa) && LSA_EQ (&map->ref_lsa, backup_lsa);
+}
+
+/*
+ * bct_is_page_changed () - is the page listed in the change map read by an incremental backup?
+ *   return: true if the page was written since the backup the map is based on
+ *   volid(in): volume identifier
+ *   level(in): level of the incremental backup
+ *   pageid(in): page identifier
+ */
+bool
+bct_is_page_changed (VOLID volid, FILEIO_BACKUP_LEVEL level, PAGEID pageid)
+{
+  BCT_VOLUME *volume;
+
+  assert (level == FILEIO_BACKUP_BIG_INCREMENT_LEVEL || level == FILEIO_BACKUP_SMALL_INCREMENT_LEVEL);
+
+  volume = bct_get_volume (volid, false);
+  if (volume == NULL)
+    {
+      return true;
+    }
+
+  return bct_test_bit (&volume->maps[level - 1], pageid);
+}
+
+/*
+ * bct_seed_page () - list a page read by the backup in progress in the change map it rebuilds
+ *   return: void
+ *   volid(in): volume identifier
+ *   pageid(in): page identifier
+ *   page_lsa(in): LSA of the page as read from disk
+ */
+void
+bct_seed_page (VOLID volid, PAGEID pageid, const LOG_LSA * page_lsa)
+{
+  BCT_VOLUME *volume;
+  BCT_MAP *map;
+
+  if (!bct_Enabled || bct_Build_map < 0 || volid < LOG_DBFIRST_VOLID)
+    {
+      return;
+    }
+
+  volume = bct_get_volume (volid, false);
+  if (volume == NULL)
+    {
+      return;
+    }
+
+  map = &volume->maps[bct_Build_map];
+  if (map->state == BCT_MAP_BUILDING && LSA_LT (&bct_Build_lsa, page_lsa) && bct_set_bit (map, pageid) != NO_ERROR)
+    {
+      map->state = BCT_MAP_INVALID;
+    }
+}
+
+/*
+ * bct_invalidate_change_map () - stop using the change map read by incremental backups of the volume
+ *   return: void
+ *   volid(in): volume identifier
+ *   level(in): level of the incremental backup
+ */
+void
+bct_invalidate_change_map (VOLID volid, FILEIO_BACKUP_LEVEL level)
+{
+  BCT_VOLUME *volume;
+
+  assert (level == FILEIO_BACKUP_BIG_INCREMENT_LEVEL || level == FILEIO_BACKUP_SMALL_INCREMENT_LEVEL);
+
+  volume = bct_get_volume (volid, false);
+  if (volume != NULL)
+    {
+      volume->maps[level - 1].state = BCT_MAP_INVALID;
+    }
+}
+
+static BCT_VOLUME *
+bct_get_volume (VOLID volid, bool create)
+{
+  BCT_VOLUME *volume, *expected = NULL;
+  int i;
+
+  assert (volid >= 0 && volid <= LOG_MAX_DBVOLID);
+
+  volume = bct_Volumes[volid].load ();
+  if (volume != NULL || !create)
+    {
+      return volume;
+    }
+
+  volume = new (std::nothrow) BCT_VOLUME ();
+  if (volume == NULL)
+    {
+      return NULL;
+    }
+  for (i = 0; i < BCT_NUM_MAPS; i++)
+    {
+      volume->maps[i].chunks = new (std::nothrow) std::atomic<BCT_WORD *>[bct_Num_chunks] ();
+      if (volume->maps[i].chunks == NULL)
+	{
+	  while (--i >= 0)
+	    {
+	      delete[] volume->maps[i].chunks;
+	    }
+	  delete volume;
+	  return NULL;
+	}
+      volume->maps[i].state = BCT_MAP_INVALID;
+      LSA_SET_NULL (&volume->maps[i].ref_lsa);
+    }
+
+  if (!bct_Volumes[volid].compare_exchange_strong (expected, volume))
+    {
+      /* another thread created it first */
+      for (i = 0; i < BCT_NUM_MAPS; i++)
+	{
+	  delete[] volume->maps[i].chunks;
+	}
+      delete volume;
+      volume = expected;
+    }
+
+  return volume;
+}
+
+static BCT_WORD *
+bct_get_chunk (BCT_MAP * map, int chunk_index, bool create)
+{
+  BCT_WORD *chunk, *expected = NULL;
+
+  if (chunk_index < 0 || chunk_index >= bct_Num_chunks)
+    {
+      assert (false);
+      return NULL;
+    }
+
+  chunk = map->chunks[chunk_index].load ();
+  if (chunk != NULL || !create)
+    {
+      return chunk;
+    }
+
+  chunk = new (std::nothrow) BCT_WORD[BCT_CHUNK_NWORDS] ();
+  if (chunk == NULL)
+    {
+      return NULL;
+    }
+  if (!map->chunks[chunk_index].compare_exchange_strong (expected, chunk))
+    {
+      delete[] chunk;
+      chunk = expected;
+    }
+
+  return chunk;
+}
+
+static int
+bct_set_bit (BCT_MAP * map, PAGEID pageid)
+{
+  BCT_WORD *chunk = bct_get_chunk (map, pageid >> BCT_CHUNK_NPAGES_LOG2, true);
+  int bit = pageid & (BCT_CHUNK_NPAGES - 1);
+
+  if (chunk == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  chunk[bit / 64].fetch_or (((std::uint64_t) 1) << (bit % 64));
+  return NO_ERROR;
+}
+
+static bool
+bct_test_bit (BCT_MAP * map, PAGEID pageid)
+{
+  BCT_WORD *chunk = bct_get_chunk (map, pageid >> BCT_CHUNK_NPAGES_LOG2, false);
+  int bit = pageid & (BCT_CHUNK_NPAGES - 1);
+
+  if (chunk == NULL)
+    {
+      return false;
+    }
+
+  return (chunk[bit / 64].load () & (((std::uint64_t) 1) << (bit % 64))) != 0;
+}
+
+static void
+bct_clear_map (BCT_MAP * map)
+{
+  int c, w;
+
+  /* chunks are not freed; concurrent writers may be setting bits in them */
+  for (c = 0; c < bct_Num_chunks; c++)
+    {
+      BCT_WORD *chunk = map->chunks[c].load ();
+
+      if (chunk == NULL)
+	{
+	  continue;
+	}
+      for (w = 0; w < BCT_CHUNK_NWORDS; w++)
+	{
+	  chunk[w].store (0);
+	}
+    }
+}
+
+static void
+bct_invalidate_all (void)
+{
+  VOLID volid;
+  int i;
+
+  for (volid = 0; volid <= LOG_MAX_DBVOLID; volid++)
+    {
+      BCT_VOLUME *volume = bct_Volumes[volid].load ();
+
+      if (volume != NULL)
+	{
+	  for (i = 0; i < BCT_NUM_MAPS; i++)
+	    {
+	      volume->maps[i].state = BCT_MAP_INVALID;
+	    }
+	}
+    }
+}
+
+/* the LSA of the backup a map must have been built by to be used */
+static const LOG_LSA *
+bct_get_backup_lsa (int map_index)
+{
+  return map_index == FILEIO_BACKUP_FULL_LEVEL ? &log_Gl.hdr.bkup_level0_lsa : &log_Gl.hdr.bkup_level1_lsa;
+}
+
+/*
+ * bct_read_file () - merge the saved change maps into the maps of this run
+ *   return: error code
+ *   fp(in): change tracking file
+ *
+ * Note: bits set since startup are kept. Format of the file: the header, then for each volume its identifier, the
+ *       size of its chunk directory and for each map its state, its LSA and its chunks, each one preceded by a byte
+ *       telling whether it is saved.
+ */
+static int
+bct_read_file (FILE * fp)
+{
+  BCT_FILE_HEADER header;
+  std::uint64_t *buffer;
+  int error = NO_ERROR;
+  int v, i, c, w;
+
+  if (fread (&header, sizeof (header), 1, fp) != 1 || strncmp (header.magic, BCT_FILE_MAGIC, sizeof (header.magic))
+      || header.version != BCT_FILE_VERSION || header.io_pagesize != IO_PAGESIZE
+      || header.db_creation != log_Gl.hdr.db_creation || !header.is_clean)
+    {
+      return ER_FAILED;
+    }
+
+  buffer = new (std::nothrow) std::uint64_t[BCT_CHUNK_NWORDS];
+  if (buffer == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  for (v = 0; v < header.num_volumes && error == NO_ERROR; v++)
+    {
+      INT32 volid, nchunks;
+      BCT_VOLUME *volume;
+
+      if (fread (&volid, sizeof (volid), 1, fp) != 1 || fread (&nchunks, sizeof (nchunks), 1, fp) != 1
+	  || volid < LOG_DBFIRST_VOLID || volid > LOG_MAX_DBVOLID || nchunks < 0 || nchunks > bct_Num_chunks)
+	{
+	  error = ER_FAILED;
+	  break;
+	}
+
+      volume = bct_get_volume ((VOLID) volid, true);
+      if (volume == NULL)
+	{
+	  error = ER_FAILED;
+	  break;
+	}
+
+      for (i = 0; i < BCT_NUM_MAPS && error == NO_ERROR; i++)
+	{
+	  BCT_MAP *map = &volume->maps[i];
+	  INT32 state;
+	  LOG_LSA ref_lsa;
+
+	  if (fread (&state, sizeof (state), 1, fp) != 1 || fread (&ref_lsa, sizeof (ref_lsa), 1, fp) != 1)
+	    {
+	      error = ER_FAILED;
+	      break;
+	    }
+
+	  for (c = 0; c < nchunks; c++)
+	    {
+	      char is_saved;
+	      BCT_WORD *chunk;
+
+	      if (fread (&is_saved, 1, 1, fp) != 1)
+		{
+		  error = ER_FAILED;
+		  break;
+		}
+	      if (!is_saved)
+		{
+		  continue;
+		}
+	      if (fread (buffer, sizeof (std::uint64_t), BCT_CHUNK_NWORDS, fp) != BCT_CHUNK_NWORDS)
+		{
+		  error = ER_FAILED;
+		  break;
+		}
+	      chunk = bct_get_chunk (map, c, true);
+	      if (chunk == NULL)
+		{
+		  error = ER_FAILED;
+		  break;
+		}
+	      for (w = 0; w < BCT_CHUNK_NWORDS; w++)
+		{
+		  chunk[w].fetch_or (buffer[w]);
+		}
+	    }
+
+	  if (error == NO_ERROR && state == BCT_MAP_VALID && !LSA_ISNULL (&ref_lsa)
+	      && LSA_EQ (&ref_lsa, bct_get_backup_lsa (i)))
+	    {
+	      LSA_COPY (&map->ref_lsa, &ref_lsa);
+	      map->state = BCT_MAP_VALID;
+	    }
+	}
+    }
+
+  delete[] buffer;
+  return error;
+}
+
+/*
+ * bct_save () - save the change maps
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   is_clean(in): every written page is marked; otherwise only a header that invalidates the maps is saved
+ *
+ * Note: the file is written under a temporary name and renamed, so that a failure leaves the previous file.
+ */
+static int
+bct_save (THREAD_ENTRY * thread_p, bool is_clean)
+{
+  char tmp_name[PATH_MAX + 8];
+  BCT_FILE_HEADER header;
+  FILE *fp;
+  VOLID volid;
+  int i, c;
+  bool is_error = false;
+
+  snprintf (tmp_name, sizeof (tmp_name), "%s.tmp", bct_File_name);
+  fp = fopen (tmp_name, "wb");
+  if (fp == NULL)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_MOUNT_FAIL, 1, tmp_name);
+      return ER_IO_MOUNT_FAIL;
+    }
+
+  memset (&header, 0, sizeof (header));
+  memcpy (header.magic, BCT_FILE_MAGIC, strlen (BCT_FILE_MAGIC));
+  header.version = BCT_FILE_VERSION;
+  header.io_pagesize = IO_PAGESIZE;
+  header.db_creation = log_Gl.hdr.db_creation;
+  header.is_clean = is_clean ? 1 : 0;
+  header.num_volumes = 0;
+
+  if (is_clean)
+    {
+      /* only volumes with a map that can still be used are saved */
+      for (volid = LOG_DBFIRST_VOLID; volid <= LOG_MAX_DBVOLID; volid++)
+	{
+	  BCT_VOLUME *volume = bct_Volumes[volid].load ();
+
+	  if (volume != NULL && (volume->maps[0].state == BCT_MAP_VALID || volume->maps[1].state == BCT_MAP_VALID))
+	    {
+	      header.num_volumes++;
+	    }
+	}
+    }
+
+  is_error = fwrite (&header, sizeof (header), 1, fp) != 1;
+
+  for (volid = LOG_DBFIRST_VOLID; volid <= LOG_MAX_DBVOLID && header.num_volumes > 0 && !is_error; volid++)
+    {
+      BCT_VOLUME *volume = bct_Volumes[volid].load ();
+      INT32 saved_volid = volid, nchunks = 0;
+
+      if (volume == NULL || (volume->maps[0].state != BCT_MAP_VALID && volume->maps[1].state != BCT_MAP_VALID))
+	{
+	  continue;
+	}
+
+      for (i = 0; i < BCT_NUM_MAPS; i++)
+	{
+	  for (c = nchunks; c < bct_Num_chunks; c++)
+	    {
+	      if (volume->maps[i].chunks[c].load () != NULL)
+		{
+		  nchunks = c + 1;
+		}
+	    }
+	}
+
+      is_error = (fwrite (&saved_volid, sizeof (saved_volid), 1, fp) != 1
+		  || fwrite (&nchunks, sizeof (nchunks), 1, fp) != 1);
+
+      for (i = 0; i < BCT_NUM_MAPS && !is_error; i++)
+	{
+	  BCT_MAP *map = &volume->maps[i];
+	  INT32 state = map->state;
+
+	  is_error = (fwrite (&state, sizeof (state), 1, fp) != 1
+		      || fwrite (&map->ref_lsa, sizeof (map->ref_lsa), 1, fp) != 1);
+
+	  for (c = 0; c < nchunks && !is_error; c++)
+	    {
+	      BCT_WORD *chunk = map->chunks[c].load ();
+	      char is_saved = (state == BCT_MAP_VALID && chunk != NULL) ? 1 : 0;
+
+	      is_error = fwrite (&is_saved, 1, 1, fp) != 1;
+	      if (is_saved && !is_error)
+		{
+		  static_assert (sizeof (BCT_WORD) == sizeof (std::uint64_t), "bitmap words are saved as they are");
+		  is_error = fwrite (chunk, sizeof (BCT_WORD), BCT_CHUNK_NWORDS, fp) != BCT_CHUNK_NWORDS;
+		}
+	    }
+	}
+    }
+
+  if (fflush (fp) != 0)
+    {
+      is_error = true;
+    }
+#if !defined (WINDOWS)
+  if (!is_error && fsync (fileno (fp)) != 0)
+    {
+      is_error = true;
+    }
+#endif /* !WINDOWS */
+  fclose (fp);
+
+  if (is_error || os_rename_file (tmp_name, bct_File_name) != NO_ERROR)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, NULL_PAGEID, bct_File_name);
+      (void) remove (tmp_name);
+      return ER_IO_WRITE;
+    }
+
+  return NO_ERROR;
+}
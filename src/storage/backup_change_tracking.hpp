@@ -0,0 +1,64 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// backup_change_tracking.hpp - bitmaps of the pages changed since the last backups, read by incremental backups
+//
+//  When backup_change_tracking is on, every page of a permanent volume written by the page buffer sets its bit in the
+//  change maps of the volume. There is one map per backup level that incremental backups are based on: map 0 lists
+//  the pages changed since the last full backup and is read by level 1 backups; map 1 lists the pages changed since
+//  the last level 1 backup and is read by level 2 backups. An incremental backup reads only the pages of its map and
+//  still copies only those newer than its backup LSA, so its content is the same as with a scan of the whole volume.
+//
+//  A backup of level L rebuilds map L. The map is cleared when the backup starts, before the volumes are flushed, and
+//  the backup sets the bits of the pages it reads whose LSA is newer than its checkpoint LSA. Pages changed after the
+//  checkpoint are either written before the backup reads them or marked when they are written afterwards.
+//
+//  The maps are saved in the <prefix>_bct file in the log directory when the server shuts down and are loaded when it
+//  restarts. A map is used only if it was saved by a clean shutdown and was built by the backup recorded in the log
+//  header; otherwise incremental backups of the volume compare the LSA of every page, as without change tracking,
+//  until the map is rebuilt.
+//
+
+#ifndef _BACKUP_CHANGE_TRACKING_HPP_
+#define _BACKUP_CHANGE_TRACKING_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "file_io.h"
+#include "log_lsa.hpp"
+#include "storage_common.h"
+#include "thread_compat.hpp"
+
+extern int bct_initialize (THREAD_ENTRY * thread_p, const char *log_path, const char *log_prefix);
+extern void bct_load (THREAD_ENTRY * thread_p, bool is_restore);
+extern void bct_finalize (THREAD_ENTRY * thread_p, bool is_clean_shutdown);
+
+extern void bct_mark_page (const VPID * vpid);
+
+extern void bct_begin_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_LEVEL level, const LOG_LSA * chkpt_lsa);
+extern void bct_end_backup (THREAD_ENTRY * thread_p, bool is_success);
+
+extern bool bct_can_use_change_map (VOLID volid, FILEIO_BACKUP_LEVEL level, const LOG_LSA * backup_lsa);
+extern bool bct_is_page_changed (VOLID volid, FILEIO_BACKUP_LEVEL level, PAGEID pageid);
+extern void bct_seed_page (VOLID volid, PAGEID pageid, const LOG_LSA * page_lsa);
+extern void bct_invalidate_change_map (VOLID volid, FILEIO_BACKUP_LEVEL level);
+
+#endif // _BACKUP_CHANGE_TRACKING_HPP_
@@ -75,6 +75,8 @@
 #define BTREE_SPLIT_MAX_PIVOT (1.0f - BTREE_SPLIT_MIN_PIVOT)
 
 #define BTREE_SPLIT_DEFAULT_PIVOT 0.5f
+/* Pivot used at least when a key bigger than all others is inserted in the last leaf. */
+#define BTREE_SPLIT_APPEND_PIVOT 0.9f
 #define DISK_PAGE_BITS  (DB_PAGESIZE * CHAR_BIT)	/* Num of bits per page */
 
 #define BTREE_NODE_MAX_SPLIT_SIZE(thread_p, page_ptr) \
@@ -1182,6 +1184,24 @@ struct btree_helper
   BTREE_DELETE_HELPER delete_helper;
 };
 
+/*
+ * Right-most leaf insert
+ */
+
+/* Each thread remembers the last leaf of the indexes it inserted to, to append keys bigger than all others without
+ * descending from root. A saved leaf is used only if no b-tree page was deallocated since it was saved. */
+#define BTREE_RIGHTMOST_LEAF_CACHE_SIZE 8
+
+typedef struct btree_rightmost_leaf BTREE_RIGHTMOST_LEAF;
+struct btree_rightmost_leaf
+{
+  BTID btid;
+  VPID vpid;
+  UINT64 epoch;			/* btree_Rightmost_leaf_epoch when leaf was saved */
+};
+
+static volatile UINT64 btree_Rightmost_leaf_epoch = 0;
+
 /*
  * Static functions
  */
@@ -1501,6 +1521,12 @@ static int btree_undo_delete_physical (THREAD_ENTRY * thread_p, BTID * btid, DB_
 static int btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				      PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				      bool * stop, bool * restart, void *other_args);
+static BTREE_RIGHTMOST_LEAF *btree_get_rightmost_leaf (THREAD_ENTRY * thread_p, const BTID * btid, bool alloc);
+static void btree_save_rightmost_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page);
+static int btree_fix_rightmost_leaf_for_insert (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+						PAGE_PTR * root_page, bool * is_leaf,
+						BTREE_SEARCH_KEY_HELPER * search_key, bool * restart,
+						BTREE_INSERT_HELPER * insert_helper);
 static int btree_split_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					 PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 					 BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -12141,6 +12167,10 @@ btree_get_prefix_separator (const DB_VALUE * key1, const DB_VALUE * key2, DB_VAL
  *      otherwise : slot point is in the range 1 to n-1, inclusive. The page
  *                  is to be split into half.
  *
+ * Note: The split point follows the split info of the node. When key is
+ * appended to the last leaf, at least BTREE_SPLIT_APPEND_PIVOT of the
+ * records are kept in the original page.
+ *
  * Note: the returned db_value should be cleared and FREED by the caller.
  */
 static DB_VALUE *
@@ -12293,6 +12323,12 @@ btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 
   /* Compute mid_size, the desired size of left node according to split info. */
   mid_size = btree_split_find_pivot (tot_rec, &(header->split_info));
+  if (node_type == BTREE_LEAF_NODE && !found && slot_id > stop_at && VPID_ISNULL (&header->next_vpid))
+    {
+      /* Key is appended to the last leaf, keys are probably sequential. Left leaf will not get new keys, so keep it
+       * almost full and move only a few records to the right leaf. */
+      mid_size = MAX (mid_size, (int) (tot_rec * BTREE_SPLIT_APPEND_PIVOT));
+    }
 
   /* Split records and new entity considering mid_size, left_max_size, and right_max_size. Since we work with left
    * node, translate right_max_size into left_min_size by subtracting from total records size. */
@@ -26823,6 +26859,16 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
 
   insert_helper->key_len_in_page = BTREE_GET_KEY_LEN_IN_PAGE (key_len);
 
+  /* Keys bigger than all others can go straight to the last leaf. */
+  error_code =
+    btree_fix_rightmost_leaf_for_insert (thread_p, btid_int, key, root_page, is_leaf, search_key, restart,
+					 insert_helper);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
   /* Success. */
   return NO_ERROR;
 
@@ -26836,6 +26882,226 @@ error:
   return error_code;
 }
 
+/*
+ * btree_get_rightmost_leaf () - Get the entry of current thread where the last leaf of b-tree is saved.
+ *
+ * return	 : Entry for b-tree (may be used by another b-tree) or NULL.
+ * thread_p (in) : Thread entry.
+ * btid (in)	 : B-tree identifier.
+ * alloc (in)	 : True to allocate the entries of thread if they are not allocated yet.
+ */
+static BTREE_RIGHTMOST_LEAF *
+btree_get_rightmost_leaf (THREAD_ENTRY * thread_p, const BTID * btid, bool alloc)
+{
+  BTREE_RIGHTMOST_LEAF *leaves;
+  int i;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  leaves = thread_p->btree_rightmost_leaves;
+  if (leaves == NULL)
+    {
+      if (!alloc)
+	{
+	  return NULL;
+	}
+      leaves = (BTREE_RIGHTMOST_LEAF *) malloc (BTREE_RIGHTMOST_LEAF_CACHE_SIZE * sizeof (BTREE_RIGHTMOST_LEAF));
+      if (leaves == NULL)
+	{
+	  /* Not needed to insert. */
+	  return NULL;
+	}
+      for (i = 0; i < BTREE_RIGHTMOST_LEAF_CACHE_SIZE; i++)
+	{
+	  BTID_SET_NULL (&leaves[i].btid);
+	  VPID_SET_NULL (&leaves[i].vpid);
+	  leaves[i].epoch = 0;
+	}
+      thread_p->btree_rightmost_leaves = leaves;
+    }
+
+  return &leaves[((unsigned int) btid->vfid.fileid ^ (unsigned int) btid->root_pageid)
+		 % BTREE_RIGHTMOST_LEAF_CACHE_SIZE];
+}
+
+/*
+ * btree_save_rightmost_leaf () - Save the leaf reached by an insert if it is the last leaf of b-tree.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * btid_int (in)  : B-tree info.
+ * leaf_page (in) : Leaf node, write latched.
+ */
+static void
+btree_save_rightmost_leaf (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page)
+{
+  BTREE_RIGHTMOST_LEAF *rightmost;
+  BTREE_NODE_HEADER *node_header;
+
+  node_header = btree_get_node_header (thread_p, leaf_page);
+  if (node_header == NULL || !VPID_ISNULL (&node_header->next_vpid))
+    {
+      return;
+    }
+
+  rightmost = btree_get_rightmost_leaf (thread_p, btid_int->sys_btid, true);
+  if (rightmost == NULL)
+    {
+      return;
+    }
+
+  /* The epoch is read while leaf is latched; a merge that removes it changes the epoch before unfixing it. */
+  BTID_COPY (&rightmost->btid, btid_int->sys_btid);
+  pgbuf_get_vpid (leaf_page, &rightmost->vpid);
+  rightmost->epoch = ATOMIC_LOAD_64 (&btree_Rightmost_leaf_epoch);
+}
+
+/*
+ * btree_invalidate_rightmost_leaves () - Invalidate the last leaves saved by all threads. Must be called before a
+ *					   b-tree page is deallocated and unfixed.
+ *
+ * return : Void.
+ */
+void
+btree_invalidate_rightmost_leaves (void)
+{
+  ATOMIC_INC_64 (&btree_Rightmost_leaf_epoch, 1);
+}
+
+/*
+ * btree_fix_rightmost_leaf_for_insert () - Replace the fixed root with the last leaf of b-tree, when the inserted key
+ *					     is bigger than all keys of b-tree.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid_int (in)       : B-tree info.
+ * key (in)	       : Key value.
+ * root_page (in/out)  : Root page, replaced by the last leaf if the key goes there.
+ * is_leaf (out)       : Output true if the last leaf is fixed.
+ * search_key (out)    : Output key search result in the last leaf.
+ * restart (out)       : Output true if root was unfixed and the leaf cannot be used.
+ * insert_helper (in)  : B-tree insert helper.
+ *
+ * NOTE: Sequential keys (e.g. auto increment or timestamps) are always inserted in the last leaf. The thread saves the
+ *	 last leaf it reached (see btree_save_rightmost_leaf) and fixes it directly next time, instead of fixing all
+ *	 nodes on the path to it. The leaf is used only if it is still last, not empty, the key is bigger than all
+ *	 of its keys and the insert needs no split and no max key length update; otherwise the traversal restarts
+ *	 from root.
+ */
+static int
+btree_fix_rightmost_leaf_for_insert (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+				     PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
+				     bool * restart, BTREE_INSERT_HELPER * insert_helper)
+{
+  BTREE_RIGHTMOST_LEAF *rightmost;
+  BTREE_NODE_HEADER *node_header;
+  PAGE_PTR leaf_page = NULL;
+  int max_new_data_size;
+  int error_code = NO_ERROR;
+
+  if (!prm_get_bool_value (PRM_ID_BT_RIGHTMOST_LEAF_INSERT) || insert_helper->purpose != BTREE_OP_INSERT_NEW_OBJECT
+      || insert_helper->insert_list != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  rightmost = btree_get_rightmost_leaf (thread_p, btid_int->sys_btid, false);
+  if (rightmost == NULL || VPID_ISNULL (&rightmost->vpid) || !BTID_IS_EQUAL (&rightmost->btid, btid_int->sys_btid))
+    {
+      return NO_ERROR;
+    }
+  if (rightmost->epoch != ATOMIC_LOAD_64 (&btree_Rightmost_leaf_epoch))
+    {
+      /* Pages were deallocated. */
+      VPID_SET_NULL (&rightmost->vpid);
+      return NO_ERROR;
+    }
+
+  node_header = btree_get_node_header (thread_p, *root_page);
+  if (node_header == NULL || node_header->node_level == 1)
+    {
+      /* Root is leaf. */
+      return NO_ERROR;
+    }
+
+  /* Like at the end of a traversal, only the leaf is latched. */
+  pgbuf_unfix_and_init (thread_p, *root_page);
+  insert_helper->is_crt_node_write_latched = false;
+
+  error_code =
+    pgbuf_fix_if_not_deallocated (thread_p, &rightmost->vpid, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH,
+				  &leaf_page);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (leaf_page == NULL)
+    {
+      /* Deallocated. */
+      goto restart_from_root;
+    }
+
+  if (rightmost->epoch != ATOMIC_LOAD_64 (&btree_Rightmost_leaf_epoch)
+      || !BTREE_IS_PAGE_VALID_LEAF (thread_p, leaf_page))
+    {
+      goto restart_from_root;
+    }
+  node_header = btree_get_node_header (thread_p, leaf_page);
+  if (!VPID_ISNULL (&node_header->next_vpid) || insert_helper->key_len_in_page > node_header->max_key_len)
+    {
+      goto restart_from_root;
+    }
+  if (btree_node_number_of_keys (thread_p, leaf_page) <= 0)
+    {
+      /* An emptied leaf has no key to compare with; the key may belong to a leaf on its left. */
+      goto restart_from_root;
+    }
+
+  max_new_data_size =
+    btree_get_max_new_data_size (thread_p, btid_int, leaf_page, BTREE_LEAF_NODE, node_header->max_key_len,
+				 insert_helper, false);
+  if (max_new_data_size > spage_get_free_space_without_saving (thread_p, leaf_page, NULL))
+    {
+      /* Leaf must be split. Keep it saved; the traversal will reach its new last half. */
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      *restart = true;
+      return NO_ERROR;
+    }
+
+  error_code = btree_search_leaf_page (thread_p, btid_int, leaf_page, key, search_key);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      return error_code;
+    }
+  if (search_key->result != BTREE_KEY_BIGGER)
+    {
+      /* Key is not appended. Keys are probably not sequential, forget the leaf. */
+      goto restart_from_root;
+    }
+
+  /* Continue with the leaf. */
+  *root_page = leaf_page;
+  *is_leaf = true;
+  insert_helper->is_root = false;
+  insert_helper->is_crt_node_write_latched = true;
+  return NO_ERROR;
+
+restart_from_root:
+  if (leaf_page != NULL)
+    {
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+    }
+  VPID_SET_NULL (&rightmost->vpid);
+  *restart = true;
+  return NO_ERROR;
+}
+
 /*
  * btree_get_max_new_data_size () - Get new data size required based on node type and operation.
  *
@@ -27242,6 +27508,13 @@ btree_split_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_V
 	  ASSERT_ERROR ();
 	  goto error;
 	}
+      if (search_key->result == BTREE_KEY_BIGGER && !insert_helper->is_root
+	  && insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT
+	  && prm_get_bool_value (PRM_ID_BT_RIGHTMOST_LEAF_INSERT))
+	{
+	  /* Next bigger key may go straight to this leaf. */
+	  btree_save_rightmost_leaf (thread_p, btid_int, *crt_page);
+	}
       *is_leaf = true;
       return NO_ERROR;
     }
@@ -30575,6 +30848,8 @@ btree_merge_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_V
 	      (void) spage_check_num_slots (thread_p, *crt_page);
 #endif /* !NDEBUG */
 
+	      /* Saved last leaves may be deallocated. */
+	      btree_invalidate_rightmost_leaves ();
 	      pgbuf_unfix_and_init (thread_p, left_page);
 	      error_code = file_dealloc (thread_p, &btid_int->sys_btid->vfid, &left_vpid, FILE_BTREE);
 	      if (error_code != NO_ERROR)
@@ -30837,7 +31112,8 @@ btree_merge_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_V
 		  (void) spage_check_num_slots (thread_p, child_page);
 #endif
 
-		  /* Deallocate right page. */
+		  /* Deallocate right page. Saved last leaves may be deallocated. */
+		  btree_invalidate_rightmost_leaves ();
 		  pgbuf_unfix_and_init (thread_p, right_page);
 		  error_code = file_dealloc (thread_p, &btid_int->sys_btid->vfid, &right_vpid, FILE_BTREE);
 		  if (error_code != NO_ERROR)
@@ -31820,6 +32096,7 @@ btree_overflow_remove_object (THREAD_ENTRY * thread_p, DB_VALUE * key, BTID_INT
 	}
       /* Unfix the page before deallocating. */
       pgbuf_get_vpid (*overflow_page, &overflow_vpid);
+      btree_invalidate_rightmost_leaves ();
       pgbuf_unfix_and_init (thread_p, *overflow_page);
 
       /* we need system op to deallocate pages. */
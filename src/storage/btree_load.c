@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <mutex>
 
 #include "btree_load.h"
 
@@ -58,6 +59,26 @@
 #include "db_value_printer.hpp"
 #endif
 
+// *INDENT-OFF*
+// hands out the heap pages of the classes being loaded, one at a time, to the threads that scan them in parallel
+class index_builder_page_cursor
+{
+  public:
+    index_builder_page_cursor (HFID *hfids, OID *class_oids, int first_class, int end_class);
+
+    // get the next page to scan and the index of its class; S_END when all heaps are handed out
+    SCAN_CODE next_page (THREAD_ENTRY *thread_p, int &cur_class, VPID &vpid);
+
+  private:
+    std::mutex m_mutex;
+    HFID *m_hfids;
+    OID *m_class_oids;
+    int m_cur_class;
+    int m_end_class;
+    VPID m_vpid;		// last page handed out of the current class
+};
+// *INDENT-ON*
+
 typedef struct sort_args SORT_ARGS;
 struct sort_args
 {				/* Collection of information required for "sr_index_sort" */
@@ -90,6 +111,16 @@ struct sort_args
   FUNCTION_INDEX_INFO *func_index_info;
 
   MVCCID oldest_visible_mvccid;
+
+  /* Parallel heap scan */
+  index_builder_page_cursor *page_cursor;	/* Hands out the heap pages to scan, NULL when scanned serially */
+  bool is_scan_copy;		/* Arguments of a thread that scans the heaps besides the one of the load */
+  bool cache_last_fix_page;	/* For the scan cache of a copy */
+  MVCC_SNAPSHOT *mvcc_snapshot;	/* For the scan cache of a copy */
+  char *pred_stream;		/* Filter that a copy unpacks for itself */
+  int pred_stream_size;
+  FUNCTION_INDEX_INFO scan_func_index_info;	/* Function that a copy unpacks for itself */
+  XASL_UNPACK_INFO *scan_func_unpack_info;
 };
 
 typedef struct btree_page BTREE_PAGE;
@@ -237,6 +268,8 @@ static int btree_get_value_from_leaf_slot (THREAD_ENTRY * thread_p, BTID_INT * b
 static int btree_dump_sort_output (const RECDES * recdes, LOAD_ARGS * load_args);
 #endif /* defined(CUBRID_DEBUG) */
 static int btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args);
+static int btree_index_sort_parallel (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, int parallelism,
+				      SORT_PUT_FUNC * out_func, void *out_args, bool includes_tde_class);
 static SORT_STATUS btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg);
 static int compare_driver (const void *first, const void *second, void *arg);
 static int list_add (BTREE_NODE ** list, VPID * pageid);
@@ -261,7 +294,13 @@ static int online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, H
 				 int n_classes, int *attrids, int n_attrs, FUNCTION_INDEX_INFO func_idx_info,
 				 PRED_EXPR_WITH_CONTEXT * filter_pred, int *attrs_prefix_length,
 				 HEAP_CACHE_ATTRINFO * attr_info, HEAP_SCANCACHE * scancache, int unique_pk,
-				 int ib_thread_count, TP_DOMAIN * key_type);
+				 int ib_thread_count, TP_DOMAIN * key_type, char *pred_stream, int pred_stream_size);
+// *INDENT-OFF*
+static int online_index_builder_scan (THREAD_ENTRY * thread_p, SORT_ARGS * scan_args,
+				      index_builder_loader_context &load_context, cubthread::entry_workpool *ib_workpool,
+				      std::atomic<std::uint64_t> &tasks_started, std::atomic<int> &num_keys,
+				      std::atomic<int> &num_oids, std::atomic<int> &num_nulls);
+// *INDENT-ON*
 static bool btree_is_worker_pool_logging_true ();
 
 typedef struct
@@ -300,6 +339,10 @@ static void bt_load_heap_scancache_end_for_attrinfo (THREAD_ENTRY * thread_p, SO
 						     HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
 static void bt_load_clear_pred_and_unpack (THREAD_ENTRY * thread_p, SORT_ARGS * args,
 					   XASL_UNPACK_INFO * func_unpack_info);
+static void bt_load_init_scan_copy (SORT_ARGS * copy, const SORT_ARGS * args, index_builder_page_cursor * page_cursor);
+static int bt_load_scan_copy_start (THREAD_ENTRY * thread_p, void *arg);
+static void bt_load_scan_copy_end (THREAD_ENTRY * thread_p, void *arg);
+static SCAN_CODE bt_load_heap_next_from_cursor (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, OID * prev_oid);
 
 /*
  * btree_get_node_header () -
@@ -840,6 +883,176 @@ bt_load_clear_pred_and_unpack (THREAD_ENTRY * thread_p, SORT_ARGS * args, XASL_U
     }
 }
 
+/*
+ * bt_load_init_scan_copy () - Make the arguments of a thread that scans the heaps in parallel with others
+ *   return: void
+ *   copy(out): arguments of the thread
+ *   args(in): arguments of the load
+ *   page_cursor(in): hands out the heap pages to the threads
+ *
+ * Note: The copy starts its own scan cache and unpacks its own filter and function, in its own thread
+ *       (see bt_load_scan_copy_start).
+ */
+static void
+bt_load_init_scan_copy (SORT_ARGS * copy, const SORT_ARGS * args, index_builder_page_cursor * page_cursor)
+{
+  *copy = *args;
+
+  OID_SET_NULL (&copy->cur_oid);
+  copy->n_nulls = 0;
+  copy->n_oids = 0;
+  copy->scancache_inited = false;
+  copy->attrinfo_inited = false;
+  copy->filter = NULL;
+  copy->filter_eval_func = NULL;
+  copy->func_index_info = NULL;
+
+  copy->page_cursor = page_cursor;
+  copy->is_scan_copy = true;
+  if (args->func_index_info != NULL)
+    {
+      copy->scan_func_index_info = *args->func_index_info;
+      copy->scan_func_index_info.expr = NULL;
+    }
+  else
+    {
+      memset (&copy->scan_func_index_info, 0, sizeof (FUNCTION_INDEX_INFO));
+    }
+  copy->scan_func_unpack_info = NULL;
+}
+
+/*
+ * bt_load_scan_copy_start () - Prepare the scan of a thread of a parallel heap scan
+ *   return: NO_ERROR or error code
+ *   arg(in/out): sort arguments of the thread
+ *
+ * Note: Nothing is done for the arguments of the load itself, whose scan is started by xbtree_load_index.
+ */
+static int
+bt_load_scan_copy_start (THREAD_ENTRY * thread_p, void *arg)
+{
+  SORT_ARGS *args = (SORT_ARGS *) arg;
+  DB_TYPE single_node_type = DB_TYPE_NULL;
+
+  if (!args->is_scan_copy)
+    {
+      return NO_ERROR;
+    }
+
+  /* the predicates cache values of the records they are evaluated on, each thread needs its own */
+  if (args->pred_stream != NULL && args->pred_stream_size > 0)
+    {
+      if (stx_map_stream_to_filter_pred (thread_p, &args->filter, args->pred_stream, args->pred_stream_size)
+	  != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      args->filter_eval_func = eval_fnc (thread_p, args->filter->pred, &single_node_type);
+    }
+
+  if (args->scan_func_index_info.expr_stream != NULL && args->scan_func_index_info.expr_stream_size > 0)
+    {
+      if (stx_map_stream_to_func_pred (thread_p, &args->scan_func_index_info.expr,
+				       args->scan_func_index_info.expr_stream,
+				       args->scan_func_index_info.expr_stream_size, &args->scan_func_unpack_info)
+	  != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      args->func_index_info = &args->scan_func_index_info;
+    }
+
+  if (bt_load_heap_scancache_start_for_attrinfo (thread_p, args, NULL, NULL, args->cache_last_fix_page) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+  args->hfscan_cache.mvcc_snapshot = args->mvcc_snapshot;
+
+  return NO_ERROR;
+}
+
+/*
+ * bt_load_scan_copy_end () - Clean up what bt_load_scan_copy_start has prepared
+ *   return: void
+ *   arg(in/out): sort arguments of the thread
+ */
+static void
+bt_load_scan_copy_end (THREAD_ENTRY * thread_p, void *arg)
+{
+  SORT_ARGS *args = (SORT_ARGS *) arg;
+
+  if (!args->is_scan_copy)
+    {
+      return;
+    }
+
+  bt_load_heap_scancache_end_for_attrinfo (thread_p, args, NULL, NULL);
+  bt_load_clear_pred_and_unpack (thread_p, args, args->scan_func_unpack_info);
+  args->scan_func_unpack_info = NULL;
+}
+
+/*
+ * bt_load_heap_next_from_cursor () - Get the next object of the heap pages handed out to a thread of a parallel scan
+ *   return: S_SUCCESS, S_END when all pages are handed out, or an error
+ *   sort_args(in/out): sort arguments of the thread; cur_oid is the current object and in_recdes gets the next one
+ *   prev_oid(out): moved to the start of each new page, for sort items that do not fit to scan again from there
+ */
+static SCAN_CODE
+bt_load_heap_next_from_cursor (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, OID * prev_oid)
+{
+  SCAN_CODE scan_result;
+  VPID vpid;
+  int next_class;
+  bool save_cache_last_fix_page;
+  MVCC_SNAPSHOT *save_mvcc_snapshot;
+
+  assert (sort_args->page_cursor != NULL);
+
+  while (true)
+    {
+      if (!OID_ISNULL (&sort_args->cur_oid))
+	{
+	  scan_result =
+	    heap_next_in_page (thread_p, &sort_args->hfids[sort_args->cur_class],
+			       &sort_args->class_ids[sort_args->cur_class], &sort_args->cur_oid,
+			       &sort_args->in_recdes, &sort_args->hfscan_cache,
+			       sort_args->hfscan_cache.cache_last_fix_page ? PEEK : COPY);
+	  if (scan_result != S_END)
+	    {
+	      return scan_result;
+	    }
+	  /* the page is done */
+	}
+
+      scan_result = sort_args->page_cursor->next_page (thread_p, next_class, vpid);
+      if (scan_result != S_SUCCESS)
+	{
+	  return scan_result;
+	}
+
+      if (next_class != sort_args->cur_class)
+	{
+	  /* the scan cache and the attribute information belong to the class */
+	  save_cache_last_fix_page = sort_args->hfscan_cache.cache_last_fix_page;
+	  save_mvcc_snapshot = sort_args->hfscan_cache.mvcc_snapshot;
+	  bt_load_heap_scancache_end_for_attrinfo (thread_p, sort_args, NULL, NULL);
+
+	  sort_args->cur_class = next_class;
+	  if (bt_load_heap_scancache_start_for_attrinfo (thread_p, sort_args, NULL, NULL, save_cache_last_fix_page)
+	      != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	  sort_args->hfscan_cache.mvcc_snapshot = save_mvcc_snapshot;
+	}
+
+      sort_args->cur_oid.volid = vpid.volid;
+      sort_args->cur_oid.pageid = vpid.pageid;
+      sort_args->cur_oid.slotid = NULL_SLOTID;
+      *prev_oid = sort_args->cur_oid;
+    }
+}
+
 /*
  * xbtree_load_index () - create & load b+tree index
  *   return: BTID * (btid on success and NULL on failure)
@@ -964,6 +1177,13 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
   sort_args->fk_refcls_oid = fk_refcls_oid;
   sort_args->fk_refcls_pk_btid = fk_refcls_pk_btid;
   sort_args->fk_name = fk_name;
+  sort_args->page_cursor = NULL;
+  sort_args->is_scan_copy = false;
+  sort_args->mvcc_snapshot = NULL;
+  sort_args->pred_stream = pred_stream;
+  sort_args->pred_stream_size = pred_stream_size;
+  memset (&sort_args->scan_func_index_info, 0, sizeof (FUNCTION_INDEX_INFO));
+  sort_args->scan_func_unpack_info = NULL;
   if (pred_stream && pred_stream_size > 0)
     {
       if (stx_map_stream_to_filter_pred (thread_p, &filter_pred, pred_stream, pred_stream_size) != NO_ERROR)
@@ -1008,8 +1228,10 @@ xbtree_load_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_name, TP
 
   /* Start scancache */
   has_fk = (fk_refcls_oid != NULL && !OID_ISNULL (fk_refcls_oid));
+  sort_args->cache_last_fix_page = !has_fk;
 
-  if (bt_load_heap_scancache_start_for_attrinfo (thread_p, sort_args, NULL, NULL, !has_fk) != NO_ERROR)
+  if (bt_load_heap_scancache_start_for_attrinfo (thread_p, sort_args, NULL, NULL, sort_args->cache_last_fix_page)
+      != NO_ERROR)
     {
       goto error;
     }
@@ -3206,6 +3428,7 @@ static int
 btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC * out_func, void *out_args)
 {
   int i;
+  int parallelism = 1;
   bool includes_tde_class = false;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
 
@@ -3222,9 +3445,78 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 	}
     }
 
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
-			NO_SORT_LIMIT, includes_tde_class);
+#if defined (SERVER_MODE)
+  parallelism = prm_get_integer_value (PRM_ID_INDEX_LOAD_PARALLELISM);
+#endif /* SERVER_MODE */
+  if (parallelism > 1)
+    {
+      return btree_index_sort_parallel (thread_p, sort_args, parallelism, out_func, out_args, includes_tde_class);
+    }
+
+  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0, &btree_sort_get_next, sort_args, out_func,
+			out_args, compare_driver, sort_args, SORT_DUP, NO_SORT_LIMIT, includes_tde_class);
+}
+
+/*
+ * btree_index_sort_parallel () - Sort for the index file creation, with several threads scanning the heaps
+ *   return: int
+ *   sort_args(in/out): sort arguments; its scan is started and it gets the counters of all threads
+ *   parallelism(in): number of threads to scan the heaps and sort the runs
+ *   out_func(in): output function to utilize the sorted items as they are produced
+ *   out_args(in): arguments to the out_func
+ *   includes_tde_class(in): whether the sort files must be encrypted
+ *
+ * Note: The threads take the heap pages one by one from a shared cursor, each with a copy of the sort arguments,
+ *       and each sorts its items into runs. The runs are merged as usual and given to out_func in this thread.
+ */
+static int
+btree_index_sort_parallel (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, int parallelism, SORT_PUT_FUNC * out_func,
+			   void *out_args, bool includes_tde_class)
+{
+  // *INDENT-OFF*
+  index_builder_page_cursor page_cursor (sort_args->hfids, sort_args->class_ids, sort_args->cur_class,
+					 sort_args->n_classes);
+  // *INDENT-ON*
+  SORT_ARGS *scan_args;
+  void **get_args;
+  int i;
+  int error;
+
+  scan_args = (SORT_ARGS *) malloc (parallelism * sizeof (SORT_ARGS));
+  get_args = (void **) malloc (parallelism * sizeof (void *));
+  if (scan_args == NULL || get_args == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      parallelism * (sizeof (SORT_ARGS) + sizeof (void *)));
+      free_and_init (scan_args);
+      free_and_init (get_args);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  /* the arguments of the load, whose scan is already started, go to the first thread */
+  sort_args->page_cursor = &page_cursor;
+  get_args[0] = sort_args;
+  for (i = 1; i < parallelism; i++)
+    {
+      bt_load_init_scan_copy (&scan_args[i], sort_args, &page_cursor);
+      get_args[i] = &scan_args[i];
+    }
+
+  error = sort_listfile_parallel (thread_p, sort_args->hfids[0].vfid.volid, 0, parallelism, &btree_sort_get_next,
+				  get_args, bt_load_scan_copy_start, bt_load_scan_copy_end, out_func, out_args,
+				  compare_driver, sort_args, includes_tde_class);
+
+  for (i = 1; i < parallelism; i++)
+    {
+      sort_args->n_oids += scan_args[i].n_oids;
+      sort_args->n_nulls += scan_args[i].n_nulls;
+    }
+  sort_args->page_cursor = NULL;
+
+  free_and_init (scan_args);
+  free_and_init (get_args);
+
+  return error;
 }
 
 /*
@@ -3283,13 +3575,21 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
        * RETRIEVE THE NEXT OBJECT
        */
 
+      sort_args->in_recdes.data = NULL;
+      if (sort_args->page_cursor != NULL)
+	{
+	  /* the heaps are scanned by several threads, the cursor also moves to the next class */
+	  scan_result = bt_load_heap_next_from_cursor (thread_p, sort_args, &prev_oid);
+	}
+      else
+	{
+	  scan_result =
+	    heap_next (thread_p, &sort_args->hfids[sort_args->cur_class], &sort_args->class_ids[sort_args->cur_class],
+		       &sort_args->cur_oid, &sort_args->in_recdes, &sort_args->hfscan_cache,
+		       sort_args->hfscan_cache.cache_last_fix_page ? PEEK : COPY);
+	}
       cur_class = sort_args->cur_class;
       attr_offset = cur_class * sort_args->n_attrs;
-      sort_args->in_recdes.data = NULL;
-      scan_result =
-	heap_next (thread_p, &sort_args->hfids[cur_class], &sort_args->class_ids[cur_class], &sort_args->cur_oid,
-		   &sort_args->in_recdes, &sort_args->hfscan_cache,
-		   sort_args->hfscan_cache.cache_last_fix_page ? PEEK : COPY);
 
       switch (scan_result)
 	{
@@ -3297,6 +3597,11 @@ btree_sort_get_next (THREAD_ENTRY * thread_p, RECDES * temp_recdes, void *arg)
 	  break;
 
 	case S_END:
+	  if (sort_args->page_cursor != NULL)
+	    {
+	      return SORT_NOMORE_RECS;
+	    }
+
 	  /* No more objects in this heap, finish the current scan */
 	  save_cache_last_fix_page = sort_args->hfscan_cache.cache_last_fix_page;
 	  bt_load_heap_scancache_end_for_attrinfo (thread_p, sort_args, NULL, NULL);
@@ -4749,7 +5054,7 @@ xbtree_load_online_index (THREAD_ENTRY * thread_p, BTID * btid, const char *bt_n
       /* Start the online index builder. */
       ret = online_index_builder (thread_p, &btid_int, &hfids[cur_class], &class_oids[cur_class], n_classes, attr_ids,
 				  n_attrs, func_index_info, filter_pred, attrs_prefix_length, &attr_info, &scan_cache,
-				  unique_pk, ib_thread_count, key_type);
+				  unique_pk, ib_thread_count, key_type, pred_stream, pred_stream_size);
       if (ret != NO_ERROR)
 	{
 	  break;
@@ -4874,7 +5179,8 @@ static int
 online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids, OID * class_oids, int n_classes,
 		      int *attrids, int n_attrs, FUNCTION_INDEX_INFO func_idx_info,
 		      PRED_EXPR_WITH_CONTEXT * filter_pred, int *attrs_prefix_length, HEAP_CACHE_ATTRINFO * attr_info,
-		      HEAP_SCANCACHE * scancache, int unique_pk, int ib_thread_count, TP_DOMAIN * key_type)
+		      HEAP_SCANCACHE * scancache, int unique_pk, int ib_thread_count, TP_DOMAIN * key_type,
+		      char *pred_stream, int pred_stream_size)
 {
   int ret = NO_ERROR, eval_res;
   OID cur_oid;
@@ -4887,7 +5193,7 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
   int attr_offset;
   DB_VALUE *p_dbvalue;
   int *p_prefix_length;
-  uint64_t tasks_started = 0;
+  std::atomic<std::uint64_t> tasks_started = {0};
   char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
   index_builder_loader_context load_context;
   bool is_parallel = ib_thread_count > 0;
@@ -4926,90 +5232,181 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
 
   p_prefix_length = (attrs_prefix_length) ?  &(attrs_prefix_length[0]) : NULL;	
 
-  /* Start extracting from heap. */
-  for (;;)
-    {
-      DB_VALUE dbvalue;
+  if (is_parallel)
+    {
+      /* The heap is scanned by as many threads as the loader pool has, which make the tasks of the loader pool. */
+      index_builder_page_cursor page_cursor (hfids, class_oids, 0, 1);
+      SORT_ARGS load_args;
+      SORT_ARGS *scan_args;
+      cubthread::entry_workpool *scan_workpool;
+      std::atomic<int> scans_finished = {0};
+      int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+      bool dummy_continue_checking = true;
+
+      memset (&load_args, 0, sizeof (SORT_ARGS));
+      load_args.unique_pk = unique_pk;
+      load_args.hfids = hfids;
+      load_args.class_ids = class_oids;
+      load_args.n_attrs = n_attrs;
+      load_args.attr_ids = attrids;
+      load_args.attrs_prefix_length = attrs_prefix_length;
+      load_args.key_type = key_type;
+      load_args.n_classes = 1;
+      load_args.btid = btid_int;
+      load_args.func_index_info = p_func_idx_info;
+      load_args.cache_last_fix_page = false;
+      load_args.mvcc_snapshot = scancache->mvcc_snapshot;
+      load_args.pred_stream = pred_stream;
+      load_args.pred_stream_size = pred_stream_size;
+
+      scan_args = (SORT_ARGS *) malloc (ib_thread_count * sizeof (SORT_ARGS));
+      if (scan_args == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, ib_thread_count * sizeof (SORT_ARGS));
+	  ret = ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      else
+	{
+	  scan_workpool =
+	    thread_get_manager ()->create_worker_pool (ib_thread_count, ib_thread_count, "Online index scan pool",
+						       &load_context, 1, btree_is_worker_pool_logging_true ());
 
-      db_make_null (&dbvalue);
+	  for (int i = 0; i < ib_thread_count; i++)
+	    {
+	      SORT_ARGS *args = &scan_args[i];
+
+	      bt_load_init_scan_copy (args, &load_args, &page_cursor);
+	      cubthread::entry_callable_task *task =
+		new cubthread::entry_callable_task ([&, args] (cubthread::entry &thread_ref)
+		  {
+		    // the scan sees the objects with the snapshot of the transaction of the load
+		    thread_ref.tran_index = tran_index;
+
+		    int error = online_index_builder_scan (&thread_ref, args, load_context, ib_workpool, tasks_started,
+							   num_keys, num_oids, num_nulls);
+		    if (error != NO_ERROR && !load_context.m_has_error.exchange (true))
+		      {
+			load_context.m_error_code = error;
+		      }
+		    scans_finished++;
+		  });
+	      thread_get_manager ()->push_task (scan_workpool, task);
+	    }
 
-      /* Scan from heap and insert into the index. */
-      attr_offset = cur_class * n_attrs;
+	  while (scans_finished < ib_thread_count)
+	    {
+	      thread_sleep (10);
 
-      cur_record.data = NULL;
+	      if (ret == NO_ERROR && logtb_is_interrupted (thread_p, true, &dummy_continue_checking))
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+		  ret = ER_INTERRUPTED;
 
-      sc = heap_next (thread_p, &hfids[cur_class], &class_oids[cur_class], &cur_oid, &cur_record, scancache, COPY);
-      if (sc != S_SUCCESS)
-        {
-          if (sc != S_END)
-            {
-                if (sc == S_ERROR)
-                  {
-                     ASSERT_ERROR_AND_SET (ret);
-                     break;
-                  }
-               assert (false);
-            }
-            break;
-        }
+		  /* Also stop all threads. */
+		  if (!load_context.m_has_error.exchange (true))
+		    {
+		      load_context.m_error_code = ret;
+		    }
+		}
+	    }
 
-      /* Make sure the scan was a success. */      
-      assert (!OID_ISNULL (&cur_oid));
+	  thread_get_manager ()->destroy_worker_pool (scan_workpool);
+	  free_and_init (scan_args);
 
-      if (filter_pred)
+	  if (ret == NO_ERROR && load_context.m_has_error)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
+	      ret = load_context.m_error_code;
+	    }
+	}
+    }
+  else
+    {
+      /* Start extracting from heap. */
+      for (;;)
 	{
-	  ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, filter_pred->cache_pred);
-	  if (ret != NO_ERROR)
+	  DB_VALUE dbvalue;
+
+	  db_make_null (&dbvalue);
+
+	  /* Scan from heap and insert into the index. */
+	  attr_offset = cur_class * n_attrs;
+
+	  cur_record.data = NULL;
+
+	  sc = heap_next (thread_p, &hfids[cur_class], &class_oids[cur_class], &cur_oid, &cur_record, scancache, COPY);
+	  if (sc != S_SUCCESS)
 	    {
-	      break;
+	      if (sc != S_END)
+		{
+		    if (sc == S_ERROR)
+		      {
+			 ASSERT_ERROR_AND_SET (ret);
+			 break;
+		      }
+		   assert (false);
+		}
+		break;
 	    }
 
-	  eval_res = (*filter_eval_fnc) (thread_p, filter_pred->pred, NULL, &cur_oid);
-	  if (eval_res == V_ERROR)
+	  /* Make sure the scan was a success. */      
+	  assert (!OID_ISNULL (&cur_oid));
+
+	  if (filter_pred)
+	    {
+	      ret = heap_attrinfo_read_dbvalues (thread_p, &cur_oid, &cur_record, filter_pred->cache_pred);
+	      if (ret != NO_ERROR)
+		{
+		  break;
+		}
+
+	      eval_res = (*filter_eval_fnc) (thread_p, filter_pred->pred, NULL, &cur_oid);
+	      if (eval_res == V_ERROR)
+		{
+		  ret = ER_FAILED;
+		  break;
+		}
+	      else if (eval_res != V_TRUE)
+		{
+		  continue;
+		}
+	    }
+
+	  /* Generate the key : provide key_type domain - needed for compares during sort */
+	  p_dbvalue = heap_attrinfo_generate_key (thread_p, n_attrs, &attrids[attr_offset], p_prefix_length, attr_info,
+						  &cur_record, &dbvalue, aligned_midxkey_buf, p_func_idx_info, key_type, &cur_oid);
+	  if (p_dbvalue == NULL)
 	    {
 	      ret = ER_FAILED;
 	      break;
 	    }
-	  else if (eval_res != V_TRUE)
+
+	  /* Dispatch the insert operation */
+	  if (load_task == NULL)
 	    {
-	      continue;
+	      // create a new task
+	      load_task.reset (new index_builder_loader_task (btid_int->sys_btid, &class_oids[cur_class], unique_pk,
+							      load_context, num_keys, num_oids, num_nulls));
+	    }
+	  if (load_task->add_key (p_dbvalue, cur_oid) == index_builder_loader_task::BATCH_FULL)
+	    {
+	      // send task to worker pool for execution
+	      thread_get_manager ()->push_task (ib_workpool, load_task.release ());
+	      /* Increment tasks started. */
+	      tasks_started++;
 	    }
-	}
-
-/* Generate the key : provide key_type domain - needed for compares during sort */
-      p_dbvalue = heap_attrinfo_generate_key (thread_p, n_attrs, &attrids[attr_offset], p_prefix_length, attr_info,
-					      &cur_record, &dbvalue, aligned_midxkey_buf, p_func_idx_info, key_type, &cur_oid);
-      if (p_dbvalue == NULL)
-	{
-	  ret = ER_FAILED;
-	  break;
-	}
-
-      /* Dispatch the insert operation */
-      if (load_task == NULL)
-        {
-          // create a new task
-	  load_task.reset (new index_builder_loader_task (btid_int->sys_btid, &class_oids[cur_class], unique_pk,
-							  load_context, num_keys, num_oids, num_nulls));
-        }
-      if (load_task->add_key (p_dbvalue, cur_oid) == index_builder_loader_task::BATCH_FULL)
-        {
-          // send task to worker pool for execution
-	  thread_get_manager ()->push_task (ib_workpool, load_task.release ());
-	  /* Increment tasks started. */
-	  tasks_started++;
-        }
 
-      /* Clear index key. */
-      pr_clear_value (p_dbvalue);
+	  /* Clear index key. */
+	  pr_clear_value (p_dbvalue);
 
-      /* Check for possible errors. */
-      if (load_context.m_has_error)
-	{
-	  /* Also stop all threads. */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
-	  ret = load_context.m_error_code;
-	  break;
+	  /* Check for possible errors. */
+	  if (load_context.m_has_error)
+	    {
+	      /* Also stop all threads. */
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IB_ERROR_ABORT, 0);
+	      ret = load_context.m_error_code;
+	      break;
+	    }
 	}
     }
 
@@ -5061,12 +5458,161 @@ online_index_builder (THREAD_ENTRY * thread_p, BTID_INT * btid_int, HFID * hfids
   return ret;
 }
 
+/*
+ * online_index_builder_scan () - Scan the heap pages handed out to a thread of the online index builder
+ *   return: NO_ERROR or error code
+ *   scan_args(in/out): arguments of the thread (see bt_load_init_scan_copy)
+ *   load_context(in): loader context shared by all threads
+ *   ib_workpool(in): loader pool that inserts the keys
+ *   tasks_started(in/out): number of tasks pushed to the loader pool
+ *   num_keys(in/out), num_oids(in/out), num_nulls(in/out): statistics of unique indexes, counted by the loader tasks
+ *
+ * Note: It stops as soon as any thread has failed.
+ */
+static int
+online_index_builder_scan (THREAD_ENTRY * thread_p, SORT_ARGS * scan_args, index_builder_loader_context &load_context,
+			   cubthread::entry_workpool *ib_workpool, std::atomic<std::uint64_t> &tasks_started,
+			   std::atomic<int> &num_keys, std::atomic<int> &num_oids, std::atomic<int> &num_nulls)
+{
+  int ret = NO_ERROR, eval_res;
+  OID prev_oid;
+  SCAN_CODE sc;
+  int attr_offset;
+  DB_VALUE *p_dbvalue;
+  int *p_prefix_length;
+  char midxkey_buf[DBVAL_BUFSIZE + MAX_ALIGNMENT], *aligned_midxkey_buf;
+  std::unique_ptr<index_builder_loader_task> load_task = NULL;
+
+  aligned_midxkey_buf = PTR_ALIGN (midxkey_buf, MAX_ALIGNMENT);
+  p_prefix_length = (scan_args->attrs_prefix_length) ? &(scan_args->attrs_prefix_length[0]) : NULL;
+
+  ret = bt_load_scan_copy_start (thread_p, scan_args);
+
+  while (ret == NO_ERROR && !load_context.m_has_error)
+    {
+      DB_VALUE dbvalue;
+
+      db_make_null (&dbvalue);
+
+      scan_args->in_recdes.data = NULL;
+      sc = bt_load_heap_next_from_cursor (thread_p, scan_args, &prev_oid);
+      if (sc == S_END)
+	{
+	  break;
+	}
+      else if (sc != S_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (ret);
+	  break;
+	}
+      attr_offset = scan_args->cur_class * scan_args->n_attrs;
+
+      if (scan_args->filter != NULL)
+	{
+	  ret = heap_attrinfo_read_dbvalues (thread_p, &scan_args->cur_oid, &scan_args->in_recdes,
+					     scan_args->filter->cache_pred);
+	  if (ret != NO_ERROR)
+	    {
+	      break;
+	    }
+
+	  eval_res = (*scan_args->filter_eval_func) (thread_p, scan_args->filter->pred, NULL, &scan_args->cur_oid);
+	  if (eval_res == V_ERROR)
+	    {
+	      ret = ER_FAILED;
+	      break;
+	    }
+	  else if (eval_res != V_TRUE)
+	    {
+	      continue;
+	    }
+	}
+
+      p_dbvalue = heap_attrinfo_generate_key (thread_p, scan_args->n_attrs, &scan_args->attr_ids[attr_offset],
+					      p_prefix_length, &scan_args->attr_info, &scan_args->in_recdes, &dbvalue,
+					      aligned_midxkey_buf, scan_args->func_index_info, scan_args->key_type,
+					      &scan_args->cur_oid);
+      if (p_dbvalue == NULL)
+	{
+	  ret = ER_FAILED;
+	  break;
+	}
+
+      if (load_task == NULL)
+	{
+	  load_task.reset (new index_builder_loader_task (scan_args->btid->sys_btid,
+							  &scan_args->class_ids[scan_args->cur_class],
+							  scan_args->unique_pk, load_context, num_keys, num_oids,
+							  num_nulls));
+	}
+      if (load_task->add_key (p_dbvalue, scan_args->cur_oid) == index_builder_loader_task::BATCH_FULL)
+	{
+	  tasks_started++;
+	  thread_get_manager ()->push_task (ib_workpool, load_task.release ());
+	}
+
+      pr_clear_value (p_dbvalue);
+    }
+
+  if (ret == NO_ERROR && load_task != NULL && load_task->has_keys ())
+    {
+      // one last task
+      tasks_started++;
+      thread_get_manager ()->push_task (ib_workpool, load_task.release ());
+    }
+
+  bt_load_scan_copy_end (thread_p, scan_args);
+
+  return ret;
+}
+
 static bool
 btree_is_worker_pool_logging_true ()
 {
   return cubthread::is_logging_configured (cubthread::LOG_WORKER_POOL_INDEX_BUILDER);
 }
 
+index_builder_page_cursor::index_builder_page_cursor (HFID *hfids, OID *class_oids, int first_class, int end_class)
+  : m_mutex ()
+  , m_hfids (hfids)
+  , m_class_oids (class_oids)
+  , m_cur_class (first_class)
+  , m_end_class (end_class)
+{
+  VPID_SET_NULL (&m_vpid);
+}
+
+SCAN_CODE
+index_builder_page_cursor::next_page (THREAD_ENTRY *thread_p, int &cur_class, VPID &vpid)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  SCAN_CODE scan;
+
+  while (m_cur_class < m_end_class)
+    {
+      if (!HFID_IS_NULL (&m_hfids[m_cur_class]))
+	{
+	  scan = heap_page_next (thread_p, &m_class_oids[m_cur_class], &m_hfids[m_cur_class], &m_vpid, NULL);
+	  if (scan == S_SUCCESS)
+	    {
+	      cur_class = m_cur_class;
+	      vpid = m_vpid;
+	      return S_SUCCESS;
+	    }
+	  else if (scan != S_END)
+	    {
+	      return scan;
+	    }
+	}
+
+      /* go on with the heap of the next class */
+      m_cur_class++;
+      VPID_SET_NULL (&m_vpid);
+    }
+
+  return S_END;
+}
+
 void
 index_builder_loader_context::on_create (context_type &context)
 {
@@ -5100,7 +5646,6 @@ index_builder_loader_task::index_builder_loader_task (const BTID *btid, const OI
   BTID_COPY (&m_btid, btid);
   COPY_OID (&m_class_oid, class_oid);
   m_unique_pk = unique_pk;
-  m_load_context.m_has_error = false;
   m_memsize = 0;
 }
 
@@ -41,6 +41,7 @@
 #include "slotted_page.h"
 #include "overflow_file.h"
 #include "boot_sr.h"
+#include "query_manager.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -51,6 +52,7 @@
 #include "thread_entry_task.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info and thread_sleep
 
+#include <atomic>
 #include <functional>
 
 /* Estimate on number of pages in the multipage temporary file */
@@ -70,6 +72,12 @@
  */
 #define SORT_MIN_HALF_FILES      2
 
+/* Lower limit on the number of buffers given to each thread of a parallel internal sorting phase */
+#define SORT_PX_MIN_BUFFERS      16
+
+/* Size of the area keeping the error of a thread of a parallel internal sorting phase */
+#define SORT_PX_ERROR_AREA_SIZE  1024
+
 /* Initial size of the dynamic array that keeps the file contents list */
 #define SORT_INITIAL_DYN_ARRAY_SIZE 30
 
@@ -155,6 +163,7 @@ struct sort_param
 				 * files during merging phase */
   int tot_runs;			/* Total number of runs */
   int tot_buffers;		/* Size of internal memory used in terms of number of buffers it occupies */
+  QMGR_MEMORY_GRANT memory_grant;	/* internal memory granted by the query memory broker */
   int tot_tempfiles;		/* Total number of temporary files */
   int half_files;		/* Half number of temporary files */
   int in_half;			/* Which half of temp files is for input */
@@ -185,6 +194,64 @@ struct sort_param
   PX_TREE_NODE *px_array;	/* px_node array */
 };
 
+#if defined(SERVER_MODE)
+/* State shared by the threads of a parallel internal sorting phase */
+typedef struct sort_px_inphase SORT_PX_INPHASE;
+struct sort_px_inphase
+{
+  SORT_PARAM *sort_param;
+  int out_curfile;		/* Temp file receiving the next run; access through px_mtx */
+  int cur_page[SORT_MAX_HALF_FILES];	/* Current page of each temp file; access through px_mtx */
+  std::atomic<bool> has_error;	/* Set by the first thread that fails; the others stop */
+  int error_code;		/* Error of the first thread that failed */
+  alignas (int) char error_area[SORT_PX_ERROR_AREA_SIZE];	/* and its message, see er_get_area_error */
+  std::atomic<int> n_finished;	/* Number of pushed threads that are done */
+};
+
+/* A thread of a parallel internal sorting phase */
+typedef struct sort_px_worker SORT_PX_WORKER;
+struct sort_px_worker
+{
+  SORT_PX_INPHASE *inphase;
+  SORT_GET_FUNC *get_fn;
+  void *get_arg;		/* Arguments of this thread for get_fn */
+  SORT_GET_START_FUNC *get_start_fn;
+  SORT_GET_END_FUNC *get_end_fn;
+  char *memory;			/* Part of the internal memory used by this thread */
+  int num_buffers;		/* Size of the part in terms of number of buffers */
+  int tran_index;		/* Transaction of the sort; the temp files belong to it */
+  unsigned int numrecs;		/* Number of records sorted by this thread */
+};
+
+// *INDENT-OFF*
+class sort_px_worker_context : public cubthread::entry_manager
+{
+  public:
+    css_conn_entry *m_conn;
+
+    sort_px_worker_context () = default;
+
+  protected:
+    void on_create (context_type &context) override
+    {
+      context.claim_system_worker ();
+      context.conn_entry = m_conn;
+    }
+
+    void on_retire (context_type &context) override
+    {
+      context.retire_system_worker ();
+      context.conn_entry = NULL;
+    }
+
+    void on_recycle (context_type &context) override
+    {
+      context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+    }
+};
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 typedef struct sort_rec_list SORT_REC_LIST;
 struct sort_rec_list
 {
@@ -253,6 +320,26 @@ static int px_sort_communicate (PX_TREE_NODE * px_node);
 
 static int sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FUNC * get_next,
 			      void *arguments, unsigned int *total_numrecs);
+#if defined(SERVER_MODE)
+static int sort_inphase_sort_parallel (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int parallelism,
+				       SORT_GET_FUNC * get_fn, void **get_args, SORT_GET_START_FUNC * get_start_fn,
+				       SORT_GET_END_FUNC * get_end_fn, unsigned int *total_numrecs);
+static void sort_px_worker_run (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker);
+static int sort_px_inphase_sort (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker);
+static int sort_px_sort_and_flush (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker, char *output_buffer,
+				   char **index_area, char **index_buff, long numrecs);
+static int sort_px_flush_long_record (THREAD_ENTRY * thread_p, SORT_PX_INPHASE * inphase, char *output_buffer,
+				      char *item_ptr, RECDES * long_recdes);
+static int sort_px_run_flush (THREAD_ENTRY * thread_p, SORT_PX_INPHASE * inphase, char *output_buffer,
+			      char **index_area, int numrecs, int rec_type);
+static int sort_put_single_run (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
+#endif /* SERVER_MODE */
+static int sort_listfile_internal (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, int parallelism,
+				   SORT_GET_FUNC * get_fn, void **get_args, SORT_GET_START_FUNC * get_start_fn,
+				   SORT_GET_END_FUNC * get_end_fn, SORT_PUT_FUNC * put_fn, void *put_arg,
+				   SORT_CMP_FUNC * cmp_fn, void *cmp_arg, SORT_DUP_OPTION option, int limit,
+				   bool includes_tde_class);
+static int sort_add_multipage_file (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
 static int sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
 static int sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
 static int sort_get_avg_numpages_of_nonempty_tmpfile (SORT_PARAM * sort_param);
@@ -1345,6 +1432,56 @@ int
 sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn, void *get_arg,
 	       SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg, SORT_DUP_OPTION option,
 	       int limit, bool includes_tde_class)
+{
+  return sort_listfile_internal (thread_p, volid, est_inp_pg_cnt, 1, get_fn, &get_arg, NULL, NULL, put_fn, put_arg,
+				 cmp_fn, cmp_arg, option, limit, includes_tde_class);
+}
+
+/*
+ * sort_listfile_parallel () - Perform sorting, getting the sort items by several threads
+ *   return:
+ *   volid(in):  volume to keep the temporary files
+ *   est_inp_pg_cnt(in): estimated number of input pages, or -1
+ *   parallelism(in): number of threads getting and sorting the sort items, the current one included
+ *   get_fn(in): user-supplied function providing the next sort item, see sort_listfile; it is called concurrently,
+ *               each thread with its own arguments
+ *   get_args(in): array of parallelism arguments to the get_fn function
+ *   get_start_fn(in): called by each thread on its arguments before it calls get_fn; may be NULL
+ *   get_end_fn(in): called by each thread on its arguments after it is done with get_fn, even if get_start_fn
+ *                   failed; may be NULL
+ *   put_fn(in): user-supplied function applied on the sorted items, see sort_listfile
+ *   put_arg(in): arguments to the put_fn function
+ *   cmp_fn(in): user-supplied function for comparing records to be sorted
+ *   cmp_arg(in): arguments to the cmp_fn function
+ *   includes_tde_class(in): whether tde-configured class data is included or not
+ *
+ * Note: Duplicates are kept and there is no limit. The internal memory is split among the threads, so fewer threads
+ *       are used when it is small; the arguments of the threads not used are left untouched and the caller must not
+ *       expect their items to be sorted unless get_fn shares the input among all the arguments it is given.
+ *       In SA_MODE, the sort items are got by the current thread only, through get_args[0].
+ */
+int
+sort_listfile_parallel (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, int parallelism,
+			SORT_GET_FUNC * get_fn, void **get_args, SORT_GET_START_FUNC * get_start_fn,
+			SORT_GET_END_FUNC * get_end_fn, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn,
+			void *cmp_arg, bool includes_tde_class)
+{
+  return sort_listfile_internal (thread_p, volid, est_inp_pg_cnt, parallelism, get_fn, get_args, get_start_fn,
+				 get_end_fn, put_fn, put_arg, cmp_fn, cmp_arg, SORT_DUP, NO_SORT_LIMIT,
+				 includes_tde_class);
+}
+
+/*
+ * sort_listfile_internal () - Perform sorting
+ *   return:
+ *
+ * Note: see sort_listfile and sort_listfile_parallel.
+ */
+static int
+sort_listfile_internal (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, int parallelism,
+			SORT_GET_FUNC * get_fn, void **get_args, SORT_GET_START_FUNC * get_start_fn,
+			SORT_GET_END_FUNC * get_end_fn, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn,
+			void *cmp_arg, SORT_DUP_OPTION option, int limit, bool includes_tde_class)
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
@@ -1353,6 +1490,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
+  QUERY_ID query_id;
 #if defined(SERVER_MODE)
   int num_cpus;
   int rv;
@@ -1402,6 +1540,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       sort_param->file_contents[i].num_pages = NULL;
     }
   sort_param->internal_memory = NULL;
+  QMGR_MEMORY_GRANT_INIT (&sort_param->memory_grant);
   sort_param->px_height_max = sort_param->px_array_size = 0;
   sort_param->px_array = NULL;
 
@@ -1431,6 +1570,23 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->tot_buffers = MIN (prm_get_integer_value (PRM_ID_SR_NBUFFERS), input_pages);
   sort_param->tot_buffers = MAX (4, sort_param->tot_buffers);
 
+  /* The sort buffer of a query is granted by the query memory broker. When the grant is denied, sort with the minimum
+   * number of buffers and merge more runs. Sorts outside of queries (e.g. index loading, which holds a class lock)
+   * neither wait for nor depend on the broker. */
+  query_id = qmgr_get_current_query_id (thread_p);
+  if (query_id != NULL_QUERY_ID)
+    {
+      if (qmgr_request_memory_grant (thread_p, query_id, (UINT64) 4 * DB_PAGESIZE,
+				     (UINT64) sort_param->tot_buffers * DB_PAGESIZE, true, &sort_param->memory_grant) > 0)
+	{
+	  sort_param->tot_buffers = (int) (sort_param->memory_grant.size / DB_PAGESIZE);
+	}
+      else
+	{
+	  sort_param->tot_buffers = 4;
+	}
+    }
+
   sort_param->internal_memory = (char *) malloc ((size_t) sort_param->tot_buffers * (size_t) DB_PAGESIZE);
   if (sort_param->internal_memory == NULL)
     {
@@ -1445,6 +1601,8 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 	}
     }
 
+  qmgr_shrink_memory_grant (&sort_param->memory_grant, (UINT64) sort_param->tot_buffers * DB_PAGESIZE);
+
   sort_param->half_files = sort_get_num_half_tmpfiles (sort_param->tot_buffers, input_pages);
   sort_param->tot_tempfiles = sort_param->half_files << 1;
   sort_param->in_half = 0;
@@ -1455,8 +1613,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       sort_param->temp[i].volid = NULL_VOLID;
 
       /* Initilize file contents list */
-      sort_param->file_contents[i].num_pages =
-	(int *) db_private_alloc (thread_p, SORT_INITIAL_DYN_ARRAY_SIZE * sizeof (int));
+      sort_param->file_contents[i].num_pages = (int *) malloc (SORT_INITIAL_DYN_ARRAY_SIZE * sizeof (int));
       if (sort_param->file_contents[i].num_pages == NULL)
 	{
 	  sort_param->tot_tempfiles = i;
@@ -1513,7 +1670,40 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
    * space that is going to be needed.
    */
 
-  error = sort_inphase_sort (thread_p, sort_param, get_fn, get_arg, &total_numrecs);
+#if defined(SERVER_MODE)
+  /* each thread needs a part of the internal memory big enough to produce runs of some length */
+  if (option != SORT_DUP || limit != NO_SORT_LIMIT)
+    {
+      parallelism = 1;
+    }
+  parallelism = MIN (parallelism, sort_param->tot_buffers / SORT_PX_MIN_BUFFERS);
+#else /* SERVER_MODE */
+  parallelism = 1;
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+  if (parallelism > 1)
+    {
+      error =
+	sort_inphase_sort_parallel (thread_p, sort_param, parallelism, get_fn, get_args, get_start_fn, get_end_fn,
+				    &total_numrecs);
+    }
+  else
+#endif /* SERVER_MODE */
+    {
+      if (get_start_fn != NULL)
+	{
+	  error = (*get_start_fn) (thread_p, get_args[0]);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = sort_inphase_sort (thread_p, sort_param, get_fn, get_args[0], &total_numrecs);
+	}
+      if (get_end_fn != NULL)
+	{
+	  (*get_end_fn) (thread_p, get_args[0]);
+	}
+    }
   if (error != NO_ERROR)
     {
       goto cleanup;
@@ -1545,6 +1735,13 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 	  error = sort_exphase_merge (thread_p, sort_param);
 	}
     }				/* if (sort_param->tot_runs > 1) */
+#if defined(SERVER_MODE)
+  else if (sort_param->tot_runs == 1 && parallelism > 1)
+    {
+      /* the threads flushed all their runs; there is nothing to merge */
+      error = sort_put_single_run (thread_p, sort_param);
+    }
+#endif /* SERVER_MODE */
 
 cleanup:
 
@@ -2423,28 +2620,10 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	      /* Put the record to the multipage area & put the pointer to internal memory area */
 
 	      /* If necessary create the multipage_file */
-	      if (sort_param->multipage_file.volid == NULL_VOLID)
+	      error = sort_add_multipage_file (thread_p, sort_param);
+	      if (error != NO_ERROR)
 		{
-		  TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
-		  /* Create the multipage file */
-		  sort_param->multipage_file.volid = sort_param->temp[0].volid;
-
-		  error = file_create_temp (thread_p, 1, &sort_param->multipage_file);
-		  if (error != NO_ERROR)
-		    {
-		      ASSERT_ERROR ();
-		      goto exit_on_error;
-		    }
-		  if (sort_param->tde_encrypted)
-		    {
-		      tde_algo = (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM);
-		    }
-		  if (file_apply_tde_algorithm (thread_p, &sort_param->multipage_file, tde_algo) != NO_ERROR)
-		    {
-		      file_temp_retire (thread_p, &sort_param->multipage_file);
-		      ASSERT_ERROR ();
-		      goto exit_on_error;
-		    }
+		  goto exit_on_error;
 		}
 
 	      /* Create a multipage record for this long record : insert to multipage_file and put the pointer as the
@@ -2654,6 +2833,561 @@ exit_on_error:
   return error;
 }
 
+/*
+ * sort_add_multipage_file () - Create the temporary file for sorting records longer than a page, if not created yet
+ *   return: NO_ERROR
+ *   sort_param(in): sort parameters
+ */
+static int
+sort_add_multipage_file (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
+{
+  TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
+  int error = NO_ERROR;
+
+  if (sort_param->multipage_file.volid != NULL_VOLID)
+    {
+      return NO_ERROR;
+    }
+
+  /* Create the multipage file */
+  sort_param->multipage_file.volid = sort_param->temp[0].volid;
+
+  error = file_create_temp (thread_p, 1, &sort_param->multipage_file);
+  if (error != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error;
+    }
+  if (sort_param->tde_encrypted)
+    {
+      tde_algo = (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM);
+    }
+  error = file_apply_tde_algorithm (thread_p, &sort_param->multipage_file, tde_algo);
+  if (error != NO_ERROR)
+    {
+      file_temp_retire (thread_p, &sort_param->multipage_file);
+      ASSERT_ERROR ();
+      return error;
+    }
+
+  return NO_ERROR;
+}
+
+#if defined(SERVER_MODE)
+/*
+ * sort_inphase_sort_parallel () - Internal sorting phase run by several threads
+ *   return: NO_ERROR
+ *   sort_param(in): sort parameters
+ *   parallelism(in): number of threads, the current one included
+ *   get_fn(in): user-supplied function: provides the temporary record for
+ *               the given input record
+ *   get_args(in): arguments for get_fn, one for each thread
+ *   get_start_fn(in): called by each thread on its arguments before get_fn, or NULL
+ *   get_end_fn(in): called by each thread on its arguments after get_fn, or NULL
+ *   total_numrecs(out): records sorted
+ *
+ * Note: The internal memory is split among the threads. Each of them gets records through its own arguments, sorts
+ *       them in its part of the memory and flushes them as runs to the temp files, which are shared under px_mtx.
+ *       Unlike sort_inphase_sort, the last run is flushed too and nothing is output here; the merging phase, or
+ *       sort_put_single_run when there is only one run, produces the output.
+ *       The current thread sorts with get_args[0]; the others are run by a worker pool on behalf of the transaction
+ *       of the sort. If the pool cannot be created, the current thread goes through all the arguments by itself.
+ *       The workers are system workers, so the file manager does not give them the temporary files cache of the
+ *       transaction, which only the thread of the transaction may use.
+ */
+static int
+sort_inphase_sort_parallel (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int parallelism, SORT_GET_FUNC * get_fn,
+			    void **get_args, SORT_GET_START_FUNC * get_start_fn, SORT_GET_END_FUNC * get_end_fn,
+			    unsigned int *total_numrecs)
+{
+  SORT_PX_INPHASE inphase;
+  SORT_PX_WORKER *workers;
+  sort_px_worker_context worker_context;
+  cubthread::entry_workpool *workpool;
+  int num_buffers;
+  int i;
+  int error = NO_ERROR;
+
+  assert (parallelism > 1);
+  assert (sort_param->option == SORT_DUP && sort_param->limit == NO_SORT_LIMIT);
+  assert (sort_param->half_files <= SORT_MAX_HALF_FILES);
+
+  workers = (SORT_PX_WORKER *) malloc (parallelism * sizeof (SORT_PX_WORKER));
+  if (workers == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, parallelism * sizeof (SORT_PX_WORKER));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  sort_param->tot_runs = 0;
+  *total_numrecs = 0;
+
+  inphase.sort_param = sort_param;
+  inphase.out_curfile = sort_param->in_half;
+  for (i = 0; i < sort_param->half_files; i++)
+    {
+      inphase.cur_page[i] = 0;
+    }
+  inphase.has_error = false;
+  inphase.error_code = NO_ERROR;
+  inphase.n_finished = 0;
+
+  num_buffers = sort_param->tot_buffers / parallelism;
+  assert (num_buffers >= SORT_PX_MIN_BUFFERS);
+
+  for (i = 0; i < parallelism; i++)
+    {
+      workers[i].inphase = &inphase;
+      workers[i].get_fn = get_fn;
+      workers[i].get_arg = get_args[i];
+      workers[i].get_start_fn = get_start_fn;
+      workers[i].get_end_fn = get_end_fn;
+      workers[i].memory = sort_param->internal_memory + (size_t) i * num_buffers * DB_PAGESIZE;
+      workers[i].num_buffers = num_buffers;
+      workers[i].tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+      workers[i].numrecs = 0;
+    }
+
+  worker_context.m_conn = thread_p->conn_entry;
+  workpool =
+    thread_get_manager ()->create_worker_pool (parallelism - 1, parallelism - 1, "external sort workers",
+					       &worker_context, 1, false);
+
+  for (i = 1; workpool != NULL && i < parallelism; i++)
+    {
+      SORT_PX_WORKER *worker = &workers[i];
+
+      // *INDENT-OFF*
+      cubthread::entry_callable_task *task = new cubthread::entry_callable_task ([worker] (cubthread::entry &thread_ref)
+        {
+          thread_ref.tran_index = worker->tran_index;
+          sort_px_worker_run (&thread_ref, worker);
+          worker->inphase->n_finished++;
+        });
+      // *INDENT-ON*
+      thread_get_manager ()->push_task (workpool, task);
+    }
+
+  sort_px_worker_run (thread_p, &workers[0]);
+
+  if (workpool != NULL)
+    {
+      /* the pushed threads stop soon after one of the threads fails */
+      while (inphase.n_finished < parallelism - 1)
+	{
+	  thread_sleep (10);
+	}
+      thread_get_manager ()->destroy_worker_pool (workpool);
+    }
+  else
+    {
+      for (i = 1; i < parallelism && !inphase.has_error; i++)
+	{
+	  sort_px_worker_run (thread_p, &workers[i]);
+	}
+    }
+
+  for (i = 0; i < parallelism; i++)
+    {
+      *total_numrecs += workers[i].numrecs;
+    }
+
+  if (inphase.has_error)
+    {
+      /* give the error of the thread that failed first to the thread of the sort */
+      (void) er_set_area_error (inphase.error_area);
+      error = inphase.error_code;
+      assert (error != NO_ERROR);
+    }
+
+  free_and_init (workers);
+
+  return error;
+}
+
+/*
+ * sort_px_worker_run () - Run a thread of a parallel internal sorting phase
+ *   return: void; the error, if any, is kept in the shared state
+ *   worker(in): the thread
+ */
+static void
+sort_px_worker_run (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker)
+{
+  SORT_PX_INPHASE *inphase = worker->inphase;
+  int error = NO_ERROR;
+  int length;
+
+  if (worker->get_start_fn != NULL)
+    {
+      error = (*worker->get_start_fn) (thread_p, worker->get_arg);
+    }
+  if (error == NO_ERROR)
+    {
+      error = sort_px_inphase_sort (thread_p, worker);
+    }
+
+  if (error != NO_ERROR && !inphase->has_error.exchange (true))
+    {
+      /* keep the first error to give it back to the thread of the sort */
+      length = SORT_PX_ERROR_AREA_SIZE;
+      (void) er_get_area_error (inphase->error_area, &length);
+      inphase->error_code = error;
+    }
+
+  if (worker->get_end_fn != NULL)
+    {
+      (*worker->get_end_fn) (thread_p, worker->get_arg);
+    }
+}
+
+/*
+ * sort_px_inphase_sort () - Internal sorting phase of a thread of a parallel sort
+ *   return: NO_ERROR
+ *   worker(in): the thread
+ *
+ * Note: This is sort_inphase_sort for SORT_DUP without limit, in the part of the internal memory of the thread.
+ *       It stops, with no error, when another thread has failed.
+ */
+static int
+sort_px_inphase_sort (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker)
+{
+  SORT_PX_INPHASE *inphase = worker->inphase;
+  SORT_STATUS status;
+  char *output_buffer;
+  RECDES temp_recdes;
+  RECDES long_recdes;		/* Record desc. for reading in long sorting records */
+  char *item_ptr;		/* Pointer to the first free location of the temp. records region of the memory */
+  long numrecs;			/* Number of records kept in the memory */
+  char **index_area;		/* Part of the memory keeping the addresses of records */
+  char **index_buff;		/* buffer area to sort indexes. */
+  int error = NO_ERROR;
+
+  output_buffer = worker->memory + ((long) (worker->num_buffers - 1) * DB_PAGESIZE);
+
+  numrecs = 0;
+  item_ptr = worker->memory + SORT_RECORD_LENGTH_SIZE;
+  index_area = (char **) (output_buffer - sizeof (char *));
+  index_buff = index_area - 1;
+  temp_recdes.area_size = SORT_MAXREC_LENGTH;
+  temp_recdes.length = 0;
+
+  long_recdes.area_size = 0;
+  long_recdes.data = NULL;
+
+  while (!inphase->has_error)
+    {
+      if ((char *) index_buff < item_ptr)
+	{
+	  /* The memory is already full */
+	  status = SORT_REC_DOESNT_FIT;
+	}
+      else
+	{
+	  /* The memory is not full; try to get the next item */
+	  temp_recdes.data = item_ptr;
+	  if (((int) ((char *) index_buff - item_ptr)) < SORT_MAXREC_LENGTH)
+	    {
+	      temp_recdes.area_size = (int) ((char *) index_buff - item_ptr) - (4 * sizeof (char *));
+	    }
+
+	  if (temp_recdes.area_size <= SSIZEOF (SORT_REC))
+	    {
+	      status = SORT_REC_DOESNT_FIT;
+	    }
+	  else
+	    {
+	      status = (*worker->get_fn) (thread_p, &temp_recdes, worker->get_arg);
+	      if (status == SORT_NOMORE_RECS)
+		{
+		  break;
+		}
+	    }
+	}
+
+      switch (status)
+	{
+	case SORT_ERROR_OCCURRED:
+	  ASSERT_ERROR_AND_SET (error);
+	  goto end;
+
+	case SORT_REC_DOESNT_FIT:
+	  if (numrecs > 0)
+	    {
+	      /* Sort the records of the memory and flush them as a run */
+	      error = sort_px_sort_and_flush (thread_p, worker, output_buffer, index_area + 1, index_buff, numrecs);
+	      if (error != NO_ERROR)
+		{
+		  goto end;
+		}
+
+	      numrecs = 0;
+	      item_ptr = worker->memory + SORT_RECORD_LENGTH_SIZE;
+	      index_area = (char **) (output_buffer - sizeof (char *));
+	      index_buff = index_area - 1;
+	      temp_recdes.area_size = SORT_MAXREC_LENGTH;
+	    }
+
+	  if (temp_recdes.length > SORT_MAXREC_LENGTH)
+	    {
+	      /* TAKE CARE OF LONG RECORD as a separate RUN */
+	      if (long_recdes.area_size < temp_recdes.length)
+		{
+		  if (long_recdes.data)
+		    {
+		      free_and_init (long_recdes.data);
+		    }
+
+		  long_recdes.area_size = temp_recdes.length;
+		  long_recdes.data = (char *) malloc (long_recdes.area_size);
+		  if (long_recdes.data == NULL)
+		    {
+		      error = ER_OUT_OF_VIRTUAL_MEMORY;
+		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, (size_t) long_recdes.area_size);
+		      goto end;
+		    }
+		}
+
+	      status = (*worker->get_fn) (thread_p, &long_recdes, worker->get_arg);
+	      if (status != SORT_SUCCESS)
+		{
+		  if (status == SORT_REC_DOESNT_FIT || status == SORT_NOMORE_RECS)
+		    {
+		      /* This should never happen */
+		      error = ER_GENERIC_ERROR;
+		      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+		    }
+		  else
+		    {
+		      ASSERT_ERROR_AND_SET (error);
+		    }
+		  goto end;
+		}
+
+	      error = sort_px_flush_long_record (thread_p, inphase, output_buffer, item_ptr, &long_recdes);
+	      if (error != NO_ERROR)
+		{
+		  goto end;
+		}
+	    }
+	  break;
+
+	case SORT_SUCCESS:
+	  /* Proceed the pointers */
+	  SORT_RECORD_LENGTH (item_ptr) = temp_recdes.length;
+	  *index_area = item_ptr;
+	  numrecs++;
+
+	  index_area--;
+	  index_buff--;		/* decrease once for pointer, once for pointer buffer */
+	  index_buff--;
+
+	  item_ptr += DB_ALIGN (temp_recdes.length, MAX_ALIGNMENT) + SORT_RECORD_LENGTH_SIZE;
+	  break;
+
+	default:
+	  /* This should never happen */
+	  error = ER_GENERIC_ERROR;
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	  goto end;
+	}
+    }
+
+  if (numrecs > 0 && !inphase->has_error)
+    {
+      /* The input has finished; flush whatever is left over in the memory as the last run of the thread */
+      error = sort_px_sort_and_flush (thread_p, worker, output_buffer, index_area + 1, index_buff, numrecs);
+    }
+
+end:
+  if (long_recdes.data)
+    {
+      free_and_init (long_recdes.data);
+    }
+
+  return error;
+}
+
+/*
+ * sort_px_sort_and_flush () - Sort the records kept in the memory of a thread and flush them as a run
+ *   return: NO_ERROR
+ *   worker(in): the thread
+ *   output_buffer(in): output buffer of the thread
+ *   index_area(in): pointers to the records
+ *   index_buff(in): buffer area to sort the pointers
+ *   numrecs(in): number of records
+ */
+static int
+sort_px_sort_and_flush (THREAD_ENTRY * thread_p, SORT_PX_WORKER * worker, char *output_buffer, char **index_area,
+			char **index_buff, long numrecs)
+{
+  index_area = sort_run_sort (thread_p, worker->inphase->sort_param, index_area, numrecs, 0, index_buff, &numrecs);
+  if (index_area == NULL || numrecs < 0)
+    {
+      return ER_FAILED;
+    }
+  worker->numrecs += numrecs;
+
+  return sort_px_run_flush (thread_p, worker->inphase, output_buffer, index_area, numrecs, REC_HOME);
+}
+
+/*
+ * sort_px_flush_long_record () - Put a record longer than a page to the multipage file and flush the pointer to it
+ *                                as a run of its own
+ *   return: NO_ERROR
+ *   inphase(in): shared state of the parallel internal sorting phase
+ *   output_buffer(in): output buffer of the thread
+ *   item_ptr(in): free location of the memory of the thread, to keep the pointer
+ *   long_recdes(in): the record
+ */
+static int
+sort_px_flush_long_record (THREAD_ENTRY * thread_p, SORT_PX_INPHASE * inphase, char *output_buffer, char *item_ptr,
+			   RECDES * long_recdes)
+{
+  SORT_PARAM *sort_param = inphase->sort_param;
+  int error = NO_ERROR;
+  int rv;
+
+  rv = pthread_mutex_lock (&sort_param->px_mtx);
+  assert (rv == NO_ERROR);
+
+  error = sort_add_multipage_file (thread_p, sort_param);
+  if (error == NO_ERROR
+      && overflow_insert (thread_p, &sort_param->multipage_file, (VPID *) item_ptr, long_recdes, FILE_TEMP) != NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+
+  pthread_mutex_unlock (&sort_param->px_mtx);
+
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  SORT_RECORD_LENGTH (item_ptr) = sizeof (VPID);
+
+  return sort_px_run_flush (thread_p, inphase, output_buffer, &item_ptr, 1, REC_BIGONE);
+}
+
+/*
+ * sort_px_run_flush () - Flush a run of a thread of a parallel sort to the next temp file
+ *   return: NO_ERROR
+ *   inphase(in): shared state of the parallel internal sorting phase
+ *   output_buffer(in): output buffer of the thread
+ *   index_area(in): ordered pointers to the records
+ *   numrecs(in): number of records of the run
+ *   rec_type(in): type of the records
+ */
+static int
+sort_px_run_flush (THREAD_ENTRY * thread_p, SORT_PX_INPHASE * inphase, char *output_buffer, char **index_area,
+		   int numrecs, int rec_type)
+{
+  SORT_PARAM *sort_param = inphase->sort_param;
+  int error = NO_ERROR;
+  int rv;
+
+  rv = pthread_mutex_lock (&sort_param->px_mtx);
+  assert (rv == NO_ERROR);
+
+  error =
+    sort_run_flush (thread_p, sort_param, inphase->out_curfile, inphase->cur_page, output_buffer, index_area, numrecs,
+		    rec_type);
+  if (error == NO_ERROR)
+    {
+      /* Switch to the next Temp file */
+      if (++inphase->out_curfile >= sort_param->half_files)
+	{
+	  inphase->out_curfile = sort_param->in_half;
+	}
+    }
+
+  pthread_mutex_unlock (&sort_param->px_mtx);
+
+  return error;
+}
+
+/*
+ * sort_put_single_run () - Output the records of the only run of the sort
+ *   return: NO_ERROR
+ *   sort_param(in): sort parameters
+ *
+ * Note: After a parallel internal sorting phase, all the runs are in the temp files. When there is only one, it is
+ *       read back page by page and its records are given to the output function.
+ */
+static int
+sort_put_single_run (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
+{
+  FILE_CONTENTS *file_contents = &sort_param->file_contents[sort_param->in_half];
+  char *input_buffer = sort_param->internal_memory;
+  RECDES temp_recdes;
+  RECDES long_recdes;
+  int num_pages;
+  int page, slot, numrecs;
+  int error = NO_ERROR;
+
+  assert (sort_param->tot_runs == 1 && file_contents->first_run == 0);
+
+  num_pages = file_contents->num_pages[file_contents->first_run];
+
+  long_recdes.area_size = 0;
+  long_recdes.data = NULL;
+
+  for (page = 0; page < num_pages; page++)
+    {
+      error = sort_read_area (thread_p, &sort_param->temp[sort_param->in_half], page, 1, input_buffer);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      numrecs = sort_spage_get_numrecs (input_buffer);
+      for (slot = 0; slot < numrecs; slot++)
+	{
+	  if (sort_spage_get_record (input_buffer, slot, &temp_recdes, PEEK) != S_SUCCESS)
+	    {
+	      assert_release (false);
+	      error = ER_GENERIC_ERROR;
+	      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	      goto end;
+	    }
+
+	  if (temp_recdes.type == REC_BIGONE)
+	    {
+	      if (sort_retrieve_longrec (thread_p, &temp_recdes, &long_recdes) == NULL)
+		{
+		  ASSERT_ERROR_AND_SET (error);
+		  goto end;
+		}
+	      error = (*sort_param->put_fn) (thread_p, &long_recdes, sort_param->put_arg);
+	    }
+	  else
+	    {
+	      /* cut-off link used in Internal Sort */
+	      ((SORT_REC *) temp_recdes.data)->next = NULL;
+	      error = (*sort_param->put_fn) (thread_p, &temp_recdes, sort_param->put_arg);
+	    }
+
+	  if (error != NO_ERROR)
+	    {
+	      if (error == SORT_PUT_STOP)
+		{
+		  error = NO_ERROR;
+		}
+	      goto end;
+	    }
+	}
+    }
+
+end:
+  if (long_recdes.data)
+    {
+      free_and_init (long_recdes.data);
+    }
+
+  return error;
+}
+#endif /* SERVER_MODE */
+
 /*
  * sort_run_flush () - Flush run
  *   return:
@@ -4417,6 +5151,7 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       free_and_init (sort_param->internal_memory);
     }
+  qmgr_release_memory_grant (&sort_param->memory_grant);
 
   for (k = 0; k < sort_param->tot_tempfiles; k++)
     {
@@ -4435,7 +5170,7 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       if (sort_param->file_contents[k].num_pages != NULL)
 	{
-	  db_private_free_and_init (thread_p, sort_param->file_contents[k].num_pages);
+	  free_and_init (sort_param->file_contents[k].num_pages);
 	}
     }
 
@@ -4864,6 +5599,7 @@ static int
 sort_run_add_new (FILE_CONTENTS * file_contents, int num_pages)
 {
   int new_total_elements;
+  int *new_num_pages;
   int ret = NO_ERROR;
 
   if (file_contents->first_run == -1)
@@ -4881,12 +5617,13 @@ sort_run_add_new (FILE_CONTENTS * file_contents, int num_pages)
   if (file_contents->last_run >= file_contents->num_slots)
     {
       new_total_elements = ((int) (((float) file_contents->num_slots * SORT_EXPAND_DYN_ARRAY_RATIO) + 0.5));
-      file_contents->num_pages =
-	(int *) db_private_realloc (NULL, file_contents->num_pages, new_total_elements * sizeof (int));
-      if (file_contents->num_pages == NULL)
+      new_num_pages = (int *) realloc (file_contents->num_pages, new_total_elements * sizeof (int));
+      if (new_num_pages == NULL)
 	{
-	  return ER_FAILED;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, new_total_elements * sizeof (int));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
 	}
+      file_contents->num_pages = new_num_pages;
       file_contents->num_slots = new_total_elements;
     }
 
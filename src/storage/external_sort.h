@@ -60,6 +60,10 @@ typedef SORT_STATUS SORT_GET_FUNC (THREAD_ENTRY * thread_p, RECDES *, void *);
 typedef int SORT_PUT_FUNC (THREAD_ENTRY * thread_p, const RECDES *, void *);
 typedef int SORT_CMP_FUNC (const void *, const void *, void *);
 
+/* called by each thread of a parallel sort on its get argument, before the first record and after the last one */
+typedef int SORT_GET_START_FUNC (THREAD_ENTRY * thread_p, void *);
+typedef void SORT_GET_END_FUNC (THREAD_ENTRY * thread_p, void *);
+
 typedef struct SORT_REC SORT_REC;
 typedef struct SUBKEY_INFO SUBKEY_INFO;
 typedef struct SORTKEY_INFO SORTKEY_INFO;
@@ -117,6 +121,9 @@ struct SUBKEY_INFO
   int is_nulls_first;
 
   bool use_cmp_dom;		/* when true, use cmp_dom to make comparing */
+
+  bool use_sort_key;		/* when true, a P_sort_key holds the collation sort key of the string instead of the
+				 * value, and it is compared by memcmp */
 };
 
 struct SORTKEY_INFO
@@ -145,5 +152,9 @@ struct SORT_INFO
 extern int sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn,
 			  void *get_arg, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg,
 			  SORT_DUP_OPTION option, int limit, bool includes_tde_class);
+extern int sort_listfile_parallel (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, int parallelism,
+				   SORT_GET_FUNC * get_fn, void **get_args, SORT_GET_START_FUNC * get_start_fn,
+				   SORT_GET_END_FUNC * get_end_fn, SORT_PUT_FUNC * put_fn, void *put_arg,
+				   SORT_CMP_FUNC * cmp_fn, void *cmp_arg, bool includes_tde_class);
 
 #endif /* _EXTERNAL_SORT_H_ */
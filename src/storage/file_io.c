@@ -36,6 +36,11 @@
 #include <assert.h>
 #include <signal.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #if defined(WINDOWS)
 #include <io.h>
 #include <share.h>
@@ -102,6 +107,7 @@
 #endif /* SERVER_MODE */
 
 #if !defined (CS_MODE)
+#include "backup_change_tracking.hpp"
 #include "double_write_buffer.h"
 #include "page_buffer.h"
 #include "xserver_interface.h"
@@ -548,7 +554,21 @@ static FILEIO_BACKUP_SESSION *fileio_continue_restore (THREAD_ENTRY * thread_p,
 						       bool first_time, bool authenticate, INT64 match_bkupcreation);
 static int fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_pageid, int stop_pageid,
 					    FILEIO_BACKUP_SESSION * session, FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
+static int fileio_read_restore_block (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int nbytes,
+				      FILEIO_BACKUP_PAGE * area, FILEIO_ZIP_PAGE * zip_page, bool * is_compressed);
 static int fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int nbytes);
+#if !defined(CS_MODE)
+typedef struct fileio_restore_pipeline FILEIO_RESTORE_PIPELINE;
+
+static FILEIO_RESTORE_PIPELINE *fileio_restore_pipeline_create (int nbytes);
+static void fileio_restore_pipeline_destroy (FILEIO_RESTORE_PIPELINE * pipeline);
+static int fileio_restore_pipeline_start_volume (FILEIO_BACKUP_SESSION * session, int nbytes);
+static void fileio_restore_pipeline_end_volume (FILEIO_BACKUP_SESSION * session);
+static void fileio_restore_pipeline_worker (FILEIO_RESTORE_PIPELINE * pipeline);
+static int fileio_restore_pipeline_read_ahead (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session,
+					       FILEIO_RESTORE_PIPELINE * pipeline);
+static int fileio_restore_pipeline_next_page (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session);
+#endif /* !CS_MODE */
 static FILEIO_NODE *fileio_allocate_node (FILEIO_QUEUE * qp, FILEIO_BACKUP_HEADER * backup_hdr);
 static FILEIO_NODE *fileio_free_node (FILEIO_QUEUE * qp, FILEIO_NODE * node);
 static FILEIO_NODE *fileio_delete_queue_head (FILEIO_QUEUE * qp);
@@ -3881,7 +3901,13 @@ fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t cou
 
   return nbytes;
 #else /* WINDOWS */
-  return pread (vol_fd, io_page_p, count, offset);
+  ssize_t nbytes;
+
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_IO);
+  nbytes = pread (vol_fd, io_page_p, count, offset);
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_NONE);
+
+  return nbytes;
 #endif
 }
 
@@ -4076,12 +4102,20 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
   pthread_mutex_unlock (io_mutex);
 
   return (ssize_t) nbytes;
-#elif defined (NDEBUG)
+#else /* WINDOWS */
+  ssize_t nbytes;
+
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_IO);
+#if defined (NDEBUG)
   /* release mode */
-  return pwrite (vol_fd, io_page_p, count, offset);
+  nbytes = pwrite (vol_fd, io_page_p, count, offset);
 #else
   /* server debugging mode */
-  return pwrite_with_injected_fault (thread_p, vol_fd, io_page_p, count, offset);
+  nbytes = pwrite_with_injected_fault (thread_p, vol_fd, io_page_p, count, offset);
+#endif
+  thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_NONE);
+
+  return nbytes;
 #endif
 }
 
@@ -4100,6 +4134,26 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
 void *
 fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id, size_t page_size,
 	      FILEIO_WRITE_MODE write_mode)
+{
+  return fileio_write_partial (thread_p, vol_fd, io_page_p, page_id, page_size, page_size, write_mode);
+}
+
+/*
+ * fileio_write_partial () - WRITE THE FIRST BYTES OF A PAGE TO DISK
+ *   return: io_page_p on success, NULL on failure
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   page_id(in): Page identifier
+ *   page_size(in): Page size
+ *   write_size(in): Number of bytes to write from the start of the page
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ *
+ * Note: The rest of the page on disk is left as it is. Used for pages whose content is smaller than the page, like
+ *       compressed temporary pages; the reader is expected to know how many bytes are valid.
+ */
+void *
+fileio_write_partial (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id, size_t page_size,
+		      size_t write_size, FILEIO_WRITE_MODE write_mode)
 {
 #if defined (EnableThreadMonitoring)
   TSC_TICKS start_tick, end_tick;
@@ -4109,6 +4163,8 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
   off_t offset = FILEIO_GET_FILE_SIZE (page_size, page_id);
   bool is_retry = true;
 
+  assert (0 < write_size && write_size <= page_size);
+
 #if defined (EnableThreadMonitoring)
   if (0 < prm_get_integer_value (PRM_ID_MNT_WAITING_THREAD))
     {
@@ -4120,8 +4176,8 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
     {
       is_retry = false;
 
-      nbytes_written = fileio_os_write (thread_p, vol_fd, io_page_p, page_size, offset);
-      if (nbytes_written != (ssize_t) page_size)
+      nbytes_written = fileio_os_write (thread_p, vol_fd, io_page_p, write_size, offset);
+      if (nbytes_written != (ssize_t) write_size)
 	{
 	  if (errno == EINTR)
 	    {
@@ -4157,7 +4213,7 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
     {
       er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_MNT_WAITING_THREAD, 2, "file write",
 	      prm_get_integer_value (PRM_ID_MNT_WAITING_THREAD));
-      er_log_debug (ARG_FILE_LINE, "fileio_write: %6d.%06d\n", elapsed_time.tv_sec, elapsed_time.tv_usec);
+      er_log_debug (ARG_FILE_LINE, "fileio_write_partial: %6d.%06d\n", elapsed_time.tv_sec, elapsed_time.tv_usec);
     }
 #endif
 
@@ -4441,7 +4497,13 @@ fileio_synchronize (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, FIL
   /* If all_sync is true, everything was synchronized. This happens when DWB is completely flushed. */
   if (ret == NO_ERROR && all_sync == false)
     {
+#if defined (SERVER_MODE)
+      thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_IO);
+#endif
       ret = fsync (vol_fd);
+#if defined (SERVER_MODE)
+      thread_set_wait_event (thread_p, THREAD_WAIT_EVENT_NONE);
+#endif
     }
 
 #if defined (EnableThreadMonitoring)
@@ -5834,6 +5896,24 @@ fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_n
   sprintf (dwb_name_p, "%s%s%s%s", dwb_path_p, FILEIO_PATH_SEPARATOR (dwb_path_p), db_name_p, FILEIO_SUFFIX_DWB);
 }
 
+/*
+ * fileio_make_change_tracking_name () - Build the name of the backup change tracking file
+ *   return: void
+ *   name_p(out): the name of the change tracking file
+ *   log_path_p(in): log path
+ *   db_name_p(in): database name
+ *
+ * Note: The caller must have enough space to store the name of the volume
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_change_tracking_name (char *name_p, const char *log_path_p, const char *db_name_p)
+{
+  sprintf (name_p, "%s%s%s%s", log_path_p, FILEIO_PATH_SEPARATOR (log_path_p), db_name_p,
+	   FILEIO_SUFFIX_CHANGE_TRACKING);
+}
+
 /*
  * fileio_make_keys_name () - Build the name of KEYS file  (for TDE Master Key)
  *   return: void
@@ -6658,6 +6738,7 @@ fileio_initialize_backup_thread (FILEIO_BACKUP_SESSION * session_p, int num_thre
   queue_p->head = NULL;
   queue_p->tail = NULL;
   queue_p->free_list = NULL;
+  thread_info_p->restore_pipeline = NULL;
 
   thread_info_p->initialized = true;
 
@@ -6837,6 +6918,9 @@ fileio_initialize_backup (const char *db_full_name_p, const char *backup_destina
   session_p->dbfile.volid = NULL_VOLID;
   session_p->dbfile.vdes = NULL_VOLDES;
   session_p->dbfile.nbytes = -1;
+  session_p->dbfile.use_change_map = false;
+  session_p->dbfile.verify_change_map = false;
+  session_p->dbfile.change_map_misses = 0;
   FILEIO_SET_BACKUP_PAGE_ID (session_p->dbfile.area, NULL_PAGEID, io_page_size);
 
 #if defined(CUBRID_DEBUG)
@@ -6928,6 +7012,14 @@ fileio_finalize_backup_thread (FILEIO_BACKUP_SESSION * session_p, FILEIO_ZIP_MET
       return;
     }
 
+#if !defined(CS_MODE)
+  if (tp->restore_pipeline != NULL)
+    {
+      fileio_restore_pipeline_destroy (tp->restore_pipeline);
+      tp->restore_pipeline = NULL;
+    }
+#endif /* !CS_MODE */
+
 #if defined(SERVER_MODE)
   rv = pthread_mutex_destroy (&tp->mtx);
   if (rv != 0)
@@ -7740,6 +7832,55 @@ exit_on_error:
   goto exit_on_end;
 }
 
+#if !defined(CS_MODE)
+/*
+ * fileio_is_backup_page_skipped () - can the backup skip reading the page?
+ *   return: true if the change map of the volume tells that the page did not change since the previous backup
+ *   session(in): The session array
+ *   page_id(in): page identifier
+ */
+static bool
+fileio_is_backup_page_skipped (FILEIO_BACKUP_SESSION * session_p, int page_id)
+{
+  return (session_p->dbfile.use_change_map && !session_p->dbfile.verify_change_map
+	  && !bct_is_page_changed (session_p->dbfile.volid, session_p->dbfile.level, page_id));
+}
+
+/*
+ * fileio_is_backup_page_needed () - Do we need to backup this page ?
+ *   return: true if the page must be copied to the backup
+ *   session(in/out): The session array
+ *   is_only_updated_pages(in): backup only the pages changed since the previous backup
+ *   page_id(in): page identifier
+ *   area(in): the page as read from the volume
+ *
+ * Note: In other words, has it been changed since either the previous backup of this level or a lower level. The
+ *       page is also listed in the change map rebuilt by this backup, if any.
+ */
+static bool
+fileio_is_backup_page_needed (FILEIO_BACKUP_SESSION * session_p, bool is_only_updated_pages, int page_id,
+			      FILEIO_BACKUP_PAGE * area_p)
+{
+  bool is_needed;
+
+  is_needed = (is_only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
+	       || LSA_LT (&session_p->dbfile.lsa, &area_p->iopage.prv.lsa));
+
+  if (session_p->dbfile.volid >= LOG_DBFIRST_VOLID)
+    {
+      bct_seed_page (session_p->dbfile.volid, page_id, &area_p->iopage.prv.lsa);
+
+      if (is_needed && session_p->dbfile.verify_change_map
+	  && !bct_is_page_changed (session_p->dbfile.volid, session_p->dbfile.level, page_id))
+	{
+	  session_p->dbfile.change_map_misses++;
+	}
+    }
+
+  return is_needed;
+}
+#endif /* !CS_MODE */
+
 /*
  * fileio_read_backup_volume () -
  *   return:
@@ -7816,6 +7957,12 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	    }
 	}
 
+      while (thread_info_p->pageid < thread_info_p->from_npages
+	     && fileio_is_backup_page_skipped (session_p, thread_info_p->pageid))
+	{
+	  thread_info_p->pageid++;
+	}
+
       /* check EOF */
       if (thread_info_p->pageid >= thread_info_p->from_npages)
 	{
@@ -7872,14 +8019,7 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 	  goto exit_on_error;
 	}
 
-      /*
-       * Do we need to backup this page ?
-       * In other words, has it been changed since either the previous backup
-       * of this level or a lower level.
-       */
-
-      if (thread_info_p->only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
-	  || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
+      if (fileio_is_backup_page_needed (session_p, thread_info_p->only_updated_pages, node_p->pageid, node_p->area))
 	{
 	  /* Backup the content of this page along with its page identifier add alloced node to the queue */
 	  (void) fileio_append_queue (queue_p, node_p);
@@ -8268,6 +8408,14 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
       from_npages = (int) CEIL_PTVDIV (session_p->dbfile.nbytes, backup_header_p->bkpagesize);
     }
 
+  /* An incremental backup reads only the pages listed by the change map of the volume, if it can be trusted. */
+  session_p->dbfile.use_change_map = (is_only_updated_pages && !LSA_ISNULL (&session_p->dbfile.lsa)
+				      && bct_can_use_change_map (from_vol_id, session_p->dbfile.level,
+								 &session_p->dbfile.lsa));
+  session_p->dbfile.verify_change_map = (session_p->dbfile.use_change_map
+					 && prm_get_bool_value (PRM_ID_BACKUP_CHANGE_TRACKING_VERIFY));
+  session_p->dbfile.change_map_misses = 0;
+
   /* Write a backup file header which identifies this volume/file on the backup.  File headers do not use the extra
    * pageid_copy field. */
   session_p->dbfile.area->iopageid = FILEIO_BACKUP_FILE_START_PAGE_ID;
@@ -8333,6 +8481,11 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	      goto error;
 	    }
 
+	  if (fileio_is_backup_page_skipped (session_p, page_id))
+	    {
+	      continue;
+	    }
+
 	  /* alloc queue node */
 	  node_p = fileio_allocate_node (queue_p, backup_header_p);
 	  if (node_p == NULL)
@@ -8358,14 +8511,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	      break;
 	    }
 
-	  /*
-	   * Do we need to backup this page ?
-	   * In other words, has it been changed since either the previous backup
-	   * of this level or a lower level.
-	   */
-
-	  if (is_only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
-	      || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
+	  if (fileio_is_backup_page_needed (session_p, is_only_updated_pages, node_p->pageid, node_p->area))
 	    {
 	      /* Backup the content of this page along with its page identifier */
 
@@ -8442,6 +8588,18 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
   /* free node */
   (void) fileio_free_node (queue_p, node_p);
   node_p = NULL;
+
+  if (session_p->dbfile.change_map_misses > 0)
+    {
+      /* the pages were still copied by the LSA comparison, but the map cannot be trusted for next backups */
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_BACKUP_CHANGE_TRACKING_MISMATCH, 3,
+	      session_p->dbfile.change_map_misses, session_p->dbfile.vlabel, session_p->dbfile.level - 1);
+      bct_invalidate_change_map (from_vol_id, session_p->dbfile.level);
+    }
+  session_p->dbfile.use_change_map = false;
+  session_p->dbfile.verify_change_map = false;
+  session_p->dbfile.change_map_misses = 0;
+
 #if defined(CUBRID_DEBUG)
   fprintf (stdout, "volume EOF : bkpagesize = %d, voltotalio = %ld\n", backup_header_p->bkpagesize,
 	   session_p->bkup.voltotalio);
@@ -8506,6 +8664,9 @@ error:
       (void) fileio_free_node (queue_p, node_p);
     }
 
+  session_p->dbfile.use_change_map = false;
+  session_p->dbfile.verify_change_map = false;
+  session_p->dbfile.change_map_misses = 0;
   session_p->dbfile.vdes = NULL_VOLDES;
   session_p->dbfile.volid = NULL_VOLID;
   session_p->dbfile.nbytes = -1;
@@ -10024,6 +10185,72 @@ fileio_fill_hole_during_restore (THREAD_ENTRY * thread_p, int *next_page_id_p, i
   return NO_ERROR;
 }
 
+/*
+ * fileio_read_restore_block () - Read the next block of a volume compressed with LZ4 from the backup destination
+ *   return: error code
+ *   session(in/out): The session array
+ *   nbytes(in): Size of the backup page
+ *   area(out): The backup page, when the block was stored uncompressed
+ *   zip_page(out): The block as stored in the backup
+ *   is_compressed(out): true if the backup page must still be decompressed from zip_page
+ */
+static int
+fileio_read_restore_block (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, int nbytes,
+			   FILEIO_BACKUP_PAGE * area_p, FILEIO_ZIP_PAGE * zip_page, bool * is_compressed)
+{
+  FILEIO_BACKUP_HEADER *backup_header_p = session_p->bkup.bkuphdr;
+  FILEIO_BACKUP_PAGE *save_area_p;
+  int rv;
+
+  *is_compressed = false;
+
+  save_area_p = session_p->dbfile.area;	/* save link */
+  session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page;
+  rv = fileio_read_restore (thread_p, session_p, sizeof (int));
+  session_p->dbfile.area = save_area_p;	/* restore link */
+  if (rv != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
+      return ER_IO_RESTORE_READ_ERROR;
+    }
+
+  /* sanity check of the size values */
+  if (zip_page->buf_len > nbytes || zip_page->buf_len == 0)
+    {
+      /* may be compress fail */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_COMPRESS_FAIL, 4, backup_header_p->zip_method,
+	      fileio_get_zip_method_string (backup_header_p->zip_method), backup_header_p->zip_level,
+	      fileio_get_zip_level_string (backup_header_p->zip_level));
+#if defined(CUBRID_DEBUG)
+      fprintf (stdout, "io_restore_volume_decompress_read: block size error - data corrupted\n");
+#endif /* CUBRID_DEBUG */
+      return ER_IO_LZ4_COMPRESS_FAIL;
+    }
+
+  save_area_p = session_p->dbfile.area;	/* save link */
+  if (zip_page->buf_len < nbytes)
+    {
+      /* read compressed block data */
+      session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page->buf;
+      *is_compressed = true;
+    }
+  else
+    {
+      /* no compressed block */
+      session_p->dbfile.area = area_p;
+    }
+
+  rv = fileio_read_restore (thread_p, session_p, zip_page->buf_len);
+  session_p->dbfile.area = save_area_p;	/* restore link */
+  if (rv != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, backup_header_p->unit_num);
+      return ER_IO_RESTORE_READ_ERROR;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * fileio_decompress_restore_volume () - The number of bytes to decompress/read
  *                                        from the backup destination
@@ -10038,7 +10265,6 @@ fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION
   FILEIO_THREAD_INFO *thread_info_p;
   FILEIO_QUEUE *queue_p;
   FILEIO_BACKUP_HEADER *backup_header_p;
-  FILEIO_BACKUP_PAGE *save_area_p;
   FILEIO_NODE *node;
 
   assert (nbytes >= 0);
@@ -10061,8 +10287,8 @@ fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION
 
     case FILEIO_ZIP_LZ4_METHOD:
       {
-	int rv;
-	FILEIO_ZIP_PAGE *zip_page;
+	bool is_compressed;
+	int unzip_len;
 
 	/* alloc queue node */
 	node = fileio_allocate_node (queue_p, backup_header_p);
@@ -10072,53 +10298,19 @@ fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION
 	  }
 
 	assert (node->zip_info != NULL);
-	zip_page = &node->zip_info->zip_page;
-
-	save_area_p = session_p->dbfile.area;	/* save link */
-	session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page;
-
-	rv = fileio_read_restore (thread_p, session_p, sizeof (int));
-	session_p->dbfile.area = save_area_p;	/* restore link */
-	if (rv != NO_ERROR)
+	error = fileio_read_restore_block (thread_p, session_p, nbytes, session_p->dbfile.area,
+					   &node->zip_info->zip_page, &is_compressed);
+	if (error != NO_ERROR)
 	  {
-	    error = ER_IO_RESTORE_READ_ERROR;
-	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
 	    goto exit_on_error;
 	  }
 
-	/* sanity check of the size values */
-	if (zip_page->buf_len > nbytes || zip_page->buf_len == 0)
+	if (is_compressed)
 	  {
-	    error = ER_IO_LZ4_COMPRESS_FAIL;	/* may be compress fail */
-	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 4, backup_header_p->zip_method,
-		    fileio_get_zip_method_string (backup_header_p->zip_method), backup_header_p->zip_level,
-		    fileio_get_zip_level_string (backup_header_p->zip_level));
-#if defined(CUBRID_DEBUG)
-	    fprintf (stdout, "io_restore_volume_decompress_read: block size error - data corrupted\n");
-#endif /* CUBRID_DEBUG */
-	    goto exit_on_error;
-	  }
-	else if (zip_page->buf_len < nbytes)
-	  {
-	    /* read compressed block data */
-	    int unzip_len;
-
-	    save_area_p = session_p->dbfile.area;	/* save link */
-	    session_p->dbfile.area = (FILEIO_BACKUP_PAGE *) zip_page->buf;
-
-	    rv = fileio_read_restore (thread_p, session_p, zip_page->buf_len);
-	    session_p->dbfile.area = save_area_p;	/* restore link */
-	    if (rv != NO_ERROR)
-	      {
-		error = ER_IO_RESTORE_READ_ERROR;
-		er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
-		goto exit_on_error;
-	      }
-
 	    /* decompress - use safe decompressor as data might be corrupted during a file transfer */
 	    unzip_len =
-	      LZ4_decompress_safe ((const char *) zip_page->buf, (char *) session_p->dbfile.area, zip_page->buf_len,
-				   nbytes);
+	      LZ4_decompress_safe ((const char *) node->zip_info->zip_page.buf, (char *) session_p->dbfile.area,
+				   node->zip_info->zip_page.buf_len, nbytes);
 	    if (unzip_len < 0 || unzip_len != nbytes)
 	      {
 		error = ER_IO_LZ4_DECOMPRESS_FAIL;
@@ -10129,18 +10321,6 @@ fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION
 		goto exit_on_error;
 	      }
 	  }
-	else
-	  {
-	    /* no compressed block */
-	    rv = fileio_read_restore (thread_p, session_p, zip_page->buf_len);
-	    if (rv != NO_ERROR)
-	      {
-		error = ER_IO_RESTORE_READ_ERROR;
-		er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, backup_header_p->unit_num);
-		goto exit_on_error;
-	      }
-	  }
-
       }
       break;
 
@@ -10170,6 +10350,423 @@ exit_on_error:
   goto exit_on_end;
 }
 
+#if !defined(CS_MODE)
+/*
+ * Restore pipeline
+ *
+ * When a volume was backed up with LZ4, the restoring thread reads the blocks of the volume ahead into a ring of
+ * slots while a pool of threads decompresses the blocks already read. The restoring thread writes the pages in backup
+ * order, as soon as the oldest slot is decompressed, so that reading, decompressing and writing overlap. The ring is
+ * bounded by restore_buffer_size.
+ *
+ * The read-ahead must stop at the end of file block of the volume, since the header of the next volume follows it in
+ * the backup. The end of file block is recognized by decompressing only the page identifier at its start.
+ *
+ * The decompressing threads only run LZ4 on their slot. Their errors are raised by the restoring thread.
+ */
+typedef enum
+{
+  FILEIO_RESTORE_SLOT_FREE,	/* can be read into */
+  FILEIO_RESTORE_SLOT_READ,	/* compressed block read, waits to be decompressed */
+  FILEIO_RESTORE_SLOT_BUSY,	/* being decompressed */
+  FILEIO_RESTORE_SLOT_READY	/* backup page can be restored */
+} FILEIO_RESTORE_SLOT_STATE;
+
+typedef struct fileio_restore_slot FILEIO_RESTORE_SLOT;
+struct fileio_restore_slot
+{
+  FILEIO_RESTORE_SLOT_STATE state;
+  int error;			/* decompression error */
+  FILEIO_BACKUP_PAGE *area;	/* the backup page */
+  FILEIO_ZIP_PAGE *zip_page;	/* the block as stored in the backup */
+};
+
+// *INDENT-OFF*
+struct fileio_restore_pipeline
+{
+  std::mutex mutex;
+  std::condition_variable read_cv;	/* decompressing threads wait for blocks to be read */
+  std::condition_variable ready_cv;	/* restoring thread waits for the oldest block to be decompressed */
+  std::vector<std::thread> workers;
+
+  FILEIO_RESTORE_SLOT *slots;
+  int num_slots;
+  int nbytes;			/* size of the backup pages */
+
+  UINT64 read_seq;		/* next block to read */
+  UINT64 decompress_seq;	/* next block to look at for decompression */
+  UINT64 restore_seq;		/* next block to restore */
+  bool is_end_read;		/* the end of file block of the volume was read */
+  bool is_shutdown;
+};
+// *INDENT-ON*
+
+/*
+ * fileio_restore_pipeline_destroy () - Stop the decompressing threads and free the pipeline
+ *   return: void
+ *   pipeline(in): restore pipeline
+ */
+static void
+fileio_restore_pipeline_destroy (FILEIO_RESTORE_PIPELINE * pipeline)
+{
+  int i;
+
+  {
+    // *INDENT-OFF*
+    std::lock_guard<std::mutex> lock (pipeline->mutex);
+    // *INDENT-ON*
+    pipeline->is_shutdown = true;
+  }
+  pipeline->read_cv.notify_all ();
+
+  // *INDENT-OFF*
+  for (std::thread &worker : pipeline->workers)
+    {
+      worker.join ();
+    }
+  // *INDENT-ON*
+
+  if (pipeline->slots != NULL)
+    {
+      for (i = 0; i < pipeline->num_slots; i++)
+	{
+	  free (pipeline->slots[i].area);
+	  free (pipeline->slots[i].zip_page);
+	}
+      free (pipeline->slots);
+    }
+
+  delete pipeline;
+}
+
+/*
+ * fileio_restore_pipeline_create () - Allocate the slots and start the decompressing threads
+ *   return: restore pipeline or NULL
+ *   nbytes(in): size of the backup pages
+ */
+static FILEIO_RESTORE_PIPELINE *
+fileio_restore_pipeline_create (int nbytes)
+{
+  FILEIO_RESTORE_PIPELINE *pipeline;
+  int num_threads, area_size, zip_size, i;
+  UINT64 buffer_size;
+
+  num_threads = prm_get_integer_value (PRM_ID_RESTORE_DECOMPRESS_THREADS);
+  if (num_threads <= 0)
+    {
+      num_threads = MAX ((int) std::thread::hardware_concurrency (), 1);
+    }
+
+  /* slot areas may be exchanged with the session area, which must be able to read any backup page or file header */
+  area_size = MAX (nbytes, (int) FILEIO_BACKUP_FILE_HEADER_PAGE_SIZE);
+  zip_size = offsetof (FILEIO_ZIP_PAGE, buf) + LZ4_compressBound (nbytes);
+
+  pipeline = new (std::nothrow) FILEIO_RESTORE_PIPELINE ();
+  if (pipeline == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (FILEIO_RESTORE_PIPELINE));
+      return NULL;
+    }
+
+  buffer_size = prm_get_bigint_value (PRM_ID_RESTORE_BUFFER_SIZE);
+  pipeline->num_slots = (int) MIN (buffer_size / (UINT64) (area_size + zip_size), (UINT64) INT_MAX);
+  /* keep every decompressing thread busy while the oldest blocks are restored */
+  pipeline->num_slots = MAX (pipeline->num_slots, 2 * num_threads + 1);
+  pipeline->nbytes = nbytes;
+
+  pipeline->slots = (FILEIO_RESTORE_SLOT *) calloc (pipeline->num_slots, sizeof (FILEIO_RESTORE_SLOT));
+  if (pipeline->slots == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) pipeline->num_slots * sizeof (FILEIO_RESTORE_SLOT));
+      fileio_restore_pipeline_destroy (pipeline);
+      return NULL;
+    }
+
+  for (i = 0; i < pipeline->num_slots; i++)
+    {
+      pipeline->slots[i].state = FILEIO_RESTORE_SLOT_FREE;
+      pipeline->slots[i].area = (FILEIO_BACKUP_PAGE *) malloc (area_size);
+      pipeline->slots[i].zip_page = (FILEIO_ZIP_PAGE *) malloc (zip_size);
+      if (pipeline->slots[i].area == NULL || pipeline->slots[i].zip_page == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (area_size + zip_size));
+	  fileio_restore_pipeline_destroy (pipeline);
+	  return NULL;
+	}
+    }
+
+  for (i = 0; i < num_threads; i++)
+    {
+      pipeline->workers.emplace_back (fileio_restore_pipeline_worker, pipeline);
+    }
+
+  return pipeline;
+}
+
+/*
+ * fileio_restore_pipeline_start_volume () - Prepare the restore pipeline of the session for the next volume
+ *   return: error code
+ *   session(in/out): The session array
+ *   nbytes(in): size of the backup pages
+ *
+ * Note: the pipeline is created by the first volume restored by the session and kept until the session ends.
+ */
+static int
+fileio_restore_pipeline_start_volume (FILEIO_BACKUP_SESSION * session_p, int nbytes)
+{
+  FILEIO_THREAD_INFO *thread_info_p = &session_p->read_thread_info;
+
+  if (thread_info_p->restore_pipeline != NULL && thread_info_p->restore_pipeline->nbytes != nbytes)
+    {
+      fileio_restore_pipeline_destroy (thread_info_p->restore_pipeline);
+      thread_info_p->restore_pipeline = NULL;
+    }
+
+  if (thread_info_p->restore_pipeline == NULL)
+    {
+      thread_info_p->restore_pipeline = fileio_restore_pipeline_create (nbytes);
+      if (thread_info_p->restore_pipeline == NULL)
+	{
+	  ASSERT_ERROR ();
+	  return er_errid ();
+	}
+    }
+
+  assert (thread_info_p->restore_pipeline->read_seq == 0 && thread_info_p->restore_pipeline->restore_seq == 0);
+  return NO_ERROR;
+}
+
+/*
+ * fileio_restore_pipeline_end_volume () - Drop the blocks read ahead and wait for their decompression
+ *   return: void
+ *   session(in/out): The session array
+ *
+ * Note: nothing is left when the volume was restored to its end of file block; blocks are left when it failed.
+ */
+static void
+fileio_restore_pipeline_end_volume (FILEIO_BACKUP_SESSION * session_p)
+{
+  FILEIO_RESTORE_PIPELINE *pipeline = session_p->read_thread_info.restore_pipeline;
+  bool is_busy;
+  int i;
+
+  if (pipeline == NULL)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (pipeline->mutex);
+  // *INDENT-ON*
+  do
+    {
+      is_busy = false;
+      for (i = 0; i < pipeline->num_slots; i++)
+	{
+	  if (pipeline->slots[i].state == FILEIO_RESTORE_SLOT_BUSY)
+	    {
+	      is_busy = true;
+	    }
+	  else
+	    {
+	      pipeline->slots[i].state = FILEIO_RESTORE_SLOT_FREE;
+	    }
+	}
+      if (is_busy)
+	{
+	  pipeline->ready_cv.wait (ulock);
+	}
+    }
+  while (is_busy);
+
+  pipeline->read_seq = 0;
+  pipeline->decompress_seq = 0;
+  pipeline->restore_seq = 0;
+  pipeline->is_end_read = false;
+}
+
+/*
+ * fileio_restore_pipeline_worker () - Decompress the blocks read by the restoring thread
+ *   return: void
+ *   pipeline(in): restore pipeline
+ */
+static void
+fileio_restore_pipeline_worker (FILEIO_RESTORE_PIPELINE * pipeline)
+{
+  FILEIO_RESTORE_SLOT *slot;
+  int unzip_len;
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (pipeline->mutex);
+  // *INDENT-ON*
+  while (true)
+    {
+      slot = NULL;
+      while (pipeline->decompress_seq < pipeline->read_seq)
+	{
+	  slot = &pipeline->slots[pipeline->decompress_seq % pipeline->num_slots];
+	  pipeline->decompress_seq++;
+	  if (slot->state == FILEIO_RESTORE_SLOT_READ)
+	    {
+	      break;
+	    }
+	  /* not compressed, or already taken from a later position of the ring */
+	  slot = NULL;
+	}
+
+      if (slot == NULL)
+	{
+	  if (pipeline->is_shutdown)
+	    {
+	      return;
+	    }
+	  pipeline->read_cv.wait (ulock);
+	  continue;
+	}
+
+      slot->state = FILEIO_RESTORE_SLOT_BUSY;
+      ulock.unlock ();
+
+      /* use safe decompressor as data might be corrupted during a file transfer */
+      unzip_len = LZ4_decompress_safe ((const char *) slot->zip_page->buf, (char *) slot->area,
+				       slot->zip_page->buf_len, pipeline->nbytes);
+
+      ulock.lock ();
+      slot->error = (unzip_len == pipeline->nbytes) ? NO_ERROR : ER_IO_LZ4_DECOMPRESS_FAIL;
+      slot->state = FILEIO_RESTORE_SLOT_READY;
+      pipeline->ready_cv.notify_one ();
+    }
+}
+
+/*
+ * fileio_restore_pipeline_read_ahead () - Read the next block of the volume into a free slot
+ *   return: error code
+ *   session(in/out): The session array
+ *   pipeline(in): restore pipeline
+ */
+static int
+fileio_restore_pipeline_read_ahead (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
+				    FILEIO_RESTORE_PIPELINE * pipeline)
+{
+  FILEIO_RESTORE_SLOT *slot;
+  bool is_compressed, is_end;
+  int error, len;
+
+  /* only the restoring thread reads; free slots are not used by the decompressing threads */
+  slot = &pipeline->slots[pipeline->read_seq % pipeline->num_slots];
+  assert (slot->state == FILEIO_RESTORE_SLOT_FREE);
+
+  error = fileio_read_restore_block (thread_p, session_p, pipeline->nbytes, slot->area, slot->zip_page,
+				     &is_compressed);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  if (is_compressed)
+    {
+      /* a block that cannot be decoded stops the read-ahead too; its decompression fails when it is restored */
+      len = LZ4_decompress_safe_partial ((const char *) slot->zip_page->buf, (char *) slot->area,
+					 slot->zip_page->buf_len, sizeof (PAGEID), pipeline->nbytes);
+      is_end = (len < (int) sizeof (PAGEID)
+		|| FILEIO_GET_BACKUP_PAGE_ID (slot->area) == FILEIO_BACKUP_FILE_END_PAGE_ID);
+    }
+  else
+    {
+      is_end = (FILEIO_GET_BACKUP_PAGE_ID (slot->area) == FILEIO_BACKUP_FILE_END_PAGE_ID);
+    }
+
+  {
+    // *INDENT-OFF*
+    std::lock_guard<std::mutex> lock (pipeline->mutex);
+    // *INDENT-ON*
+    slot->error = NO_ERROR;
+    slot->state = is_compressed ? FILEIO_RESTORE_SLOT_READ : FILEIO_RESTORE_SLOT_READY;
+    pipeline->read_seq++;
+    pipeline->is_end_read = is_end;
+  }
+
+  if (is_compressed)
+    {
+      pipeline->read_cv.notify_one ();
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_restore_pipeline_next_page () - Get the next backup page of the volume in the session area
+ *   return: error code
+ *   session(in/out): The session array
+ *
+ * Note: while the oldest block is being decompressed, the restoring thread reads the next ones. The decompressed
+ *       area is exchanged with the session area, which the slot reuses.
+ */
+static int
+fileio_restore_pipeline_next_page (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
+{
+  FILEIO_RESTORE_PIPELINE *pipeline = session_p->read_thread_info.restore_pipeline;
+  FILEIO_RESTORE_SLOT *slot;
+  FILEIO_BACKUP_PAGE *area_p;
+  bool can_read_ahead;
+  int error;
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (pipeline->mutex);
+  // *INDENT-ON*
+  while (true)
+    {
+      slot = &pipeline->slots[pipeline->restore_seq % pipeline->num_slots];
+      if (pipeline->restore_seq < pipeline->read_seq && slot->state == FILEIO_RESTORE_SLOT_READY)
+	{
+	  break;
+	}
+
+      can_read_ahead = (!pipeline->is_end_read
+			&& pipeline->read_seq - pipeline->restore_seq < (UINT64) pipeline->num_slots);
+      if (can_read_ahead)
+	{
+	  ulock.unlock ();
+	  error = fileio_restore_pipeline_read_ahead (thread_p, session_p, pipeline);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	  ulock.lock ();
+	}
+      else if (pipeline->restore_seq < pipeline->read_seq)
+	{
+	  pipeline->ready_cv.wait (ulock);
+	}
+      else
+	{
+	  /* the end of file block was already restored */
+	  assert (false);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_RESTORE_READ_ERROR, 1, session_p->bkup.bkuphdr->unit_num);
+	  return ER_IO_RESTORE_READ_ERROR;
+	}
+    }
+
+  slot->state = FILEIO_RESTORE_SLOT_FREE;
+  pipeline->restore_seq++;
+  error = slot->error;
+  ulock.unlock ();
+
+  if (error != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  area_p = session_p->dbfile.area;
+  session_p->dbfile.area = slot->area;
+  slot->area = area_p;
+
+  return NO_ERROR;
+}
+#endif /* !CS_MODE */
+
 #if !defined(CS_MODE)
 /*
  * fileio_restore_volume () - Restore a volume/file of given database
@@ -10199,6 +10796,7 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   int i;
   char *buffer_p;
   bool incremental_includes_volume_header = false;
+  bool use_pipeline = false;
 
   npages = (int) CEIL_PTVDIV (session_p->dbfile.nbytes, IO_PAGESIZE);
   session_p->dbfile.vlabel = to_vol_label_p;
@@ -10255,9 +10853,26 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   from_npages = (int) CEIL_PTVDIV (session_p->dbfile.nbytes, backup_header_p->bkpagesize);
   nbytes = FILEIO_RESTORE_DBVOLS_IO_PAGE_SIZE (session_p);
 
+  /* Decompress the pages ahead of the ones being written. */
+  if (backup_header_p->zip_method == FILEIO_ZIP_LZ4_METHOD)
+    {
+      if (fileio_restore_pipeline_start_volume (session_p, nbytes) != NO_ERROR)
+	{
+	  goto error;
+	}
+      use_pipeline = true;
+    }
+
   while (true)
     {
-      if (fileio_decompress_restore_volume (thread_p, session_p, nbytes) != NO_ERROR)
+      if (use_pipeline)
+	{
+	  if (fileio_restore_pipeline_next_page (thread_p, session_p) != NO_ERROR)
+	    {
+	      goto error;
+	    }
+	}
+      else if (fileio_decompress_restore_volume (thread_p, session_p, nbytes) != NO_ERROR)
 	{
 	  goto error;
 	}
@@ -10342,6 +10957,12 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
 	}
     }
 
+  if (use_pipeline)
+    {
+      fileio_restore_pipeline_end_volume (session_p);
+      use_pipeline = false;
+    }
+
   if (total_nbytes > session_p->dbfile.nbytes && session_p->dbfile.volid < LOG_DBFIRST_VOLID)
     {
       (void) ftruncate (session_p->dbfile.vdes, session_p->dbfile.nbytes);
@@ -10460,6 +11081,11 @@ fileio_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_
   return NO_ERROR;
 
 error:
+  if (use_pipeline)
+    {
+      fileio_restore_pipeline_end_volume (session_p);
+    }
+
   if (session_p->dbfile.vdes != NULL_VOLDES)
     {
       fileio_dismount (thread_p, session_p->dbfile.vdes);
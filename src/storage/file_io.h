@@ -66,6 +66,9 @@
 
 #define FILEIO_PAGE_FLAG_ENCRYPTED_MASK 0x3
 
+/* temporary page whose data area is LZ4 compressed on disk; p_reserve_1 keeps the compressed size */
+#define FILEIO_PAGE_FLAG_COMPRESSED_LZ4 0x4
+
 #if defined(WINDOWS)
 #define STR_PATH_SEPARATOR "\\"
 #else /* WINDOWS */
@@ -92,6 +95,7 @@
 #define FILEIO_VOLLOCK_SUFFIX        "__lock"
 #define FILEIO_SUFFIX_DWB            "_dwb"
 #define FILEIO_SUFFIX_KEYS           "_keys"
+#define FILEIO_SUFFIX_CHANGE_TRACKING "_bct"
 #define FILEIO_MAX_SUFFIX_LENGTH     7
 
 typedef enum
@@ -359,6 +363,9 @@ struct fileio_backup_db_buffer
   int dummy;			/* Dummy field for 8byte align */
 #endif
   FILEIO_BACKUP_PAGE *area;	/* Area to read/write the page */
+  bool use_change_map;		/* Read only the pages in the change map of the volume (see backup_change_tracking.hpp) */
+  bool verify_change_map;	/* Read every page and count the changed pages missing in the change map */
+  int change_map_misses;	/* Number of changed pages missing in the change map */
 };
 
 typedef struct file_zip_page FILEIO_ZIP_PAGE;
@@ -424,6 +431,8 @@ struct fileio_thread_info
   int check_npages;
 
   FILEIO_QUEUE io_queue;
+
+  struct fileio_restore_pipeline *restore_pipeline;	/* read-ahead and decompression of restored volumes */
 };
 
 typedef struct io_backup_session FILEIO_BACKUP_SESSION;
@@ -489,6 +498,8 @@ extern void *fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FI
 					 size_t page_size);
 extern void *fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id, size_t page_size,
 			   FILEIO_WRITE_MODE write_mode);
+extern void *fileio_write_partial (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_id,
+				   size_t page_size, size_t write_size, FILEIO_WRITE_MODE write_mode);
 extern void *fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				size_t page_size);
 extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
@@ -546,6 +557,7 @@ extern void fileio_make_backup_volume_info_name (char *backup_volinfo_name, cons
 extern void fileio_make_backup_name (char *backup_name, const char *nopath_volname, const char *backup_path,
 				     FILEIO_BACKUP_LEVEL level, int unit_num);
 extern void fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_name_p);
+extern void fileio_make_change_tracking_name (char *name_p, const char *log_path_p, const char *db_name_p);
 extern void fileio_make_keys_name (char *keys_name_p, const char *db_name_p);
 extern void fileio_make_keys_name_given_path (char *keys_name_p, const char *keys_path_p, const char *db_name_p);
 #ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
@@ -474,6 +474,23 @@ struct file_tempcache_entry
   FILE_TEMPCACHE_ENTRY *next;
 };
 
+/* temporary files a transaction keeps for itself. only the transaction uses them, so it does so without the lock of
+ * the temporary cache. the cached files keep their sectors, the next query of the transaction allocates its pages
+ * without reserving sectors again. */
+typedef struct file_tempcache_tran FILE_TEMPCACHE_TRAN;
+struct file_tempcache_tran
+{
+  FILE_TEMPCACHE_ENTRY *cached_not_numerable;	/* cached temporary files */
+  FILE_TEMPCACHE_ENTRY *cached_numerable;	/* cached temporary numerable files */
+  int ncached_not_numerable;
+  int ncached_numerable;
+
+  FILE_TEMPCACHE_ENTRY *free_entries;	/* entries free to be used */
+  int nfree_entries;
+};
+#define FILE_TEMPCACHE_TRAN_NFREE_ENTRIES_MAX 8
+#define FILE_TEMPCACHE_TRAN_NSECTS_MAX 2	/* bigger files go to the shared cache */
+
 typedef struct file_tempcache FILE_TEMPCACHE;
 struct file_tempcache
 {
@@ -494,6 +511,9 @@ struct file_tempcache
 
   FILE_TEMPCACHE_ENTRY **tran_files;	/* transaction temporary files */
 
+  FILE_TEMPCACHE_TRAN *tran_caches;	/* temporary files cached by each transaction */
+  int ncached_tran_max;		/* files each transaction may cache */
+
   /* space info */
   SPACEDB_FILES spacedb_temp;
 };
@@ -781,7 +801,13 @@ STATIC_INLINE void file_tempcache_unlock (void) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void file_tempcache_check_lock (void) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void file_tempcache_free_entry_list (FILE_TEMPCACHE_ENTRY ** list) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int file_tempcache_alloc_entry (FILE_TEMPCACHE_ENTRY ** entry) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void file_tempcache_retire_entry (FILE_TEMPCACHE_ENTRY * entry) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void file_tempcache_retire_entry (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE FILE_TEMPCACHE_TRAN *file_tempcache_get_tran_cache (THREAD_ENTRY * thread_p)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool file_tempcache_tran_get (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_TRAN * tran_cache,
+					    FILE_TYPE ftype, bool numerable, FILE_TEMPCACHE_ENTRY ** entry)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int file_tempcache_get (THREAD_ENTRY * thread_p, FILE_TYPE ftype, bool numerable,
 				      FILE_TEMPCACHE_ENTRY ** entry) __attribute__ ((ALWAYS_INLINE));
 static bool file_tempcache_check_duplicate (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry, bool is_numerable);
@@ -3173,7 +3199,7 @@ file_create_temp_internal (THREAD_ENTRY * thread_p, int npages, FILE_TYPE ftype,
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  file_tempcache_retire_entry (tempcache_entry);
+	  file_tempcache_retire_entry (thread_p, tempcache_entry);
 	  return error_code;
 	}
       tempcache_entry->vfid = *vfid_out;
@@ -4096,6 +4122,12 @@ file_destroy (THREAD_ENTRY * thread_p, const VFID * vfid, bool is_temp)
   assert (is_temp == FILE_IS_TEMPORARY (fhead));
   assert (FILE_IS_TEMPORARY (fhead) || log_check_system_op_is_started (thread_p));
 
+  if (fhead->type == FILE_BTREE)
+    {
+      /* threads may have saved leaves of this b-tree */
+      btree_invalidate_rightmost_leaves ();
+    }
+
   error_code = file_table_collect_all_vsids (thread_p, page_fhead, &vsid_collector);
   if (error_code != NO_ERROR)
     {
@@ -4372,7 +4404,7 @@ file_temp_retire_internal (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_
 
   if (entry != NULL)
     {
-      file_tempcache_retire_entry (entry);
+      file_tempcache_retire_entry (thread_p, entry);
     }
   return error_code;
 }
@@ -5300,6 +5332,10 @@ file_alloc (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_INIT_PAGE_FUNC f_in
 	  ASSERT_ERROR ();
 	  goto exit;
 	}
+      if (thread_p != NULL)
+	{
+	  thread_p->resource_usage.temp_pages++;
+	}
     }
   else
     {
@@ -8956,7 +8992,7 @@ file_temp_preserve (THREAD_ENTRY * thread_p, const VFID * vfid)
     }
   else
     {
-      file_tempcache_retire_entry (entry);
+      file_tempcache_retire_entry (thread_p, entry);
     }
 }
 
@@ -9011,6 +9047,19 @@ file_tempcache_init (void)
     }
   memset (file_Tempcache.tran_files, 0, memsize);
 
+  /* allocate the caches of transactions */
+  file_Tempcache.ncached_tran_max = prm_get_integer_value (PRM_ID_MAX_ENTRIES_IN_TRAN_TEMP_FILE_CACHE);
+  memsize = ntrans * sizeof (FILE_TEMPCACHE_TRAN);
+  file_Tempcache.tran_caches = (FILE_TEMPCACHE_TRAN *) malloc (memsize);
+  if (file_Tempcache.tran_caches == NULL)
+    {
+      free_and_init (file_Tempcache.tran_files);
+      pthread_mutex_destroy (&file_Tempcache.mutex);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, memsize);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (file_Tempcache.tran_caches, 0, memsize);
+
   /* stats */
   memset (&file_Tempcache.spacedb_temp, 0, sizeof (file_Tempcache.spacedb_temp));
 
@@ -9051,8 +9100,14 @@ file_tempcache_final (void)
 	  /* should be empty */
 	  file_tempcache_free_entry_list (&file_Tempcache.tran_files[tran]);
 	}
+
+      /* temporary volumes are removed, we don't have to destroy files */
+      file_tempcache_free_entry_list (&file_Tempcache.tran_caches[tran].cached_not_numerable);
+      file_tempcache_free_entry_list (&file_Tempcache.tran_caches[tran].cached_numerable);
+      file_tempcache_free_entry_list (&file_Tempcache.tran_caches[tran].free_entries);
     }
   free_and_init (file_Tempcache.tran_files);
+  free_and_init (file_Tempcache.tran_caches);
 
   /* temporary volumes are removed, we don't have to destroy files */
   file_tempcache_free_entry_list (&file_Tempcache.cached_not_numerable);
@@ -9126,12 +9181,24 @@ file_tempcache_alloc_entry (FILE_TEMPCACHE_ENTRY ** entry)
 /*
  * file_tempcache_retire_entry () - retire entry to free entry list (if not maxed) or deallocate
  *
- * return     : void
- * entry (in) : retired entry
+ * return        : void
+ * thread_p (in) : thread entry
+ * entry (in)    : retired entry
  */
 STATIC_INLINE void
-file_tempcache_retire_entry (FILE_TEMPCACHE_ENTRY * entry)
+file_tempcache_retire_entry (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry)
 {
+  FILE_TEMPCACHE_TRAN *tran_cache = file_tempcache_get_tran_cache (thread_p);
+
+  if (tran_cache != NULL && tran_cache->nfree_entries < FILE_TEMPCACHE_TRAN_NFREE_ENTRIES_MAX)
+    {
+      /* keep it for the next file of transaction */
+      entry->next = tran_cache->free_entries;
+      tran_cache->free_entries = entry;
+      tran_cache->nfree_entries++;
+      return;
+    }
+
   /* we lock to change free entry list */
   file_tempcache_lock ();
 
@@ -9191,6 +9258,93 @@ file_tempcache_check_lock (void)
   assert (file_Tempcache.owner_mutex == thread_get_current_entry_index ());
 }
 
+/*
+ * file_tempcache_get_tran_cache () - get the temporary files cache of current transaction
+ *
+ * return        : cache of transaction or NULL when the thread must use the shared cache
+ * thread_p (in) : thread entry
+ */
+STATIC_INLINE FILE_TEMPCACHE_TRAN *
+file_tempcache_get_tran_cache (THREAD_ENTRY * thread_p)
+{
+  int tran_index = file_get_tempcache_entry_index (thread_p);
+
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (tran_index == LOG_SYSTEM_TRAN_INDEX)
+    {
+      /* all system threads have this transaction */
+      return NULL;
+    }
+  if (thread_p->get_system_tdes () != NULL)
+    {
+      /* a system worker that borrows the transaction index of the thread it helps (e.g. parallel sort). the cache of
+       * transaction is not locked, only the thread of the transaction may use it. */
+      return NULL;
+    }
+#endif /* SERVER_MODE */
+
+  return &file_Tempcache.tran_caches[tran_index];
+}
+
+/*
+ * file_tempcache_tran_get () - get a file from temporary file cache of transaction
+ *
+ * return           : true if a cached file was found, false otherwise
+ * thread_p (in)    : thread entry
+ * tran_cache (in)  : temporary file cache of transaction
+ * ftype (in)       : file type
+ * numerable (in)   : true for numerable file, false for regular file
+ * entry (out)      : entry of cached file
+ */
+STATIC_INLINE bool
+file_tempcache_tran_get (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_TRAN * tran_cache, FILE_TYPE ftype, bool numerable,
+			 FILE_TEMPCACHE_ENTRY ** entry)
+{
+  FILE_TEMPCACHE_ENTRY **cached_p = numerable ? &tran_cache->cached_numerable : &tran_cache->cached_not_numerable;
+
+  if (*cached_p == NULL)
+    {
+      return false;
+    }
+
+  if ((*cached_p)->ftype != ftype)
+    {
+      /* change type */
+      if (file_temp_set_type (thread_p, &(*cached_p)->vfid, ftype) != NO_ERROR)
+	{
+	  /* could not change it, give up */
+	  return false;
+	}
+      (*cached_p)->ftype = ftype;
+    }
+
+  /* remove from cache */
+  *entry = *cached_p;
+  *cached_p = (*entry)->next;
+  if (numerable)
+    {
+      assert (tran_cache->ncached_numerable > 0);
+      tran_cache->ncached_numerable--;
+    }
+  else
+    {
+      assert (tran_cache->ncached_not_numerable > 0);
+      tran_cache->ncached_not_numerable--;
+    }
+  (*entry)->next = NULL;
+
+  file_log ("file_tempcache_tran_get", "found in transaction cache temporary file entry "
+	    FILE_TEMPCACHE_ENTRY_MSG ", %s\n", FILE_TEMPCACHE_ENTRY_AS_ARGS (*entry),
+	    numerable ? "numerable" : "regular");
+
+  return true;
+}
+
 /*
  * file_tempcache_get () - get a file from temporary file cache
  *
@@ -9205,8 +9359,16 @@ file_tempcache_get (THREAD_ENTRY * thread_p, FILE_TYPE ftype, bool numerable, FI
 {
   int error_code = NO_ERROR;
 
+  FILE_TEMPCACHE_TRAN *tran_cache = file_tempcache_get_tran_cache (thread_p);
+
   assert (entry != NULL && *entry == NULL);
 
+  /* first look for the files of transaction, they need no lock */
+  if (tran_cache != NULL && file_tempcache_tran_get (thread_p, tran_cache, ftype, numerable, entry))
+    {
+      return NO_ERROR;
+    }
+
   file_tempcache_lock ();
 
   *entry = numerable ? file_Tempcache.cached_numerable : file_Tempcache.cached_not_numerable;
@@ -9257,12 +9419,23 @@ file_tempcache_get (THREAD_ENTRY * thread_p, FILE_TYPE ftype, bool numerable, FI
     }
 
   /* not from cache, get a new entry */
-  error_code = file_tempcache_alloc_entry (entry);
-  if (error_code != NO_ERROR)
+  if (tran_cache != NULL && tran_cache->free_entries != NULL)
     {
-      ASSERT_ERROR ();
-      file_tempcache_unlock ();
-      return error_code;
+      assert (tran_cache->nfree_entries > 0);
+
+      *entry = tran_cache->free_entries;
+      tran_cache->free_entries = tran_cache->free_entries->next;
+      tran_cache->nfree_entries--;
+    }
+  else
+    {
+      error_code = file_tempcache_alloc_entry (entry);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  file_tempcache_unlock ();
+	  return error_code;
+	}
     }
 
   /* init new entry */
@@ -9331,6 +9504,7 @@ STATIC_INLINE bool
 file_tempcache_put (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry)
 {
   FILE_HEADER fhead;
+  FILE_TEMPCACHE_TRAN *tran_cache;
 
   assert (entry != NULL);
   assert (!VFID_ISNULL (&entry->vfid));
@@ -9349,6 +9523,44 @@ file_tempcache_put (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry)
   /* make sure entry has correct type. */
   entry->ftype = fhead.type;
 
+  /* small files are kept by the transaction for itself, while it has room */
+  tran_cache = file_tempcache_get_tran_cache (thread_p);
+  if (tran_cache != NULL && fhead.n_sector_total <= FILE_TEMPCACHE_TRAN_NSECTS_MAX
+      && tran_cache->ncached_not_numerable + tran_cache->ncached_numerable < file_Tempcache.ncached_tran_max)
+    {
+      /* reset file */
+      if (file_temp_reset_user_pages (thread_p, &entry->vfid) != NO_ERROR)
+	{
+	  /* failed to reset file, we cannot cache it */
+	  ASSERT_ERROR ();
+
+	  file_log ("file_tempcache_put",
+		    "could not cache temporary file " FILE_TEMPCACHE_ENTRY_MSG
+		    ", error during file reset", FILE_TEMPCACHE_ENTRY_AS_ARGS (entry));
+	  return false;
+	}
+
+      if (FILE_IS_NUMERABLE (&fhead))
+	{
+	  entry->next = tran_cache->cached_numerable;
+	  tran_cache->cached_numerable = entry;
+	  tran_cache->ncached_numerable++;
+	}
+      else
+	{
+	  entry->next = tran_cache->cached_not_numerable;
+	  tran_cache->cached_not_numerable = entry;
+	  tran_cache->ncached_not_numerable++;
+	}
+
+      file_log ("file_tempcache_put",
+		"cached temporary file " FILE_TEMPCACHE_ENTRY_MSG ", %s, in transaction cache\n",
+		FILE_TEMPCACHE_ENTRY_AS_ARGS (entry), FILE_IS_NUMERABLE (&fhead) ? "numerable" : "regular");
+
+      /* cached */
+      return true;
+    }
+
   /* lock temporary cache */
   file_tempcache_lock ();
 
@@ -9443,6 +9655,123 @@ file_tempcache_drop_tran_temp_files (THREAD_ENTRY * thread_p)
     }
 }
 
+/*
+ * file_tempcache_drop_tran_cache () - empty the temporary files cache of a transaction index that is released
+ *
+ * return          : void
+ * thread_p (in)   : thread entry
+ * tran_index (in) : released transaction index
+ *
+ * note: cached files go to the shared cache while it has room, the others are destroyed.
+ */
+void
+file_tempcache_drop_tran_cache (THREAD_ENTRY * thread_p, int tran_index)
+{
+  FILE_TEMPCACHE_TRAN *tran_cache;
+  FILE_TEMPCACHE_ENTRY **tran_lists[2];
+  FILE_TEMPCACHE_ENTRY **shared_lists[2];
+  int *shared_counts[2];
+  FILE_TEMPCACHE_ENTRY *entry, *next;
+  FILE_TEMPCACHE_ENTRY *destroy_entries = NULL;
+  FILE_TEMPCACHE_ENTRY *free_entries = NULL;
+  int i;
+
+  if (file_Tempcache.tran_caches == NULL)
+    {
+      /* not initialized or already finalized */
+      return;
+    }
+
+#if defined (SERVER_MODE)
+  if (tran_index == LOG_SYSTEM_TRAN_INDEX || tran_index == NULL_TRAN_INDEX)
+    {
+      return;
+    }
+#else /* !SERVER_MODE */
+  tran_index = file_get_tempcache_entry_index (thread_p);
+#endif /* !SERVER_MODE */
+
+  tran_cache = &file_Tempcache.tran_caches[tran_index];
+
+  tran_lists[0] = &tran_cache->cached_not_numerable;
+  tran_lists[1] = &tran_cache->cached_numerable;
+  shared_lists[0] = &file_Tempcache.cached_not_numerable;
+  shared_lists[1] = &file_Tempcache.cached_numerable;
+  shared_counts[0] = &file_Tempcache.ncached_not_numerable;
+  shared_counts[1] = &file_Tempcache.ncached_numerable;
+
+  file_tempcache_lock ();
+
+  /* the files were reset when the transaction cached them */
+  for (i = 0; i < 2; i++)
+    {
+      for (entry = *tran_lists[i]; entry != NULL; entry = next)
+	{
+	  next = entry->next;
+
+	  if (file_Tempcache.ncached_not_numerable + file_Tempcache.ncached_numerable < file_Tempcache.ncached_max)
+	    {
+	      assert (file_tempcache_check_duplicate (thread_p, entry, i == 1) == false);
+
+	      entry->next = *shared_lists[i];
+	      *shared_lists[i] = entry;
+	      (*shared_counts[i])++;
+	    }
+	  else
+	    {
+	      entry->next = destroy_entries;
+	      destroy_entries = entry;
+	    }
+	}
+      *tran_lists[i] = NULL;
+    }
+  tran_cache->ncached_not_numerable = 0;
+  tran_cache->ncached_numerable = 0;
+
+  free_entries = tran_cache->free_entries;
+  tran_cache->free_entries = NULL;
+  tran_cache->nfree_entries = 0;
+
+  file_tempcache_unlock ();
+
+  /* destroy the files the shared cache has no room for, without holding the mutex */
+  for (entry = destroy_entries; entry != NULL; entry = next)
+    {
+      next = entry->next;
+
+      file_log ("file_tempcache_drop_tran_cache", "drop entry " FILE_TEMPCACHE_ENTRY_MSG,
+		FILE_TEMPCACHE_ENTRY_AS_ARGS (entry));
+      if (file_destroy (thread_p, &entry->vfid, true) != NO_ERROR)
+	{
+	  /* file is leaked */
+	  assert_release (false);
+	  /* ignore error and continue free as many files as possible */
+	}
+
+      entry->next = free_entries;
+      free_entries = entry;
+    }
+
+  /* not file_tempcache_retire_entry, it would keep them in the cache of the current transaction */
+  file_tempcache_lock ();
+  for (entry = free_entries; entry != NULL; entry = next)
+    {
+      next = entry->next;
+
+      if (file_Tempcache.nfree_entries < file_Tempcache.nfree_entries_max)
+	{
+	  entry->next = file_Tempcache.free_entries;
+	  file_Tempcache.free_entries = entry;
+	  file_Tempcache.nfree_entries++;
+	}
+      else
+	{
+	  free (entry);
+	}
+    }
+  file_tempcache_unlock ();
+}
+
 /*
  * file_tempcache_cache_or_drop_entries () - drop all temporary files in the give entry list
  *
@@ -9472,7 +9801,7 @@ file_tempcache_cache_or_drop_entries (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_EN
 	      assert_release (false);
 	      /* ignore error and continue free as many files as possible */
 	    }
-	  file_tempcache_retire_entry (temp_file);
+	  file_tempcache_retire_entry (thread_p, temp_file);
 	}
     }
   *entries = NULL;
@@ -9568,6 +9897,8 @@ STATIC_INLINE void
 file_tempcache_dump (FILE * fp)
 {
   FILE_TEMPCACHE_ENTRY *cached_files;
+  FILE_TEMPCACHE_TRAN *tran_cache;
+  int tran, ntrans;
 
   file_tempcache_lock ();
 
@@ -9599,8 +9930,26 @@ file_tempcache_dump (FILE * fp)
 
   file_tempcache_unlock ();
 
-  /* todo: to print transaction temporary files we need some kind of synchronization... right now each transaction
-   *       manages its own list freely. */
+  /* each transaction manages its own lists freely, so we only print what they count. */
+  fprintf (fp, "  files cached by transactions (max %d each):\n", file_Tempcache.ncached_tran_max);
+#if defined (SERVER_MODE)
+  ntrans = logtb_get_number_of_total_tran_indices ();
+#else
+  ntrans = 1;
+#endif
+  for (tran = 0; tran < ntrans; tran++)
+    {
+      tran_cache = &file_Tempcache.tran_caches[tran];
+      if (tran_cache->ncached_not_numerable + tran_cache->ncached_numerable + tran_cache->nfree_entries == 0)
+	{
+	  continue;
+	}
+      fprintf (fp, "    tran index = %d, regular files count = %d, numerable files count = %d, free entries = %d\n",
+	       tran, tran_cache->ncached_not_numerable, tran_cache->ncached_numerable, tran_cache->nfree_entries);
+    }
+  fprintf (fp, "\n");
+
+  /* todo: to print transaction temporary files we need some kind of synchronization... */
 }
 
 /************************************************************************/
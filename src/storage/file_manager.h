@@ -202,6 +202,7 @@ extern int file_numerable_find_nth (THREAD_ENTRY * thread_p, const VFID * vfid,
 extern int file_numerable_truncate (THREAD_ENTRY * thread_p, const VFID * vfid, DKNPAGES npages);
 
 extern void file_tempcache_drop_tran_temp_files (THREAD_ENTRY * thread_p);
+extern void file_tempcache_drop_tran_cache (THREAD_ENTRY * thread_p, int tran_index);
 
 extern void file_temp_preserve (THREAD_ENTRY * thread_p, const VFID * vfid);
 extern int file_get_tran_num_temp_files (THREAD_ENTRY * thread_p);
@@ -72,6 +72,8 @@
 #include "log_append.hpp"
 #include "string_buffer.hpp"
 #include "tde.h"
+#include "columnar_cache.hpp"
+#include "statistics_auto.hpp"
 
 #include <set>
 
@@ -99,6 +101,11 @@ static int rv;
 #define HEAP_STATS_ENTRY_MHT_EST_SIZE 1000
 #define HEAP_STATS_ENTRY_FREELIST_SIZE 1000
 
+/* new records counted by an inserter before they are added to the heap header */
+#define HEAP_INSERT_AFFINITY_STATS_BATCH 64
+/* concurrent inserters looking for best space pages are spread over this many pages */
+#define HEAP_BESTSPACE_SPREAD 8
+
 #define HEAP_DEBUG_SCANCACHE_INITPATTERN (12345)
 
 #if defined(CUBRID_DEBUG)
@@ -474,6 +481,20 @@ struct heap_stats_bestspace_cache
   pthread_mutex_t bestspace_mutex;
 };
 
+/* The page a thread inserted into last, tried first by its next insert into the same heap so that concurrent inserters
+ * keep to pages of their own. The header estimates of these inserts are added to the heap header in batches. */
+typedef struct heap_insert_affinity HEAP_INSERT_AFFINITY;
+struct heap_insert_affinity
+{
+  HFID hfid;			/* heap of the page */
+  VPID vpid;			/* the page; NULL if the thread has none */
+  UINT64 epoch;			/* heap_Insert_affinity_epoch when the page was taken */
+  int unfill_space;		/* unfill space of the heap */
+  int num_recs;			/* new records not counted in the heap header yet */
+  int num_pages;		/* overflow pages not counted in the heap header yet */
+  float recs_sumlen;		/* length of records not counted in the heap header yet */
+};
+
 typedef struct heap_show_scan_ctx HEAP_SHOW_SCAN_CTX;
 struct heap_show_scan_ctx
 {
@@ -496,6 +517,12 @@ static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area = { 0, NULL, NULL, 0
 
 static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
 
+/* insert pages by thread index */
+static HEAP_INSERT_AFFINITY *heap_Insert_affinity = NULL;
+static int heap_Insert_affinity_count = 0;
+/* incremented whenever heap pages are removed, to drop the insert pages the threads have */
+static volatile UINT64 heap_Insert_affinity_epoch = 0;
+
 static HEAP_HFID_TABLE heap_Hfid_table_area = { LF_HASH_TABLE_INITIALIZER, LF_ENTRY_DESCRIPTOR_INITIALIZER,
   LF_FREELIST_INITIALIZER, false
 };
@@ -723,6 +750,12 @@ static int heap_chnguess_remove_entry (const void *oid_key, void *ent, void *xig
 
 static int heap_stats_bestspace_initialize (void);
 static int heap_stats_bestspace_finalize (void);
+static void heap_stats_invalidate_insert_affinity (void);
+static HEAP_INSERT_AFFINITY *heap_stats_get_insert_affinity (THREAD_ENTRY * thread_p);
+static bool heap_stats_find_affinity_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space,
+					   bool isnew_rec, int newrec_size, PGBUF_WATCHER * pg_watcher);
+static void heap_stats_flush_affinity_estimates (THREAD_ENTRY * thread_p, HEAP_INSERT_AFFINITY * affinity,
+						 HEAP_HDR_STATS * heap_hdr);
 
 static int heap_get_spage_type (void);
 static bool heap_is_reusable_oid (const FILE_TYPE file_type);
@@ -759,7 +792,8 @@ static SCAN_CODE heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, R
 				       DB_VALUE ** record_info);
 static SCAN_CODE heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 				     RECDES * recdes, HEAP_SCANCACHE * scan_cache, bool ispeeking,
-				     bool reversed_direction, DB_VALUE ** cache_recordinfo, sampling_info * sampling);
+				     bool reversed_direction, DB_VALUE ** cache_recordinfo, sampling_info * sampling,
+				     bool stay_in_page);
 
 static SCAN_CODE heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
 				     const PAGE_PTR pgptr, DB_VALUE ** page_info);
@@ -1096,6 +1130,9 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
 
+  /* the pages of the heap are gone */
+  heap_stats_invalidate_insert_affinity ();
+
   rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
   while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
@@ -3264,6 +3301,9 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   int rc;
   int idx_worstspace;
   int i, best_array_index = -1;
+  int best_array_start, best_array_count, skip_count;
+  void *last, *prev_last;
+  HEAP_BESTSPACE first_fit;
   bool hash_is_available;
   bool best_hint_is_used;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
@@ -3285,8 +3325,12 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   found = HEAP_FINDSPACE_NOTFOUND;
   notfound_cnt = 0;
   best_array_index = 0;
+  best_array_count = 0;
   hash_is_available = prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0;
 
+  /* each thread starts at pages of its own, so that concurrent inserters do not all go for the same page */
+  best_array_start = thread_get_entry_index (thread_p) % HEAP_NUM_BEST_SPACESTATS;
+
   while (found == HEAP_FINDSPACE_NOTFOUND)
     {
       best.freespace = -1;	/* init */
@@ -3297,17 +3341,40 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 	  PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
 	  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
-	  while (notfound_cnt < BEST_PAGE_SEARCH_MAX_COUNT
-		 && (ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
+	  /* skip some pages with enough space, by thread and by the pages already tried */
+	  skip_count = (thread_get_entry_index (thread_p) + notfound_cnt) % HEAP_BESTSPACE_SPREAD;
+	  first_fit.freespace = -1;
+	  last = NULL;
+
+	  while (notfound_cnt < BEST_PAGE_SEARCH_MAX_COUNT)
 	    {
+	      prev_last = last;
+	      ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, &last);
+	      if (ent == NULL)
+		{
+		  /* less pages than skipped; take the first one */
+		  best = first_fit;
+		  break;
+		}
+
 	      if (ent->best.freespace >= needed_space)
 		{
+		  if (first_fit.freespace == -1)
+		    {
+		      first_fit = ent->best;
+		    }
+		  if (skip_count-- > 0)
+		    {
+		      continue;
+		    }
+
 		  best = ent->best;
 		  assert (best.freespace > 0 && best.freespace <= PGLENGTH_MAX);
 		  break;
 		}
 
-	      /* remove in memory bestspace */
+	      /* remove in memory bestspace; the next search starts again after the previous entry */
+	      last = prev_last;
 	      (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
 	      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
 	      (void) heap_stats_entry_free (thread_p, ent, NULL);
@@ -3326,8 +3393,9 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 	{
 	  /* Maybe PRM_ID_HF_MAX_BESTSPACE_ENTRIES <= 0 or There is no best space in heap_Bestspace hashtable. We will
 	   * use bestspace hint in heap_header. */
-	  while (best_array_index < HEAP_NUM_BEST_SPACESTATS)
+	  while (best_array_count < HEAP_NUM_BEST_SPACESTATS)
 	    {
+	      best_array_index = (best_array_start + best_array_count) % HEAP_NUM_BEST_SPACESTATS;
 	      if (bestspace[best_array_index].freespace >= needed_space)
 		{
 		  best.vpid = bestspace[best_array_index].vpid;
@@ -3336,7 +3404,7 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 		  best_hint_is_used = true;
 		  break;
 		}
-	      best_array_index++;
+	      best_array_count++;
 	    }
 	}
 
@@ -3439,8 +3507,8 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
 	{
 	  if (best_hint_is_used)
 	    {
-	      /* Increment best_array_index for next search */
-	      best_array_index++;
+	      /* Increment best_array_count for next search */
+	      best_array_count++;
 	    }
 	  else
 	    {
@@ -3481,6 +3549,181 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   return found;
 }
 
+/*
+ * heap_stats_get_insert_affinity () - Get the insert page of a thread
+ *   return: the insert page entry of the thread, or NULL
+ */
+static HEAP_INSERT_AFFINITY *
+heap_stats_get_insert_affinity (THREAD_ENTRY * thread_p)
+{
+  int index = thread_get_entry_index (thread_p);
+
+  if (heap_Insert_affinity == NULL || index < 0 || index >= heap_Insert_affinity_count)
+    {
+      return NULL;
+    }
+
+  return &heap_Insert_affinity[index];
+}
+
+/*
+ * heap_stats_invalidate_insert_affinity () - Drop the insert pages of all threads
+ *   return: void
+ *
+ * Note: Called before heap pages are removed, while the removed page is still fixed; a thread fixing its insert page
+ *       afterwards sees the new epoch and looks for another page.
+ */
+static void
+heap_stats_invalidate_insert_affinity (void)
+{
+  (void) ATOMIC_INC_64 (&heap_Insert_affinity_epoch, 1ULL);
+}
+
+/*
+ * heap_stats_flush_affinity_estimates () - Add the estimates counted by a thread to the heap header
+ *   return: void
+ *   affinity(in/out): insert page entry of the thread
+ *   heap_hdr(in/out): header of the heap of the entry, fixed for write
+ */
+static void
+heap_stats_flush_affinity_estimates (THREAD_ENTRY * thread_p, HEAP_INSERT_AFFINITY * affinity,
+				     HEAP_HDR_STATS * heap_hdr)
+{
+  heap_hdr->estimates.num_recs += affinity->num_recs;
+  heap_hdr->estimates.num_pages += affinity->num_pages;
+  heap_hdr->estimates.recs_sumlen += affinity->recs_sumlen;
+
+  affinity->num_recs = 0;
+  affinity->num_pages = 0;
+  affinity->recs_sumlen = 0;
+}
+
+/*
+ * heap_stats_find_affinity_page () - Fix the page the thread inserted into last, if it still has the needed space
+ *   return: true if the page is fixed in pg_watcher
+ *   hfid(in): Object heap file identifier
+ *   needed_space(in): The minimal space needed
+ *   isnew_rec(in): Are we inserting a new record to the heap ?
+ *   newrec_size(in): Size of the new record
+ *   pg_watcher(out): watcher of the page
+ *
+ * Note: The heap header is not fixed. The page is given up, rather than waited for, when another thread has it, so
+ *       that concurrent inserters end up on different pages. The header estimates of the insert are counted by the
+ *       thread and added to the header every HEAP_INSERT_AFFINITY_STATS_BATCH records, or when the thread fixes the
+ *       header anyway.
+ */
+static bool
+heap_stats_find_affinity_page (THREAD_ENTRY * thread_p, const HFID * hfid, int needed_space, bool isnew_rec,
+			       int newrec_size, PGBUF_WATCHER * pg_watcher)
+{
+  HEAP_INSERT_AFFINITY *affinity;
+  VPID hdr_vpid;
+  PAGE_PTR hdr_pgptr;
+  RECDES hdr_recdes;
+  LOG_DATA_ADDR addr_hdr;
+  int old_wait_msecs;
+  int total_space;
+
+  assert (pg_watcher->pgptr == NULL);
+
+  if (!prm_get_bool_value (PRM_ID_HF_INSERT_PAGE_AFFINITY))
+    {
+      return false;
+    }
+
+  affinity = heap_stats_get_insert_affinity (thread_p);
+  if (affinity == NULL || VPID_ISNULL (&affinity->vpid) || !HFID_EQ (&affinity->hfid, hfid))
+    {
+      return false;
+    }
+
+  if (affinity->epoch != ATOMIC_LOAD_64 (&heap_Insert_affinity_epoch))
+    {
+      /* pages were removed */
+      VPID_SET_NULL (&affinity->vpid);
+      return false;
+    }
+
+  total_space = needed_space + heap_Slotted_overhead + affinity->unfill_space;
+  if (heap_is_big_length (total_space))
+    {
+      total_space = needed_space + heap_Slotted_overhead;
+    }
+
+  if (er_errid () != NO_ERROR)
+    {
+      /* an error set before would be mistaken for a fix error */
+      return false;
+    }
+
+  /* LK_FORCE_ZERO_WAIT doesn't set error when deadlock occurs */
+  old_wait_msecs = xlogtb_reset_wait_msecs (thread_p, LK_FORCE_ZERO_WAIT);
+  (void) pgbuf_ordered_fix (thread_p, &affinity->vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, pg_watcher);
+  (void) xlogtb_reset_wait_msecs (thread_p, old_wait_msecs);
+
+  if (pg_watcher->pgptr == NULL)
+    {
+      /* busy or deallocated; look for another page */
+      if (er_errid () != ER_INTERRUPTED)
+	{
+	  er_clear ();
+	}
+      VPID_SET_NULL (&affinity->vpid);
+      return false;
+    }
+
+  if (affinity->epoch != ATOMIC_LOAD_64 (&heap_Insert_affinity_epoch)
+      || pgbuf_get_page_ptype (thread_p, pg_watcher->pgptr) != PAGE_HEAP
+      || spage_max_space_for_new_record (thread_p, pg_watcher->pgptr) < total_space)
+    {
+      pgbuf_ordered_unfix (thread_p, pg_watcher);
+      VPID_SET_NULL (&affinity->vpid);
+      return false;
+    }
+
+  if (isnew_rec == true)
+    {
+      affinity->num_recs++;
+      if (newrec_size > DB_PAGESIZE)
+	{
+	  affinity->num_pages += CEIL_PTVDIV (newrec_size, DB_PAGESIZE);
+	}
+    }
+  affinity->recs_sumlen += (float) newrec_size;
+
+  if (affinity->num_recs >= HEAP_INSERT_AFFINITY_STATS_BATCH)
+    {
+      /* do not wait for the header; keep counting if it is busy */
+      hdr_vpid.volid = hfid->vfid.volid;
+      hdr_vpid.pageid = hfid->hpgid;
+      hdr_pgptr = pgbuf_fix (thread_p, &hdr_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_CONDITIONAL_LATCH);
+      if (hdr_pgptr != NULL)
+	{
+	  if (spage_get_record (thread_p, hdr_pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, &hdr_recdes, PEEK) == S_SUCCESS)
+	    {
+	      heap_stats_flush_affinity_estimates (thread_p, affinity, (HEAP_HDR_STATS *) hdr_recdes.data);
+
+	      addr_hdr.vfid = &hfid->vfid;
+	      addr_hdr.pgptr = hdr_pgptr;
+	      addr_hdr.offset = HEAP_HEADER_AND_CHAIN_SLOTID;
+	      log_skip_logging (thread_p, &addr_hdr);
+	      pgbuf_set_dirty (thread_p, hdr_pgptr, FREE);
+	    }
+	  else
+	    {
+	      assert (false);
+	      pgbuf_unfix (thread_p, hdr_pgptr);
+	    }
+	}
+      else if (er_errid () != ER_INTERRUPTED)
+	{
+	  er_clear ();
+	}
+    }
+
+  return true;
+}
+
 /*
  * heap_stats_find_best_page () - Find a page with the needed space.
  *   return: pointer to page with enough space or NULL
@@ -3510,16 +3753,27 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
   int num_pages_found;
   float other_high_best_ratio;
   PGBUF_WATCHER hdr_page_watcher;
+  HEAP_INSERT_AFFINITY *affinity;
   int error_code = NO_ERROR;
   PERF_UTIME_TRACKER time_find_best_page = PERF_UTIME_TRACKER_INITIALIZER;
 
   PERF_UTIME_TRACKER_START (thread_p, &time_find_best_page);
+
+  assert (scan_cache == NULL || scan_cache->cache_last_fix_page == false || scan_cache->page_watcher.pgptr == NULL);
+
+  /*
+   * First try the page this thread inserted into last, without the heap header.
+   */
+  if (heap_stats_find_affinity_page (thread_p, hfid, needed_space, isnew_rec, newrec_size, pg_watcher))
+    {
+      PERF_UTIME_TRACKER_TIME (thread_p, &time_find_best_page, PSTAT_HF_HEAP_FIND_BEST_PAGE);
+      return pg_watcher->pgptr;
+    }
+
   /*
    * Try to use the space cache for as much information as possible to avoid
    * fetching and updating the header page a lot.
    */
-
-  assert (scan_cache == NULL || scan_cache->cache_last_fix_page == false || scan_cache->page_watcher.pgptr == NULL);
   PGBUF_INIT_WATCHER (&hdr_page_watcher, PGBUF_ORDERED_HEAP_HDR, hfid);
 
   /*
@@ -3569,6 +3823,13 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
     }
   heap_hdr->estimates.recs_sumlen += (float) newrec_size;
 
+  affinity = heap_stats_get_insert_affinity (thread_p);
+  if (affinity != NULL && HFID_EQ (&affinity->hfid, hfid))
+    {
+      /* the header is fixed anyway */
+      heap_stats_flush_affinity_estimates (thread_p, affinity, heap_hdr);
+    }
+
   assert (!heap_is_big_length (needed_space));
   /* Take into consideration the unfill factor for pages with objects */
   total_space = needed_space + heap_Slotted_overhead + heap_hdr->unfill_space;
@@ -3673,6 +3934,27 @@ heap_stats_find_best_page (THREAD_ENTRY * thread_p, const HFID * hfid, int neede
 	      || er_errid () == ER_FILE_NOT_ENOUGH_PAGES_IN_DATABASE);
     }
 
+  if (affinity != NULL && pg_watcher->pgptr != NULL && prm_get_bool_value (PRM_ID_HF_INSERT_PAGE_AFFINITY))
+    {
+      /* the next inserts of this thread go to this page while it has space */
+      if (!HFID_EQ (&affinity->hfid, hfid))
+	{
+	  /* the estimates of the previous heap are given up; they are only estimates */
+	  affinity->hfid = *hfid;
+	  affinity->num_recs = 0;
+	  affinity->num_pages = 0;
+	  affinity->recs_sumlen = 0;
+	}
+      affinity->vpid = *pgbuf_get_vpid_ptr (pg_watcher->pgptr);
+      affinity->epoch = ATOMIC_LOAD_64 (&heap_Insert_affinity_epoch);
+      affinity->unfill_space = heap_hdr->unfill_space;
+      if (VPID_EQ (&affinity->vpid, &vpid))
+	{
+	  /* the header page is fixed in the header order only */
+	  VPID_SET_NULL (&affinity->vpid);
+	}
+    }
+
   addr_hdr.pgptr = hdr_page_watcher.pgptr;
   log_skip_logging (thread_p, &addr_hdr);
   pgbuf_ordered_set_dirty_and_free (thread_p, &hdr_page_watcher);
@@ -4639,6 +4921,7 @@ heap_vpid_remove (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * h
     }
 
   /* Free the page to be deallocated and deallocate the page */
+  heap_stats_invalidate_insert_affinity ();
   pgbuf_ordered_unfix (thread_p, &rm_pg_watcher);
 
   if (file_dealloc (thread_p, &hfid->vfid, rm_vpid, FILE_HEAP) != NO_ERROR)
@@ -4939,6 +5222,7 @@ heap_remove_page_on_vacuum (THREAD_ENTRY * thread_p, PAGE_PTR * page_ptr, HFID *
     }
 
   /* Unfix current page. */
+  heap_stats_invalidate_insert_affinity ();
   pgbuf_ordered_unfix_and_init (thread_p, *page_ptr, &crt_watcher);
   /* Deallocate current page. */
   if (file_dealloc (thread_p, &hfid->vfid, &page_vpid, FILE_HEAP) != NO_ERROR)
@@ -7863,11 +8147,13 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
  *			       be NULL COPY when the object is copied.
  * cache_recordinfo (in/out) : DB_VALUE pointer array that caches record
  *			       information values.
+ * sampling (in)	     : Pages to skip when sampling, or NULL.
+ * stay_in_page (in)	     : Do not go past the page of next_oid.
  */
 static SCAN_CODE
 heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo,
-		    sampling_info * sampling)
+		    sampling_info * sampling, bool stay_in_page)
 {
   VPID vpid;
   VPID *vpidptr_incache;
@@ -8046,7 +8332,12 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	      if (scan == S_END)
 		{
 		  /* Find next page of heap and continue scanning */
-		  if (reversed_direction)
+		  if (stay_in_page)
+		    {
+		      /* the end of the page is the end of the scan */
+		      VPID_SET_NULL (&vpid);
+		    }
+		  else if (reversed_direction)
 		    {
 		      (void) heap_vpid_prev (thread_p, hfid, scan_cache->page_watcher.pgptr, &vpid);
 		    }
@@ -15260,6 +15551,7 @@ static int
 heap_stats_bestspace_initialize (void)
 {
   int ret = NO_ERROR;
+  int i;
 
   if (heap_Bestspace != NULL)
     {
@@ -15293,6 +15585,27 @@ heap_stats_bestspace_initialize (void)
   heap_Bestspace->free_list_count = 0;
   heap_Bestspace->free_list = NULL;
 
+  heap_Insert_affinity_count = (int) thread_num_total_threads ();
+  heap_Insert_affinity =
+    (HEAP_INSERT_AFFINITY *) malloc (heap_Insert_affinity_count * sizeof (HEAP_INSERT_AFFINITY));
+  if (heap_Insert_affinity == NULL)
+    {
+      ret = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ret, 1, heap_Insert_affinity_count * sizeof (HEAP_INSERT_AFFINITY));
+      heap_Insert_affinity_count = 0;
+      goto exit_on_error;
+    }
+  for (i = 0; i < heap_Insert_affinity_count; i++)
+    {
+      HFID_SET_NULL (&heap_Insert_affinity[i].hfid);
+      VPID_SET_NULL (&heap_Insert_affinity[i].vpid);
+      heap_Insert_affinity[i].epoch = 0;
+      heap_Insert_affinity[i].unfill_space = 0;
+      heap_Insert_affinity[i].num_recs = 0;
+      heap_Insert_affinity[i].num_pages = 0;
+      heap_Insert_affinity[i].recs_sumlen = 0;
+    }
+
   return ret;
 
 exit_on_error:
@@ -15349,6 +15662,12 @@ heap_stats_bestspace_finalize (void)
 
   pthread_mutex_destroy (&heap_Bestspace->bestspace_mutex);
 
+  if (heap_Insert_affinity != NULL)
+    {
+      free_and_init (heap_Insert_affinity);
+      heap_Insert_affinity_count = 0;
+    }
+
   heap_Bestspace = NULL;
 
   return ret;
@@ -18915,7 +19234,35 @@ SCAN_CODE
 heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, NULL,
+			     false);
+}
+
+/*
+ * heap_next_in_page () - Retrieve or peek next object of a page
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ *   hfid(in):
+ *   class_oid(in):
+ *   next_oid(in/out): Object identifier of current record, or the page to scan with NULL_SLOTID to start with its
+ *                     first record. Will be set to next available record of the same page or NULL_OID when there
+ *                     is not one.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to
+ *                   describe the new record.
+ *   scan_cache(in/out): Scan cache
+ *   ispeeking(in): PEEK when the object is peeked, scan_cache cannot be NULL
+ *                  COPY when the object is copied
+ *
+ * Note: Like heap_next, but the scan ends with the page instead of following the chain of pages. This lets several
+ *       threads scan the pages of a heap that are handed out to them one by one (see heap_page_next).
+ */
+SCAN_CODE
+heap_next_in_page (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
+		   HEAP_SCANCACHE * scan_cache, int ispeeking)
+{
+  assert (!OID_ISNULL (next_oid));
+
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, NULL,
+			     true);
 }
 
 /*
@@ -18937,7 +19284,8 @@ SCAN_CODE
 heap_next_sampling (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 		    HEAP_SCANCACHE * scan_cache, int ispeeking, sampling_info * sampling)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, sampling);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL,
+			     sampling, false);
 }
 
 /*
@@ -18964,7 +19312,7 @@ heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false,
-			     cache_recordinfo, NULL);
+			     cache_recordinfo, NULL, false);
 }
 
 /*
@@ -18986,7 +19334,8 @@ SCAN_CODE
 heap_prev (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL, NULL,
+			     false);
 }
 
 /*
@@ -19013,7 +19362,7 @@ heap_prev_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true,
-			     cache_recordinfo, NULL);
+			     cache_recordinfo, NULL, false);
 }
 
 /*
@@ -23131,6 +23480,12 @@ heap_insert_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
       perfmon_inc_stat (thread_p, PSTAT_HEAP_ASSIGN_INSERTS);
     }
 
+  colcache_class_modified (&context->class_oid);
+  if (context->recdes_p->type != REC_ASSIGN_ADDRESS)
+    {
+      stats_auto_class_modified (&context->class_oid);
+    }
+
   if (context->do_supplemental_log && !LSA_ISNULL (&context->supp_redo_lsa)
       && context->recdes_p->type != REC_ASSIGN_ADDRESS)
     {
@@ -23311,6 +23666,12 @@ heap_delete_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
       goto error;
     }
 
+  if (rc == NO_ERROR)
+    {
+      colcache_class_modified (&context->class_oid);
+      stats_auto_class_modified (&context->class_oid);
+    }
+
   if (context->do_supplemental_log == true)
     {
       (void) log_append_supplemental_lsa (thread_p,
@@ -23539,6 +23900,9 @@ heap_update_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
       goto exit;
     }
 
+  colcache_class_modified (&context->class_oid);
+  stats_auto_class_modified (&context->class_oid);
+
   /*
    * Class update case
    */
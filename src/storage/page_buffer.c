@@ -56,6 +56,7 @@
 #include "xserver_interface.h"
 #include "btree_load.h"
 #include "boot_sr.h"
+#include "backup_change_tracking.hpp"
 #include "double_write_buffer.h"
 #include "resource_tracker.hpp"
 #include "tde.h"
@@ -65,6 +66,7 @@
 
 #if defined(SERVER_MODE)
 #include "connection_error.h"
+#include "resource_group.hpp"
 #endif /* SERVER_MODE */
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
@@ -99,6 +101,9 @@ static int rv;
 #define PGBUF_TIMEOUT                      300	/* timeout seconds */
 #define PGBUF_FIX_COUNT_THRESHOLD           64	/* fix count threshold. used as indicator for hot pages. */
 
+/* compressed temporary pages are written in multiples of this size */
+#define PGBUF_TEMP_COMPRESS_BLOCK_SIZE    4096
+
 /* size of io page */
 #if defined(CUBRID_DEBUG)
 #define SIZEOF_IOPAGE_PAGESIZE_AND_GUARD() (IO_PAGESIZE + sizeof (pgbuf_Guard))
@@ -1211,6 +1216,8 @@ STATIC_INLINE int pgbuf_find_current_wait_msecs (THREAD_ENTRY * thread_p) __attr
 
 static bool pgbuf_is_temp_lsa (const log_lsa & lsa);
 static void pgbuf_init_temp_page_lsa (FILEIO_PAGE * io_page, PGLENGTH page_size);
+static size_t pgbuf_compress_temp_page (THREAD_ENTRY * thread_p, const FILEIO_PAGE * io_page, FILEIO_PAGE * zip_page);
+static int pgbuf_decompress_temp_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page);
 
 static void pgbuf_scan_bcb_table (THREAD_ENTRY * thread_p);
 
@@ -1860,6 +1867,14 @@ pgbuf_fix_release (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE f
 	}
     }
 
+#if defined (SERVER_MODE)
+  if (thread_p != NULL && thread_p->resgrp_io_delay_usec > 0 && pgbuf_get_hold_count (thread_p) == 0)
+    {
+      /* sleep for the page reads of the resource group over its rate while no page is fixed */
+      resgrp_pay_page_read_delay (thread_p);
+    }
+#endif /* SERVER_MODE */
+
   perf.lock_wait_time = 0;
   perf.is_perf_tracking = perfmon_is_perf_tracking ();
 
@@ -2121,6 +2136,10 @@ try_again:
     }
 
   show_status->num_page_request++;
+  if (thread_p != NULL)
+    {
+      thread_p->resource_usage.page_fetches++;
+    }
 
   /* Record number of fetches in statistics */
   if (perf.is_perf_tracking)
@@ -7719,6 +7738,15 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
       /* Record number of reads in statistics */
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
       show_status->num_pages_read++;
+      if (thread_p != NULL)
+	{
+	  thread_p->resource_usage.page_ioreads++;
+	}
+
+#if defined (SERVER_MODE)
+      /* keep the resource group of the reader under its page read rate; the delay is slept at a later fix */
+      resgrp_charge_page_read (thread_p);
+#endif /* SERVER_MODE */
 
 #if defined(ENABLE_SYSTEMTAP)
       query_id = qmgr_get_current_query_id (thread_p);
@@ -7781,6 +7809,17 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	      return NULL;
 	    }
 	}
+      else if (bufptr->iopage_buffer->iopage.prv.pflag & FILEIO_PAGE_FLAG_COMPRESSED_LZ4)
+	{
+	  if (pgbuf_decompress_temp_page (thread_p, &bufptr->iopage_buffer->iopage) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	      (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+	      PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	      return NULL;
+	    }
+	}
 
 #if defined(ENABLE_SYSTEMTAP)
       if (monitored == true)
@@ -9917,7 +9956,10 @@ STATIC_INLINE int
 pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_page_flush_thread, bool * is_bcb_locked)
 {
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  char zip_page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
   FILEIO_PAGE *iopage = NULL;
+  FILEIO_PAGE *write_page = NULL;
+  size_t write_size;
   PAGE_PTR pgptr = NULL;
   LOG_LSA oldest_unflush_lsa;
   int error = NO_ERROR;
@@ -10075,9 +10117,35 @@ copy_unflushed_lsa:
       /* Record number of writes in statistics */
       write_mode = (dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE);
 
+      write_page = iopage;
+      write_size = IO_PAGESIZE;
+      if (is_temp)
+	{
+	  /* encrypted temporary pages are not compressed */
+	  if (tde_algo == TDE_ALGORITHM_NONE && prm_get_bool_value (PRM_ID_TEMP_FILE_COMPRESSION))
+	    {
+	      FILEIO_PAGE *zip_page = (FILEIO_PAGE *) PTR_ALIGN (zip_page_buf, MAX_ALIGNMENT);
+
+	      write_size = pgbuf_compress_temp_page (thread_p, iopage, zip_page);
+	      if (write_size > 0)
+		{
+		  write_page = zip_page;
+		  perfmon_inc_stat (thread_p, PSTAT_TEMP_NUM_PAGES_COMPRESSED);
+		}
+	      else
+		{
+		  write_size = IO_PAGESIZE;
+		}
+	    }
+
+	  perfmon_inc_stat (thread_p, PSTAT_TEMP_NUM_PAGES_WRITTEN);
+	  perfmon_add_stat (thread_p, PSTAT_TEMP_NUM_RAW_BYTES, IO_PAGESIZE);
+	  perfmon_add_stat (thread_p, PSTAT_TEMP_NUM_WRITTEN_BYTES, write_size);
+	}
+
       perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
-      if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
-			IO_PAGESIZE, write_mode) == NULL)
+      if (fileio_write_partial (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), write_page,
+				bufptr->vpid.pageid, IO_PAGESIZE, write_size, write_mode) == NULL)
 	{
 	  error = ER_FAILED;
 	}
@@ -10107,6 +10175,12 @@ copy_unflushed_lsa:
       return ER_FAILED;
     }
 
+  if (!is_temp)
+    {
+      /* the next incremental backups must copy the page */
+      bct_mark_page (&bufptr->vpid);
+    }
+
   assert (bufptr->latch_mode != PGBUF_LATCH_FLUSH);
 
 #if defined (SERVER_MODE)
@@ -10676,6 +10750,11 @@ pgbuf_is_consistent (const PGBUF_BCB * bufptr, int likely_bad_after_fixcnt)
 	  /* Unable to verify consistency of this page */
 	  consistent = PGBUF_CONTENT_BAD;
 	}
+      else if ((malloc_io_pgptr->prv.pflag & FILEIO_PAGE_FLAG_COMPRESSED_LZ4)
+	       && pgbuf_decompress_temp_page (NULL, malloc_io_pgptr) != NO_ERROR)
+	{
+	  consistent = PGBUF_CONTENT_BAD;
+	}
       else
 	{
 	  /* If page is dirty, it should be different from the one on disk */
@@ -16128,6 +16207,90 @@ pgbuf_init_temp_page_lsa (FILEIO_PAGE * io_page, PGLENGTH page_size)
   prv2->lsa = PGBUF_TEMP_LSA;
 }
 
+/*
+ * pgbuf_compress_temp_page () - compress the data area of a temporary page that is about to be written to disk
+ *
+ * return         : number of bytes of zip_page to write, or 0 if the page should be written uncompressed
+ * thread_p (in)  : thread entry
+ * io_page (in)   : copy of the page being flushed
+ * zip_page (out) : page header flagged as compressed, followed by the compressed data area
+ *
+ * note: the data area is compressed only when it saves at least one PGBUF_TEMP_COMPRESS_BLOCK_SIZE block. the
+ *       watermark is not written; it duplicates prv.lsa and is restored when the page is read.
+ */
+static size_t
+pgbuf_compress_temp_page (THREAD_ENTRY * thread_p, const FILEIO_PAGE * io_page, FILEIO_PAGE * zip_page)
+{
+  PERF_UTIME_TRACKER time_track = PERF_UTIME_TRACKER_INITIALIZER;
+  int zip_length;
+  size_t write_size;
+
+  if (IO_PAGESIZE <= PGBUF_TEMP_COMPRESS_BLOCK_SIZE)
+    {
+      return 0;
+    }
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+  /* fails when the compressed data would not end at least one block before the end of page */
+  zip_length = LZ4_compress_default ((const char *) io_page->page, (char *) zip_page->page, DB_PAGESIZE,
+				     (int) (IO_PAGESIZE - PGBUF_TEMP_COMPRESS_BLOCK_SIZE - sizeof (FILEIO_PAGE_RESERVED)));
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_TEMP_LZ4_COMPRESS_TIME_COUNTERS);
+  if (zip_length <= 0)
+    {
+      return 0;
+    }
+
+  write_size = DB_ALIGN (sizeof (FILEIO_PAGE_RESERVED) + zip_length, PGBUF_TEMP_COMPRESS_BLOCK_SIZE);
+  assert (write_size < (size_t) IO_PAGESIZE);
+
+  zip_page->prv = io_page->prv;
+  zip_page->prv.pflag |= FILEIO_PAGE_FLAG_COMPRESSED_LZ4;
+  zip_page->prv.p_reserve_1 = zip_length;
+
+  return write_size;
+}
+
+/*
+ * pgbuf_decompress_temp_page () - restore a temporary page read from disk in its compressed form
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * io_page (in/out) : page read from disk; its data area is decompressed in place
+ */
+static int
+pgbuf_decompress_temp_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page)
+{
+  PERF_UTIME_TRACKER time_track = PERF_UTIME_TRACKER_INITIALIZER;
+  char zip_buf[IO_MAX_PAGE_SIZE];
+  int zip_length = io_page->prv.p_reserve_1;
+  int length;
+
+  assert (io_page->prv.pflag & FILEIO_PAGE_FLAG_COMPRESSED_LZ4);
+
+  if (zip_length <= 0 || zip_length >= DB_PAGESIZE)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  memcpy (zip_buf, io_page->page, zip_length);
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+  length = LZ4_decompress_safe (zip_buf, (char *) io_page->page, zip_length, DB_PAGESIZE);
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_TEMP_LZ4_DECOMPRESS_TIME_COUNTERS);
+  if (length != DB_PAGESIZE)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_LZ4_DECOMPRESS_FAIL, 0);
+      return ER_IO_LZ4_DECOMPRESS_FAIL;
+    }
+
+  io_page->prv.pflag &= ~FILEIO_PAGE_FLAG_COMPRESSED_LZ4;
+  io_page->prv.p_reserve_1 = 0;
+  fileio_get_page_watermark_pos (io_page, IO_PAGESIZE)->lsa = io_page->prv.lsa;
+
+  return NO_ERROR;
+}
+
 /*
  * pgbuf_scan_bcb_table () - scan bcb table to count snapshot data with no bcb mutex
  */
@@ -47,6 +47,9 @@
 
 #define STATS_MAX_PRECISION	4000	/* max precision of char for getting statistics */
 
+#define STATS_COL_GROUP_MAX_ATTRS 8	/* max columns of a column group */
+#define STATS_COL_GROUP_MAX_NUM 8	/* max column groups of a class */
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -88,6 +91,17 @@ struct attr_stats
   INT64 ndv;			/* Number of Distinct Values of column */
 };
 
+/* Statistical Information about a group of columns given in statistics_column_groups */
+typedef struct stats_col_group STATS_COL_GROUP;
+struct stats_col_group
+{
+  int n_attrs;			/* number of columns in the group */
+  int attr_ids[STATS_COL_GROUP_MAX_ATTRS];	/* the columns */
+  INT64 ndv;			/* Number of Distinct Values of the columns together */
+  double dependency;		/* degree of the functional dependency of the last column on the others; the fraction
+				 * of rows whose values of the other columns always come with the same last column */
+};
+
 /* Statistical Information about the class */
 typedef struct class_stats CLASS_STATS;
 struct class_stats
@@ -97,6 +111,8 @@ struct class_stats
   int heap_num_pages;		/* number of pages the class occupy */
   int n_attrs;			/* number of attributes; size of the attr_stats[] */
   ATTR_STATS *attr_stats;	/* pointer to the array of attribute statistics */
+  int n_col_groups;		/* number of column groups; size of the col_groups[] */
+  STATS_COL_GROUP *col_groups;	/* pointer to the array of column group statistics */
 };
 
 /* Statistical Information about the attribute NDV */
@@ -115,6 +131,12 @@ struct class_attr_ndv
 };
 #define CLASS_ATTR_NDV_INITIALIZER	{0, NULL}
 
+/* an NDV estimated by the server instead of counted by a query; the NDV of the leading column of an index is taken
+ * from the index statistics instead, when there is one */
+#define STATS_NDV_ESTIMATE(ndv)	(-(ndv) - 1)
+#define STATS_NDV_IS_ESTIMATE(ndv)	((ndv) < 0)
+#define STATS_NDV_ESTIMATE_VALUE(ndv)	(-(ndv) - 1)
+
 #if !defined(SERVER_MODE)
 extern int stats_get_statistics (OID * classoid, unsigned int timestamp, CLASS_STATS ** stats_p);
 extern void stats_free_statistics (CLASS_STATS * stats);
@@ -0,0 +1,354 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// statistics_auto.cpp - automatic refresh of the statistics of modified classes
+//
+
+#include "statistics_auto.hpp"
+
+#include "error_manager.h"
+#include "oid.h"
+#include "system_parameter.h"
+#if defined (SERVER_MODE)
+#include "boot_sr.h"
+#include "connection_defs.h"
+#include "log_impl.h"
+#include "server_support.h"
+#include "statistics_sr.h"
+#include "thread_daemon.hpp"
+#include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_looper.hpp"
+#include "thread_manager.hpp"
+#include "xasl_cache.h"
+#include "xserver_interface.h"
+#endif // SERVER_MODE
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined (SERVER_MODE)
+/* the counters are split by class OID to keep the modifying threads from waiting for each other */
+#define STATS_AUTO_STRIPE_COUNT 64
+
+typedef struct stats_auto_stripe STATS_AUTO_STRIPE;
+struct stats_auto_stripe
+{
+  std::mutex mutex;
+  // *INDENT-OFF*
+  std::unordered_map<OID, INT64> changes;	/* objects inserted, updated or deleted by class */
+  // *INDENT-ON*
+};
+
+typedef struct stats_auto_candidate STATS_AUTO_CANDIDATE;
+struct stats_auto_candidate
+{
+  OID class_oid;
+  INT64 npages;			/* pages read to refresh the statistics */
+  double changed_ratio;		/* changes per object of the last statistics */
+};
+
+static STATS_AUTO_STRIPE stats_Auto_stripes[STATS_AUTO_STRIPE_COUNT];
+
+/* changes collected by the daemon and not refreshed yet; only used by the daemon */
+// *INDENT-OFF*
+static std::unordered_map<OID, INT64> stats_Auto_pending;
+// *INDENT-ON*
+
+/* pages the daemon may read; negative after a refresh that read more than was left */
+static INT64 stats_Auto_io_credit = 0;
+static INT64 stats_Auto_last_round_msec = 0;
+
+static cubthread::daemon *stats_Auto_daemon = NULL;
+
+static void stats_auto_collect_changes (void);
+static INT64 stats_auto_refill_io_credit (void);
+static int stats_auto_refresh_class (THREAD_ENTRY * thread_p, OID * class_oid);
+static void stats_auto_execute (cubthread::entry & thread_ref);
+#endif // SERVER_MODE
+
+/*
+ * stats_auto_class_modified () - count an object inserted, updated or deleted in the heap of a class
+ *
+ * class_oid (in) : the class
+ */
+void
+stats_auto_class_modified (const OID * class_oid)
+{
+#if defined (SERVER_MODE)
+  if (!prm_get_bool_value (PRM_ID_AUTO_UPDATE_STATISTICS) || OID_ISNULL (class_oid)
+      || OID_IS_ROOTOID (class_oid))
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  STATS_AUTO_STRIPE &stripe = stats_Auto_stripes[std::hash<OID> () (*class_oid) % STATS_AUTO_STRIPE_COUNT];
+  std::lock_guard<std::mutex> guard (stripe.mutex);
+  // *INDENT-ON*
+  stripe.changes[*class_oid]++;
+#endif // SERVER_MODE
+}
+
+#if defined (SERVER_MODE)
+/*
+ * stats_auto_collect_changes () - move the counted changes to the pending changes of the daemon
+ */
+static void
+stats_auto_collect_changes (void)
+{
+  // *INDENT-OFF*
+  std::unordered_map<OID, INT64> changes;
+  // *INDENT-ON*
+
+  for (int i = 0; i < STATS_AUTO_STRIPE_COUNT; i++)
+    {
+      {
+	// *INDENT-OFF*
+	std::lock_guard<std::mutex> guard (stats_Auto_stripes[i].mutex);
+	// *INDENT-ON*
+	changes.swap (stats_Auto_stripes[i].changes);
+      }
+
+      // *INDENT-OFF*
+      for (const auto &it : changes)
+	{
+	  stats_Auto_pending[it.first] += it.second;
+	}
+      // *INDENT-ON*
+      changes.clear ();
+    }
+}
+
+/*
+ * stats_auto_refill_io_credit () - add the pages allowed since the last round to the I/O credit
+ *
+ * return : the I/O credit
+ */
+static INT64
+stats_auto_refill_io_credit (void)
+{
+  INT64 pages_per_sec = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_IO_PAGES_PER_SEC);
+  INT64 max_credit = pages_per_sec * prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL);
+  // *INDENT-OFF*
+  INT64 now_msec = std::chrono::duration_cast<std::chrono::milliseconds>
+    (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+  // *INDENT-ON*
+
+  if (stats_Auto_last_round_msec != 0)
+    {
+      stats_Auto_io_credit += pages_per_sec * (now_msec - stats_Auto_last_round_msec) / 1000;
+    }
+  else
+    {
+      stats_Auto_io_credit = max_credit;
+    }
+  stats_Auto_last_round_msec = now_msec;
+
+  /* unused credit is not saved for later */
+  stats_Auto_io_credit = MIN (stats_Auto_io_credit, max_credit);
+
+  return stats_Auto_io_credit;
+}
+
+/*
+ * stats_auto_refresh_class () - refresh the statistics of a class in a transaction of its own
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * class_oid (in) : the class
+ */
+static int
+stats_auto_refresh_class (THREAD_ENTRY * thread_p, OID * class_oid)
+{
+  OID partitioned_class_oid;
+  int tran_index;
+  int error_code;
+
+  tran_index =
+    logtb_assign_tran_index (thread_p, NULL_TRANID, TRAN_ACTIVE, NULL, NULL, TRAN_LOCK_INFINITE_WAIT,
+			     TRAN_DEFAULT_ISOLATION_LEVEL ());
+  if (tran_index == NULL_TRAN_INDEX)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  error_code = stats_update_statistics_by_sampling (thread_p, class_oid, &partitioned_class_oid);
+  if (error_code == NO_ERROR)
+    {
+      if (xtran_server_commit (thread_p, false) != TRAN_UNACTIVE_COMMITTED)
+	{
+	  assert_release (false);
+	  error_code = ER_FAILED;
+	}
+    }
+  else
+    {
+      (void) xtran_server_abort (thread_p);
+    }
+
+  logtb_free_tran_index (thread_p, tran_index);
+  logtb_set_to_system_tran_index (thread_p);
+
+  if (error_code == NO_ERROR)
+    {
+      /* plans of the class were made with the old statistics */
+      xcache_remove_by_oid (thread_p, class_oid);
+      if (!OID_ISNULL (&partitioned_class_oid))
+	{
+	  xcache_remove_by_oid (thread_p, &partitioned_class_oid);
+	}
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_auto_execute () - refresh the statistics of the classes that changed enough, within the I/O credit
+ *
+ * thread_ref (in) : thread entry of the daemon
+ */
+static void
+stats_auto_execute (cubthread::entry & thread_ref)
+{
+  // *INDENT-OFF*
+  std::vector<STATS_AUTO_CANDIDATE> candidates;
+  // *INDENT-ON*
+  STATS_AUTO_CANDIDATE candidate;
+  INT64 min_changes, nobjs, npages, io_credit;
+  double threshold;
+
+  if (!BO_IS_SERVER_RESTARTED () || !prm_get_bool_value (PRM_ID_AUTO_UPDATE_STATISTICS))
+    {
+      return;
+    }
+
+  if (!HA_DISABLED () && css_ha_server_state () != HA_SERVER_STATE_ACTIVE)
+    {
+      /* the statistics are replicated from the active server */
+      stats_auto_collect_changes ();
+      stats_Auto_pending.clear ();
+      return;
+    }
+
+  stats_auto_collect_changes ();
+  io_credit = stats_auto_refill_io_credit ();
+
+  min_changes = prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_MIN_CHANGES);
+  threshold = prm_get_float_value (PRM_ID_AUTO_UPDATE_STATISTICS_THRESHOLD);
+
+  // *INDENT-OFF*
+  for (auto it = stats_Auto_pending.begin (); it != stats_Auto_pending.end ();)
+  // *INDENT-ON*
+    {
+      if (it->second < min_changes)
+	{
+	  ++it;
+	  continue;
+	}
+
+      candidate.class_oid = it->first;
+      if (stats_get_sampling_cost (&thread_ref, &candidate.class_oid, &nobjs, &npages) != NO_ERROR)
+	{
+	  /* the class is gone */
+	  er_clear ();
+	  it = stats_Auto_pending.erase (it);
+	  continue;
+	}
+
+      if (it->second >= threshold * nobjs)
+	{
+	  candidate.npages = npages;
+	  candidate.changed_ratio = (double) it->second / MAX (nobjs, 1);
+	  candidates.push_back (candidate);
+	}
+      ++it;
+    }
+
+  // *INDENT-OFF*
+  std::sort (candidates.begin (), candidates.end (),
+	     [] (const STATS_AUTO_CANDIDATE & a, const STATS_AUTO_CANDIDATE & b)
+	     {
+	       return a.changed_ratio > b.changed_ratio;
+	     });
+  // *INDENT-ON*
+
+  for (size_t i = 0; i < candidates.size () && io_credit > 0; i++)
+    {
+      if (stats_auto_refresh_class (&thread_ref, &candidates[i].class_oid) != NO_ERROR)
+	{
+	  /* e.g. the schema of the class is being changed; retry in the next round */
+	  er_clear ();
+	  continue;
+	}
+
+      stats_Auto_pending.erase (candidates[i].class_oid);
+      io_credit -= candidates[i].npages;
+    }
+
+  stats_Auto_io_credit = io_credit;
+}
+#endif // SERVER_MODE
+
+/*
+ * stats_auto_daemon_init () - start the daemon refreshing the statistics, if auto_update_statistics is on
+ */
+void
+stats_auto_daemon_init (void)
+{
+#if defined (SERVER_MODE)
+  assert (stats_Auto_daemon == NULL);
+
+  if (!prm_get_bool_value (PRM_ID_AUTO_UPDATE_STATISTICS))
+    {
+      return;
+    }
+
+  stats_Auto_pending.clear ();
+  stats_Auto_io_credit = 0;
+  stats_Auto_last_round_msec = 0;
+
+  // *INDENT-OFF*
+  cubthread::looper looper =
+    cubthread::looper (std::chrono::seconds (prm_get_integer_value (PRM_ID_AUTO_UPDATE_STATISTICS_INTERVAL)));
+  // *INDENT-ON*
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (stats_auto_execute);
+
+  stats_Auto_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "auto_update_statistics");
+#endif // SERVER_MODE
+}
+
+/*
+ * stats_auto_daemon_destroy () - stop the daemon refreshing the statistics
+ */
+void
+stats_auto_daemon_destroy (void)
+{
+#if defined (SERVER_MODE)
+  if (stats_Auto_daemon != NULL)
+    {
+      cubthread::get_manager ()->destroy_daemon (stats_Auto_daemon);
+    }
+  stats_Auto_pending.clear ();
+#endif // SERVER_MODE
+}
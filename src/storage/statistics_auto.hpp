@@ -0,0 +1,49 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+//
+// statistics_auto.hpp - automatic refresh of the statistics of modified classes
+//
+//  When auto_update_statistics is on, the server counts the objects inserted, updated and deleted in the heap of each
+//  class. Every auto_update_statistics_interval_in_secs a daemon refreshes the statistics of the classes where the
+//  changes reached both auto_update_statistics_min_changes and auto_update_statistics_threshold times the number of
+//  objects of the last statistics, most changed first (see stats_update_statistics_by_sampling). The cached plans of
+//  a refreshed class are removed from the XASL cache, so the next executions are planned with the new statistics.
+//
+//  The pages read by the refreshes are limited to auto_update_statistics_io_pages_per_sec on average; classes that do
+//  not fit in a round keep their changes for the next one. The counters are kept in memory only and start over when
+//  the server restarts. The changes of a partition are counted and refreshed for the partition itself, after which
+//  the statistics of its partitioned class are aggregated again. The daemon does nothing on an HA server that is not
+//  active.
+//
+
+#ifndef _STATISTICS_AUTO_HPP_
+#define _STATISTICS_AUTO_HPP_
+
+#if !defined (SERVER_MODE) && !defined (SA_MODE)
+#error Wrong module
+#endif // not server and not SA mode
+
+#include "storage_common.h"
+
+extern void stats_auto_class_modified (const OID * class_oid);
+
+extern void stats_auto_daemon_init (void);
+extern void stats_auto_daemon_destroy (void);
+
+#endif // _STATISTICS_AUTO_HPP_
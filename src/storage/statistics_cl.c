@@ -99,6 +99,8 @@ stats_client_unpack_statistics (char *buf_p)
     {
       return NULL;
     }
+  class_stats_p->n_col_groups = 0;
+  class_stats_p->col_groups = NULL;
 
   class_stats_p->time_stamp = (unsigned int) OR_GET_INT (buf_p);
   buf_p += OR_INT_SIZE;
@@ -224,6 +226,44 @@ stats_client_unpack_statistics (char *buf_p)
 	}
     }
 
+  class_stats_p->n_col_groups = OR_GET_INT (buf_p);
+  buf_p += OR_INT_SIZE;
+
+  if (class_stats_p->n_col_groups > 0)
+    {
+      class_stats_p->col_groups =
+	(STATS_COL_GROUP *) db_ws_alloc (class_stats_p->n_col_groups * sizeof (STATS_COL_GROUP));
+      if (class_stats_p->col_groups == NULL)
+	{
+	  class_stats_p->n_col_groups = 0;
+	  stats_free_statistics (class_stats_p);
+	  return NULL;
+	}
+
+      for (i = 0; i < class_stats_p->n_col_groups; i++)
+	{
+	  STATS_COL_GROUP *col_group_p = &class_stats_p->col_groups[i];
+
+	  col_group_p->n_attrs = OR_GET_INT (buf_p);
+	  buf_p += OR_INT_SIZE;
+
+	  col_group_p->dependency = OR_GET_INT (buf_p) / 1000000.0;
+	  buf_p += OR_INT_SIZE;
+
+	  for (k = 0; k < STATS_COL_GROUP_MAX_ATTRS; k++)
+	    {
+	      col_group_p->attr_ids[k] = OR_GET_INT (buf_p);
+	      buf_p += OR_INT_SIZE;
+	    }
+
+	  OR_GET_INT64 (buf_p, &col_group_p->ndv);
+	  buf_p += OR_INT64_SIZE;
+
+	  assert (col_group_p->n_attrs <= STATS_COL_GROUP_MAX_ATTRS);
+	  col_group_p->ndv = MIN (col_group_p->ndv, class_stats_p->heap_num_objects);
+	}
+    }
+
   /* validate key stats info */
   assert (class_stats_p->heap_num_objects >= 0);
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
@@ -279,6 +319,12 @@ stats_free_statistics (CLASS_STATS * class_statsp)
 	  class_statsp->attr_stats = NULL;
 	}
 
+      if (class_statsp->col_groups)
+	{
+	  db_ws_free (class_statsp->col_groups);
+	  class_statsp->col_groups = NULL;
+	}
+
       db_ws_free (class_statsp);
     }
 }
@@ -367,6 +413,23 @@ stats_dump (const char *class_name_p, FILE * file_p)
       fprintf (file_p, "\n");
     }
 
+  for (i = 0; i < class_stats_p->n_col_groups; i++)
+    {
+      STATS_COL_GROUP *col_group_p = &(class_stats_p->col_groups[i]);
+
+      fprintf (file_p, " Column group: (");
+      prefix_p = "";
+      for (k = 0; k < col_group_p->n_attrs; k++)
+	{
+	  name_p = sm_get_att_name (class_mop, col_group_p->attr_ids[k]);
+	  fprintf (file_p, "%s%s", prefix_p, (name_p ? name_p : "not found"));
+	  prefix_p = ",";
+	}
+      fprintf (file_p, ")\n");
+      fprintf (file_p, "    Number of Distinct Values: %ld\n", col_group_p->ndv);
+      fprintf (file_p, "    Dependency: %.6f\n\n", col_group_p->dependency);
+    }
+
   fprintf (file_p, "\n\n");
 }
 
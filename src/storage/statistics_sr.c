@@ -36,8 +36,17 @@
 #include "partition_sr.h"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "dbtype.h"
 #include "thread_entry.hpp"
 #include "system_parameter.h"
+#include "memory_hash.h"
+#include "intl_support.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #define SQUARE(n) ((n)*(n))
 
@@ -62,6 +71,24 @@ struct partition_stats_acumulator
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
 };
 
+/* the rows sampled for a column group, by the hash of their values */
+typedef struct stats_col_group_determinant STATS_COL_GROUP_DETERMINANT;
+struct stats_col_group_determinant
+{
+  UINT64 last_hash;		/* hash of the last column in the first row with these other columns */
+  INT64 nrows;			/* sampled rows with these other columns */
+  bool is_consistent;		/* all those rows have the same last column */
+};
+
+typedef struct stats_col_group_sample STATS_COL_GROUP_SAMPLE;
+struct stats_col_group_sample
+{
+  // *INDENT-OFF*
+  std::unordered_set<UINT64> values;	/* distinct values of all the columns */
+  std::unordered_map<UINT64, STATS_COL_GROUP_DETERMINANT> determinants;	/* by the values of all but the last */
+  // *INDENT-ON*
+};
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int stats_compare_data (DB_DATA * data1, DB_DATA * data2, DB_TYPE type);
 static int stats_compare_date (DB_DATE * date1, DB_DATE * date2);
@@ -72,6 +99,16 @@ static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
 						bool with_fullscan, CLASS_ATTR_NDV * class_attr_ndv);
+static int stats_update_partitioned_statistics_by_sampling (THREAD_ENTRY * thread_p, OID * class_id_p);
+static INT64 stats_get_estimated_ndv (DISK_ATTR * disk_attr_p, INT64 estimate);
+static int stats_sample_heap_objects (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p,
+				      DISK_REPR * disk_repr_p, INT64 * nobjs_p, INT64 * attr_ndv);
+// *INDENT-OFF*
+static void stats_get_col_group_defs (THREAD_ENTRY * thread_p, OID * class_id_p, const char *class_name,
+				      DISK_REPR * disk_repr_p, std::vector<STATS_COL_GROUP> &col_groups);
+// *INDENT-ON*
+static int stats_update_col_groups (THREAD_ENTRY * thread_p, OID * class_id_p, const char *class_name, HFID * hfid_p,
+				    INT64 nobjs, DISK_REPR * disk_repr_p);
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -277,11 +314,24 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	  if (disk_attr_p->id == class_attr_ndv->attr_ndv[k].id)
 	    {
 	      disk_attr_p->ndv = class_attr_ndv->attr_ndv[k].ndv;
+	      if (STATS_NDV_IS_ESTIMATE (disk_attr_p->ndv))
+		{
+		  disk_attr_p->ndv = stats_get_estimated_ndv (disk_attr_p, STATS_NDV_ESTIMATE_VALUE (disk_attr_p->ndv));
+		}
 	      break;
 	    }
 	}
     }				/* for (i = 0; ...) */
 
+  /* the column groups of statistics_column_groups */
+  error_code =
+    stats_update_col_groups (thread_p, class_id_p, class_name, &cls_info_p->ci_hfid, cls_info_p->ci_tot_objects,
+			     disk_repr_p);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
     {
@@ -344,6 +394,359 @@ error:
   goto end;
 }
 
+/*
+ * stats_update_statistics_by_sampling () - Updates the statistics of a class without querying its columns
+ *   return: error code
+ *   class_id_p(in): Identifier of the class
+ *
+ *   partitioned_class_oid(out): the partitioned class whose statistics were refreshed with the partition, or a
+ *				 NULL OID
+ *
+ * Note: Used to refresh the statistics from the server (see statistics_auto.hpp), where the NDV query of
+ *       UPDATE STATISTICS cannot be run. The number of objects and the NDV of the columns are estimated from a page
+ *       sampling scan of the heap, and the index statistics are taken by sampling the leaf pages. The NDV of the
+ *       leading column of an index is taken from the index. The columns that are not sampled (LOB, JSON and long
+ *       strings) derive their NDV from the last statistics: a column that was unique-like grows with the objects, the
+ *       others keep their NDV.
+ *
+ *       A partitioned class has no rows of its own; when a partition is refreshed, the statistics of its partitioned
+ *       class are aggregated again from the current statistics of all the partitions.
+ */
+int
+stats_update_statistics_by_sampling (THREAD_ENTRY * thread_p, OID * class_id_p, OID * partitioned_class_oid)
+{
+  CLS_INFO *cls_info_p = NULL;
+  REPR_ID repr_id;
+  DISK_REPR *disk_repr_p = NULL;
+  DISK_ATTR *disk_attr_p = NULL;
+  CLASS_ATTR_NDV class_attr_ndv = CLASS_ATTR_NDV_INITIALIZER;
+  OID dir_oid;
+  OID root_oid;
+  INT64 old_nobjs, nobjs, ndv;
+  INT64 *sampled_ndv = NULL;
+  OID *partitions = NULL;
+  int n_attrs, i, count = 0;
+  int error_code = NO_ERROR;
+  bool is_locked = false;
+  CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
+
+  OID_SET_NULL (partitioned_class_oid);
+
+  if (lock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, LK_COND_LOCK) != LK_GRANTED)
+    {
+      /* the schema is being changed; try next time */
+      return ER_UPDATE_STAT_CANNOT_GET_LOCK;
+    }
+  is_locked = true;
+
+  error_code = catalog_get_dir_oid_from_cache (thread_p, class_id_p, &dir_oid);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  catalog_access_info.class_oid = class_id_p;
+  catalog_access_info.dir_oid = &dir_oid;
+  error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, S_LOCK);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  cls_info_p = catalog_get_class_info (thread_p, class_id_p, &catalog_access_info);
+  if (cls_info_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  error_code = catalog_get_last_representation_id (thread_p, class_id_p, &repr_id);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  disk_repr_p = catalog_get_representation (thread_p, class_id_p, repr_id, &catalog_access_info);
+  if (disk_repr_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, NO_ERROR);
+
+  error_code = partition_get_partition_oids (thread_p, class_id_p, &partitions, &count);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  if (count != 0)
+    {
+      db_private_free_and_init (thread_p, partitions);
+      goto end;
+    }
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+
+  nobjs = 0;
+  if (!HFID_IS_NULL (&cls_info_p->ci_hfid))
+    {
+      sampled_ndv = (INT64 *) db_private_alloc (thread_p, sizeof (INT64) * (n_attrs + 1));
+      if (sampled_ndv == NULL)
+	{
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, sizeof (INT64) * (n_attrs + 1));
+	  goto end;
+	}
+
+      error_code =
+	stats_sample_heap_objects (thread_p, class_id_p, &cls_info_p->ci_hfid, disk_repr_p, &nobjs, sampled_ndv);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+  old_nobjs = cls_info_p->ci_tot_objects;
+
+  class_attr_ndv.attr_ndv = (ATTR_NDV *) db_private_alloc (thread_p, sizeof (ATTR_NDV) * (n_attrs + 1));
+  if (class_attr_ndv.attr_ndv == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, sizeof (ATTR_NDV) * (n_attrs + 1));
+      goto end;
+    }
+  class_attr_ndv.attr_cnt = n_attrs;
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      if (sampled_ndv != NULL && sampled_ndv[i] >= 0)
+	{
+	  ndv = sampled_ndv[i];
+	}
+      else
+	{
+	  ndv = disk_attr_p->ndv;
+	  if (old_nobjs > 0 && ndv * 10 >= old_nobjs * 9)
+	    {
+	      /* unique-like column */
+	      ndv = nobjs;
+	    }
+	}
+      ndv = MIN (ndv, nobjs);
+      if (ndv == 0 && nobjs > 0)
+	{
+	  ndv = 1;
+	}
+
+      class_attr_ndv.attr_ndv[i].id = disk_attr_p->id;
+      class_attr_ndv.attr_ndv[i].ndv = STATS_NDV_ESTIMATE (ndv);
+    }
+
+  /* the total count follows the columns */
+  class_attr_ndv.attr_ndv[n_attrs].id = 0;
+  class_attr_ndv.attr_ndv[n_attrs].ndv = MIN (nobjs, (INT64) INT_MAX);
+
+  catalog_free_representation_and_init (disk_repr_p);
+  catalog_free_class_info_and_init (cls_info_p);
+
+  error_code = xstats_update_statistics (thread_p, class_id_p, STATS_WITH_SAMPLING, &class_attr_ndv);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  error_code = partition_find_root_class_oid (thread_p, class_id_p, &root_oid);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  if (!OID_ISNULL (&root_oid) && !OID_EQ (&root_oid, class_id_p))
+    {
+      error_code = stats_update_partitioned_statistics_by_sampling (thread_p, &root_oid);
+      if (error_code == NO_ERROR)
+	{
+	  COPY_OID (partitioned_class_oid, &root_oid);
+	}
+      else if (error_code == ER_UPDATE_STAT_CANNOT_GET_LOCK)
+	{
+	  /* aggregated again with the next refreshed partition */
+	  error_code = NO_ERROR;
+	}
+    }
+
+end:
+  if (catalog_access_info.access_started)
+    {
+      (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, error_code);
+    }
+
+  if (disk_repr_p != NULL)
+    {
+      catalog_free_representation_and_init (disk_repr_p);
+    }
+
+  if (cls_info_p != NULL)
+    {
+      catalog_free_class_info_and_init (cls_info_p);
+    }
+
+  if (class_attr_ndv.attr_ndv != NULL)
+    {
+      db_private_free_and_init (thread_p, class_attr_ndv.attr_ndv);
+    }
+
+  if (sampled_ndv != NULL)
+    {
+      db_private_free_and_init (thread_p, sampled_ndv);
+    }
+
+  if (is_locked)
+    {
+      lock_unlock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, false);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_update_partitioned_statistics_by_sampling () - Aggregates the statistics of a partitioned class from the
+ *							 current statistics of its partitions
+ *   return: error code
+ *   class_id_p(in): the partitioned class, or any other class (nothing is done)
+ */
+static int
+stats_update_partitioned_statistics_by_sampling (THREAD_ENTRY * thread_p, OID * class_id_p)
+{
+  OID *partitions = NULL;
+  int count = 0;
+  int error_code = NO_ERROR;
+
+  if (lock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, LK_COND_LOCK) != LK_GRANTED)
+    {
+      return ER_UPDATE_STAT_CANNOT_GET_LOCK;
+    }
+
+  error_code = partition_get_partition_oids (thread_p, class_id_p, &partitions, &count);
+  if (error_code == NO_ERROR && count != 0)
+    {
+      error_code =
+	stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, STATS_WITH_SAMPLING, NULL);
+    }
+
+  if (partitions != NULL)
+    {
+      db_private_free_and_init (thread_p, partitions);
+    }
+
+  lock_unlock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, false);
+
+  return error_code;
+}
+
+/*
+ * stats_get_sampling_cost () - Reads the class size kept by the last statistics and the number of pages that
+ *				stats_update_statistics_by_sampling would read for it
+ *   return: error code
+ *   class_id_p(in): Identifier of the class
+ *   nobjs_p(out): number of objects of the last statistics
+ *   npages_p(out): heap pages and index leaf pages to be sampled
+ */
+int
+stats_get_sampling_cost (THREAD_ENTRY * thread_p, OID * class_id_p, INT64 * nobjs_p, INT64 * npages_p)
+{
+  CLS_INFO *cls_info_p = NULL;
+  REPR_ID repr_id;
+  DISK_REPR *disk_repr_p = NULL;
+  DISK_ATTR *disk_attr_p = NULL;
+  BTREE_STATS *btree_stats_p = NULL;
+  OID dir_oid;
+  int i, j;
+  int error_code = NO_ERROR;
+  CATALOG_ACCESS_INFO catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
+
+  *nobjs_p = 0;
+  *npages_p = 0;
+
+  error_code = catalog_get_dir_oid_from_cache (thread_p, class_id_p, &dir_oid);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  catalog_access_info.class_oid = class_id_p;
+  catalog_access_info.dir_oid = &dir_oid;
+  error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, S_LOCK);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  cls_info_p = catalog_get_class_info (thread_p, class_id_p, &catalog_access_info);
+  if (cls_info_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  error_code = catalog_get_last_representation_id (thread_p, class_id_p, &repr_id);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  disk_repr_p = catalog_get_representation (thread_p, class_id_p, repr_id, &catalog_access_info);
+  if (disk_repr_p == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  *nobjs_p = cls_info_p->ci_tot_objects;
+  *npages_p = MIN (cls_info_p->ci_tot_pages, NUMBER_OF_SAMPLING_PAGES);
+
+  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
+	{
+	  /* a sampling trial fixes the pages from the root down to a leaf */
+	  *npages_p += MIN (btree_stats_p->leafs, STATS_SAMPLING_LEAFS_MAX) + btree_stats_p->height;
+	}
+    }
+
+end:
+  (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, error_code);
+
+  if (disk_repr_p != NULL)
+    {
+      catalog_free_representation_and_init (disk_repr_p);
+    }
+
+  if (cls_info_p != NULL)
+    {
+      catalog_free_class_info_and_init (cls_info_p);
+    }
+
+  return error_code;
+}
+
 /*
  * xstats_get_statistics_from_server () - Retrieves the class statistics
  *   return: buffer contaning class statistics, or NULL on error
@@ -487,6 +890,13 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 
   size += tot_key_info_size;	/* key_type, pkeys[] of BTREE_STATS */
 
+  size += (OR_INT_SIZE		/* n_col_groups from DISK_REPR */
+	   + (OR_INT_SIZE	/* n_attrs of STATS_COL_GROUP */
+	      + OR_INT_SIZE	/* dependency of STATS_COL_GROUP, in millionths */
+	      + OR_INT_SIZE * STATS_COL_GROUP_MAX_ATTRS	/* attr_ids[] of STATS_COL_GROUP */
+	      + OR_INT64_SIZE	/* ndv of STATS_COL_GROUP */
+	   ) * disk_repr_p->n_col_groups);
+
   start_p = buf_p = (char *) malloc (size);
   if (buf_p == NULL)
     {
@@ -589,10 +999,34 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 		  btree_stats_p->pkeys[k] = btree_stats_p->keys;
 		}
 
-	      OR_PUT_INT (buf_p, btree_stats_p->pkeys[k]);
-	      buf_p += OR_INT_SIZE;
-	    }
-	}			/* for (j = 0, ...) */
+	      OR_PUT_INT (buf_p, btree_stats_p->pkeys[k]);
+	      buf_p += OR_INT_SIZE;
+	    }
+	}			/* for (j = 0, ...) */
+    }
+
+  /* put the statistics of the column groups */
+  OR_PUT_INT (buf_p, disk_repr_p->n_col_groups);
+  buf_p += OR_INT_SIZE;
+
+  for (i = 0; i < disk_repr_p->n_col_groups; i++)
+    {
+      STATS_COL_GROUP *col_group_p = &disk_repr_p->col_groups[i];
+
+      OR_PUT_INT (buf_p, col_group_p->n_attrs);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, (int) (col_group_p->dependency * 1000000.0));
+      buf_p += OR_INT_SIZE;
+
+      for (k = 0; k < STATS_COL_GROUP_MAX_ATTRS; k++)
+	{
+	  OR_PUT_INT (buf_p, k < col_group_p->n_attrs ? col_group_p->attr_ids[k] : -1);
+	  buf_p += OR_INT_SIZE;
+	}
+
+      OR_PUT_INT64 (buf_p, &col_group_p->ndv);
+      buf_p += OR_INT64_SIZE;
     }
 
   catalog_free_representation_and_init (disk_repr_p);
@@ -1026,6 +1460,8 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  * partitions (in) : oids of partitions
  * int partitions_count (in) : number of partitions
  * with_fullscan(in): true iff WITH FULLSCAN
+ * class_attr_ndv(in): NDV gathered by the client for the partitioned class; NULL to aggregate only, from the current
+ *		       statistics of the partitions, which are not refreshed (see stats_update_statistics_by_sampling)
  *
  * Note: Since, during plan generation we only have access to the partitioned
  * class, we have to keep an estimate of average statistics in this class. We
@@ -1060,12 +1496,13 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
   CATALOG_ACCESS_INFO part_catalog_access_info = CATALOG_ACCESS_INFO_INITIALIZER;
   OID dir_oid;
   OID part_dir_oid;
+  INT64 *part_ndv = NULL;
 
   assert_release (class_id_p != NULL);
   assert_release (partitions != NULL);
   assert_release (partitions_count > 0);
 
-  for (i = 0; i < partitions_count; i++)
+  for (i = 0; class_attr_ndv != NULL && i < partitions_count; i++)
     {
       error = xstats_update_statistics (thread_p, &partitions[i], with_fullscan, class_attr_ndv);
       if (error != NO_ERROR)
@@ -1113,6 +1550,21 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 
   (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, NO_ERROR);
 
+  if (class_attr_ndv == NULL)
+    {
+      /* sum of the NDV of the partitions, by column */
+      size_t size = sizeof (INT64) * (disk_repr_p->n_fixed + disk_repr_p->n_variable);
+
+      part_ndv = (INT64 *) db_private_alloc (thread_p, size);
+      if (part_ndv == NULL)
+	{
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, size);
+	  goto cleanup;
+	}
+      memset (part_ndv, 0, size);
+    }
+
   /* partitions_count number of btree_stats we will need to use */
   n_btrees = 0;
   for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
@@ -1227,7 +1679,14 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  goto cleanup;
 	}
       cls_info_p->ci_tot_pages += subcls_info->ci_tot_pages;
-      cls_info_p->ci_tot_objects = class_attr_ndv->attr_ndv[class_attr_ndv->attr_cnt].ndv;;
+      if (class_attr_ndv != NULL)
+	{
+	  cls_info_p->ci_tot_objects = class_attr_ndv->attr_ndv[class_attr_ndv->attr_cnt].ndv;
+	}
+      else
+	{
+	  cls_info_p->ci_tot_objects += subcls_info->ci_tot_objects;
+	}
 
       /* get disk repr for subclass */
       error = catalog_get_last_representation_id (thread_p, &partitions[i], &subcls_repr_id);
@@ -1279,6 +1738,11 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  assert_release (subcls_attr_p->id == disk_attr_p->id);
 	  assert_release (subcls_attr_p->n_btstats == disk_attr_p->n_btstats);
 
+	  if (part_ndv != NULL && subcls_attr_p->ndv > 0)
+	    {
+	      part_ndv[j] += subcls_attr_p->ndv;
+	    }
+
 	  for (k = 0, btree_stats_p = disk_attr_p->bt_stats; k < disk_attr_p->n_btstats; k++, btree_stats_p++)
 	    {
 	      const BTREE_STATS *subcls_stats;
@@ -1330,7 +1794,11 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	}
 
       /* put ndv of columns */
-      for (int k = 0; k < class_attr_ndv->attr_cnt; k++)
+      if (part_ndv != NULL)
+	{
+	  disk_attr_p->ndv = MIN (part_ndv[i], cls_info_p->ci_tot_objects);
+	}
+      for (int k = 0; class_attr_ndv != NULL && k < class_attr_ndv->attr_cnt; k++)
 	{
 	  if (disk_attr_p->id == class_attr_ndv->attr_ndv[k].id)
 	    {
@@ -1416,6 +1884,10 @@ cleanup:
     {
       catalog_free_representation_and_init (disk_repr_p);
     }
+  if (part_ndv != NULL)
+    {
+      db_private_free_and_init (thread_p, part_ndv);
+    }
 
   return error;
 }
@@ -1484,3 +1956,501 @@ stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_re
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return NULL;
 }
+
+/*
+ * stats_get_estimated_ndv () - NDV of an attribute for an estimate given by the server
+ *   return: the number of distinct values of the leading column of the attribute indexes, or the estimate if the
+ *	     attribute does not lead an index
+ *   disk_attr_p(in): the attribute, with its index statistics already taken
+ *   estimate(in): the estimated NDV
+ */
+static INT64
+stats_get_estimated_ndv (DISK_ATTR * disk_attr_p, INT64 estimate)
+{
+  BTREE_STATS *btree_stats_p;
+  INT64 ndv = -1;
+  int j;
+
+  for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
+    {
+      if (btree_stats_p->has_function || btree_stats_p->pkeys_size <= 0)
+	{
+	  continue;
+	}
+
+      ndv = MAX (ndv, (INT64) btree_stats_p->pkeys[0]);
+    }
+
+  return ndv > 0 ? ndv : estimate;
+}
+
+/*
+ * stats_sample_heap_objects () - Estimates the number of objects of a class and the NDV of its columns by a page
+ *				  sampling scan of its heap
+ *   return: error code
+ *   class_id_p(in): Identifier of the class
+ *   hfid_p(in): heap file of the class
+ *   disk_repr_p(in): the last representation of the class
+ *   nobjs_p(out): estimated number of objects visible to the current transaction
+ *   attr_ndv(out): estimated NDV of each column of disk_repr_p, in the order of the representation (fixed columns
+ *		    first); -1 for the columns that UPDATE STATISTICS does not gather either
+ *
+ * Note: The NDV of a column is extrapolated from the distinct values of the sampled rows like the NDV of a column
+ *       group (see stats_update_col_groups).
+ */
+static int
+stats_sample_heap_objects (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+			   INT64 * nobjs_p, INT64 * attr_ndv)
+{
+  // *INDENT-OFF*
+  std::vector<std::unordered_set<UINT64>> samples;
+  std::vector<ATTR_ID> attr_ids;
+  std::vector<int> attr_pos;
+  std::vector<bool> is_ignored;
+  // *INDENT-ON*
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  SAMPLING_INFO sampling;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID oid;
+  SCAN_CODE scan_code;
+  DISK_ATTR *disk_attr_p;
+  DB_VALUE *value;
+  INT64 count = 0, distinct;
+  int total_pages = 0;
+  int n_attrs, i;
+  size_t a;
+  int error_code;
+
+  *nobjs_p = 0;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      attr_ndv[i] = -1;
+      if (TP_IS_LOB_TYPE (disk_attr_p->type) || disk_attr_p->type == DB_TYPE_JSON)
+	{
+	  /* not gathered for statistics */
+	  continue;
+	}
+      attr_ids.push_back (disk_attr_p->id);
+      attr_pos.push_back (i);
+    }
+  samples.resize (attr_ids.size ());
+  is_ignored.resize (attr_ids.size (), false);
+
+  error_code = file_get_num_user_pages (thread_p, &hfid_p->vfid, &total_pages);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+  sampling.weight = MAX ((total_pages / NUMBER_OF_SAMPLING_PAGES), 1);
+
+  if (!attr_ids.empty ())
+    {
+      error_code = heap_attrinfo_start (thread_p, class_id_p, (int) attr_ids.size (), attr_ids.data (), &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, true, false,
+				     logtb_get_mvcc_snapshot (thread_p));
+  if (error_code != NO_ERROR)
+    {
+      if (!attr_ids.empty ())
+	{
+	  heap_attrinfo_end (thread_p, &attr_info);
+	}
+      return error_code;
+    }
+
+  OID_SET_NULL (&oid);
+  while ((scan_code = heap_next_sampling (thread_p, hfid_p, class_id_p, &oid, &recdes, &scan_cache, PEEK,
+					  &sampling)) == S_SUCCESS)
+    {
+      count++;
+
+      if (attr_ids.empty ())
+	{
+	  continue;
+	}
+
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+
+      for (a = 0; a < attr_ids.size (); a++)
+	{
+	  value = heap_attrinfo_access (attr_ids[a], &attr_info);
+	  if (value == NULL || DB_IS_NULL (value) || is_ignored[a])
+	    {
+	      continue;
+	    }
+
+	  if (TP_IS_CHAR_TYPE (DB_VALUE_DOMAIN_TYPE (value)) && db_value_precision (value) > STATS_MAX_PRECISION)
+	    {
+	      /* long strings are not gathered for statistics */
+	      is_ignored[a] = true;
+	      samples[a].clear ();
+	      continue;
+	    }
+
+	  samples[a].insert (mht_get_hash_number (UINT_MAX, value));
+	}
+    }
+
+  if (scan_code == S_ERROR && error_code == NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+    }
+
+  (void) heap_scancache_end (thread_p, &scan_cache);
+  if (!attr_ids.empty ())
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  *nobjs_p = count * sampling.weight;
+
+  for (a = 0; a < attr_ids.size (); a++)
+    {
+      if (is_ignored[a])
+	{
+	  continue;
+	}
+
+      distinct = (INT64) samples[a].size ();
+      attr_ndv[attr_pos[a]] = MIN (distinct * stats_adjust_sampling_weight (distinct, sampling.weight), *nobjs_p);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_get_col_group_defs () - Finds the column groups of statistics_column_groups defined for a class
+ *   class_id_p(in): Identifier of the class
+ *   class_name(in): name of the class, with its owner
+ *   disk_repr_p(in): the last representation of the class
+ *   col_groups(out): the groups with their attribute ids; the statistics are not filled
+ *
+ * Note: statistics_column_groups is "class(column, column, ...); ...", where the class is named with or without its
+ *       owner. Groups of unknown columns, of less than two or more than STATS_COL_GROUP_MAX_ATTRS columns, and
+ *       groups beyond STATS_COL_GROUP_MAX_NUM are ignored; a mistake in the parameter should not fail UPDATE
+ *       STATISTICS.
+ */
+static void
+// *INDENT-OFF*
+stats_get_col_group_defs (THREAD_ENTRY * thread_p, OID * class_id_p, const char *class_name, DISK_REPR * disk_repr_p,
+			  std::vector<STATS_COL_GROUP> &col_groups)
+// *INDENT-ON*
+{
+  const char *definition = prm_get_string_value (PRM_ID_STATISTICS_COLUMN_GROUPS);
+  const char *short_name;
+  std::string def_str, item, name, column;
+  size_t pos, next_pos, open_pos, close_pos, col_pos, col_end;
+  HEAP_SCANCACHE scan_cache;
+  RECDES recdes = RECDES_INITIALIZER;
+  STATS_COL_GROUP col_group;
+  DISK_ATTR *disk_attr_p;
+  char *attr_name;
+  int alloced_string;
+  int i, attr_id;
+  bool is_valid;
+
+  col_groups.clear ();
+
+  if (definition == NULL || definition[0] == '\0' || class_name == NULL)
+    {
+      return;
+    }
+
+  short_name = strchr (class_name, '.');
+  short_name = (short_name != NULL) ? short_name + 1 : class_name;
+
+  /* the attribute names are only in the class record */
+  (void) heap_scancache_quick_start_root_hfid (thread_p, &scan_cache);
+  if (heap_get_class_record (thread_p, class_id_p, &recdes, &scan_cache, PEEK) != S_SUCCESS)
+    {
+      er_clear ();
+      (void) heap_scancache_end (thread_p, &scan_cache);
+      return;
+    }
+
+  def_str = definition;
+  for (pos = 0; pos < def_str.size () && col_groups.size () < STATS_COL_GROUP_MAX_NUM; pos = next_pos + 1)
+    {
+      next_pos = def_str.find (';', pos);
+      if (next_pos == std::string::npos)
+	{
+	  next_pos = def_str.size ();
+	}
+      item = def_str.substr (pos, next_pos - pos);
+
+      open_pos = item.find ('(');
+      close_pos = item.rfind (')');
+      if (open_pos == std::string::npos || close_pos == std::string::npos || close_pos < open_pos)
+	{
+	  continue;
+	}
+
+      name = item.substr (0, open_pos);
+      name.erase (0, name.find_first_not_of (" \t"));
+      name.erase (name.find_last_not_of (" \t") + 1);
+      if (intl_identifier_casecmp (name.c_str (), class_name) != 0
+	  && intl_identifier_casecmp (name.c_str (), short_name) != 0)
+	{
+	  continue;
+	}
+
+      col_group.n_attrs = 0;
+      col_group.ndv = 0;
+      col_group.dependency = 0;
+      is_valid = true;
+
+      for (col_pos = open_pos + 1; col_pos < close_pos && is_valid; col_pos = col_end + 1)
+	{
+	  col_end = item.find (',', col_pos);
+	  if (col_end == std::string::npos || col_end > close_pos)
+	    {
+	      col_end = close_pos;
+	    }
+	  column = item.substr (col_pos, col_end - col_pos);
+	  column.erase (0, column.find_first_not_of (" \t"));
+	  column.erase (column.find_last_not_of (" \t") + 1);
+
+	  attr_id = -1;
+	  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable && attr_id < 0; i++)
+	    {
+	      disk_attr_p = (i < disk_repr_p->n_fixed
+			     ? disk_repr_p->fixed + i : disk_repr_p->variable + (i - disk_repr_p->n_fixed));
+
+	      attr_name = NULL;
+	      alloced_string = 0;
+	      if (or_get_attrname (&recdes, disk_attr_p->id, &attr_name, &alloced_string) != NO_ERROR)
+		{
+		  er_clear ();
+		  continue;
+		}
+
+	      if (attr_name != NULL && intl_identifier_casecmp (attr_name, column.c_str ()) == 0)
+		{
+		  attr_id = disk_attr_p->id;
+		}
+
+	      if (attr_name != NULL && alloced_string == 1)
+		{
+		  db_private_free_and_init (thread_p, attr_name);
+		}
+	    }
+
+	  if (attr_id < 0 || col_group.n_attrs >= STATS_COL_GROUP_MAX_ATTRS)
+	    {
+	      is_valid = false;
+	      break;
+	    }
+	  col_group.attr_ids[col_group.n_attrs++] = attr_id;
+	}
+
+      if (is_valid && col_group.n_attrs >= 2)
+	{
+	  col_groups.push_back (col_group);
+	}
+    }
+
+  (void) heap_scancache_end (thread_p, &scan_cache);
+}
+
+/*
+ * stats_update_col_groups () - Gathers the statistics of the column groups of a class
+ *   return: error code
+ *   class_id_p(in): Identifier of the class
+ *   class_name(in): name of the class
+ *   hfid_p(in): heap file of the class
+ *   nobjs(in): number of objects of the class
+ *   disk_repr_p(in/out): the last representation; its column groups are replaced
+ *
+ * Note: The groups are gathered from a page sampling scan of the heap, also for UPDATE STATISTICS WITH FULLSCAN;
+ *       the NDV of a group is extrapolated from the sample like the NDV of the columns. The dependency of a group
+ *       is the fraction of the sampled rows whose values of the other columns are always seen with the same value of
+ *       the last column (e.g. city for (zipcode, city)).
+ */
+static int
+stats_update_col_groups (THREAD_ENTRY * thread_p, OID * class_id_p, const char *class_name, HFID * hfid_p,
+			 INT64 nobjs, DISK_REPR * disk_repr_p)
+{
+  // *INDENT-OFF*
+  std::vector<STATS_COL_GROUP> col_groups;
+  std::vector<STATS_COL_GROUP_SAMPLE> samples;
+  std::vector<ATTR_ID> attr_ids;
+  // *INDENT-ON*
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  SAMPLING_INFO sampling;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID oid;
+  SCAN_CODE scan_code;
+  DB_VALUE *value;
+  UINT64 hash, det_hash, last_hash;
+  INT64 nrows = 0, consistent_rows, distinct;
+  int total_pages = 0;
+  size_t g;
+  int i;
+  int error_code = NO_ERROR;
+
+  if (disk_repr_p->col_groups != NULL)
+    {
+      db_private_free_and_init (thread_p, disk_repr_p->col_groups);
+    }
+  disk_repr_p->n_col_groups = 0;
+
+  stats_get_col_group_defs (thread_p, class_id_p, class_name, disk_repr_p, col_groups);
+  if (col_groups.empty ())
+    {
+      return NO_ERROR;
+    }
+
+  // *INDENT-OFF*
+  for (const STATS_COL_GROUP &col_group : col_groups)
+    {
+      for (i = 0; i < col_group.n_attrs; i++)
+	{
+	  if (std::find (attr_ids.begin (), attr_ids.end (), col_group.attr_ids[i]) == attr_ids.end ())
+	    {
+	      attr_ids.push_back (col_group.attr_ids[i]);
+	    }
+	}
+    }
+  // *INDENT-ON*
+  samples.resize (col_groups.size ());
+
+  error_code = file_get_num_user_pages (thread_p, &hfid_p->vfid, &total_pages);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+  sampling.weight = MAX ((total_pages / NUMBER_OF_SAMPLING_PAGES), 1);
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, (int) attr_ids.size (), attr_ids.data (), &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, true, false,
+				     logtb_get_mvcc_snapshot (thread_p));
+  if (error_code != NO_ERROR)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+      return error_code;
+    }
+
+  OID_SET_NULL (&oid);
+  while ((scan_code = heap_next_sampling (thread_p, hfid_p, class_id_p, &oid, &recdes, &scan_cache, PEEK,
+					  &sampling)) == S_SUCCESS)
+    {
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+      nrows++;
+
+      for (g = 0; g < col_groups.size (); g++)
+	{
+	  det_hash = 0;
+	  last_hash = 0;
+	  for (i = 0; i < col_groups[g].n_attrs; i++)
+	    {
+	      value = heap_attrinfo_access (col_groups[g].attr_ids[i], &attr_info);
+	      hash = mht_get_hash_number (UINT_MAX, value);
+	      if (i < col_groups[g].n_attrs - 1)
+		{
+		  /* FNV-1a over the hashes of the columns */
+		  det_hash = (det_hash ^ hash) * 1099511628211ULL;
+		}
+	      else
+		{
+		  last_hash = hash;
+		}
+	    }
+
+	  samples[g].values.insert ((det_hash ^ last_hash) * 1099511628211ULL);
+
+	  // *INDENT-OFF*
+	  auto inserted = samples[g].determinants.insert ({det_hash, {last_hash, 0, true}});
+	  // *INDENT-ON*
+	  STATS_COL_GROUP_DETERMINANT & determinant = inserted.first->second;
+	  determinant.nrows++;
+	  if (determinant.last_hash != last_hash)
+	    {
+	      determinant.is_consistent = false;
+	    }
+	}
+    }
+
+  if (scan_code == S_ERROR && error_code == NO_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+    }
+
+  (void) heap_scancache_end (thread_p, &scan_cache);
+  heap_attrinfo_end (thread_p, &attr_info);
+
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  for (g = 0; g < col_groups.size (); g++)
+    {
+      distinct = (INT64) samples[g].values.size ();
+      col_groups[g].ndv = distinct * stats_adjust_sampling_weight (distinct, sampling.weight);
+      if (nobjs > 0)
+	{
+	  col_groups[g].ndv = MIN (col_groups[g].ndv, nobjs);
+	}
+
+      consistent_rows = 0;
+      // *INDENT-OFF*
+      for (const auto &it : samples[g].determinants)
+	{
+	  if (it.second.is_consistent)
+	    {
+	      consistent_rows += it.second.nrows;
+	    }
+	}
+      // *INDENT-ON*
+      col_groups[g].dependency = (nrows > 0) ? (double) consistent_rows / nrows : 0;
+    }
+
+  disk_repr_p->col_groups =
+    (STATS_COL_GROUP *) db_private_alloc (thread_p, sizeof (STATS_COL_GROUP) * col_groups.size ());
+  if (disk_repr_p->col_groups == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      sizeof (STATS_COL_GROUP) * col_groups.size ());
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memcpy (disk_repr_p->col_groups, col_groups.data (), sizeof (STATS_COL_GROUP) * col_groups.size ());
+  disk_repr_p->n_col_groups = (int) col_groups.size ();
+
+  return NO_ERROR;
+}
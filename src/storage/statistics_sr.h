@@ -36,6 +36,9 @@
 #include "object_representation_sr.h"
 
 extern unsigned int stats_get_time_stamp (void);
+extern int stats_update_statistics_by_sampling (THREAD_ENTRY * thread_p, OID * class_id_p,
+						OID * partitioned_class_oid);
+extern int stats_get_sampling_cost (THREAD_ENTRY * thread_p, OID * class_id_p, INT64 * nobjs_p, INT64 * npages_p);
 extern const BTREE_STATS *stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_rep,
 							    DISK_ATTR * subcls_attr, BTID * cls_btid);
 #if defined(CUBRID_DEBUG)
@@ -993,6 +993,8 @@ typedef enum
   SHOWSTMT_TRAN_TABLES,
   SHOWSTMT_THREADS,
   SHOWSTMT_PAGE_BUFFER_STATUS,
+  SHOWSTMT_ACTIVE_SESSION_HISTORY,
+  SHOWSTMT_STATEMENT_STATISTICS,
 
   /* append the new show statement types in here */
 
@@ -97,7 +97,7 @@ static int rv;
 #define CATALOG_DISK_REPR_N_FIXED_OFF        4
 #define CATALOG_DISK_REPR_FIXED_LENGTH_OFF   8
 #define CATALOG_DISK_REPR_N_VARIABLE_OFF     12
-#define CATALOG_DISK_REPR_RESERVED_1_OFF     16	/* reserved for future use */
+#define CATALOG_DISK_REPR_N_COL_GROUPS_OFF   16
 #define CATALOG_DISK_REPR_SIZE               56
 
 /* Each disk attribute is aligned with MAX_ALIGNMENT
@@ -127,6 +127,13 @@ static int rv;
 #define CATALOG_GET_BT_STATS_BTID(var, ptr) \
     OR_GET_BTID((ptr) + CATALOG_BT_STATS_BTID_OFF, (var))
 
+/* Column groups follow the attributes of the disk representation */
+#define CATALOG_COL_GROUP_N_ATTRS_OFF    0
+#define CATALOG_COL_GROUP_DEPENDENCY_OFF 4	/* in millionths */
+#define CATALOG_COL_GROUP_ATTR_IDS_OFF   8
+#define CATALOG_COL_GROUP_NDV_OFF        (CATALOG_COL_GROUP_ATTR_IDS_OFF + (OR_INT_SIZE * STATS_COL_GROUP_MAX_ATTRS))	/* 40 */
+#define CATALOG_COL_GROUP_SIZE           (CATALOG_COL_GROUP_NDV_OFF + OR_INT64_SIZE)	/* 48 */
+
 #define CATALOG_CLS_INFO_HFID_OFF           0
 #define CATALOG_CLS_INFO_TOT_PAGES_OFF     12
 #define CATALOG_CLS_INFO_TOT_OBJS_OFF      16
@@ -326,6 +333,10 @@ static int catalog_fetch_attribute_value (THREAD_ENTRY * thread_p, void *value,
 					  CATALOG_RECORD * ct_recordp);
 static int catalog_fetch_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * bt_statsp,
 					   CATALOG_RECORD * ct_recordp);
+static int catalog_store_col_group (THREAD_ENTRY * thread_p, STATS_COL_GROUP * col_group_p,
+				    CATALOG_RECORD * ct_recordp, PGSLOTID * remembered_slotid);
+static int catalog_fetch_col_group (THREAD_ENTRY * thread_p, STATS_COL_GROUP * col_group_p,
+				    CATALOG_RECORD * ct_recordp);
 static int catalog_drop_disk_representation_from_page (THREAD_ENTRY * thread_p, VPID * page_id, PGSLOTID slot_id);
 static int catalog_drop_representation_class_from_page (THREAD_ENTRY * thread_p, VPID * dir_pgid, PAGE_PTR * dir_pgptr,
 							VPID * page_id, PGSLOTID slot_id);
@@ -370,6 +381,8 @@ static void catalog_put_disk_representation (char *rec_p, DISK_REPR * disk_repr_
 static void catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p);
 static void catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p);
 static void catalog_put_btree_statistics (char *rec_p, BTREE_STATS * stat_p);
+static void catalog_get_col_group (STATS_COL_GROUP * col_group_p, char *rec_p);
+static void catalog_put_col_group (char *rec_p, STATS_COL_GROUP * col_group_p);
 static void catalog_get_class_info_from_record (CLS_INFO * class_info_p, char *rec_p);
 static void catalog_put_class_info_to_record (char *rec_p, CLS_INFO * class_info_p);
 static void catalog_get_repr_item_from_record (CATALOG_REPR_ITEM * item_p, char *rec_p);
@@ -401,10 +414,9 @@ catalog_get_disk_representation (DISK_REPR * disk_repr_p, char *rec_p)
   disk_repr_p->fixed_length = OR_GET_INT (rec_p + CATALOG_DISK_REPR_FIXED_LENGTH_OFF);
   disk_repr_p->n_variable = OR_GET_INT (rec_p + CATALOG_DISK_REPR_N_VARIABLE_OFF);
   disk_repr_p->variable = NULL;
-
-#if 0				/* reserved for future use */
-  disk_repr_p->repr_reserved_1 = OR_GET_INT (rec_p + CATALOG_DISK_REPR_RESERVED_1_OFF);
-#endif
+  /* zero in the representations stored before column groups */
+  disk_repr_p->n_col_groups = OR_GET_INT (rec_p + CATALOG_DISK_REPR_N_COL_GROUPS_OFF);
+  disk_repr_p->col_groups = NULL;
 }
 
 static void
@@ -414,9 +426,7 @@ catalog_put_disk_representation (char *rec_p, DISK_REPR * disk_repr_p)
   OR_PUT_INT (rec_p + CATALOG_DISK_REPR_N_FIXED_OFF, disk_repr_p->n_fixed);
   OR_PUT_INT (rec_p + CATALOG_DISK_REPR_FIXED_LENGTH_OFF, disk_repr_p->fixed_length);
   OR_PUT_INT (rec_p + CATALOG_DISK_REPR_N_VARIABLE_OFF, disk_repr_p->n_variable);
-
-  /* reserved for future use */
-  OR_PUT_INT (rec_p + CATALOG_DISK_REPR_RESERVED_1_OFF, 0);
+  OR_PUT_INT (rec_p + CATALOG_DISK_REPR_N_COL_GROUPS_OFF, disk_repr_p->n_col_groups);
 }
 
 static void
@@ -497,6 +507,41 @@ catalog_put_btree_statistics (char *rec_p, BTREE_STATS * stat_p)
     }
 }
 
+static void
+catalog_get_col_group (STATS_COL_GROUP * col_group_p, char *rec_p)
+{
+  int i;
+
+  col_group_p->n_attrs = OR_GET_INT (rec_p + CATALOG_COL_GROUP_N_ATTRS_OFF);
+  col_group_p->dependency = OR_GET_INT (rec_p + CATALOG_COL_GROUP_DEPENDENCY_OFF) / 1000000.0;
+
+  assert (col_group_p->n_attrs <= STATS_COL_GROUP_MAX_ATTRS);
+  for (i = 0; i < STATS_COL_GROUP_MAX_ATTRS; i++)
+    {
+      col_group_p->attr_ids[i] = OR_GET_INT (rec_p + CATALOG_COL_GROUP_ATTR_IDS_OFF + (OR_INT_SIZE * i));
+    }
+
+  OR_GET_INT64 (rec_p + CATALOG_COL_GROUP_NDV_OFF, &col_group_p->ndv);
+}
+
+static void
+catalog_put_col_group (char *rec_p, STATS_COL_GROUP * col_group_p)
+{
+  int i;
+
+  OR_PUT_INT (rec_p + CATALOG_COL_GROUP_N_ATTRS_OFF, col_group_p->n_attrs);
+  OR_PUT_INT (rec_p + CATALOG_COL_GROUP_DEPENDENCY_OFF, (int) (col_group_p->dependency * 1000000.0));
+
+  assert (col_group_p->n_attrs <= STATS_COL_GROUP_MAX_ATTRS);
+  for (i = 0; i < STATS_COL_GROUP_MAX_ATTRS; i++)
+    {
+      OR_PUT_INT (rec_p + CATALOG_COL_GROUP_ATTR_IDS_OFF + (OR_INT_SIZE * i),
+		  i < col_group_p->n_attrs ? col_group_p->attr_ids[i] : -1);
+    }
+
+  OR_PUT_INT64 (rec_p + CATALOG_COL_GROUP_NDV_OFF, &col_group_p->ndv);
+}
+
 static void
 catalog_get_class_info_from_record (CLS_INFO * class_info_p, char *rec_p)
 {
@@ -864,6 +909,11 @@ catalog_free_representation (DISK_REPR * repr_p)
 	    }
 	}
 
+      if (repr_p->col_groups != NULL)
+	{
+	  db_private_free_and_init (NULL, repr_p->col_groups);
+	}
+
       if (repr_p->fixed != NULL)
 	{
 	  db_private_free_and_init (NULL, repr_p->fixed);
@@ -1312,6 +1362,32 @@ catalog_store_btree_statistics (THREAD_ENTRY * thread_p, BTREE_STATS * btree_sta
   return NO_ERROR;
 }
 
+/*
+ * catalog_store_col_group () -
+ *   return: NO_ERROR or ER_FAILED
+ *   col_group_p(in): pointer to STATS_COL_GROUP structure (disk representation)
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *   remembered_slotid(in):
+ *
+ * Note: Transforms disk representation form into catalog disk form.
+ * Store STATS_COL_GROUP structure into catalog record.
+ */
+static int
+catalog_store_col_group (THREAD_ENTRY * thread_p, STATS_COL_GROUP * col_group_p, CATALOG_RECORD * catalog_record_p,
+			 PGSLOTID * remembered_slot_id_p)
+{
+  if (catalog_write_unwritten_portion (thread_p, catalog_record_p, remembered_slot_id_p, CATALOG_COL_GROUP_SIZE) !=
+      NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  catalog_put_col_group (catalog_record_p->recdes.data + catalog_record_p->offset, col_group_p);
+  catalog_record_p->offset += CATALOG_COL_GROUP_SIZE;
+
+  return NO_ERROR;
+}
+
 /*
  * catalog_get_record_from_page () - Get the catalog record from the page.
  *   return: NO_ERROR or ER_FAILED
@@ -1583,6 +1659,29 @@ exit_on_end:
   return NO_ERROR;
 }
 
+/*
+ * catalog_fetch_col_group () -
+ *   return: NO_ERROR or ER_FAILED
+ *   col_group_p(in): pointer to STATS_COL_GROUP structure (disk representation)
+ *   ct_recordp(in): pointer to CATALOG_RECORD structure (catalog record)
+ *
+ * Note: Transforms catalog disk form into disk representation form.
+ * Fetch STATS_COL_GROUP structure from catalog record.
+ */
+static int
+catalog_fetch_col_group (THREAD_ENTRY * thread_p, STATS_COL_GROUP * col_group_p, CATALOG_RECORD * catalog_record_p)
+{
+  if (catalog_read_unread_portion (thread_p, catalog_record_p, CATALOG_COL_GROUP_SIZE) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  catalog_get_col_group (col_group_p, catalog_record_p->recdes.data + catalog_record_p->offset);
+  catalog_record_p->offset += CATALOG_COL_GROUP_SIZE;
+
+  return NO_ERROR;
+}
+
 static int
 catalog_drop_representation_helper (THREAD_ENTRY * thread_p, PAGE_PTR page_p, VPID * page_id_p, PGSLOTID slot_id)
 {
@@ -2845,6 +2944,7 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
   size = CATALOG_DISK_REPR_SIZE;
   size += catalog_sum_disk_attribute_size (disk_repr_p->fixed, disk_repr_p->n_fixed);
   size += catalog_sum_disk_attribute_size (disk_repr_p->variable, disk_repr_p->n_variable);
+  size += disk_repr_p->n_col_groups * CATALOG_COL_GROUP_SIZE;
 
   if (catalog_access_info_p == NULL)
     {
@@ -2971,6 +3071,22 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	}
     }
 
+  for (i = 0; i < disk_repr_p->n_col_groups; i++)
+    {
+      if (catalog_store_col_group (thread_p, &disk_repr_p->col_groups[i], &catalog_record, &remembered_slot_id) !=
+	  NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
+    }
+
   catalog_record.recdes.length = catalog_record.offset;
   catalog_record.offset = catalog_record.recdes.area_size;
 
@@ -4025,6 +4141,24 @@ catalog_get_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	}
     }
 
+  if (disk_repr_p->n_col_groups > 0)
+    {
+      disk_repr_p->col_groups =
+	(STATS_COL_GROUP *) db_private_alloc (thread_p, sizeof (STATS_COL_GROUP) * disk_repr_p->n_col_groups);
+      if (disk_repr_p->col_groups == NULL)
+	{
+	  goto exit_on_error;
+	}
+
+      for (i = 0; i < disk_repr_p->n_col_groups; i++)
+	{
+	  if (catalog_fetch_col_group (thread_p, &disk_repr_p->col_groups[i], &catalog_record) != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+    }
+
 exit_on_end:
 
   if (catalog_record.page_p)
@@ -4907,6 +5041,25 @@ catalog_dump_representation (DISK_REPR * disk_repr_p)
 	{
 	  catalog_dump_disk_attribute (attr_p);
 	}
+
+      if (disk_repr_p->n_col_groups > 0)
+	{
+	  fprintf (stdout, " Column Groups : \n\n");
+	  for (i = 0; i < disk_repr_p->n_col_groups; i++)
+	    {
+	      STATS_COL_GROUP *col_group_p = &disk_repr_p->col_groups[i];
+	      int j;
+
+	      fprintf (stdout, "    Attribute ids: (");
+	      for (j = 0; j < col_group_p->n_attrs; j++)
+		{
+		  fprintf (stdout, "%s%d", j > 0 ? "," : "", col_group_p->attr_ids[j]);
+		}
+	      fprintf (stdout, ") , Distinct values: %lld , Dependency: %g\n", (long long) col_group_p->ndv,
+		       col_group_p->dependency);
+	    }
+	  fprintf (stdout, "\n");
+	}
     }
 }
 
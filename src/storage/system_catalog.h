@@ -68,9 +68,8 @@ struct disk_representation
   int fixed_length;		/* total length of fixed attributes */
   int n_variable;		/* number of variable attributes */
   struct disk_attribute *variable;	/* variable attribute structures */
-#if 0				/* reserved for future use */
-  int repr_reserved_1;
-#endif
+  int n_col_groups;		/* number of column groups */
+  STATS_COL_GROUP *col_groups;	/* column group statistics */
 };				/* object disk representation */
 
 
@@ -118,6 +118,7 @@ namespace cubthread
     , no_logging (false)
     , net_request_index (-1)
     , vacuum_worker (NULL)
+    , btree_rightmost_leaves (NULL)
     , sort_stats_active (false)
     , event_stats ()
     , trace_format (0)
@@ -133,6 +134,10 @@ namespace cubthread
 #endif /* DEBUG */
     , m_qlist_count (0)
     , read_ovfl_pages_count (0) // For Vacuum only.
+    , wait_event (THREAD_WAIT_EVENT_NONE)
+    , sql_id (0)
+    , resource_usage ()
+    , resgrp_io_delay_usec (0)
     , m_loaddb_driver (NULL)
       // private:
     , m_id ()
@@ -186,6 +191,8 @@ namespace cubthread
     tran_entries[THREAD_TS_HFID_TABLE] = NULL;
     tran_entries[THREAD_TS_XCACHE] = NULL;
     tran_entries[THREAD_TS_FPCACHE] = NULL;
+    tran_entries[THREAD_TS_DWB_SLOTS] = NULL;
+    tran_entries[THREAD_TS_CLASSNAMES] = NULL;
 
 #if !defined (NDEBUG)
     fi_thread_init (this);
@@ -216,6 +223,7 @@ namespace cubthread
     tran_entries[THREAD_TS_XCACHE] = lf_tran_request_entry (&xcache_Ts);
     tran_entries[THREAD_TS_FPCACHE] = lf_tran_request_entry (&fpcache_Ts);
     tran_entries[THREAD_TS_DWB_SLOTS] = lf_tran_request_entry (&dwb_slots_Ts);
+    tran_entries[THREAD_TS_CLASSNAMES] = lf_tran_request_entry (&classnames_Ts);
   }
 
   void
@@ -257,6 +265,10 @@ namespace cubthread
       {
 	free (log_data_ptr);
       }
+    if (btree_rightmost_leaves != NULL)
+      {
+	free (btree_rightmost_leaves);
+      }
 
     no_logging = false;
 
@@ -40,6 +40,8 @@
 // forward definitions
 // from adjustable_array.h
 struct adj_array;
+// from btree.c
+struct btree_rightmost_leaf;
 // from connection_defs.h
 struct css_conn_entry;
 // from fault_injection.h
@@ -88,6 +90,7 @@ enum
   THREAD_TS_XCACHE,
   THREAD_TS_FPCACHE,
   THREAD_TS_DWB_SLOTS,
+  THREAD_TS_CLASSNAMES,
   THREAD_TS_LAST
 };
 #define THREAD_TS_COUNT  THREAD_TS_LAST
@@ -115,6 +118,16 @@ struct event_stat
   int trace_log_flush_time;
 };
 
+/* resources used by a thread; written by the owner only and read as deltas around the execution of a query */
+typedef struct thread_resource_usage THREAD_RESOURCE_USAGE;
+struct thread_resource_usage
+{
+  INT64 page_fetches;		/* pages fixed in the page buffer */
+  INT64 page_ioreads;		/* pages read from the volumes */
+  INT64 temp_pages;		/* pages allocated in temporary files */
+  INT64 lock_wait_usec;		/* time waited for object locks */
+};
+
 typedef std::thread::id thread_id_t;
 
 // FIXME - move these enum to cubthread::entry
@@ -159,6 +172,15 @@ enum thread_resume_suspend_status
   THREAD_DWB_QUEUE_RESUMED = 24
 };
 
+// waits that are not suspensions on the thread entry; the thread publishes them itself so the active session history
+// sampler can tell them apart from CPU time
+enum thread_wait_event
+{
+  THREAD_WAIT_EVENT_NONE = 0,
+  THREAD_WAIT_EVENT_IO,		/* volume read, write or sync */
+  THREAD_WAIT_EVENT_NETWORK	/* sending to a client */
+};
+
 namespace cubthread
 {
 
@@ -262,6 +284,8 @@ namespace cubthread
 
       struct vacuum_worker *vacuum_worker;	/* Vacuum worker info */
 
+      struct btree_rightmost_leaf *btree_rightmost_leaves;	/* last leaves of the indexes appended to */
+
       bool sort_stats_active;
 
       EVENT_STAT event_stats;
@@ -287,6 +311,15 @@ namespace cubthread
       int m_qlist_count;
       int read_ovfl_pages_count; // For Vacuum only.
 
+      /* for active session history; written by the owner, read by the sampler */
+      std::atomic<thread_wait_event> wait_event;
+      std::atomic<UINT64> sql_id;	/* SQL_ID of the executing query as a number, 0 if none */
+
+      /* for statement statistics */
+      THREAD_RESOURCE_USAGE resource_usage;
+
+      INT64 resgrp_io_delay_usec;	/* page read delay owed by the resource group, slept when no page is fixed */
+
       cubload::driver *m_loaddb_driver;
 
       thread_id_t get_id ();
@@ -474,4 +507,13 @@ int thread_suspend_with_other_mutex (cubthread::entry *p, pthread_mutex_t *mutex
 const char *thread_type_to_string (thread_type type);
 const char *thread_status_to_string (cubthread::entry::status status);
 const char *thread_resume_status_to_string (thread_resume_suspend_status resume_status);
+
+inline void
+thread_set_wait_event (cubthread::entry *thread_p, thread_wait_event event)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_event.store (event, std::memory_order_relaxed);
+    }
+}
 #endif // _THREAD_ENTRY_HPP_
@@ -73,9 +73,14 @@
 #include "event_log.h"
 #include "tz_support.h"
 #include "filter_pred_cache.h"
+#include "columnar_cache.hpp"
 #include "scan_manager.h"
 #include "slotted_page.h"
 #include "thread_manager.hpp"
+#include "backup_change_tracking.hpp"
+#include "monitor_active_session_history.hpp"
+#include "monitor_statement_statistics.hpp"
+#include "statistics_auto.hpp"
 #include "double_write_buffer.h"
 #include "xasl_cache.h"
 #include "log_volids.hpp"
@@ -86,6 +91,7 @@
 
 #if defined(SERVER_MODE)
 #include "connection_sr.h"
+#include "resource_group.hpp"
 #include "server_support.h"
 #endif /* SERVER_MODE */
 
@@ -2470,6 +2476,14 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 
   oid_set_root (&boot_Db_parm->rootclass_oid);
 
+  /* Track the pages written from now on, including the pages recovered below */
+  error_code = bct_initialize (thread_p, log_path, log_prefix);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
   /* Load and recover data pages before log recovery */
   error_code = dwb_load_and_recover_pages (thread_p, log_path, log_prefix);
   if (error_code != NO_ERROR)
@@ -2484,6 +2498,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 
   log_initialize (thread_p, boot_Db_full_name, log_path, log_prefix, from_backup, r_args);
 
+  bct_load (thread_p, from_backup);
+
   error_code = boot_after_copydb (thread_p);	// only does something if this is first boot after copydb
   if (error_code != NO_ERROR)
     {
@@ -2495,6 +2511,9 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   pgbuf_daemons_init ();
   dwb_daemons_init ();
   cdc_daemons_init ();
+  ash_daemon_init ();
+  stmtstat_init ();
+  stats_auto_daemon_init ();
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2549,6 +2568,13 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+  error_code = colcache_initialize (thread_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
   /*
    * Initialize system locale using values from db_root system table
    */
@@ -2806,6 +2832,9 @@ error:
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  stats_auto_daemon_destroy ();
+  ash_daemon_destroy ();
+  stmtstat_final ();
   cdc_daemons_destroy ();
 
   pgbuf_daemons_destroy ();
@@ -2813,7 +2842,9 @@ error:
 #endif
 
   log_final (thread_p);
+  bct_finalize (thread_p, false);
   fpcache_finalize (thread_p);
+  colcache_finalize (thread_p);
   qfile_finalize_list_cache (thread_p);
   xcache_finalize (thread_p);
 
@@ -3098,6 +3129,11 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
 
   sysprm_set_force (prm_get_name (PRM_ID_SUPPRESS_FSYNC), "0");
 
+#if defined(SERVER_MODE)
+  /* the daemon runs transactions of its own */
+  stats_auto_daemon_destroy ();
+#endif
+
   /* Shutdown the system with the system transaction */
   logtb_set_to_system_tran_index (thread_p);
   log_abort_all_active_transaction (thread_p);
@@ -3108,6 +3144,7 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   qfile_finalize_list_cache (thread_p);
   xcache_finalize (thread_p);
   fpcache_finalize (thread_p);
+  colcache_finalize (thread_p);
   session_states_finalize (thread_p);
 
   (void) boot_remove_all_temp_volumes (thread_p, REMOVE_TEMP_VOL_DEFAULT_ACTION);
@@ -3121,6 +3158,8 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   vacuum_stop_master (thread_p);
 
 #if defined(SERVER_MODE)
+  ash_daemon_destroy ();
+  stmtstat_final ();
   pgbuf_daemons_destroy ();
   cdc_daemons_destroy ();
 #endif
@@ -3133,6 +3172,9 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   /* Since all pages were flushed, now it's safe to destroy DWB. */
   (void) dwb_destroy (thread_p);
 
+  /* Every written page is marked; the change maps can be saved. */
+  bct_finalize (thread_p, true);
+
   if (is_er_final == ER_ALL_FINAL)
     {
       boot_server_all_finalize (thread_p, is_er_final, BOOT_SHUTDOWN_EXCEPT_COMMON_MODULES);
@@ -3319,6 +3361,13 @@ xboot_register_client (THREAD_ENTRY * thread_p, BOOT_CLIENT_CREDENTIAL * client_
 	{
 	  css_notify_ha_log_applier_state (thread_p, HA_LOG_APPLIER_STATE_UNREGISTERED);
 	}
+
+      /* the following requests of the client are scheduled and limited by its resource group */
+      if (thread_p->conn_entry != NULL)
+	{
+	  thread_p->conn_entry->resource_group_id =
+	    resgrp_find_client_group (client_credential->get_db_user (), client_credential->get_program_name ());
+	}
 #endif /* SERVER_MODE */
 
       er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_BO_CLIENT_CONNECTED, 4,
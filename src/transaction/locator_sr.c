@@ -25,6 +25,8 @@
 #include "config.h"
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include <stdlib.h>
 #include <string.h>
@@ -62,6 +64,7 @@
 #include "slotted_page.h"
 #include "xasl_cache.h"
 #include "xasl_predicate.hpp"
+#include "thread_lockfree_hash_map.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
 #include "transaction_transient.hpp"
 #include "xserver_interface.h"
@@ -100,7 +103,12 @@ struct locator_classname_action
 typedef struct locator_classname_entry LOCATOR_CLASSNAME_ENTRY;
 struct locator_classname_entry
 {
-  char *e_name;			/* Name of the class */
+  LOCATOR_CLASSNAME_ENTRY *stack;	/* used in freelist */
+  LOCATOR_CLASSNAME_ENTRY *next;	/* next in hash chain */
+  pthread_mutex_t mutex;	/* protects the entry; held by lookups and by DDL on this name */
+  UINT64 del_id;		/* delete transaction ID (for lock free) */
+
+  char *e_name;			/* Name of the class (key) */
   int e_tran_index;		/* Transaction of entry */
   LOCATOR_CLASSNAME_ACTION e_current;	/* The most current action */
 };
@@ -120,22 +128,67 @@ struct locator_return_nxobj
 
 bool locator_Dont_check_foreign_key = false;
 
-static MHT_TABLE *locator_Mht_classnames = NULL;
+/* handling functions for classname entries of the lock-free hash table */
+static void *locator_classname_entry_alloc (void);
+static int locator_classname_entry_free (void *ent);
+static int locator_classname_entry_init (void *ent);
+static int locator_classname_entry_uninit (void *ent);
+static int locator_classname_key_copy (void *src, void *dest);
+static int locator_classname_key_compare (void *key1, void *key2);
+static unsigned int locator_classname_key_hash (void *key, int htsize);
+
+static LF_ENTRY_DESCRIPTOR locator_classname_entry_Descriptor = {
+  offsetof (LOCATOR_CLASSNAME_ENTRY, stack),
+  offsetof (LOCATOR_CLASSNAME_ENTRY, next),
+  offsetof (LOCATOR_CLASSNAME_ENTRY, del_id),
+  offsetof (LOCATOR_CLASSNAME_ENTRY, e_name),
+  offsetof (LOCATOR_CLASSNAME_ENTRY, mutex),
+
+  LF_EM_USING_MUTEX,
+
+  locator_classname_entry_alloc,
+  locator_classname_entry_free,
+  locator_classname_entry_init,
+  locator_classname_entry_uninit,
+  locator_classname_key_copy,
+  locator_classname_key_compare,
+  locator_classname_key_hash,
+  NULL				/* no duplicates */
+};
+
+/*
+ * Classname to OID table.
+ *
+ * Lookups do not enter any critical section; they only hold the mutex of the entry they find, long enough to copy
+ * its current action. DDL (reserve, delete, rename, savepoint and end of transaction processing) enters
+ * CSECT_LOCATOR_SR_CLASSNAME_TABLE as a reader, so DDL on different names runs concurrently and DDL on the same name
+ * is serialized by the entry mutex. Only the passes that need a stable view of the whole table (initialize, finalize
+ * and the consistency check) enter the critical section as writers.
+ */
+// *INDENT-OFF*
+using locator_classname_hashmap_type = cubthread::lockfree_hashmap<const char *, locator_classname_entry>;
+using locator_classname_hashmap_iterator = locator_classname_hashmap_type::iterator;
+// *INDENT-ON*
+static locator_classname_hashmap_type locator_Classnames;
+static bool locator_Classnames_initialized = false;
 
 static const HFID NULL_HFID = { {-1, -1}, -1 };
 
 /* Pseudo pageid used to generate pseudo OID for reserved class names. */
 static const INT32 locator_Pseudo_pageid_first = -2;
 static const INT32 locator_Pseudo_pageid_last = -0x7FFF;
-static INT32 locator_Pseudo_pageid_crt = -2;
+static volatile UINT32 locator_Pseudo_pageid_seq = 0;
 
 static int locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, const OID * class_oid);
-static int locator_defence_drop_class_name_entry (const void *name, void *ent, void *args);
-static int locator_force_drop_class_name_entry (const void *name, void *ent, void *args);
+static LOCATOR_CLASSNAME_ENTRY *locator_find_class_name_entry (THREAD_ENTRY * thread_p, const char *classname);
+static void locator_clear_class_name_entries (THREAD_ENTRY * thread_p);
+static void locator_defence_drop_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * savep_lsa);
+static void locator_force_drop_class_name_entry (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry);
 static int locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, LOG_LSA * savep_lsa);
-static int locator_savepoint_class_name_entry (const char *classname, LOG_LSA * savep_lsa);
+static int locator_savepoint_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, LOG_LSA * savep_lsa);
 static int locator_print_class_name (THREAD_ENTRY * thread_p, FILE * outfp, const void *key, void *ent, void *args);
-static int locator_check_class_on_heap (const void *name, void *ent, void *args);
+static int locator_check_class_on_heap (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry,
+					DISK_ISVALID * isvalid);
 static SCAN_CODE locator_lock_and_return_object (THREAD_ENTRY * thread_p, LOCATOR_RETURN_NXOBJ * assign,
 						 OID * class_oid, OID * oid, int chn, LOCK lock_mode,
 						 SCAN_OPERATION_TYPE op_type);
@@ -236,13 +289,205 @@ static DB_LOGICAL locator_mvcc_reev_cond_and_assignment (THREAD_ENTRY * thread_p
 							 MVCC_REC_HEADER * mvcc_header_p,
 							 const OID * curr_row_version_oid_p, RECDES * recdes);
 
+/*
+ * locator_classname_entry_alloc () - allocate a classname entry
+ *   returns: new entry or NULL
+ */
+static void *
+locator_classname_entry_alloc (void)
+{
+  LOCATOR_CLASSNAME_ENTRY *entry;
+
+  entry = (LOCATOR_CLASSNAME_ENTRY *) malloc (sizeof (LOCATOR_CLASSNAME_ENTRY));
+  if (entry != NULL)
+    {
+      pthread_mutex_init (&entry->mutex, NULL);
+      entry->e_name = NULL;
+    }
+  return (void *) entry;
+}
+
+/*
+ * locator_classname_entry_free () - free a classname entry
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to free
+ */
+static int
+locator_classname_entry_free (void *ent)
+{
+  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
+
+  if (entry == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  pthread_mutex_destroy (&entry->mutex);
+  if (entry->e_name != NULL)
+    {
+      free_and_init (entry->e_name);
+    }
+  free (entry);
+  return NO_ERROR;
+}
+
+/*
+ * locator_classname_entry_init () - initialize a classname entry claimed from freelist
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to initialize
+ *
+ * Note: the name of a retired entry is only released here or in the uninit function, once no concurrent lookup can
+ *       still be comparing it.
+ */
+static int
+locator_classname_entry_init (void *ent)
+{
+  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
+
+  if (entry == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  if (entry->e_name != NULL)
+    {
+      free_and_init (entry->e_name);
+    }
+  entry->e_tran_index = NULL_TRAN_INDEX;
+  entry->e_current.action = LC_CLASSNAME_ERROR;
+  OID_SET_NULL (&entry->e_current.oid);
+  LSA_SET_NULL (&entry->e_current.savep_lsa);
+  entry->e_current.prev = NULL;
+  return NO_ERROR;
+}
+
+/*
+ * locator_classname_entry_uninit () - uninitialize a classname entry
+ *   returns: error code or NO_ERROR
+ *   ent(in): entry to uninitialize
+ */
+static int
+locator_classname_entry_uninit (void *ent)
+{
+  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
+
+  if (entry == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  assert (entry->e_current.prev == NULL);
+  if (entry->e_name != NULL)
+    {
+      free_and_init (entry->e_name);
+    }
+  return NO_ERROR;
+}
+
+/*
+ * locator_classname_key_copy () - copy a classname key
+ *   returns: error code or NO_ERROR
+ *   src(in): source key (pointer to name)
+ *   dest(out): destination key (pointer to name)
+ */
+static int
+locator_classname_key_copy (void *src, void *dest)
+{
+  const char *name = *(const char **) src;
+  char **dest_name = (char **) dest;
+
+  assert (name != NULL);
+
+  *dest_name = strdup (name);
+  if (*dest_name == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (strlen (name) + 1));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  return NO_ERROR;
+}
+
+/*
+ * locator_classname_key_compare () - compare two classname keys
+ *   returns: 0 if the names are equal, non-zero otherwise
+ *   key1(in): first key
+ *   key2(in): second key
+ */
+static int
+locator_classname_key_compare (void *key1, void *key2)
+{
+  return strcmp (*(const char **) key1, *(const char **) key2);
+}
+
+/*
+ * locator_classname_key_hash () - hash a classname key
+ *   returns: hash value
+ *   key(in): key to hash
+ *   htsize(in): hash table size
+ */
+static unsigned int
+locator_classname_key_hash (void *key, int htsize)
+{
+  return mht_1strhash (*(const char **) key, (unsigned int) htsize);
+}
+
+/*
+ * locator_find_class_name_entry () - find and lock the entry of a classname
+ *
+ * return: the entry with its mutex locked or NULL
+ *
+ *   classname(in): name of class
+ */
+static LOCATOR_CLASSNAME_ENTRY *
+locator_find_class_name_entry (THREAD_ENTRY * thread_p, const char *classname)
+{
+  const char *key = classname;
+
+  return locator_Classnames.find (thread_p, key);
+}
+
+/*
+ * locator_clear_class_name_entries () - Remove all entries of the classname table
+ *
+ * return: nothing
+ *
+ * Note: The caller must own CSECT_LOCATOR_SR_CLASSNAME_TABLE as writer.
+ */
+static void
+locator_clear_class_name_entries (THREAD_ENTRY * thread_p)
+{
+  locator_classname_hashmap_iterator it = { thread_p, locator_Classnames };
+  LOCATOR_CLASSNAME_ENTRY *entry;
+  LOCATOR_CLASSNAME_ACTION *old_action;
+  OID class_oid;
+
+  assert (csect_check_own (thread_p, CSECT_CT_OID_TABLE) == 1);
+  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+
+  for (entry = it.iterate (); entry != NULL; entry = it.iterate ())
+    {
+      COPY_OID (&class_oid, &entry->e_current.oid);
+
+      while (entry->e_current.prev != NULL)
+	{
+	  old_action = entry->e_current.prev;
+	  entry->e_current = *old_action;
+	  free_and_init (old_action);
+	}
+
+      (void) catcls_remove_entry (thread_p, &class_oid);
+    }
+
+  locator_Classnames.clear (thread_p);
+}
+
 /*
  * locator_initialize () - Initialize the locator on the server
  *
  * return: NO_ERROR if all OK, ER_ status otherwise
  *
  * Note: Initialize the server transaction object locator.
- *       Currently, only the classname memory hash table is initialized.
+ *       Currently, only the classname hash table is initialized.
  */
 int
 locator_initialize (THREAD_ENTRY * thread_p)
@@ -253,6 +498,12 @@ locator_initialize (THREAD_ENTRY * thread_p)
   char *classname = NULL;
   HEAP_SCANCACHE scan_cache;
   LOCATOR_CLASSNAME_ENTRY *entry;
+  const char *key;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
 
   if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
@@ -268,20 +519,15 @@ locator_initialize (THREAD_ENTRY * thread_p)
       return DISK_ERROR;
     }
 
-  if (locator_Mht_classnames != NULL)
+  if (locator_Classnames_initialized)
     {
-      (void) mht_map (locator_Mht_classnames, locator_force_drop_class_name_entry, NULL);
+      locator_clear_class_name_entries (thread_p);
     }
   else
     {
-      locator_Mht_classnames =
-	mht_create ("Memory hash Classname to OID", CLASSNAME_CACHE_SIZE, mht_1strhash, mht_compare_strings_are_equal);
-    }
-
-  if (locator_Mht_classnames == NULL)
-    {
-      assert (false);
-      goto error;
+      locator_Classnames.init (classnames_Ts, THREAD_TS_CLASSNAMES, CLASSNAME_CACHE_SIZE, 100, 2,
+			       locator_classname_entry_Descriptor);
+      locator_Classnames_initialized = true;
     }
 
   /* Find every single class */
@@ -306,18 +552,17 @@ locator_initialize (THREAD_ENTRY * thread_p)
       assert (classname != NULL);
       assert (strlen (classname) < DB_MAX_IDENTIFIER_LENGTH);
 
-      entry = ((LOCATOR_CLASSNAME_ENTRY *) malloc (sizeof (*entry)));
-      if (entry == NULL)
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (*entry));
-	  goto error;
-	}
-
-      entry->e_name = strdup ((char *) classname);
-      if (entry->e_name == NULL)
+      key = classname;
+      entry = NULL;
+      if (!locator_Classnames.find_or_insert (thread_p, key, entry))
 	{
-	  free_and_init (entry);
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (strlen (classname) + 1));
+	  /* either failed to insert or the name is duplicated */
+	  assert (false);
+	  if (entry != NULL)
+	    {
+	      locator_Classnames.unlock (thread_p, entry);
+	    }
+	  (void) heap_scancache_end (thread_p, &scan_cache);
 	  goto error;
 	}
 
@@ -330,7 +575,7 @@ locator_initialize (THREAD_ENTRY * thread_p)
 
       assert (locator_is_exist_class_name_entry (thread_p, entry));
 
-      (void) mht_put (locator_Mht_classnames, entry->e_name, entry);
+      locator_Classnames.unlock (thread_p, entry);
     }
 
   /* End the scan cursor */
@@ -365,6 +610,11 @@ error:
 void
 locator_finalize (THREAD_ENTRY * thread_p)
 {
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We will leak resources. */
@@ -372,7 +622,7 @@ locator_finalize (THREAD_ENTRY * thread_p)
       return;
     }
 
-  if (locator_Mht_classnames == NULL)
+  if (!locator_Classnames_initialized)
     {
       csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
       return;
@@ -385,10 +635,10 @@ locator_finalize (THREAD_ENTRY * thread_p)
       return;
     }
 
-  (void) mht_map (locator_Mht_classnames, locator_force_drop_class_name_entry, NULL);
+  locator_clear_class_name_entries (thread_p);
 
-  mht_destroy (locator_Mht_classnames);
-  locator_Mht_classnames = NULL;
+  locator_Classnames.destroy ();
+  locator_Classnames_initialized = false;
 
   csect_exit (thread_p, CSECT_CT_OID_TABLE);
 
@@ -460,6 +710,8 @@ xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID
   LC_FIND_CLASSNAME reserve = LC_CLASSNAME_RESERVED;
   OID tmp_classoid;
   int tran_index;
+  const char *key;
+  bool inserted;
 
   if (classname == NULL)
     {
@@ -469,27 +721,63 @@ xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID
   assert (classname != NULL);
   assert (strlen (classname) < DB_MAX_IDENTIFIER_LENGTH);
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
 start:
   reserve = LC_CLASSNAME_RESERVED;
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
       return LC_CLASSNAME_ERROR;
     }
 
-  /* Is there any entries on the classname hash table ? */
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  /* Find the entry of the classname or insert a new one; either way it is returned locked. */
+  key = classname;
+  entry = NULL;
+  inserted = locator_Classnames.find_or_insert (thread_p, key, entry);
+  if (entry == NULL)
+    {
+      csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+      return LC_CLASSNAME_ERROR;
+    }
 
-  if (locator_is_exist_class_name_entry (thread_p, entry))
+  if (inserted)
+    {
+      entry->e_tran_index = tran_index;
+
+      entry->e_current.action = LC_CLASSNAME_RESERVED;
+      if (OID_ISNULL (class_oid))
+	{
+	  locator_generate_class_pseudo_oid (thread_p, class_oid);
+	}
+      COPY_OID (&entry->e_current.oid, class_oid);
+      LSA_SET_NULL (&entry->e_current.savep_lsa);
+      entry->e_current.prev = NULL;
+
+      assert (locator_is_exist_class_name_entry (thread_p, entry) == false);
+
+      locator_incr_num_transient_classnames (entry->e_tran_index);
+
+      locator_Classnames.unlock (thread_p, entry);
+
+      /* Add dummy log to make sure we can revert transient state change. See comment in xlocator_rename_class_name.
+       * Since reserve has been moved before any change (or flush) is done, same scenario can happen here. */
+      log_append_redo_data2 (thread_p, RVLOC_CLASSNAME_DUMMY, NULL, NULL, 0, 0, NULL);
+    }
+  else if (locator_is_exist_class_name_entry (thread_p, entry))
     {
       /* There is a class with such a name on the classname cache. */
       reserve = LC_CLASSNAME_EXIST;
+      locator_Classnames.unlock (thread_p, entry);
     }
-  else if (entry != NULL)
+  else
     {
       assert (entry->e_current.action != LC_CLASSNAME_EXIST);
 
@@ -525,6 +813,7 @@ start:
 		  if (old_action == NULL)
 		    {
 		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (*old_action));
+		      locator_Classnames.unlock (thread_p, entry);
 		      csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 		      return LC_CLASSNAME_ERROR;
 		    }
@@ -541,6 +830,8 @@ start:
 		}
 	      COPY_OID (&entry->e_current.oid, class_oid);
 
+	      locator_Classnames.unlock (thread_p, entry);
+
 	      /* Add dummy log to make sure we can revert transient state change. See comment in
 	       * xlocator_rename_class_name. Since reserve has been moved before any change (or flush) is done, same
 	       * scenario can happen here. */
@@ -552,6 +843,7 @@ start:
 		      || entry->e_current.action == LC_CLASSNAME_RESERVED_RENAME);
 
 	      reserve = LC_CLASSNAME_EXIST;
+	      locator_Classnames.unlock (thread_p, entry);
 	    }
 	}
       else
@@ -567,6 +859,7 @@ start:
 	   * Exit from critical section since we are going to be suspended and
 	   * then retry again.
 	   */
+	  locator_Classnames.unlock (thread_p, entry);
 	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
 	  if (lock_object (thread_p, &tmp_classoid, oid_Root_class_oid, SCH_M_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
@@ -587,46 +880,6 @@ start:
 	    }
 	}
     }
-  else
-    {
-      entry = (LOCATOR_CLASSNAME_ENTRY *) malloc (sizeof (*entry));
-      if (entry == NULL)
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (*entry));
-	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-	  return LC_CLASSNAME_ERROR;
-	}
-
-      entry->e_name = strdup ((char *) classname);
-      if (entry->e_name == NULL)
-	{
-	  free_and_init (entry);
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (strlen (classname) + 1));
-	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-	  return LC_CLASSNAME_ERROR;
-	}
-
-      entry->e_tran_index = tran_index;
-
-      entry->e_current.action = LC_CLASSNAME_RESERVED;
-      if (OID_ISNULL (class_oid))
-	{
-	  locator_generate_class_pseudo_oid (thread_p, class_oid);
-	}
-      COPY_OID (&entry->e_current.oid, class_oid);
-      LSA_SET_NULL (&entry->e_current.savep_lsa);
-      entry->e_current.prev = NULL;
-
-      /* Add dummy log to make sure we can revert transient state change. See comment in xlocator_rename_class_name.
-       * Since reserve has been moved before any change (or flush) is done, same scenario can happen here. */
-      log_append_redo_data2 (thread_p, RVLOC_CLASSNAME_DUMMY, NULL, NULL, 0, 0, NULL);
-
-      assert (locator_is_exist_class_name_entry (thread_p, entry) == false);
-
-      (void) mht_put (locator_Mht_classnames, entry->e_name, entry);
-
-      locator_incr_num_transient_classnames (entry->e_tran_index);
-    }
 
   /*
    * Note that the index has not been made permanently into the database.
@@ -638,35 +891,43 @@ start:
   /*
    * Get the lock on the class if we were able to reserve the name
    */
-  if (reserve == LC_CLASSNAME_RESERVED && entry != NULL)
+  if (reserve == LC_CLASSNAME_RESERVED)
     {
-      assert (entry->e_tran_index == tran_index);
-
       if (lock_object (thread_p, class_oid, oid_Root_class_oid, SCH_M_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
 	{
 	  /*
-	   * Something wrong. Remove the entry from hash table.
+	   * Something wrong. Remove the entry from hash table. Nobody else can remove it while the current
+	   * transaction owns it, so it is looked up again.
 	   */
-	  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+	  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
 	    {
 	      assert (false);
 	      return LC_CLASSNAME_ERROR;
 	    }
 
-	  if (entry->e_current.prev == NULL)
+	  entry = locator_find_class_name_entry (thread_p, classname);
+	  if (entry != NULL)
 	    {
-	      locator_decr_num_transient_classnames (entry->e_tran_index);
+	      assert (entry->e_tran_index == tran_index);
 
-	      (void) mht_rem (locator_Mht_classnames, entry->e_name, NULL, NULL);
+	      if (entry->e_current.prev == NULL)
+		{
+		  locator_decr_num_transient_classnames (entry->e_tran_index);
 
-	      free_and_init (entry->e_name);
-	      free_and_init (entry);
-	    }
-	  else
-	    {
-	      old_action = entry->e_current.prev;
-	      entry->e_current = *old_action;
-	      free_and_init (old_action);
+		  key = entry->e_name;
+		  if (!locator_Classnames.erase_locked (thread_p, key, entry))
+		    {
+		      assert_release (false);
+		      locator_Classnames.unlock (thread_p, entry);
+		    }
+		}
+	      else
+		{
+		  old_action = entry->e_current.prev;
+		  entry->e_current = *old_action;
+		  free_and_init (old_action);
+		  locator_Classnames.unlock (thread_p, entry);
+		}
 	    }
 
 	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
@@ -695,12 +956,7 @@ xlocator_get_reserved_class_name_oid (THREAD_ENTRY * thread_p, const char *class
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
-  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
-    {
-      assert (false);
-      return ER_FAILED;
-    }
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  entry = locator_find_class_name_entry (thread_p, classname);
   if (entry == NULL)
     {
       assert (false);
@@ -721,12 +977,15 @@ xlocator_get_reserved_class_name_oid (THREAD_ENTRY * thread_p, const char *class
 
   COPY_OID (class_oid, &entry->e_current.oid);
 
-  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+  locator_Classnames.unlock (thread_p, entry);
 
   return NO_ERROR;
 
 error:
-  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+  if (entry != NULL)
+    {
+      locator_Classnames.unlock (thread_p, entry);
+    }
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return ER_FAILED;
 }
@@ -770,19 +1029,24 @@ xlocator_delete_class_name (THREAD_ENTRY * thread_p, const char *classname)
   assert (classname != NULL);
   assert (strlen (classname) < DB_MAX_IDENTIFIER_LENGTH);
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
 start:
   classname_delete = LC_CLASSNAME_DELETED;
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
       return LC_CLASSNAME_ERROR;
     }
 
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  entry = locator_find_class_name_entry (thread_p, classname);
   if (entry != NULL)
     {
       assert (entry->e_tran_index == NULL_TRAN_INDEX || entry->e_tran_index == tran_index);
@@ -861,6 +1125,7 @@ start:
 	   * then retry again.
 	   */
 
+	  locator_Classnames.unlock (thread_p, entry);
 	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
 	  if (lock_object (thread_p, &tmp_classoid, oid_Root_class_oid, SCH_M_LOCK, LK_UNCOND_LOCK) != LK_GRANTED)
@@ -888,6 +1153,10 @@ start:
     }
 
 error:
+  if (entry != NULL)
+    {
+      locator_Classnames.unlock (thread_p, entry);
+    }
   csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
   /*
@@ -932,6 +1201,11 @@ xlocator_rename_class_name (THREAD_ENTRY * thread_p, const char *oldname, const
   assert (strlen (newname) < 255);
   assert (!OID_ISNULL (class_oid));
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
   renamed = xlocator_reserve_class_name (thread_p, newname, class_oid);
@@ -940,68 +1214,85 @@ xlocator_rename_class_name (THREAD_ENTRY * thread_p, const char *oldname, const
       return renamed;
     }
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  /*
+   * Both names belong to the current transaction from now on, so the entries are looked up (and locked) one at a
+   * time. The critical section is not held across xlocator_delete_class_name, which enters it by itself.
+   */
+  entry = locator_find_class_name_entry (thread_p, newname);
+  if (entry == NULL)
+    {
+      return renamed;
+    }
+
+  assert (entry->e_current.action == LC_CLASSNAME_RESERVED);
+
+  entry->e_current.action = LC_CLASSNAME_RESERVED_RENAME;
+  locator_Classnames.unlock (thread_p, entry);
+
+  renamed = xlocator_delete_class_name (thread_p, oldname);
+
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
       return LC_CLASSNAME_ERROR;
     }
 
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, newname);
-  if (entry != NULL)
+  entry = locator_find_class_name_entry (thread_p, oldname);
+  if (renamed == LC_CLASSNAME_DELETED && entry != NULL)
     {
-      assert (entry->e_current.action == LC_CLASSNAME_RESERVED);
+      entry->e_current.action = LC_CLASSNAME_DELETED_RENAME;
+      locator_Classnames.unlock (thread_p, entry);
+      renamed = LC_CLASSNAME_RESERVED_RENAME;
 
-      entry->e_current.action = LC_CLASSNAME_RESERVED_RENAME;
-      renamed = xlocator_delete_class_name (thread_p, oldname);
-      entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, oldname);
-      if (renamed == LC_CLASSNAME_DELETED && entry != NULL)
+      /* Add new name to modified list, to correctly restore in case of abort. */
+      if (log_add_to_modified_class_list (thread_p, newname, class_oid) != NO_ERROR)
 	{
-	  entry->e_current.action = LC_CLASSNAME_DELETED_RENAME;
-	  renamed = LC_CLASSNAME_RESERVED_RENAME;
-
-	  /* Add new name to modified list, to correctly restore in case of abort. */
-	  if (log_add_to_modified_class_list (thread_p, newname, class_oid) != NO_ERROR)
-	    {
-	      csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-	      return LC_CLASSNAME_ERROR;
-	    }
+	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+	  return LC_CLASSNAME_ERROR;
+	}
 
-	  /* We need to add a dummy log here. If rename is the first clause of alter statement, there will be no log
-	   * entries between parent system savepoint and next flush. Next flush will start a system operation which
-	   * will mark the delete action of old class name with same LSA as parent system savepoint. Therefore, the
-	   * delete action is not removed when alter statement is aborted and a new table with the same name may be
-	   * created. */
-	  log_append_redo_data2 (thread_p, RVLOC_CLASSNAME_DUMMY, NULL, NULL, 0, 0, NULL);
+      /* We need to add a dummy log here. If rename is the first clause of alter statement, there will be no log
+       * entries between parent system savepoint and next flush. Next flush will start a system operation which
+       * will mark the delete action of old class name with same LSA as parent system savepoint. Therefore, the
+       * delete action is not removed when alter statement is aborted and a new table with the same name may be
+       * created. */
+      log_append_redo_data2 (thread_p, RVLOC_CLASSNAME_DUMMY, NULL, NULL, 0, 0, NULL);
+    }
+  else
+    {
+      if (entry != NULL)
+	{
+	  locator_Classnames.unlock (thread_p, entry);
 	}
-      else
+
+      entry = locator_find_class_name_entry (thread_p, newname);
+      if (entry == NULL)
 	{
-	  entry = ((LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, newname));
-	  if (entry == NULL)
-	    {
-	      renamed = LC_CLASSNAME_ERROR;
-	      goto error;
-	    }
+	  renamed = LC_CLASSNAME_ERROR;
+	  goto error;
+	}
 
-	  assert (locator_is_exist_class_name_entry (thread_p, entry) == false);
-	  assert (entry->e_tran_index == tran_index);
+      assert (locator_is_exist_class_name_entry (thread_p, entry) == false);
+      assert (entry->e_tran_index == tran_index);
 
-	  if (csect_enter (thread_p, CSECT_CT_OID_TABLE, INF_WAIT) != NO_ERROR)
-	    {
-	      assert (false);
-	      renamed = LC_CLASSNAME_ERROR;
-	      goto error;
-	    }
+      locator_Classnames.unlock (thread_p, entry);
 
-	  if (locator_drop_class_name_entry (thread_p, newname, NULL) != NO_ERROR)
-	    {
-	      csect_exit (thread_p, CSECT_CT_OID_TABLE);
-	      renamed = LC_CLASSNAME_ERROR;
-	      goto error;
-	    }
+      if (csect_enter (thread_p, CSECT_CT_OID_TABLE, INF_WAIT) != NO_ERROR)
+	{
+	  assert (false);
+	  renamed = LC_CLASSNAME_ERROR;
+	  goto error;
+	}
 
+      if (locator_drop_class_name_entry (thread_p, newname, NULL) != NO_ERROR)
+	{
 	  csect_exit (thread_p, CSECT_CT_OID_TABLE);
+	  renamed = LC_CLASSNAME_ERROR;
+	  goto error;
 	}
+
+      csect_exit (thread_p, CSECT_CT_OID_TABLE);
     }
 
 error:
@@ -1039,18 +1330,18 @@ xlocator_find_class_oid (THREAD_ENTRY * thread_p, const char *classname, OID * c
   LOCK tmp_lock;
   LC_FIND_CLASSNAME find = LC_CLASSNAME_EXIST;
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
 start:
   find = LC_CLASSNAME_EXIST;
 
-  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
-    {
-      assert (false);
-      return LC_CLASSNAME_ERROR;
-    }
-
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  /* The lookup does not block on DDL of other names; only the entry of this name is locked while it is read. */
+  entry = locator_find_class_name_entry (thread_p, classname);
 
   if (entry != NULL)
     {
@@ -1091,7 +1382,7 @@ start:
 	   * Do not know the fate of this entry until the transaction is
 	   * committed or aborted. Get the lock and try again.
 	   */
-	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+	  locator_Classnames.unlock (thread_p, entry);
 
 	  if (lock != NULL_LOCK)
 	    {
@@ -1126,7 +1417,10 @@ start:
       find = LC_CLASSNAME_DELETED;
     }
 
-  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+  if (entry != NULL)
+    {
+      locator_Classnames.unlock (thread_p, entry);
+    }
 
   if (lock != NULL_LOCK && find == LC_CLASSNAME_EXIST)
     {
@@ -1178,14 +1472,19 @@ locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, cons
   LOCATOR_CLASSNAME_ACTION *old_action;
   int error_code = NO_ERROR;
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   /* Is there any entries on the classname hash table ? */
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       assert (false);
       return ER_FAILED;
     }
 
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  entry = locator_find_class_name_entry (thread_p, classname);
   if (entry == NULL || entry->e_tran_index != LOG_FIND_THREAD_TRAN_INDEX (thread_p))
     {
       assert (false);
@@ -1230,6 +1529,7 @@ locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, cons
       COPY_OID (&entry->e_current.oid, class_oid);
     }
 
+  locator_Classnames.unlock (thread_p, entry);
   csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
   assert (error_code == NO_ERROR);
@@ -1238,6 +1538,10 @@ locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, cons
 
 error:
 
+  if (entry != NULL)
+    {
+      locator_Classnames.unlock (thread_p, entry);
+    }
   csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
   assert (error_code != NO_ERROR);
@@ -1263,6 +1567,11 @@ locator_drop_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * sa
   LOG_TDES *tdes;		/* Transaction descriptor */
   int error_code = NO_ERROR;
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
   if (tran_index != NULL_TRAN_INDEX)
@@ -1275,7 +1584,7 @@ locator_drop_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * sa
 
   tdes = LOG_FIND_TDES (tran_index);
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -1308,7 +1617,7 @@ locator_drop_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * sa
     {
       if (locator_get_num_transient_classnames (tran_index) > 0)
 	{
-	  (void) mht_map (locator_Mht_classnames, locator_defence_drop_class_name_entry, savep_lsa);
+	  locator_defence_drop_class_name_entries (thread_p, savep_lsa);
 	}
     }
 
@@ -1356,9 +1665,9 @@ locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, L
   tdes = LOG_FIND_TDES (tran_index);
 
   assert (csect_check_own (thread_p, CSECT_CT_OID_TABLE) == 1);
-  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) >= 1);
 
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  entry = locator_find_class_name_entry (thread_p, classname);
   if (entry == NULL)
     {
       /* table is dropped by myself; not exist */
@@ -1368,6 +1677,7 @@ locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, L
   if (!(entry->e_tran_index == NULL_TRAN_INDEX || entry->e_tran_index == tran_index))
     {
       /* table is dropped by myself and reserved by other tranx */
+      locator_Classnames.unlock (thread_p, entry);
       return NO_ERROR;
     }
 
@@ -1415,7 +1725,7 @@ locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, L
 	      assert (entry->e_current.action == LC_CLASSNAME_DELETED
 		      || entry->e_current.action == LC_CLASSNAME_DELETED_RENAME);
 
-	      (void) locator_force_drop_class_name_entry (entry->e_name, entry, NULL);
+	      locator_force_drop_class_name_entry (thread_p, entry);
 	      entry = NULL;	/* clear */
 	    }
 	}
@@ -1457,7 +1767,7 @@ locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, L
 		  assert (entry->e_current.action == LC_CLASSNAME_RESERVED
 			  || entry->e_current.action == LC_CLASSNAME_RESERVED_RENAME);
 
-		  (void) locator_force_drop_class_name_entry (entry->e_name, entry, NULL);
+		  locator_force_drop_class_name_entry (thread_p, entry);
 		  entry = NULL;	/* clear */
 		}
 	    }
@@ -1485,91 +1795,98 @@ locator_drop_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, L
     }
 #endif
 
+  if (entry != NULL)
+    {
+      locator_Classnames.unlock (thread_p, entry);
+    }
+
   return NO_ERROR;
 }
 
 /*
- * locator_defence_drop_class_name_entry () - Remove one transient entry
+ * locator_defence_drop_class_name_entries () - Remove transient entries left by the current transaction
  *
- * return: NO_ERROR or error code
+ * return: nothing
  *
- *   name(in):
- *   ent(in):
- *   args(in):
+ *   savep_lsa(in): up to given LSA
  *
- * Note: Remove transient entry if it belongs to current transaction.
+ * Note: Remove transient entries that belong to current transaction but were not found through its list of
+ *       modified classes. Entries cannot be removed while the table is iterated, so the names are collected first.
  */
-static int
-locator_defence_drop_class_name_entry (const void *name, void *ent, void *args)
+static void
+locator_defence_drop_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * savep_lsa)
 {
-  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
-  LOG_LSA *savep_lsa = (LOG_LSA *) args;
-  THREAD_ENTRY *thread_p;
+  locator_classname_hashmap_iterator it = { thread_p, locator_Classnames };
+  LOCATOR_CLASSNAME_ENTRY *entry;
   int tran_index;
-
-  thread_p = thread_get_thread_entry_info ();
+  // *INDENT-OFF*
+  std::vector<std::string> classnames;
+  // *INDENT-ON*
 
   assert (csect_check_own (thread_p, CSECT_CT_OID_TABLE) == 1);
-  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) >= 1);
 
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   assert (tran_index != NULL_TRAN_INDEX);
 
-#if !defined(NDEBUG)
-  if (locator_is_exist_class_name_entry (thread_p, entry))
+  for (entry = it.iterate (); entry != NULL; entry = it.iterate ())
     {
-      OID class_oid;
+#if !defined(NDEBUG)
+      if (locator_is_exist_class_name_entry (thread_p, entry))
+	{
+	  OID class_oid;
 
-      COPY_OID (&class_oid, &entry->e_current.oid);
+	  COPY_OID (&class_oid, &entry->e_current.oid);
 
-      assert (heap_does_exist (thread_p, oid_Root_class_oid, &class_oid));
+	  assert (heap_does_exist (thread_p, oid_Root_class_oid, &class_oid));
 
-      /* check class_oid */
-      if (class_oid.slotid <= 0 || class_oid.volid < 0 || class_oid.pageid < 0)
-	{
-	  assert (false);
+	  /* check class_oid */
+	  if (class_oid.slotid <= 0 || class_oid.volid < 0 || class_oid.pageid < 0)
+	    {
+	      assert (false);
+	    }
+
+	  if (disk_is_page_sector_reserved_with_debug_crash (thread_p, class_oid.volid, class_oid.pageid, true)
+	      != DISK_VALID)
+	    {
+	      assert (false);
+	    }
 	}
+#endif
 
-      if (disk_is_page_sector_reserved_with_debug_crash (thread_p, class_oid.volid, class_oid.pageid, true)
-	  != DISK_VALID)
+      /* check iff uncleared entry */
+      if (entry->e_tran_index == tran_index)
 	{
-	  assert (false);
+	  assert (entry->e_tran_index != NULL_TRAN_INDEX);
+
+	  classnames.emplace_back (entry->e_name);
 	}
     }
-#endif
 
-  /* check iff uncleared entry */
-  if (entry->e_tran_index == tran_index)
+  // *INDENT-OFF*
+  for (const std::string &classname : classnames)
     {
-      assert (entry->e_tran_index != NULL_TRAN_INDEX);
-
-      (void) locator_drop_class_name_entry (thread_p, entry->e_name, savep_lsa);
+      (void) locator_drop_class_name_entry (thread_p, classname.c_str (), savep_lsa);
     }
-
-  return NO_ERROR;
+  // *INDENT-ON*
 }
 
 /*
- * locator_force_drop_class_name_entry () -
+ * locator_force_drop_class_name_entry () - Remove an entry from the classname table
  *
- * return:
+ * return: nothing
  *
- *   name(in):
- *   ent(in):
- *   args(in): Not used
+ *   entry(in): locked entry; it is unlocked on return
  */
-static int
-locator_force_drop_class_name_entry (const void *name, void *ent, void *args)
+static void
+locator_force_drop_class_name_entry (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry)
 {
-  THREAD_ENTRY *thread_p;
-  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
   LOCATOR_CLASSNAME_ACTION *old_action;
   OID class_oid;
-
-  thread_p = thread_get_thread_entry_info ();
+  const char *key;
 
   assert (csect_check_own (thread_p, CSECT_CT_OID_TABLE) == 1);
-  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) >= 1);
 
   COPY_OID (&class_oid, &entry->e_current.oid);
 
@@ -1580,14 +1897,15 @@ locator_force_drop_class_name_entry (const void *name, void *ent, void *args)
       free_and_init (old_action);
     }
 
-  (void) mht_rem (locator_Mht_classnames, name, NULL, NULL);
-
-  free_and_init (entry->e_name);
-  free_and_init (entry);
+  /* the name itself is released when the entry is reclaimed, lookups in progress may still compare it */
+  key = entry->e_name;
+  if (!locator_Classnames.erase_locked (thread_p, key, entry))
+    {
+      assert_release (false);
+      locator_Classnames.unlock (thread_p, entry);
+    }
 
   (void) catcls_remove_entry (thread_p, &class_oid);
-
-  return NO_ERROR;
 }
 
 /*
@@ -1609,6 +1927,11 @@ locator_savepoint_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA
   LOG_TDES *tdes;		/* Transaction descriptor */
   int error_code = NO_ERROR;
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
   if (tran_index != NULL_TRAN_INDEX)
@@ -1628,7 +1951,7 @@ locator_savepoint_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA
       return NO_ERROR;		/* do nothing */
     }
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -1636,9 +1959,9 @@ locator_savepoint_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA
     }
 
   // *INDENT-OFF*
-  const auto lambda_func = [&error_code, &savep_lsa] (const tx_transient_class_entry & t, bool & stop)
+  const auto lambda_func = [&error_code, &thread_p, &savep_lsa] (const tx_transient_class_entry & t, bool & stop)
     {
-      error_code = locator_savepoint_class_name_entry (t.get_classname (), savep_lsa);
+      error_code = locator_savepoint_class_name_entry (thread_p, t.get_classname (), savep_lsa);
       if (error_code != NO_ERROR)
 	{
 	  assert (false);
@@ -1666,19 +1989,16 @@ locator_savepoint_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA
  *              modified point.
  */
 static int
-locator_savepoint_class_name_entry (const char *classname, LOG_LSA * savep_lsa)
+locator_savepoint_class_name_entry (THREAD_ENTRY * thread_p, const char *classname, LOG_LSA * savep_lsa)
 {
-  THREAD_ENTRY *thread_p;
   int tran_index;
   LOCATOR_CLASSNAME_ENTRY *entry;
 
-  thread_p = thread_get_thread_entry_info ();
-
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
 
-  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) >= 1);
 
-  entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+  entry = locator_find_class_name_entry (thread_p, classname);
   if (entry == NULL)
     {
       /* table is dropped by myself; not exist */
@@ -1688,6 +2008,7 @@ locator_savepoint_class_name_entry (const char *classname, LOG_LSA * savep_lsa)
   if (!(entry->e_tran_index == NULL_TRAN_INDEX || entry->e_tran_index == tran_index))
     {
       /* table is dropped by myself and reserved by other tranx */
+      locator_Classnames.unlock (thread_p, entry);
       return NO_ERROR;		/* do nothing */
     }
 
@@ -1705,6 +2026,8 @@ locator_savepoint_class_name_entry (const char *classname, LOG_LSA * savep_lsa)
 	}
     }
 
+  locator_Classnames.unlock (thread_p, entry);
+
   return NO_ERROR;
 }
 
@@ -1787,22 +2110,29 @@ locator_print_class_name (THREAD_ENTRY * thread_p, FILE * outfp, const void *key
 void
 locator_dump_class_names (THREAD_ENTRY * thread_p, FILE * out_fp)
 {
+  LOCATOR_CLASSNAME_ENTRY *entry;
   int class_no;
 
-#if defined(NDEBUG)		/* skip at debug build */
-  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (!locator_Classnames_initialized)
     {
-      assert (false);
       return;
     }
-#endif
 
-  class_no = 1;			/* init */
-  (void) mht_dump (thread_p, out_fp, locator_Mht_classnames, false, locator_print_class_name, &class_no);
+  fprintf (out_fp, "CLASSNAME TO OID TABLE: NENTRIES = %zu\n\n", locator_Classnames.get_element_count ());
 
-#if defined(NDEBUG)		/* skip at debug build */
-  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-#endif
+  /* each entry is locked while it is printed */
+  locator_classname_hashmap_iterator it = { thread_p, locator_Classnames };
+
+  class_no = 1;			/* init */
+  for (entry = it.iterate (); entry != NULL; entry = it.iterate ())
+    {
+      (void) locator_print_class_name (thread_p, out_fp, entry->e_name, entry, &class_no);
+    }
 }
 
 /*
@@ -1817,20 +2147,15 @@ locator_dump_class_names (THREAD_ENTRY * thread_p, FILE * out_fp)
 static void
 locator_generate_class_pseudo_oid (THREAD_ENTRY * thread_p, OID * class_oid)
 {
-  assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
+  UINT32 seq;
+
+  /* reservations of different names run concurrently; cycle through the pseudo pageids with an atomic counter */
+  seq = ATOMIC_INC_32 (&locator_Pseudo_pageid_seq, 1) - 1;
 
   class_oid->volid = -2;
   class_oid->slotid = -2;
-  class_oid->pageid = locator_Pseudo_pageid_crt;
-
-  if (locator_Pseudo_pageid_crt == locator_Pseudo_pageid_last)
-    {
-      locator_Pseudo_pageid_crt = locator_Pseudo_pageid_first;
-    }
-  else
-    {
-      locator_Pseudo_pageid_crt--;
-    }
+  class_oid->pageid =
+    locator_Pseudo_pageid_first - (INT32) (seq % (UINT32) (locator_Pseudo_pageid_first - locator_Pseudo_pageid_last + 1));
 }
 
 /*
@@ -1838,9 +2163,8 @@ locator_generate_class_pseudo_oid (THREAD_ENTRY * thread_p, OID * class_oid)
  *
  * return: NO_ERROR continue checking, error code stop checking, bad error
  *
- *   name(in): The expected class name
- *   ent(in):
- *   args(out): Could be set as a side effect to either: DISK_INVALID,
+ *   entry(in): The locked entry of the expected class name
+ *   isvalid(out): Could be set as a side effect to either: DISK_INVALID,
  *              DISK_ERROR when an inconsistency is found. Otherwise, it is
  *              left in touch. The caller should initialize it to DISK_VALID
  *
@@ -1849,21 +2173,16 @@ locator_generate_class_pseudo_oid (THREAD_ENTRY * thread_p, OID * class_oid)
  *       If class does not exist, or its name is different from the
  *       given one, isvalid is set to DISK_INVALID. In the case of other
  *       kind of error, isvalid is set to DISK_ERROR.
- *       If isvalid is set to DISK_ERROR, we return false to stop
- *       the map hash, otherwise, we return true to continue.
+ *       If isvalid is set to DISK_ERROR, we return an error to stop
+ *       the iteration, otherwise, we return NO_ERROR to continue.
  */
 static int
-locator_check_class_on_heap (const void *name, void *ent, void *args)
+locator_check_class_on_heap (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry, DISK_ISVALID * isvalid)
 {
-  THREAD_ENTRY *thread_p;
-  LOCATOR_CLASSNAME_ENTRY *entry = (LOCATOR_CLASSNAME_ENTRY *) ent;
-  DISK_ISVALID *isvalid = (DISK_ISVALID *) args;
   const char *classname;
   char *heap_classname;
   OID *class_oid;
 
-  thread_p = thread_get_thread_entry_info ();
-
   assert (csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE) == 1);
 
   if (entry->e_current.action != LC_CLASSNAME_EXIST)
@@ -1872,7 +2191,7 @@ locator_check_class_on_heap (const void *name, void *ent, void *args)
       return NO_ERROR;
     }
 
-  classname = (char *) name;
+  classname = entry->e_name;
   class_oid = &entry->e_current.oid;
 
   if (heap_get_class_name_alloc_if_diff (thread_p, class_oid, (char *) classname, &heap_classname) != NO_ERROR
@@ -1933,6 +2252,11 @@ locator_check_class_names (THREAD_ENTRY * thread_p)
   MVCC_SNAPSHOT *mvcc_snapshot = NULL;
   LOCATOR_CLASSNAME_ENTRY *entry;
 
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
   mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
   if (mvcc_snapshot == NULL)
     {
@@ -1981,7 +2305,7 @@ locator_check_class_names (THREAD_ENTRY * thread_p)
        * Make sure that this class exists in classname_to_OID table and that
        * the OIDS matches
        */
-      entry = (LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname);
+      entry = locator_find_class_name_entry (thread_p, classname);
       if (entry == NULL)
 	{
 	  isvalid = DISK_INVALID;
@@ -1998,6 +2322,7 @@ locator_check_class_names (THREAD_ENTRY * thread_p)
 		      class_oid.volid, class_oid.pageid, class_oid.slotid);
 	      isvalid = DISK_INVALID;
 	    }
+	  locator_Classnames.unlock (thread_p, entry);
 	}
     }				/* while (...) */
 
@@ -2010,7 +2335,24 @@ locator_check_class_names (THREAD_ENTRY * thread_p)
   /*
    * CHECK 2: Same that check1 but from classname_to_OID to existance of class
    */
-  (void) mht_map (locator_Mht_classnames, locator_check_class_on_heap, &isvalid);
+  {
+    locator_classname_hashmap_iterator it = { thread_p, locator_Classnames };
+    bool is_check_failed = false;
+
+    for (entry = it.iterate (); entry != NULL; entry = it.iterate ())
+      {
+	if (is_check_failed)
+	  {
+	    /* the iteration goes on to its end, so the iterator releases its entry and transaction */
+	    continue;
+	  }
+
+	if (locator_check_class_on_heap (thread_p, entry, &isvalid) != NO_ERROR)
+	  {
+	    is_check_failed = true;
+	  }
+      }
+  }
 
   csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
@@ -11093,9 +11435,6 @@ xlocator_find_lockhint_class_oids (THREAD_ENTRY * thread_p, int num_classes, con
   int retry;
   int i, j;
   int n;
-#if !defined(NDEBUG)
-  int check_own;
-#endif
 
   *fetch_area = NULL;
 
@@ -11145,13 +11484,7 @@ xlocator_find_lockhint_class_oids (THREAD_ENTRY * thread_p, int num_classes, con
 	  (*hlock)->classes[n].lock = many_locks[i];
 	  (*hlock)->classes[n].need_subclasses = many_need_subclasses[i];
 
-	  if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
-	    {
-	      assert (false);
-	      return LC_CLASSNAME_ERROR;
-	    }
-
-	  entry = ((LOCATOR_CLASSNAME_ENTRY *) mht_get (locator_Mht_classnames, classname));
+	  entry = locator_find_class_name_entry (thread_p, classname);
 
 	  if (entry != NULL)
 	    {
@@ -11188,7 +11521,7 @@ xlocator_find_lockhint_class_oids (THREAD_ENTRY * thread_p, int num_classes, con
 		    }
 		  else
 		    {
-		      csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+		      locator_Classnames.unlock (thread_p, entry);
 
 		      /*
 		       * Do not know the fate of this entry until the transaction is
@@ -11222,7 +11555,7 @@ xlocator_find_lockhint_class_oids (THREAD_ENTRY * thread_p, int num_classes, con
 			  retry = 1;
 			}
 
-		      /* already exit cset */
+		      /* already unlocked the entry */
 		      continue;
 		    }
 		}
@@ -11234,12 +11567,10 @@ xlocator_find_lockhint_class_oids (THREAD_ENTRY * thread_p, int num_classes, con
 	      find = LC_CLASSNAME_DELETED;
 	    }
 
-#if !defined(NDEBUG)
-	  check_own = csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-	  assert (check_own >= 1);
-#endif
-
-	  csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
+	  if (entry != NULL)
+	    {
+	      locator_Classnames.unlock (thread_p, entry);
+	    }
 
 	}			/* while (retry) */
 
@@ -12582,13 +12913,7 @@ locator_get_num_transient_classnames (int tran_index)
 static bool
 locator_is_exist_class_name_entry (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry)
 {
-#if !defined(NDEBUG)
-  int check_own;
-
-  check_own = csect_check_own (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
-  assert (check_own >= 1);
-#endif
-
+  /* the entry, if any, is locked by the caller */
   if (entry != NULL && entry->e_current.action == LC_CLASSNAME_EXIST)
     {
       assert (entry->e_name != NULL);
@@ -3830,10 +3830,8 @@ lock_tran_lk_entry:
 
 blocked:
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
-    {
-      tsc_getticks (&start_tick);
-    }
+  /* the wait is timed for the statement statistics even when perfmon does not watch locks */
+  tsc_getticks (&start_tick);
 
   /* LK_CANWAIT(wait_msecs) : wait_msecs > 0 */
   perfmon_inc_stat (thread_p, PSTAT_LK_NUM_WAITED_ON_OBJECTS);
@@ -3848,11 +3846,12 @@ blocked:
     }
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
 
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+  lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
+  thread_p->resource_usage.lock_wait_usec += lock_wait_time;
   if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
     {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
       perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
     }
 
@@ -74,6 +74,7 @@
 #include "critical_section.h"
 #include "page_buffer.h"
 #include "double_write_buffer.h"
+#include "backup_change_tracking.hpp"
 #include "file_io.h"
 #include "disk_manager.h"
 #include "error_manager.h"
@@ -7959,6 +7960,9 @@ loop:
       goto error;
     }
 
+  /* The change map of this level is rebuilt from the pages written after the volumes are flushed below. */
+  bct_begin_backup (thread_p, backup_level, &chkpt_lsa);
+
   if (separate_keys)
     {
       db_nopath_name_p = fileio_get_base_file_name (log_Db_fullname);
@@ -8160,6 +8164,9 @@ loop:
   /* Now indicate how many volumes were backed up */
   logpb_flush_header (thread_p);
 
+  /* the change map matches the backup LSA now recorded in the log header */
+  bct_end_backup (thread_p, true);
+
   /* Include active log always. Skipping log active is obsolete. */
   error_code = fileio_backup_volume (thread_p, &session, log_Name_active, LOG_DBLOG_ACTIVE_VOLID, -1, false);
   if (error_code != NO_ERROR)
@@ -8241,6 +8248,7 @@ error:
    * Destroy the backup that has been created.
    */
   fileio_abort_backup (thread_p, &session, bkup_in_progress);
+  bct_end_backup (thread_p, false);
 
 #if defined(SERVER_MODE)
   LOG_CS_ENTER (thread_p);
@@ -10391,6 +10399,13 @@ logpb_delete (THREAD_ENTRY * thread_p, VOLID num_perm_vols, const char *db_fulln
       fileio_unformat (thread_p, vol_fullname);
     }
 
+  /* Destroy the change tracking file, if exists. */
+  fileio_make_change_tracking_name (vol_fullname, log_Path, log_Prefix);
+  if (fileio_is_volume_exist (vol_fullname))
+    {
+      fileio_unformat (thread_p, vol_fullname);
+    }
+
   if (force_delete)
     {
       /*
@@ -1138,6 +1138,7 @@ logtb_release_tran_index (THREAD_ENTRY * thread_p, int tran_index)
 
   qmgr_clear_trans_wakeup (thread_p, tran_index, true, false);
   heap_chnguess_clear (thread_p, tran_index);
+  file_tempcache_drop_tran_cache (thread_p, tran_index);
 
   tdes = LOG_FIND_TDES (tran_index);
   if (tran_index != LOG_SYSTEM_TRAN_INDEX && tdes != NULL)
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_open_hash_table.hpp"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int
+main (int argc, char **argv)
+{
+  // usage: test_hash_table [functional | performance [group_count ...]]
+  std::string option = (argc >= 2) ? argv[1] : "all";
+  std::vector<size_t> group_counts;
+  int err = 0;
+
+  for (int i = 2; i < argc; i++)
+    {
+      group_counts.push_back ((size_t) std::strtoull (argv[i], NULL, 10));
+    }
+  if (group_counts.empty ())
+    {
+      group_counts = { 1000000, 100000000 };
+    }
+
+  if (option == "all" || option == "functional")
+    {
+      err = err | test_hash_table::test_open_hash_table_functional ();
+    }
+  if (option == "all" || option == "performance")
+    {
+      err = err | test_hash_table::test_open_hash_table_performance (group_counts);
+    }
+
+  return err;
+}
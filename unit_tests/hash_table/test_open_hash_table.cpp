@@ -0,0 +1,323 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_open_hash_table.hpp"
+
+#include "memory_hash.h"
+#include "open_hash_table.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <list>
+#include <random>
+#include <unordered_map>
+
+namespace test_hash_table
+{
+  static unsigned int
+  mix_int64 (std::int64_t key)
+  {
+    std::uint64_t x = (std::uint64_t) key;
+
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (unsigned int) x;
+  }
+
+  struct int64_ptr_hash
+  {
+    unsigned int operator() (std::int64_t *const &key) const
+    {
+      return mix_int64 (*key);
+    }
+  };
+
+  struct int64_ptr_equal
+  {
+    bool operator() (std::int64_t *const &key1, std::int64_t *const &key2) const
+    {
+      return *key1 == *key2;
+    }
+  };
+
+  using group_table = cubbase::open_hash_table<std::int64_t *, std::int64_t *, int64_ptr_hash, int64_ptr_equal>;
+
+  static unsigned int
+  mht_int64_ptr_hash (const void *key, unsigned int ht_size)
+  {
+    return mix_int64 (* (const std::int64_t *) key) % ht_size;
+  }
+
+  static int
+  mht_int64_ptr_equal (const void *key1, const void *key2)
+  {
+    return * (const std::int64_t *) key1 == * (const std::int64_t *) key2;
+  }
+
+  // a hash that puts every key in a few probe sequences, to test erasing in long runs of slots
+  struct int64_ptr_bad_hash
+  {
+    unsigned int operator() (std::int64_t *const &key) const
+    {
+      return (unsigned int) (*key % 7);
+    }
+  };
+
+  template <typename Hash>
+  static int
+  test_functional_with_hash (const char *name)
+  {
+    cubbase::open_hash_table<std::int64_t *, std::int64_t *, Hash, int64_ptr_equal> table;
+    std::unordered_map<std::int64_t, std::int64_t> expected;
+    std::list<std::int64_t> lru;
+    std::vector<std::int64_t> keys (3000), values (3000);
+    std::mt19937 rng (1);
+
+    for (size_t i = 0; i < keys.size (); i++)
+      {
+	keys[i] = (std::int64_t) i;
+	values[i] = (std::int64_t) i * 3;
+      }
+
+    for (int op_count = 0; op_count < 200000; op_count++)
+      {
+	std::int64_t k = rng () % keys.size ();
+	int op = rng () % 4;
+	unsigned int index = table.find (&keys[k]);
+	bool is_expected = expected.find (k) != expected.end ();
+
+	if ((index != table.NULL_INDEX) != is_expected)
+	  {
+	    std::cout << "  " << name << ": find of key " << k << " does not match" << std::endl;
+	    return 1;
+	  }
+	if (is_expected)
+	  {
+	    if (*table.get_value (index) != expected[k])
+	      {
+		std::cout << "  " << name << ": value of key " << k << " does not match" << std::endl;
+		return 1;
+	      }
+	    // found entries become the most recently used
+	    lru.remove (k);
+	    lru.push_back (k);
+	  }
+
+	if (op == 0 && is_expected)
+	  {
+	    table.erase (index);
+	    expected.erase (k);
+	    lru.remove (k);
+	  }
+	else if (op == 1 && table.count () > 0)
+	  {
+	    index = table.lru_first ();
+	    if (*table.get_key (index) != lru.front ())
+	      {
+		std::cout << "  " << name << ": least recently used key does not match" << std::endl;
+		return 1;
+	      }
+	    expected.erase (*table.get_key (index));
+	    lru.pop_front ();
+	    table.erase (index);
+	  }
+	else if (!is_expected)
+	  {
+	    if (table.insert (&keys[k], &values[k]) != NO_ERROR)
+	      {
+		std::cout << "  " << name << ": insert failed" << std::endl;
+		return 1;
+	      }
+	    expected[k] = values[k];
+	    lru.push_back (k);
+	  }
+
+	if (table.count () != expected.size ())
+	  {
+	    std::cout << "  " << name << ": count does not match" << std::endl;
+	    return 1;
+	  }
+      }
+
+    for (unsigned int i = 0; i < table.count (); i++)
+      {
+	if (expected.at (*table.get_key (i)) != *table.get_value (i))
+	  {
+	    std::cout << "  " << name << ": iteration does not match" << std::endl;
+	    return 1;
+	  }
+      }
+
+    table.clear ();
+    if (table.count () != 0 || table.find (&keys[0]) != table.NULL_INDEX)
+      {
+	std::cout << "  " << name << ": clear failed" << std::endl;
+	return 1;
+      }
+
+    return 0;
+  }
+
+  int
+  test_open_hash_table_functional ()
+  {
+    std::cout << "  start open_hash_table functional test" << std::endl;
+
+    int err = test_functional_with_hash<int64_ptr_hash> ("good hash");
+    err = err | test_functional_with_hash<int64_ptr_bad_hash> ("bad hash");
+
+    std::cout << "  open_hash_table functional test " << (err == 0 ? "passed" : "failed") << std::endl;
+    return err;
+  }
+
+  // the rows of a GROUP BY: each group appears twice, in random order
+  static void
+  make_rows (size_t group_count, std::vector<std::uint32_t> &rows)
+  {
+    std::mt19937_64 rng (group_count);
+
+    rows.resize (group_count * 2);
+    for (size_t i = 0; i < rows.size (); i++)
+      {
+	rows[i] = (std::uint32_t) (i % group_count);
+      }
+    std::shuffle (rows.begin (), rows.end (), rng);
+  }
+
+  static int
+  group_with_open_hash_table (const std::vector<std::uint32_t> &rows, std::vector<std::int64_t> &keys,
+			      std::vector<std::int64_t> &counts, size_t &groups)
+  {
+    group_table table;
+    unsigned int index;
+
+    // same initial size as hash aggregation
+    if (table.init (1000) != NO_ERROR)
+      {
+	return 1;
+      }
+
+    for (std::uint32_t row : rows)
+      {
+	index = table.find (&keys[row]);
+	if (index == table.NULL_INDEX)
+	  {
+	    counts[row] = 1;
+	    if (table.insert (&keys[row], &counts[row]) != NO_ERROR)
+	      {
+		return 1;
+	      }
+	  }
+	else
+	  {
+	    (*table.get_value (index))++;
+	  }
+      }
+
+    groups = table.count ();
+    return 0;
+  }
+
+  static int
+  group_with_mht (const std::vector<std::uint32_t> &rows, std::vector<std::int64_t> &keys,
+		  std::vector<std::int64_t> &counts, size_t &groups)
+  {
+    MHT_TABLE *table;
+    std::int64_t *count;
+
+    table = mht_create ("test group by", 1000, mht_int64_ptr_hash, mht_int64_ptr_equal);
+    if (table == NULL)
+      {
+	return 1;
+      }
+    table->build_lru_list = true;
+
+    for (std::uint32_t row : rows)
+      {
+	count = (std::int64_t *) mht_get (table, &keys[row]);
+	if (count == NULL)
+	  {
+	    counts[row] = 1;
+	    if (mht_put (table, &keys[row], &counts[row]) == NULL)
+	      {
+		mht_destroy (table);
+		return 1;
+	      }
+	  }
+	else
+	  {
+	    (*count)++;
+	  }
+      }
+
+    groups = mht_count (table);
+    mht_destroy (table);
+    return 0;
+  }
+
+  template <typename Func>
+  static int
+  time_grouping (const char *name, Func &&func, const std::vector<std::uint32_t> &rows, size_t group_count)
+  {
+    std::vector<std::int64_t> keys (group_count), counts (group_count, 0);
+    size_t groups = 0;
+
+    for (size_t i = 0; i < group_count; i++)
+      {
+	keys[i] = (std::int64_t) i * 7919;
+      }
+
+    auto start_time = std::chrono::high_resolution_clock::now ();
+    int err = func (rows, keys, counts, groups);
+    auto end_time = std::chrono::high_resolution_clock::now ();
+
+    if (err != 0 || groups != group_count)
+      {
+	std::cout << "    " << name << ": grouping failed" << std::endl;
+	return 1;
+      }
+
+    std::cout << "    " << name << ": ";
+    std::cout << std::chrono::duration_cast<std::chrono::milliseconds> (end_time - start_time).count () << " msec";
+    std::cout << std::endl;
+    return 0;
+  }
+
+  int
+  test_open_hash_table_performance (const std::vector<size_t> &group_counts)
+  {
+    std::vector<std::uint32_t> rows;
+    int err = 0;
+
+    std::cout << "  start open_hash_table performance test" << std::endl;
+
+    for (size_t group_count : group_counts)
+      {
+	make_rows (group_count, rows);
+
+	std::cout << "  " << group_count << " groups, " << rows.size () << " rows" << std::endl;
+	err = err | time_grouping ("open_hash_table", group_with_open_hash_table, rows, group_count);
+	err = err | time_grouping ("mht", group_with_mht, rows, group_count);
+      }
+
+    return err;
+  }
+} // namespace test_hash_table
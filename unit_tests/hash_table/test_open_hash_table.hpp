@@ -0,0 +1,33 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef _TEST_OPEN_HASH_TABLE_HPP_
+#define _TEST_OPEN_HASH_TABLE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace test_hash_table
+{
+  int test_open_hash_table_functional ();
+
+  // group rows by key in open_hash_table and in MHT_TABLE, for each count of groups
+  int test_open_hash_table_performance (const std::vector<size_t> &group_counts);
+} // namespace test_hash_table
+
+#endif // !_TEST_OPEN_HASH_TABLE_HPP_